@@ -3,13 +3,14 @@
 
 
 class Scene;
+class Renderer;
 class Model;
 class Texture;
 
 class Editor
 {
 public:
-	Editor(Scene* pScene);
+	Editor(Scene* pScene, Renderer* pRenderer);
 	~Editor();
 
 	void Update(float deltaTime);
@@ -19,8 +20,10 @@ private:
 	void ImGuiStyleSettings();
 	void LoadModelFilePaths(std::string path, std::string originalPath);
 	void ModelSelectionWindow();
+	void RenderStatsWindow();
 	float deltaTime;
 	Scene* m_pScene = nullptr;
+	Renderer* m_pRenderer = nullptr;
 	std::vector<std::string> m_ModelFilePaths;
 	std::vector<std::string> m_ComboDisplayNames;
 	std::vector<std::string> m_DisplayModelNames;
@@ -4,6 +4,8 @@
 #include "Graphics/DX12Utilities.h"
 #include "Graphics/ConstantBuffer.h"
 #include "Math/Vector3D.h"
+#include "Graphics/TextureCook.h"
+#include "Graphics/TextureStreamer.h"
 
 class DX12Device;
 class Texture;
@@ -15,6 +17,29 @@ class ShadowStage;
 class SkyBoxStage;
 class SphereMapConverterStage;
 class IBLBakerStage;
+class GeometryArena;
+
+/// <summary>
+/// `擝v (Ot[̒lGfB^ɕ\܂)
+/// </summary>
+struct RenderStats
+{
+	uint32_t TotalModels = 0;    //!< V[̃f
+	uint32_t VisibleModels = 0;  //!< 1ȏ̃bV̃f
+	uint32_t TotalMeshes = 0;    //!< V[̃bV
+	uint32_t VisibleMeshes = 0;  //!< JOʉ߂bV
+	uint32_t DrawCalls = 0;      //!< SceneStage Ŕsh[R[
+	uint64_t Triangles = 0;      //!< SceneStage ŕ`悵Op` (LOD I)
+	double CullingTimeMs = 0.0;  //!< JOɂ (~b)
+	uint32_t TotalMeshlets = 0;      //!< bVbgPʂŔ肵bVbg
+	uint32_t VisibleMeshlets = 0;    //!< bVbg̔ʉ߂
+	uint32_t ConeCulledMeshlets = 0; //!< @R[ (w) ŏObVbg
+
+	uint32_t ShadowTotalCasters = 0;   //!< VhEpX̑ΏۃbV
+	uint32_t ShadowVisibleCasters = 0; //!< Cg̎ʉ߂bV (= VhEpX̃h[R[)
+	uint64_t ShadowTriangles = 0;      //!< VhEpXŕ`悵Op` (LOD I)
+	double ShadowCullingTimeMs = 0.0;  //!< LX^[JOɂ (~b)
+};
 
 class Renderer
 {
@@ -56,14 +81,50 @@ public:
 	ComPtr<ID3D12Device> GetDevice();
 	DX12DescriptorHeap* GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE type);
 	Texture* GetTexture(TextureID id);
+	//! @brief V[Ŝ̒_ECfbNXf[^uLobt@
+	GeometryArena* GetGeometryArena() { return m_pGeometryArena.get(); }
 	Window* GetWindow();
 	const Vector3D& GetHalfVector3D() const { return m_HalfVector3D; }
 	const Vector3D& GetOneVector3D() const { return m_OneVector3D; }
 	const Vector3D& GetZeroVector3D() const { return m_ZeroVector3D; }
+	RenderStats& GetRenderStats() { return m_RenderStats; }
+	const RenderStats& GetRenderStats() const { return m_RenderStats; }
+	bool IsFrustumCullingEnabled() const { return m_IsFrustumCullingEnabled; }
+	void SetFrustumCullingEnabled(bool enable) { m_IsFrustumCullingEnabled = enable; }
+	bool IsLodEnabled() const { return m_IsLodEnabled; }
+	void SetLodEnabled(bool enable) { m_IsLodEnabled = enable; }
+	//! @brief LOD Iŋeʏ̌덷 (sNZ)
+	float GetLodErrorThreshold() const { return m_LodErrorThreshold; }
+	void SetLodErrorThreshold(float threshold) { m_LodErrorThreshold = threshold; }
+	//! @brief LOD0 bVbgPʂŎJO邩
+	bool IsMeshletCullingEnabled() const { return m_IsMeshletCullingEnabled; }
+	void SetMeshletCullingEnabled(bool enable) { m_IsMeshletCullingEnabled = enable; }
+	//! @brief bVbgPʂ̃JOŖ@R[ɂwʃJOs
+	bool IsMeshletConeCullingEnabled() const { return m_IsMeshletConeCullingEnabled; }
+	void SetMeshletConeCullingEnabled(bool enable) { m_IsMeshletConeCullingEnabled = enable; }
+	//! @brief ȍ~ɓǂݍރf̒_ PackedVertex (16 oCg) ɂ邩
+	bool IsPackedVertexEnabled() const { return m_IsPackedVertexEnabled; }
+	void SetPackedVertexEnabled(bool enable) { m_IsPackedVertexEnabled = enable; }
+	//! @brief ȍ~ɓǂݍރeNX`̃~bvXg[~O邩 (ŏ͏~bvǂݍ݁AKvɉčׂ~bvǂݍ)
+	bool IsTextureStreamingEnabled() const { return m_IsTextureStreamingEnabled; }
+	void SetTextureStreamingEnabled(bool enable) { m_IsTextureStreamingEnabled = enable; }
+	//! @brief ȍ~ɓǂݍށA~bv̂Ȃ摜̃~bvktB^ (prAl TextureCook::GetDefaultMipFilter)
+	MipGenerator::Filter GetMipFilter(TextureCook::TextureRole role) const { return m_MipFilters[static_cast<size_t>(role)]; }
+	void SetMipFilter(TextureCook::TextureRole role, MipGenerator::Filter filter) { m_MipFilters[static_cast<size_t>(role)] = filter; }
+	//! @brief eNX`̃~bv̏풓߂XPW[ (\ZȂǂ̐ݒŕύX)
+	TextureStreamer& GetTextureStreamer() { return m_TextureStreamer; }
 	
 	void SetScene(Scene* newScene);
 
+	//! @brief pr̓t@C琄܂ (TextureCook::GuessRoleFromName)
 	void CreateTextureFromFile(const std::wstring& filePath);
+	/// <summary>
+	/// ̃eNX`܂Ƃ߂č쐬܂ (쐬ς݁EdĂ͓̂ǂݍ݂܂)
+	/// fR[h͕ɍsAGPU ւ̓]1̎sɂ܂Ƃ߂܂
+	/// </summary>
+	/// <param name="roles"> filePaths Ɠ̗pr (F sRGB œǂ݂܂) </param>
+	/// <returns> Vɍ쐬eNX` </returns>
+	uint32_t CreateTexturesFromFiles(const std::vector<std::wstring>& filePaths, const std::vector<TextureCook::TextureRole>& roles);
 	void TransitionResource(ID3D12Resource* resource,
 		D3D12_RESOURCE_STATES beforeState,
 		D3D12_RESOURCE_STATES afterState);
@@ -74,11 +135,14 @@ public:
 private:
 	void CreateConstantBuffer();
 	void InitializeImGui();
+	//! @brief Õt[̗vɉă~bvǂݍ݁EjA]R}hL^܂
+	void UpdateTextureStreaming(ID3D12GraphicsCommandList* pCommandList);
 
 	std::unique_ptr<Window> m_pWindow = nullptr;
 	std::unique_ptr<DX12Device> m_pDevice = nullptr;
 	std::unique_ptr<DX12Commands> m_pDirectCommand = nullptr;
 	std::unique_ptr<DX12Commands> m_pCopyCommand = nullptr;
+	std::unique_ptr<GeometryArena> m_pGeometryArena = nullptr;
 
 	std::unique_ptr<DX12DescriptorHeap> m_pRTVHeap = nullptr;
 	std::unique_ptr<DX12DescriptorHeap> m_pDSVHeap = nullptr;
@@ -117,6 +181,25 @@ private:
 	Vector3D m_OneVector3D = Vector3D(1.0f, 1.0f, 1.0f);
 	Vector3D m_ZeroVector3D = Vector3D(1.0f, 1.0f, 1.0f);
 
+	// `擝v
+	RenderStats m_RenderStats;
+	bool m_IsFrustumCullingEnabled = true;
+	bool m_IsLodEnabled = true;
+	float m_LodErrorThreshold = 1.0f;
+	bool m_IsMeshletCullingEnabled = true;
+	bool m_IsMeshletConeCullingEnabled = true;
+	bool m_IsPackedVertexEnabled = false;
+	bool m_IsTextureStreamingEnabled = true;
+	MipGenerator::Filter m_MipFilters[3] = {
+		TextureCook::GetDefaultMipFilter(TextureCook::TextureRole::Color),
+		TextureCook::GetDefaultMipFilter(TextureCook::TextureRole::Normal),
+		TextureCook::GetDefaultMipFilter(TextureCook::TextureRole::Mask),
+	};
+
+	// eNX`̃Xg[~O (m_StreamingTextures ̓nh̏)
+	TextureStreamer m_TextureStreamer;
+	std::vector<Texture*> m_StreamingTextures;
+
 	// V[֘A
 	Scene* m_pScene = nullptr;
 	std::unique_ptr<SceneStage> m_pSceneStage = nullptr;
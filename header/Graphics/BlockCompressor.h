@@ -0,0 +1,86 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/// <summary>
+/// RGBA8 ̉摜 BC1/BC3/BC4/BC5/BC7 ̃ubNɈkGR[_[ (DirectXTexEGPU Ɉˑ܂)
+/// 4x4 ̃ubN݂͌ɓƗȂ̂ŁAubN̍s܂Ƃ߂ĕXbhňk܂
+/// efɍł߂pbg̒T SSE/AVX2  4/8 fs܂
+/// (MATH_FORCE_SCALAR `ƃXJ[ɂȂAʂ̓rbgPʂňv܂)
+/// </summary>
+namespace BlockCompressor
+{
+	/// <summary>
+	/// k`
+	/// </summary>
+	enum class Format : uint8_t
+	{
+		BC1, //!< RGB + 1 rbg̃At@ (8 oCg/ubN)
+		BC3, //!< RGB (BC1 Ɠ) + BC4 Ɠ`̃At@ (16 oCg/ubN)
+		BC4, //!< R 1`l (8 oCg/ubN)
+		BC5, //!< RG 2`l (16 oCg/ubN)
+		BC7, //!< RGBA (16 oCg/ubNA[h 1  6 g܂)
+	};
+
+	/// <summary>
+	/// k̕i (グقǒxȂ܂)
+	/// </summary>
+	enum class Quality : uint8_t
+	{
+		Fast,   //!< 听̗̕[[_ɂ (BC7 ̓[h 6 ̂)
+		Normal, //!< ŏ@Œ[_lߒ (BC7 ݂͌̂镪[h 1 )
+		High,   //!< ɗʎq[_ӂŒT (BC7 ̓[h 1 𑽂̕߂Ɏ)
+	};
+
+	/// <summary>
+	/// k̐ݒ
+	/// </summary>
+	struct Settings
+	{
+		Quality Level = Quality::Normal;
+		bool IsParallel = true; //!< ubN̍s𕡐XbhɕĈk
+	};
+
+	/// <summary>
+	/// k̉摜 (RGBA8)
+	/// </summary>
+	struct SourceImage
+	{
+		const uint8_t* pPixels = nullptr;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		size_t RowPitch = 0; //!< 1s̃oCg
+	};
+
+	const char* GetFormatName(Format format);
+	const char* GetQualityName(Quality quality);
+	//! @brief pbg̒TɎg߃Zbg̖O ("avx2"E"sse2"E"scalar")
+	const char* GetInstructionSetName();
+
+	//! @brief 1ubÑoCg
+	size_t GetBlockSize(Format format);
+	//! @brief k̃oCg ([̔[ȃubN܂)
+	size_t GetCompressedSize(Format format, uint32_t width, uint32_t height);
+
+	/// <summary>
+	/// 摜kAubNォsɋl߂ď݂܂
+	/// E 4 ̔{łȂꍇA[̃ubN͒[̉fJԂĖ߂܂
+	/// FԂ͕ϊȂ̂ŁAsRGB ̉摜͂̂܂ sRGB ̌`ƂĎg܂
+	/// </summary>
+	/// <param name="pOutBlocks"> GetCompressedSize() oCgȏ̗̈ </param>
+	void Compress(const SourceImage& source, Format format, const Settings& settings, uint8_t* pOutBlocks);
+
+	/// <summary>
+	/// ubN RGBA8 (1s width * 4 oCg) ɓWJ܂
+	/// `Ȃ`l D3D ƓAF 0AAt@ 255 ɂȂ܂
+	/// BC7 ͂̃GR[_[gȂ[hWJł܂
+	/// </summary>
+	void Decompress(const uint8_t* pBlocks, Format format, uint32_t width, uint32_t height, uint8_t* pOutPixels);
+
+	/// <summary>
+	/// 摜ƓWJ (Decompress ̏o)  PSNR (dB) ߂܂
+	/// ``lׂ܂ (BC4  RABC5  RGAȊO RGBA)
+	/// </summary>
+	/// <returns> SɈvꍇ͖ </returns>
+	double ComputePSNR(const SourceImage& source, const uint8_t* pDecoded, Format format);
+}
@@ -43,6 +43,7 @@ public:
 	const float& GetNear() const { return m_Near; }
 	const float& GetFovY() const { return m_FovY; }
 	const float& GetAspect() const { return m_Aspect; }
+	const float& GetHeight() const { return m_Height; }
 	const Matrix4x4& GetView();
 	const Matrix4x4& GetProj();
 	const Matrix4x4& GetViewProj();
@@ -55,6 +56,7 @@ private:
 	Matrix4x4 m_View = Matrix4x4(); //!< r[s
 	Matrix4x4 m_ViewInv = Matrix4x4(); //!< r[s̋ts
 	Matrix4x4 m_Proj = Matrix4x4();//!< vWFNVs
+	Matrix4x4 m_ViewProj = Matrix4x4(); //!< r[EvWFNVs
 	Matrix4x4 m_cameraRotation = Matrix4x4(); //!< J̉]s
 	Vector3D m_Forward = Vector3D(0.0f, 0.0f, 1.0f); //!< J̑O
 	Vector3D m_Right = Vector3D(1.0f, 0.0f, 0.0f); //!< J̉E
@@ -0,0 +1,115 @@
+#pragma once
+#include "pch.h"
+#include "Utilities/OffsetAllocator.h"
+
+#include <functional>
+
+class Renderer;
+
+/// <summary>
+/// V[Ŝ̒_ECfbNXf[^uLobt@ (ftHgq[v)
+/// bV OffsetAllocator Ő؂ögAx[X_EJnCfbNXw肵ĕ`悵܂
+/// 󂫂Ȃꍇ́Amۍς݂̗̈Vobt@֋lߒĈڂ܂ (nh͂̂܂܎g܂)
+/// </summary>
+class GeometryArena
+{
+public:
+	//! mۂ̈̎ʎq (obt@ڂĂItZbg̓nh܂)
+	using Handle = uint32_t;
+	static constexpr Handle InvalidHandle = UINT32_MAX;
+
+	//! ŏɊmۂ钸_obt@̃TCY (oCg)
+	static constexpr uint64_t InitialVertexCapacity = 64ull * 1024 * 1024;
+	//! ŏɊmۂCfbNXobt@̃TCY (oCg)
+	static constexpr uint64_t InitialIndexCapacity = 32ull * 1024 * 1024;
+
+	enum class BufferType : uint8_t
+	{
+		Vertex,
+		Index,
+		Count,
+	};
+
+	/// <summary>
+	/// gp (GfB^\p)
+	/// </summary>
+	struct Stats
+	{
+		uint64_t Capacity = 0;
+		uint64_t UsedSize = 0;
+		size_t AllocationCount = 0;
+		float Fragmentation = 0.0f;
+	};
+
+	GeometryArena(Renderer* pRenderer);
+	~GeometryArena();
+	GeometryArena(const GeometryArena&) = delete;
+	GeometryArena& operator=(const GeometryArena&) = delete;
+
+	/// <summary>
+	/// ̈mۂ܂
+	/// </summary>
+	/// <param name="size"> TCY (oCgA0 Ȃ InvalidHandle Ԃ܂) </param>
+	/// <param name="stride"> vf̃TCY (ItZbg͂̔{ɂȂ̂ŁAx[X_EJnCfbNXɕϊł܂) </param>
+	Handle Allocate(BufferType type, uint64_t size, uint64_t stride);
+
+	//! @brief ̈܂ (InvalidHandle ͖܂)
+	void Free(Handle handle);
+
+	/// <summary>
+	/// mۂ̈փf[^݂܂
+	/// ꎞIȃAbv[hobt@ write(i, pDst)  handles[i] ̓eɏ݁A܂Ƃ߂ăRs[Ċ҂܂
+	/// </summary>
+	void Upload(const std::vector<Handle>& handles, const std::function<void(size_t, uint8_t*)>& write);
+
+	/// <summary>
+	/// mۍς݂̗̈擪lߒA󂫂1ɂ܂Ƃ߂܂ (GPU ̏IĂ鎞ɌĂł)
+	/// </summary>
+	void Defragment();
+
+	//! @brief obt@擪̃ItZbg (oCg)
+	uint64_t GetOffset(Handle handle) const { return handle != InvalidHandle ? m_Blocks[handle].Offset : 0; }
+	uint64_t GetSize(Handle handle) const { return handle != InvalidHandle ? m_Blocks[handle].Size : 0; }
+
+	//! @brief _obt@Ŝ̃r[
+	D3D12_VERTEX_BUFFER_VIEW GetVBV(uint32_t stride) const;
+	//! @brief CfbNXobt@Ŝ̃r[
+	D3D12_INDEX_BUFFER_VIEW GetIBV(DXGI_FORMAT format) const;
+
+	Stats GetStats(BufferType type) const;
+	//! @brief obt@ڂ (lߒEg) 
+	uint32_t GetRelocationCount() const { return m_RelocationCount; }
+
+private:
+	/// <summary>
+	/// ޖ̃obt@Ɗ蓖ď
+	/// </summary>
+	struct Arena
+	{
+		ComPtr<ID3D12Resource> pBuffer;
+		OffsetAllocator Allocator;
+	};
+
+	/// <summary>
+	/// nhẅ
+	/// </summary>
+	struct Block
+	{
+		uint64_t Offset = 0;
+		uint64_t Size = 0;
+		BufferType Type = BufferType::Vertex;
+		bool IsUsed = false;
+	};
+
+	ComPtr<ID3D12Resource> CreateBuffer(uint64_t size, D3D12_HEAP_TYPE heapType);
+	//! @brief mۍς݂̗̈lߒȂAnewCapacity ̐Vobt@ֈڂ܂
+	void Relocate(BufferType type, uint64_t newCapacity);
+	//! @brief ꎞIȃR}hXgɃRs[L^ĎsA҂܂
+	void ExecuteCopy(const std::function<void(ID3D12GraphicsCommandList*)>& record);
+
+	Renderer* m_pRenderer = nullptr;
+	Arena m_Arenas[static_cast<size_t>(BufferType::Count)];
+	std::vector<Block> m_Blocks;
+	std::vector<Handle> m_FreeHandles;
+	uint32_t m_RelocationCount = 0;
+};
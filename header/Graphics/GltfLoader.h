@@ -0,0 +1,28 @@
+#pragma once
+#include <string>
+#include "Graphics/MeshData.h"
+
+/// <summary>
+/// Assimp ʂ glTF 2.0 (.gltf / .glb)  ModelData ֓ǂݍ݂܂
+/// .binE.glb ̓}bvAANZTŏII Vertex z֒ڏ݂܂
+/// ʂ Assimp ̓ǂݍ݃tO (Model  ImportFlags) Ɠ`
+/// (Op`E_ւ̃m[hϊ̓KpE@/ڐ̐Enւ̕ϊ) ɑĂ܂
+/// pch.h  D3D12 ɈˑȂ̂ŁAc[eXgg܂
+/// </summary>
+namespace GltfLoader
+{
+	/// <summary>
+	/// gq炱̃[_[œǂݍ߂t@C肵܂
+	/// </summary>
+	bool CanLoad(const std::wstring& filePath);
+
+	/// <summary>
+	/// glTF / GLB t@Cǂݍ݂܂
+	/// Sparse ANZTȂǖΉ̋@\gĂꍇ͎ŝŁAAssimp œǂݍݒĂ
+	/// </summary>
+	/// <param name="filePath"> ǂݍރt@C </param>
+	/// <param name="outData"> ǂݍ݌ </param>
+	/// <param name="pError"> sR (svȂ nullptr) </param>
+	/// <returns> ǂݍ݂ɐ true </returns>
+	bool Load(const std::wstring& filePath, ModelData& outData, std::string* pError = nullptr);
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "Math/Matrix4x4.h"
+#include "Math/Bounds.h"
+#include "Graphics/MeshData.h"
+
+/// <summary>
+/// Ẻʏ̑傫A`Ɏg LOD Iт܂
+/// e LOD ̌덷 (MeshLod::Error) ʏ̃sNZɊZAelȉōłe LOD I܂
+/// </summary>
+struct LodSelector
+{
+	Vector3D ViewPosition;       //!< _̃[hW (ˉeł͎g܂)
+	float PixelScale = 0.0f;     //!<  1 ɂ钷 1 ̂̕ʏŉsNZɂȂ邩 (ˉeł͋ɂȂ)
+	bool IsOrthographic = false; //!< ˉe
+	float ErrorThreshold = 1.0f; //!< eʏ̌덷 (sNZ)
+
+	/// <summary>
+	/// vWFNVs񂩂琶܂
+	/// </summary>
+	/// <param name="proj"> vWFNVs (Camera::GetProj() Ȃ) </param>
+	/// <param name="viewportHeight"> `̍ (sNZ) </param>
+	/// <param name="viewPosition"> _̃[hW </param>
+	/// <param name="errorThreshold"> eʏ̌덷 (sNZ) </param>
+	static LodSelector FromProj(const Matrix4x4& proj, float viewportHeight, const Vector3D& viewPosition, float errorThreshold)
+	{
+		LodSelector selector;
+		selector.ViewPosition = viewPosition;
+		// e m[1][1] = 1 / tan(fovY / 2)Aˉe m[1][1] = 2 / height ŁAǂ NDC ̍ 2 r[|[g̍ɑΉ
+		selector.PixelScale = proj.m_mat[1][1] * viewportHeight * 0.5f;
+		selector.IsOrthographic = proj.m_mat[3][3] == 1.0f;
+		selector.ErrorThreshold = errorThreshold;
+		return selector;
+	}
+
+	/// <summary>
+	/// E̎_ɍł߂ʒuŁA[hԂ̒ 1 ʏŉsNZɂȂ邩߂܂
+	/// </summary>
+	/// <returns> E̒Ɏ_ꍇ͖ </returns>
+	float GetPixelsPerUnit(const Sphere& worldSphere) const
+	{
+		if (IsOrthographic)
+		{
+			return PixelScale;
+		}
+		const float distance = (worldSphere.Center - ViewPosition).length() - worldSphere.Radius;
+		if (distance <= 0.0f)
+		{
+			return std::numeric_limits<float>::infinity();
+		}
+		return PixelScale / distance;
+	}
+
+	/// <summary>
+	/// LOD I܂
+	/// </summary>
+	/// <param name="lods"> bV LOD (擪 LOD0) </param>
+	/// <param name="worldSphere"> [hԂ̋E </param>
+	/// <param name="localRadius"> [JԂ̋E̔a (LOD ̌덷[hԂ̒ɊZ邽) </param>
+	/// <returns> LOD ̔ԍ </returns>
+	uint32_t Select(const std::vector<MeshLod>& lods, const Sphere& worldSphere, float localRadius) const
+	{
+		if (lods.size() <= 1 || localRadius <= 0.0f)
+		{
+			return 0;
+		}
+
+		// eNX`̃~bvIƓAE̎_ɍł߂ʒuŊZ (Sł̊Zׂ LOD ɂȂ)
+		const float pixelsPerUnit = GetPixelsPerUnit(worldSphere);
+		if (pixelsPerUnit == std::numeric_limits<float>::infinity())
+		{
+			// E̒Ɏ_ꍇ͍łׂ LOD g
+			return 0;
+		}
+
+		// ʏ̔a (sNZ) / [JԂ̔a = [JԂ̒ 1 ̃sNZ
+		const float pixelsPerLocalUnit = worldSphere.Radius * pixelsPerUnit / localRadius;
+		uint32_t selected = 0;
+		for (uint32_t i = 1; i < lods.size(); ++i)
+		{
+			if (lods[i].Error * pixelsPerLocalUnit > ErrorThreshold)
+			{
+				break;
+			}
+			selected = i;
+		}
+		return selected;
+	}
+};
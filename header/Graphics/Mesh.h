@@ -1,31 +1,58 @@
 #pragma once
 #include "pch.h"
-#include "Math/Vector2D.h"
-#include "Math/Vector3D.h"
+#include "Math/Bounds.h"
 #include "Graphics/DX12Utilities.h"
+#include "Graphics/MeshData.h"
+#include "Graphics/VertexPacking.h"
+#include "Graphics/GeometryArena.h"
 
-#include <assimp/Importer.hpp>
-#include <assimp/scene.h>
-#include <assimp/postprocess.h>
+class Texture;
 
-struct Vertex
+/// <summary>
+/// bV̒_ECfbNXf[^u GeometryArena ̗̈
+/// (V[̑SbV1̃obt@L܂)
+/// </summary>
+struct MeshBufferRange
 {
-	Vector3D m_Position; // _W
-	Vector3D m_Normal;    // @xNg
-	Vector2D m_TexCoord;    // UVW
-	Vector3D m_Tangent;    // ڐxNg
+	GeometryArena* pArena = nullptr;
+	GeometryArena::Handle VertexHandle = GeometryArena::InvalidHandle; //!< _f[^̗̈
+	GeometryArena::Handle IndexHandle = GeometryArena::InvalidHandle;  //!< CfbNXf[^̗̈
+	bool IsPackedVertex = false; //!< _ PackedVertex ŏ񂾂
+	bool Is16BitIndex = false;   //!< CfbNX 16bit ŏ񂾂
 };
 
-class Texture;
-
 class Mesh
 {
 public:
-	Mesh(Renderer* pRenderer, const aiMesh* pSrcMesh);
+	/// <summary>
+	/// RXgN^
+	/// </summary>
+	/// <param name="meshData"> bVf[^ (_ECfbNX bufferRange ֏ݍς݂ł邱) </param>
+	/// <param name="bufferRange"> _ECfbNXf[^̔zu (̈̓bV̔jɉ܂) </param>
+	Mesh(Renderer* pRenderer, const MeshData& meshData, const MeshBufferRange& bufferRange);
 	~Mesh();
-	D3D12_VERTEX_BUFFER_VIEW GetVBV() const { return m_VBV; }
-	D3D12_INDEX_BUFFER_VIEW GetIBV() const { return m_IBV; }
+	//! @brief L_obt@Ŝ̃r[ (̃bV̒_`̃XgCh)
+	D3D12_VERTEX_BUFFER_VIEW GetVBV() const { return m_pArena->GetVBV(m_VertexStride); }
+	//! @brief LCfbNXobt@Ŝ̃r[ (̃bṼCfbNX`)
+	D3D12_INDEX_BUFFER_VIEW GetIBV() const { return m_pArena->GetIBV(GetIndexFormat()); }
+	//! @brief `掞Ɏw肷x[X_ (Lobt@̐擪_)
+	int32_t GetBaseVertex() const { return static_cast<int32_t>(m_pArena->GetOffset(m_VertexHandle) / m_VertexStride); }
+	//! @brief `掞Ɏw肷JnCfbNX̊ (LODEbVbg̃ItZbgɉ܂)
+	uint32_t GetStartIndex() const { return static_cast<uint32_t>(m_pArena->GetOffset(m_IndexHandle) / GetIndexStride()); }
+	//! @brief _f[^̃TCY (oCg)
+	uint64_t GetVertexBufferSize() const { return m_pArena->GetSize(m_VertexHandle); }
+	bool Is16BitIndex() const { return m_Is16BitIndex; }
+	DXGI_FORMAT GetIndexFormat() const { return m_Is16BitIndex ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT; }
+	uint32_t GetIndexStride() const { return m_Is16BitIndex ? sizeof(uint16_t) : sizeof(uint32_t); }
+	//! @brief LOD0 ̃CfbNX
 	uint32_t GetIndexCount() const { return m_IndexCount; }
+	//! @brief LOD (擪 LOD0ACfbNXobt@͈̔͂ƌ덷)
+	const std::vector<MeshLod>& GetLods() const { return m_Lods; }
+	//! @brief LOD0 ̃bVbg (Ȃ烁bVbgȂ)
+	const std::vector<Meshlet>& GetMeshlets() const { return m_Meshlets; }
+	//! @brief _ PackedVertex  (ʒu̓WJ GetPositionQuantization() Kv)
+	bool IsPackedVertex() const { return m_IsPackedVertex; }
+	const PositionQuantization& GetPositionQuantization() const { return m_PositionQuantization; }
 	uint32_t GetMaterialIndex() const { return m_MaterialIndex; }
 	void SetMaterialIndex(uint32_t index) { m_MaterialIndex = index; }
 	void SetDiffuseTex(Texture* pTexture) { m_pDiffuseTexture = pTexture; }
@@ -38,13 +65,15 @@ public:
 	Texture* GetShinessTex() const { return m_pShinessTexture; }
 	void SetSpecularTex(Texture* pTexture) { m_pSpecularTexture = pTexture; }
 	Texture* GetSpecularTex() const { return m_pSpecularTexture; }
+	//! @brief [JԂ AABB
+	const AABB& GetLocalBounds() const { return m_LocalBounds; }
+	//! @brief [JԂ̋E
+	const Sphere& GetLocalSphere() const { return m_LocalSphere; }
+	//! @brief [JԂ̒ 1  UV ̕ω (eNX`̃Xg[~OŕKvȃ~bv߂̂Ɏg)
+	float GetUvDensity() const { return m_UvDensity; }
 	std::string m_Name;
 
 private:
-	void UploadBuffers(ID3D12Device* pDevice);
-
-	std::vector<Vertex> m_Vertices;
-	std::vector<uint32_t> m_Indices;
 	uint32_t m_MaterialIndex = -1;
 
 	Texture* m_pDiffuseTexture = nullptr;
@@ -53,13 +82,22 @@ private:
 	Texture* m_pShinessTexture = nullptr;
 	Texture* m_pSpecularTexture = nullptr;
 
-	// _ACfbNXf[^
-	ComPtr<ID3D12Resource> m_pVB = nullptr;
-	D3D12_VERTEX_BUFFER_VIEW m_VBV = {};
-
-	ComPtr<ID3D12Resource> m_pIB = nullptr;
-	D3D12_INDEX_BUFFER_VIEW m_IBV = {};
+	// _ACfbNXf[^ (obt@͑̃bVƋL)
+	GeometryArena* m_pArena = nullptr;
+	GeometryArena::Handle m_VertexHandle = GeometryArena::InvalidHandle;
+	GeometryArena::Handle m_IndexHandle = GeometryArena::InvalidHandle;
+	uint32_t m_VertexStride = 0;
+	bool m_Is16BitIndex = false;
 
 	uint32_t m_IndexCount = 0;
+	std::vector<MeshLod> m_Lods;
+	std::vector<Meshlet> m_Meshlets;
+	bool m_IsPackedVertex = false;
+	PositionQuantization m_PositionQuantization;
 	Renderer* m_pRenderer = nullptr;
+
+	// E{[ (ǂݍݎɌvZς)
+	AABB m_LocalBounds;
+	Sphere m_LocalSphere;
+	float m_UvDensity = 0.0f;
 };
\ No newline at end of file
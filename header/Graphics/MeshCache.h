@@ -0,0 +1,47 @@
+#pragma once
+#include "pch.h"
+#include "Graphics/MeshData.h"
+
+/// <summary>
+/// ǂݍݍς݃f̃oCiLbV (.mvmesh)
+/// AssimpEglTF [_[ł̓ǂݍ݁E㏈EbVœǨ (_/CfbNXzA}eAAE{[) ۑA
+/// 2ڈȍ~̓}bvœǂݍ Assimp g킸ɍς܂܂
+/// z̓}bv MeshData 1Rs[ACfbNXELODEbVbg͈̔͂m߂Ăg܂
+/// </summary>
+namespace MeshCache
+{
+	//! t@C`̃o[W (`ςグĂ)
+	constexpr uint32_t Version = 6;
+
+	/// <summary>
+	/// LbV̗L𔻒肷L[
+	/// </summary>
+	struct Key
+	{
+		uint64_t SourceHash = 0;  //!< ǂݍ݌t@C̓ẽnbV
+		uint32_t ImportFlags = 0; //!< Assimp ̓ǂݍ݃tO
+	};
+
+	/// <summary>
+	/// ǂݍ݌t@CL[쐬܂
+	/// .gltf ̏ꍇ͓tH_ .bin ẽnbVɊ܂߂܂
+	/// </summary>
+	Key MakeKey(const std::wstring& sourcePath, uint32_t importFlags);
+
+	/// <summary>
+	/// LbVt@C̃pX擾܂ (cache tH_ÃpXƂɈ)
+	/// </summary>
+	std::wstring GetCachePath(const std::wstring& sourcePath);
+
+	/// <summary>
+	/// LbVǂݍ݂܂
+	/// </summary>
+	/// <returns> LbV݂AL[Eo[Wvēǂݍ߂ true </returns>
+	bool Load(const std::wstring& cachePath, const Key& key, ModelData& outData);
+
+	/// <summary>
+	/// LbV݂܂ (ꎞt@CɏĂu܂)
+	/// </summary>
+	/// <returns> ݂ɐ true </returns>
+	bool Save(const std::wstring& cachePath, const Key& key, const ModelData& data);
+}
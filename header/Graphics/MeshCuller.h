@@ -0,0 +1,38 @@
+#pragma once
+#include "pch.h"
+#include "Math/Bounds.h"
+
+class Model;
+
+/// <summary>
+/// f̃bV܂Ƃ߂ĎJO܂
+/// 茋ʂ͑Sf̃bVA1{̔zɕێAfɎQƂł܂
+/// </summary>
+class MeshCuller
+{
+public:
+	//! ̐ȏ̃bVꍇɕŔ肷
+	static constexpr size_t ParallelThreshold = 4096;
+	//! 񔻒莞1Wu̍ŏbV
+	static constexpr size_t ParallelMinBatch = 1024;
+
+	/// <summary>
+	/// Sf̃bṼ[h AABB Ŕ肵܂
+	/// bVꍇ Parallel::For ŕĕɔ肵܂
+	/// </summary>
+	/// <param name="models"> 肷郂f </param>
+	/// <param name="frustum"> [hԂ̎ </param>
+	void Cull(const std::vector<std::unique_ptr<Model>>& models, const Frustum& frustum);
+
+	/// <summary>
+	/// O Cull() ɂ modelIndex Ԗڂ̃f̉tO擾܂
+	/// </summary>
+	/// <returns> bV̉tO (Model::GetMeshes() Ɠ) </returns>
+	const uint8_t* GetMeshVisibility(size_t modelIndex) const { return m_MeshVisibility.data() + m_MeshOffsets[modelIndex]; }
+
+private:
+	//! bV̉tO (Sf̃bVA)
+	std::vector<uint8_t> m_MeshVisibility;
+	//! ef̃bV m_MeshVisibility Ŏn܂ʒu (ɃbV)
+	std::vector<size_t> m_MeshOffsets;
+};
@@ -0,0 +1,171 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Math/Vector2D.h"
+#include "Math/Vector3D.h"
+#include "Math/Bounds.h"
+
+struct Vertex
+{
+	Vector3D m_Position; // _W
+	Vector3D m_Normal;    // @xNg
+	Vector2D m_TexCoord;    // UVW
+	Vector3D m_Tangent;    // ڐxNg
+};
+
+/// <summary>
+/// ǂݍݒ̃}eA (eNX`̓t@CpXŕێAGPU \[X͎܂)
+/// </summary>
+struct MaterialData
+{
+	Vector3D Diffuse = Vector3D(0.5f, 0.5f, 0.5f); //!< fBt[YF
+	Vector3D Specular = Vector3D(0.5f, 0.5f, 0.5f); //!< XyL[F
+	float Alpha = 1.0f;     //!< At@l
+	float Shininess = 0.0f; //!< ʔˋx
+	std::string DiffuseTexPath;               //!< fBt[YeNX` (ȂȂ)
+	std::string NormalTexPath;                //!< m[}eNX`
+	std::string GLTFMetaricRoughnessTexPath;  //!< GLTF̃^bNtlXeNX`
+	std::string ShininessTexPath;             //!< VClXeNX`
+	std::string SpecularTexPath;              //!< XyLeNX`
+};
+
+/// <summary>
+/// _LbV (FIFO) ̃V~[V
+/// 񐔂ŕێĂ̂ŁAbV̌ʂ𑫂킹Ă䗦߂܂
+/// </summary>
+struct VertexCacheStats
+{
+	uint32_t TriangleCount = 0;    //!< Op`
+	uint32_t VertexCount = 0;      //!< CfbNXQƂĂ钸_
+	uint32_t TransformedCount = 0; //!< LbV~X (_VF[_[̎s)
+
+	//! @brief 1Op`̒_VF[_[s (Average Cache Miss RatioA0.5`3)
+	float GetACMR() const { return TriangleCount > 0 ? static_cast<float>(TransformedCount) / TriangleCount : 0.0f; }
+	//! @brief 1_̒_VF[_[s (Average Transformed Vertex RatioAz1)
+	float GetATVR() const { return VertexCount > 0 ? static_cast<float>(TransformedCount) / VertexCount : 0.0f; }
+
+	void Merge(const VertexCacheStats& stats)
+	{
+		TriangleCount += stats.TriangleCount;
+		VertexCount += stats.VertexCount;
+		TransformedCount += stats.TransformedCount;
+	}
+};
+
+/// <summary>
+/// _̗n (d_̓) ̌
+/// VertexCacheStats Ɠ񐔂ŕێAbV̌ʂ𑫂킹܂
+/// </summary>
+struct WeldStats
+{
+	uint32_t VertexCountBefore = 0;  //!< nڑO̒_
+	uint32_t VertexCountAfter = 0;   //!< nڌ̒_
+	uint32_t DegenerateTriangles = 0; //!< _2ȏQƂ悤ɂȂ菜Op`̐
+
+	//! @brief _̊ (0`1)
+	float GetReduction() const { return VertexCountBefore > 0 ? 1.0f - static_cast<float>(VertexCountAfter) / VertexCountBefore : 0.0f; }
+
+	void Merge(const WeldStats& stats)
+	{
+		VertexCountBefore += stats.VertexCountBefore;
+		VertexCountAfter += stats.VertexCountAfter;
+		DegenerateTriangles += stats.DegenerateTriangles;
+	}
+};
+
+/// <summary>
+/// 1iK LOD (S LOD Œ_zLACfbNX܂)
+/// </summary>
+struct MeshLod
+{
+	uint32_t IndexOffset = 0; //!< MeshData::Indices ̐擪
+	uint32_t IndexCount = 0;  //!< CfbNX
+	float Error = 0.0f;       //!< ̌`󂩂̂ ([JԂ̋)
+};
+
+/// <summary>
+/// LOD0 𕪊Op`̂܂Ƃ܂ (bVbg)
+/// CfbNX͘AĂ̂ŁA͈͂w肷邾ŕ`ł܂
+/// </summary>
+struct Meshlet
+{
+	uint32_t IndexOffset = 0; //!< MeshData::Indices ̐擪
+	uint32_t IndexCount = 0;  //!< CfbNX
+	Sphere Bounds;            //!< [JԂ̋E
+	Vector3D ConeAxis;        //!< @R[̎ (Op`̕\̌̕)
+	float ConeCutoff = 1.0f;  //!< @R[̍L sin (1 ȂwʃJOȂ)
+};
+
+/// <summary>
+/// GPU փAbv[hÕbV
+/// (pch.h ɈˑȂ̂ŁA[_[LbV̓c[g܂)
+/// </summary>
+struct MeshData
+{
+	std::string Name;
+	uint32_t MaterialIndex = -1;
+	std::vector<Vertex> Vertices;
+	std::vector<uint32_t> Indices;  //!< LOD0 珇ɑS LOD ̃CfbNXA
+	std::vector<MeshLod> Lods;      //!< LOD ̃CfbNX͈ (Ȃ Indices Ŝ LOD0)
+	std::vector<Meshlet> Meshlets;  //!< LOD0 ̃bVbg (Ȃ烁bVbgPʂ̃JOȂ)
+	AABB LocalBounds;   //!< [JԂ AABB
+	Sphere LocalSphere; //!< [JԂ̋E
+	VertexCacheStats CacheStatsBefore; //!< œKO̒_LbV
+	VertexCacheStats CacheStatsAfter;  //!< œK̒_LbV
+	WeldStats Weld;                    //!< _̗nڂ̌
+
+	//! @brief 16bit ̃CfbNXőS_QƂł邩
+	bool CanUse16BitIndices() const { return Vertices.size() <= 0x10000; }
+
+	//! @brief _W LocalBoundsELocalSphere vZ܂
+	void ComputeBounds()
+	{
+		if (Vertices.empty())
+		{
+			LocalBounds = AABB();
+			LocalSphere = Sphere();
+			return;
+		}
+		const float* pPositions = &Vertices[0].m_Position.x;
+		LocalBounds = AABB::FromPoints(pPositions, Vertices.size(), sizeof(Vertex));
+		LocalSphere = Sphere::FromPoints(pPositions, Vertices.size(), sizeof(Vertex), LocalBounds);
+	}
+
+	/// <summary>
+	/// [JԂ̒ 1  UV ̕ωʂ LOD0 ̎Op`̖ʐϔ䂩狁߂܂
+	/// eNX`̃Xg[~OŁAʏ̑傫Kvȃ~bv߂̂Ɏg܂
+	/// </summary>
+	/// <returns> UV Ȃ (UV ̖ʐς 0 ) ꍇ 0 </returns>
+	float ComputeUvDensity() const
+	{
+		const uint32_t offset = Lods.empty() ? 0 : Lods[0].IndexOffset;
+		const uint32_t count = Lods.empty() ? static_cast<uint32_t>(Indices.size()) : Lods[0].IndexCount;
+		double localArea = 0.0;
+		double uvArea = 0.0;
+		for (uint32_t i = offset; i + 3 <= offset + count; i += 3)
+		{
+			const Vertex& v0 = Vertices[Indices[i + 0]];
+			const Vertex& v1 = Vertices[Indices[i + 1]];
+			const Vertex& v2 = Vertices[Indices[i + 2]];
+			localArea += (v1.m_Position - v0.m_Position).cross(v2.m_Position - v0.m_Position).length();
+			const Vector2D uv1 = v1.m_TexCoord - v0.m_TexCoord;
+			const Vector2D uv2 = v2.m_TexCoord - v0.m_TexCoord;
+			uvArea += std::abs(uv1.x * uv2.y - uv1.y * uv2.x);
+		}
+		if (localArea <= 0.0 || uvArea <= 0.0)
+		{
+			return 0.0f;
+		}
+		return static_cast<float>(std::sqrt(uvArea / localArea));
+	}
+};
+
+/// <summary>
+/// 1t@C̓ǂݍ݌ (AssimpEglTF [_[ł̓ǂݍ݂ƃbVLbV̋ʌ`)
+/// </summary>
+struct ModelData
+{
+	std::vector<MaterialData> Materials;
+	std::vector<MeshData> Meshes;
+};
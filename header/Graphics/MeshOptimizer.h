@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Graphics/MeshData.h"
+
+/// <summary>
+/// _VF[_[̎s񐔂ƃI[o[h[炷߂̃bV̕בւ
+/// Op`𒸓_LbVɕבւ (Tipsify)AI[o[h[悤ɃNX^PʂŕבւA
+/// _QƏɕגătFb`̋Ǐグ܂
+/// ʂ̓bVLbVɕۑ̂ŁAœK͏̓ǂݍݎs܂
+/// </summary>
+namespace MeshOptimizer
+{
+	//! V~[VEœKőz肷钸_LbV (FIFO) ̃TCY
+	constexpr uint32_t CacheSize = 16;
+	//! I[o[h[̕בւŋe ACMR ̈ (ꍇ͕בւs܂)
+	constexpr float OverdrawThreshold = 1.05f;
+
+	/// <summary>
+	/// FIFO ̒_LbVV~[V ACMREATVR ߂܂
+	/// </summary>
+	VertexCacheStats AnalyzeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertexCount);
+
+	/// <summary>
+	/// Op`𒸓_LbV̋ǏȂ鏇ɕבւ܂ (Tipsify)
+	/// </summary>
+	/// <param name="pClusterStarts"> LbVg؂ĕʂ̏ꏊֈڂOp`̔ԍ (svȂ nullptrA擪͕K 0) </param>
+	void OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertexCount, std::vector<uint32_t>* pClusterStarts = nullptr);
+
+	/// <summary>
+	/// OptimizeVertexCache() ̃NX^AOĂ̂قǐɕ`悳悤ɕבւ܂
+	/// ACMR  OverdrawThreshold {𒴂Ĉꍇ͌̏̂܂܂ɂ܂
+	/// </summary>
+	void OptimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& clusterStarts);
+
+	/// <summary>
+	/// _CfbNXŏɎQƂ鏇ɕגACfbNXtւ܂
+	/// QƂĂȂ_͎菜܂
+	/// </summary>
+	void OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+
+	/// <summary>
+	/// L܂Ƃ߂ēKpAœKO̓v CacheStatsBeforeECacheStatsAfter ɋL^܂
+	/// </summary>
+	/// <param name="isOptimizeOverdraw"> I[o[h[̕בւs </param>
+	void Optimize(MeshData& mesh, bool isOptimizeOverdraw = true);
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Graphics/MeshData.h"
+
+/// <summary>
+/// 񎟌덷 (Quadric Error Metrics) ɂӂ̏kŃbVȗALOD 쐬܂
+/// _͊̒_֊񂹂邾Ȃ̂ŁAS LOD Œ_zLł܂
+/// UVE@̌pڂƃbV̋Eɂ钸_͓Ȃ̂ŁAȗĂЂъ܂
+/// </summary>
+namespace MeshSimplifier
+{
+	//! LOD0 ܂߂ LOD ̍ő吔
+	constexpr uint32_t MaxLodCount = 4;
+	//! LOD 1iK閈̎Op`̊
+	constexpr float LodReduction = 0.5f;
+	//! ̎Op`̃bVɂ LOD ܂
+	constexpr uint32_t MinLodTriangleCount = 256;
+	//! 1O LOD 炱̊܂ł点Ȃꍇ́Aȏ LOD ܂
+	constexpr float MinLodReduction = 0.8f;
+
+	/// <summary>
+	/// CfbNX targetIndexCount ȉɂȂ܂Ŋȗ܂
+	/// pڂ⋫EŏkłӂȂȂꍇ́AڕWɓ͂ȂĂI܂
+	/// </summary>
+	/// <param name="outIndices"> ȗ̃CfbNX (vertices Q) </param>
+	/// <returns> ̌`󂩂̂ ([JԂ̋) </returns>
+	float Simplify(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+		size_t targetIndexCount, std::vector<uint32_t>& outIndices);
+
+	/// <summary>
+	/// mesh.Indices  LOD0 Ƃ LOD 쐬AIndices ̌֘A Lods ɋL^܂
+	/// e LOD ͒_LbVɕבւ܂ (MeshOptimizer::Optimize ̌ɌĂł)
+	/// </summary>
+	void GenerateLods(MeshData& mesh);
+}
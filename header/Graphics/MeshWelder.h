@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "Graphics/MeshData.h"
+
+/// <summary>
+/// d_̗n ()
+/// ee덷̕ŗʎql̃nbVœ_TACfbNXtւ܂
+/// ʎq̋E܂l͋e덷łʂ̒_ƂĎc邱Ƃ܂Aꂪe덷𒴂ē邱Ƃ͂܂
+/// bVœK (MeshOptimizer) ̑OɓKpĂ
+/// </summary>
+namespace MeshWelder
+{
+	//! ̒_ȏ̃bV̓nbV̌vZƏďɍs܂ (Settings::IsParallel  true ̏ꍇ)
+	constexpr size_t ParallelThreshold = 1 << 16;
+
+	/// <summary>
+	/// ̋e덷 (0 ȂrbgPʂňvl𓝍܂)
+	/// </summary>
+	struct Settings
+	{
+		float PositionEpsilon = 1.0e-6f; //!< ʒu (bV AABB ̍őӂɑ΂䗦)
+		float NormalEpsilon = 1.0e-3f;   //!< @̊e
+		float TexCoordEpsilon = 1.0e-5f; //!< UV ̊e
+		float TangentEpsilon = 1.0e-2f;  //!< ڐ̊e (VF[fBOւ̉êŊɂ)
+		bool IsParallel = true;          //!< 傫ȃbV𕡐Xbhŏ (bVPʂŕɗnڂꍇ false)
+	};
+
+	/// <summary>
+	/// _nڂăCfbNX蒼Aʐς 0 ɂȂOp`菜܂
+	/// ꂽ_͍ŏɌꂽ_̒lg܂
+	/// ʂ mesh.Weld ɋL^AE{[vZ܂
+	/// </summary>
+	WeldStats Weld(MeshData& mesh, const Settings& settings = Settings());
+}
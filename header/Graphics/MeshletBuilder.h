@@ -0,0 +1,24 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Graphics/MeshData.h"
+
+/// <summary>
+/// LOD0 ̒_EOp`Ȃ܂Ƃ܂ (bVbg) ɕAEƖ@R[߂܂
+/// bVbgɃCfbNXA悤 LOD0 ̎Op`בւ̂ŁA
+/// ̃bVbg̓CfbNXobt@͈̔͂ƂĂ̂܂ܕ`ł܂ (MeshletCuller)
+/// </summary>
+namespace MeshletBuilder
+{
+	//! 1bVbg̍ő咸_
+	constexpr uint32_t MaxVertices = 64;
+	//! 1bVbg̍őOp`
+	constexpr uint32_t MaxTriangles = 124;
+
+	/// <summary>
+	/// mesh.Indices (LOD0) bVbgɕAMeshlets ɋL^܂
+	/// Op`ƒ_בւ̂ŁAMeshOptimizer::Optimize ̌AMeshSimplifier::GenerateLods ̑OɌĂł
+	/// ĂȂbV͗ʂ邱Ƃ̂ŁA@R[ɂwʃJO𖳌ɂ܂
+	/// </summary>
+	void Build(MeshData& mesh);
+}
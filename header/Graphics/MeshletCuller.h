@@ -0,0 +1,70 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Math/Matrix4x4.h"
+#include "Math/Bounds.h"
+#include "Graphics/MeshData.h"
+
+/// <summary>
+/// CfbNXobt@̘A͈ (1̃h[R[ŕ`łP)
+/// </summary>
+struct IndexRange
+{
+	uint32_t IndexOffset = 0;
+	uint32_t IndexCount = 0;
+};
+
+/// <summary>
+/// bVbgPʂ̃JO CPU ōs܂
+/// Ǝ_f̃[JԂ֕ϊAbVbg̋EƖ@R[𔻒肵܂
+/// cbVbgׂ͗荇̓mŃCfbNX͈̔͂AAh[R[}܂
+/// </summary>
+class MeshletCuller
+{
+public:
+	/// <summary>
+	/// 茋ʂ̏Wv (ResetStats() Z܂)
+	/// </summary>
+	struct Stats
+	{
+		uint32_t TotalMeshlets = 0;      //!< 肵bVbg
+		uint32_t VisibleMeshlets = 0;    //!< ʉ߂bVbg
+		uint32_t ConeCulledMeshlets = 0; //!< @R[ (w) ŏObVbg
+		uint32_t Meshes = 0;             //!< 1ȏ̃bVbgcbV
+		uint32_t Ranges = 0;             //!< o͂CfbNX͈͂̐ (= h[R[)
+	};
+
+	/// <summary>
+	/// Jݒ肵܂ (eOƂ܂)
+	/// </summary>
+	/// <param name="viewProj"> r[EvWFNVs </param>
+	/// <param name="viewPosition"> _̃[hW </param>
+	/// <param name="isConeCulling"> @R[ɂwʃJOs </param>
+	void SetView(const Matrix4x4& viewProj, const Vector3D& viewPosition, bool isConeCulling);
+
+	/// <summary>
+	/// 肷郂f̃[hsݒ肵܂ (Ǝ_[JԂ֕ϊ܂)
+	/// </summary>
+	void SetWorld(const Matrix4x4& world);
+
+	/// <summary>
+	/// bVbg𔻒肵A̃CfbNX͈͂Ԃ܂
+	/// </summary>
+	/// <returns> ͈̔ ( Cull() ܂ŗLASďOꂽꍇ͋) </returns>
+	const std::vector<IndexRange>& Cull(const std::vector<Meshlet>& meshlets);
+
+	const Stats& GetStats() const { return m_Stats; }
+	void ResetStats() { m_Stats = Stats(); }
+
+private:
+	Matrix4x4 m_ViewProj = Matrix4x4::Identity();
+	Vector3D m_ViewPosition;
+	bool m_IsConeCulling = true;
+
+	// [JԂ̎Ǝ_ (SetWorld() ōXV)
+	Frustum m_LocalFrustum;
+	Vector3D m_LocalViewPosition;
+
+	std::vector<IndexRange> m_Ranges;
+	Stats m_Stats;
+};
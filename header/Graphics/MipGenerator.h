@@ -0,0 +1,68 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/// <summary>
+/// RGBA8 ̉摜~bv}bv CPU  (DirectXTexEGPU Ɉˑ܂)
+/// k͉Ec̕\ȃtB^ōsA1f RGBA  float4 Ƃ SSE/NEON ł܂Ƃ߂ČvZ܂
+/// o͂̍s̑тɕAтƂɕʂ̃Xbhŏ܂
+/// </summary>
+namespace MipGenerator
+{
+	/// <summary>
+	/// ktB^
+	/// </summary>
+	enum class Filter : uint8_t
+	{
+		Box,    //!< k1f͈͂̕ (2 ̗ݏȂ 2x2 ̕)
+		Kaiser, //!< Kaiser t sinc (Box וcAGCAXȂ)
+	};
+
+	/// <summary>
+	/// f̒g (ǂ̋Ԃŕς邩߂܂)
+	/// </summary>
+	enum class Content : uint8_t
+	{
+		Color,  //!< sRGB ̐F (`Ԃɖ߂ĕςAsRGB ɖ߂BAt@͐`)
+		Linear, //!< tlXEAO Ȃǂ̐`Ȓl
+		Normal, //!< @}bv (XYZ  [-1, 1] ɖ߂ĕςA 1 ɐK)
+	};
+
+	/// <summary>
+	/// ~bv̍쐬̐ݒ
+	/// </summary>
+	struct Settings
+	{
+		Filter Kind = Filter::Box;
+		Content Type = Content::Color;
+		bool IsParallel = true; //!< o͂̍s𕡐Xbhɕď
+	};
+
+	/// <summary>
+	/// RGBA8 ̉摜 (1f 4 oCg)
+	/// </summary>
+	struct Image
+	{
+		uint8_t* pPixels = nullptr;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		size_t RowPitch = 0; //!< 1s̃oCg
+	};
+
+	//! @brief 1x1 ܂ł̃~bv (̉摜܂)
+	uint32_t GetMipCount(uint32_t width, uint32_t height);
+	//! @brief 1̃~bṽTCY (Aŏ 1)
+	uint32_t GetNextMipSize(uint32_t size);
+
+	/// <summary>
+	/// source k destination ɏ݂܂ (TCY͌ĂяoŌ߂܂Bʏ GetNextMipSize())
+	/// 摜̒[͒[̉fJԂĈ܂
+	/// </summary>
+	void Downsample(const Image& source, const Image& destination, const Settings& settings);
+
+	/// <summary>
+	/// 擪̃~bvc̃~bvɍ܂ (e~bv1̃~bvkč܂)
+	/// </summary>
+	/// <param name="pMips"> 傫ɕ񂾃~bv (pMips[0] ̉摜) </param>
+	void Generate(const Image* pMips, uint32_t mipCount, const Settings& settings);
+}
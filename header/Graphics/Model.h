@@ -3,6 +3,9 @@
 #include "Graphics/Transform.h"
 #include "Graphics/DX12Utilities.h"
 #include "Graphics/Materials.h"
+#include "Graphics/MeshData.h"
+#include "Graphics/TextureCook.h"
+#include "Math/Bounds.h"
 
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
@@ -10,18 +13,45 @@
 
 class Mesh;
 class Window;
+struct LodSelector;
+class MeshletCuller;
 class Renderer;
+class TextureStreamer;
 
 class Model
 {
 public:
+	//! @brief bVf[^̎擾
+	enum class ImportSource : uint8_t
+	{
+		Assimp, //!< Assimp œǂݍ
+		Gltf,   //!< glTF [_[ (GltfLoader) œǂݍ
+		Cache,  //!< bVLbVǂݍ
+	};
+
 	Model(Renderer* pRenderer, const std::wstring& filePath);
 	Model(const Model& model) = delete;
 	Model& operator=(const Model& model) = delete;
 	~Model();
 	void Update(float deltaTime);
 
-	void Draw(const Matrix4x4& viewMat, const Matrix4x4& projMat);
+	/// <summary>
+	/// `悵܂
+	/// </summary>
+	/// <param name="pMeshVisibility"> bV̉tO (GetMeshes() Ɠ, nullptr ȂSĕ`) </param>
+	/// <param name="pLodSelector"> LOD ̑I@ (nullptr ȂS LOD0) </param>
+	/// <param name="pTriangleCount"> `悵Op`Z (svȂ nullptr) </param>
+	/// <param name="pMeshletCuller"> LOD0 bVbgPʂŃJOꍇ̔@ (nullptr Ȃ烁bVŜ`) </param>
+	/// <returns> `悵bV (bVbg̃JOȂ΃h[R[Ɠ) </returns>
+	uint32_t Draw(const uint8_t* pMeshVisibility = nullptr, const LodSelector* pLodSelector = nullptr, uint64_t* pTriangleCount = nullptr,
+		MeshletCuller* pMeshletCuller = nullptr);
+
+	/// <summary>
+	/// Ă郁bṼeNX`ɂāAʏ̑傫Kvȃ~bvv܂
+	/// </summary>
+	/// <param name="view"> _Ɖʂ̑傫 (LOD ̑IƓ) </param>
+	/// <param name="pMeshVisibility"> Draw() ƓbV̉ (nullptr ȂSbV) </param>
+	void RequestTextureMips(TextureStreamer& streamer, const LodSelector& view, const uint8_t* pMeshVisibility = nullptr) const;
 
 	void SetPosition(const Vector3D& pos);
 	void SetScale(const Vector3D& scale);
@@ -29,17 +59,63 @@ public:
 	const std::string& GetName() const { return m_Name; }
 	Mesh* GetMesh(uint32_t index);
 	const std::vector<std::unique_ptr<Mesh>>& GetMeshes() const;
-	const TransformBuffer& GetTransform() const { return m_Transform; }
+	const Matrix4x4& GetWorld() const { return m_World; }
+	const ObjectTransform& GetObjectTransform() const { return m_ObjectTransform; }
+
+	//! @brief fŜ̃[J AABB
+	const AABB& GetLocalBounds() const { return m_LocalBounds; }
+	//! @brief fŜ̃[h AABB
+	const AABB& GetWorldBounds() const { return m_WorldBounds; }
+	//! @brief fŜ̃[hԋE
+	const Sphere& GetWorldSphere() const { return m_WorldSphere; }
+	//! @brief bṼ[h AABB (GetMeshes() Ɠ)
+	const std::vector<AABB>& GetMeshWorldBounds() const { return m_MeshWorldBounds; }
+	//! @brief bṼ[hԋE (GetMeshes() Ɠ)
+	const std::vector<Sphere>& GetMeshWorldSpheres() const { return m_MeshWorldSpheres; }
+	//! @brief ǂݍ݂ɂ (eNX`EGPU ւ̃Abv[h܂)
+	double GetLoadTimeMs() const { return m_LoadTimeMs; }
+	//! @brief bVf[^̎擾ɂ (AssimpEglTF [_[ł̓ǂݍ݁A܂̓LbV̓ǂݍ)
+	double GetImportTimeMs() const { return m_ImportTimeMs; }
+	//! @brief eNX`̓ǂݍ݂ɂ (fR[h GPU ւ̃Abv[hASeNX`̍v)
+	double GetTextureLoadTimeMs() const { return m_TextureLoadTimeMs; }
+	//! @brief ̃fŐVɓǂݍ񂾃eNX` (̃fœǂݍݍς݂̂̂͊܂܂Ȃ)
+	uint32_t GetTextureCount() const { return m_TextureCount; }
+	//! @brief bVf[^̎擾
+	ImportSource GetImportSource() const { return m_ImportSource; }
+	//! @brief CfbNXobt@̃TCY (oCgASbV̍v)
+	uint64_t GetIndexBufferSize() const { return m_IndexBufferSize; }
+	//! @brief 16bit CfbNXɂƂŌTCY (oCg)
+	uint64_t GetIndexBufferSaving() const { return m_IndexBufferSaving; }
+	//! @brief _ PackedVertex ŕێĂ邩 (`Ɉk_p̃pCvCXe[gKv)
+	bool IsPackedVertex() const { return m_IsPackedVertex; }
+	//! @brief bVœKO̒_LbV (SbV̍v)
+	const VertexCacheStats& GetCacheStatsBefore() const { return m_CacheStatsBefore; }
+	//! @brief bVœK̒_LbV (SbV̍v)
+	const VertexCacheStats& GetCacheStatsAfter() const { return m_CacheStatsAfter; }
+	//! @brief d_̗nڂ̌ (SbV̍v)
+	const WeldStats& GetWeldStats() const { return m_WeldStats; }
 	MaterialBuffer m_MaterialBuffer;
 	std::string m_Name;
 
 private:
-	void PerseMaterial(const aiMaterial* pSrcMat, Material& dstMat);
+	//! @brief Assimp Ńt@Cǂݍ݁AModelData ɕϊ܂
+	bool ImportFromFile(const std::string& path, ModelData& outData);
+	/// <summary>
+	/// SbV̒_ECfbNX1̃obt@ɂ܂Ƃ߂ăAbv[hAMesh 𐶐܂
+	/// </summary>
+	void CreateMeshes(const ModelData& modelData);
+	//! @brief [hs̕ύXVF[_[p̍sƋE{[ɔf
+	void UpdateWorldTransform();
+
+	void PerseMaterial(const aiMaterial* pSrcMat, MaterialData& dstMat);
 
-	void SetTextureId(const aiMaterial* pSrcMat,
-		aiString& texturePath,
+	void GetTexturePath(const aiMaterial* pSrcMat,
 		const aiTextureType& texType,
-		TextureID& texId);
+		std::string& texturePath);
+
+	//! @brief eNX` ID ݒ肵AǂݍރpXƗpr outTexturePathsEoutTextureRoles ɒǉ܂ (ǂݍ݂͌ł܂Ƃ߂čs)
+	void SetTextureId(const std::string& texturePath, TextureCook::TextureRole role, TextureID& texId,
+		std::vector<std::wstring>& outTexturePaths, std::vector<TextureCook::TextureRole>& outTextureRoles);
 
 	std::vector<std::unique_ptr<Mesh>> m_pMeshes;
 	std::vector<Material> m_Materials;
@@ -47,6 +123,25 @@ private:
 	ID3D12GraphicsCommandList* m_pCommandList = nullptr;
 	Window* m_pWindow = nullptr;
 	Renderer* m_pRenderer = nullptr;
-	TransformBuffer m_Transform;
+	Matrix4x4 m_World = Matrix4x4::Identity();
+	ObjectTransform m_ObjectTransform;
+
+	AABB m_LocalBounds;
+	AABB m_WorldBounds;
+	Sphere m_WorldSphere;
+	std::vector<AABB> m_MeshWorldBounds;
+	std::vector<Sphere> m_MeshWorldSpheres;
+
+	double m_LoadTimeMs = 0.0;
+	double m_ImportTimeMs = 0.0;
+	double m_TextureLoadTimeMs = 0.0;
+	uint32_t m_TextureCount = 0;
+	ImportSource m_ImportSource = ImportSource::Assimp;
+	bool m_IsPackedVertex = false;
+	uint64_t m_IndexBufferSize = 0;
+	uint64_t m_IndexBufferSaving = 0;
+	VertexCacheStats m_CacheStatsBefore;
+	VertexCacheStats m_CacheStatsAfter;
+	WeldStats m_WeldStats;
 	float count = 0.f;
 };
\ No newline at end of file
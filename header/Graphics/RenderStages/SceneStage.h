@@ -3,6 +3,9 @@
 #include "Graphics/RenderStage.h"
 #include "Graphics/Lights.h"
 #include "Graphics/DX12Utilities.h"
+#include "Graphics/Transform.h"
+#include "Graphics/MeshCuller.h"
+#include "Graphics/MeshletCuller.h"
 
 class Scene;
 class Camera;
@@ -28,4 +31,8 @@ private:
 	ShadowStage* m_pShadowStage = nullptr;
 	IBLBakerStage* m_IBLBakerStage = nullptr;
 	ShadowLightData m_ShadowLightData;
+	CameraBuffer m_CameraBuffer;
+	MeshCuller m_MeshCuller;
+	MeshletCuller m_MeshletCuller;
+	std::unique_ptr<DX12PipelineState> m_pPackedPSO = nullptr; //!< k_ (PackedVertex) p
 };
\ No newline at end of file
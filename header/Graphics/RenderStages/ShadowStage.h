@@ -4,6 +4,7 @@
 #include "Math/Vector3D.h"
 #include "Math/Matrix4x4.h"
 #include "Graphics/Transform.h"
+#include "Graphics/MeshCuller.h"
 
 class Scene;
 class DepthBuffer;
@@ -20,7 +21,9 @@ public:
 
 	void RecordStage(ID3D12GraphicsCommandList* pCmdList) override;
 	DepthBuffer* GetDepthBuffer() const { return m_pDepthBuffer.get(); }
-	const Matrix4x4& GetVPMat() const;
+	Matrix4x4 GetVPMat() const;
+	//! @brief Cg̐ˉes
+	Matrix4x4 GetProj() const;
 	const Vector3D& GetLightDir() const;
 
 private:
@@ -40,4 +43,6 @@ private:
 	float m_LightDistance = 50.0f;// CgJƒ_̋
 	float lightY = -45.0f;
 	float lightX = 50.0f;
+	MeshCuller m_CasterCuller;
+	std::unique_ptr<DX12PipelineState> m_pPackedPSO = nullptr; //!< k_ (PackedVertex) p
 };
\ No newline at end of file
@@ -1,15 +1,81 @@
 #pragma once
 #include "pch.h"
+#include "Graphics/TextureCook.h"
+#include "Graphics/TextureStreamer.h"
 
 class DX12DescriptorHeap;
 class Renderer;
 
+/// <summary>
+/// GPU ɓ]Ỏ摜 (t@C̓ǂݍ݁EfR[ȟ)
+/// </summary>
+struct TextureImage
+{
+	DirectX::TexMetadata MetaData = {};
+	DirectX::ScratchImage Image;
+	bool IsCooked = false; //!< TextureCooker ŕϊς݂ DDS (tH[}bĝ܂܎g)
+	TextureCook::TextureRole Role = TextureCook::TextureRole::Color; //!< ϊĂȂ摜 sRGB œǂނE~bvǂς邩߂
+};
+
 class Texture
 {
 public:
+	//! @brief pr̓t@C琄܂ (TextureCook::GuessRoleFromName)
 	Texture(Renderer* pRenderer, const std::wstring& filePath, D3D12_RESOURCE_FLAGS flag = D3D12_RESOURCE_FLAG_NONE);
+	/// <summary>
+	/// fR[hς݂̉摜烊\[X쐬A]R}h pCommandList ɋL^܂
+	/// R}h̊҂܂ŃAbv[hpobt@ێ̂ŁA҂ ReleaseUploadBuffer() Ăł
+	/// </summary>
+	/// <param name="firstMip"> \[XɊ܂߂łׂ~bv (Xg[~Oōׂ~bvォǂݍޏꍇ) </param>
+	Texture(Renderer* pRenderer, const TextureImage& image, ID3D12GraphicsCommandList* pCommandList,
+		D3D12_RESOURCE_FLAGS flag = D3D12_RESOURCE_FLAG_NONE, uint32_t firstMip = 0);
 	~Texture();
 
+	/// <summary>
+	/// 摜t@CǂݍŃfR[h܂ (GPU gȂ̂Ń[J[XbhĂׂ܂)
+	/// ϊς݂ DDS ΂ǂݍ݁AȂ΃~bv̂Ȃ摜Ƀ~bv܂
+	/// </summary>
+	/// <param name="role"> pr (TextureCooker ƓAF sRGB Ƃēǂ݁A~bvɍ킹č܂) </param>
+	/// <param name="mipFilter"> ~bvktB^ (Kaiser ̕ڂɂAǂݍ݂͔{قǒxȂ) </param>
+	/// <param name="isParallel"> ~bv̍쐬𕡐Xbhōs (̉摜ɃfR[hꍇ false) </param>
+	static HRESULT Decode(const std::wstring& filePath, TextureCook::TextureRole role, MipGenerator::Filter mipFilter, TextureImage& outImage,
+		bool isParallel = true);
+
+	/// <summary>
+	/// ̃eNX`܂Ƃ߂č쐬܂
+	/// fR[h̓[J[XbhŕɍsA]1̃R}hXgɂ܂Ƃ߂1񂾂҂܂
+	/// </summary>
+	/// <param name="streamingTailSize"> 0 ȊOȂ~bvXg[~OłeNX`͒ӂ̑傫ȉ̃~bvǂݍ݁A
+	/// c̃~bv̂߂ɉ摜ێ܂ (TextureStreamer::Settings::TailSize) </param>
+	/// <param name="roles"> filePaths Ɠ̗pr </param>
+	/// <param name="mipFilters"> filePaths Ɠ́A~bvktB^ (~bv̂Ȃ摜Ɏg܂) </param>
+	/// <returns> filePaths Ɠ̃eNX` </returns>
+	static std::vector<std::unique_ptr<Texture>> CreateFromFiles(Renderer* pRenderer, const std::vector<std::wstring>& filePaths,
+		const std::vector<TextureCook::TextureRole>& roles, const std::vector<MipGenerator::Filter>& mipFilters, uint32_t streamingTailSize = 0);
+
+	//! @brief ]̊ɃAbv[hpobt@j܂
+	void ReleaseUploadBuffer() { m_pUploadResource.Reset(); }
+
+	//! @brief ~bvXg[~O邽߂ɉ摜ێĂ邩
+	bool IsStreamable() const { return m_StreamImage.Image.GetImageCount() > 0; }
+	//! @brief ~bv 0 ̕ (Xg[~OeNX`̂)
+	uint32_t GetWidth() const { return static_cast<uint32_t>(m_StreamImage.MetaData.width); }
+	//! @brief ~bv 0 ̍ (Xg[~OeNX`̂)
+	uint32_t GetHeight() const { return static_cast<uint32_t>(m_StreamImage.MetaData.height); }
+	//! @brief e~bṽoCg (Xg[~OeNX`̂)
+	std::vector<uint64_t> GetMipSizes() const;
+	TextureStreamer::Handle GetStreamHandle() const { return m_StreamHandle; }
+	void SetStreamHandle(TextureStreamer::Handle handle) { m_StreamHandle = handle; }
+	//! @brief \[XɊ܂܂Ăłׂ~bv
+	uint32_t GetResidentMip() const { return m_ResidentMip; }
+
+	/// <summary>
+	/// 풓~bvύX܂ (Xg[~OeNX`̂)
+	/// \[X residentMip ̃~bvō蒼ē]R}h pCommandList ɋL^ASRV ͓ԍ̂܂܍ւ܂
+	/// Õ\[X͔ĵŁAGPU Õ\[XgIĂĂł
+	/// </summary>
+	void SetResidentMip(Renderer* pRenderer, uint32_t residentMip, ID3D12GraphicsCommandList* pCommandList);
+
 	uint32_t GetSRVIndex() const { return srvIndex; }
 	ComPtr<ID3D12Resource> GetResource() const { return m_pResource; }
 	ID3D12Resource* GetResourcePtr() const { return m_pResource.Get(); }
@@ -17,13 +83,18 @@ public:
 	D3D12_GPU_VIRTUAL_ADDRESS GetGPULocation() const;
 
 private:
+	void CreateResource(Renderer* pRenderer, const TextureImage& image, ID3D12GraphicsCommandList* pCommandList, D3D12_RESOURCE_FLAGS flag,
+		uint32_t firstMip);
 	D3D12_SHADER_RESOURCE_VIEW_DESC GetViewDesc(D3D12_RESOURCE_DESC desc);
 	ComPtr<ID3D12Resource> m_pResource = nullptr;
 	ComPtr<ID3D12Resource> m_pUploadResource = nullptr;
 	uint32_t srvIndex = 0;
 	DX12DescriptorHeap* SRVHeap = nullptr;
+	TextureImage m_StreamImage; //!< Xg[~OpɕێS~bv̉摜
+	TextureStreamer::Handle m_StreamHandle = TextureStreamer::InvalidHandle;
+	uint32_t m_ResidentMip = 0;
 
-	std::wstring FileExtension(const std::wstring& filePath);
-	std::wstring ExChangeFileExtension(const std::wstring& filePath);
+	static std::wstring FileExtension(const std::wstring& filePath);
+	static std::wstring ExChangeFileExtension(const std::wstring& filePath);
 	std::unordered_map<std::wstring, Texture*> m_pTextures;
 };
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include "Graphics/MipGenerator.h"
+
+/// <summary>
+/// ItCŕϊeNX` (BC kE~bvt DDS) ̒uꏊƗpr̔
+/// ϊ tools/TextureCooker ōsAs Texture 摜̑ɕϊʂǂݍ݂܂
+/// ϊʂ͌摜̓ẽnbVŊǗ̂ŁA摜XVƌÂϊʂ͎gȂȂ܂
+/// pch.h  DirectXTex ɈˑȂ̂ŁAc[g܂
+/// </summary>
+namespace TextureCook
+{
+	//! ϊ̋K̃o[W (pr̔Ek`E~bv̍ςグĂ)
+	constexpr uint32_t Version = 3;
+	//! ϊʂutH_̖O (摜ƓtH_ɍ܂)
+	constexpr const wchar_t* CookedDirName = L"cooked";
+
+	/// <summary>
+	/// eNX`̗pr (k` sRGB ǂ߂܂)
+	/// </summary>
+	enum class TextureRole : uint8_t
+	{
+		Color,  //!< F (BC7 sRGB)
+		Normal, //!< @}bv (BC5AZ ̓VF[_[ŕ܂)
+		Mask,   //!< tlXEAO Ȃǂ̐`Ȓl (O[XP[Ȃ BC4AȊO BC1)
+	};
+
+	const char* GetRoleName(TextureRole role);
+
+	//! @brief sRGB ƂĈpr (FB@E}XN UNORM ̂܂ܓǂ)
+	inline bool IsSRGB(TextureRole role) { return role == TextureRole::Color; }
+
+	/// <summary>
+	/// prɍ킹ă~bv𕽋ς (TextureCooker ƁAϊĂȂ摜̃~bv̍쐬ŋ)
+	/// </summary>
+	MipGenerator::Content GetMipContent(TextureRole role);
+
+	/// <summary>
+	/// ϊĂȂ摜̃~bvsɍktB^̊l (Renderer::SetMipFilter ŗprɕύXł܂)
+	/// F Kaiser łڂɂA@E}XÑ͕[uŒls߂Ȃ悤 Box ŕς܂
+	/// </summary>
+	inline MipGenerator::Filter GetDefaultMipFilter(TextureRole role)
+	{
+		return role == TextureRole::Color ? MipGenerator::Filter::Kaiser : MipGenerator::Filter::Box;
+	}
+
+	//! @brief ϊ̑ΏۂɂȂ摜 (gqŔAHDREDDS ͑ΏۊO)
+	bool IsCookable(const std::wstring& filePath);
+
+	/// <summary>
+	/// 摜̓e Version ϊʂʂL[܂
+	/// </summary>
+	/// <returns> 摜ǂ߂Ȃꍇ false </returns>
+	bool MakeKey(const std::wstring& sourcePath, uint64_t& outKey);
+
+	/// <summary>
+	/// ϊʂ̃pX (摜̃tH_/cooked/O_L[.dds)
+	/// </summary>
+	std::wstring GetCookedPath(const std::wstring& sourcePath, uint64_t key);
+
+	/// <summary>
+	/// 摜ɑΉŐV̕ϊʂT܂
+	/// </summary>
+	/// <returns> ϊʂ̃pX (ȂA摜XVĂ΋) </returns>
+	std::wstring FindCooked(const std::wstring& sourcePath);
+
+	/// <summary>
+	/// t@Cpr𐄑܂ (_normalE_roughness ȂǁAȂ Color)
+	/// }eAprȂ摜Ɏg܂
+	/// </summary>
+	TextureRole GuessRoleFromName(const std::wstring& filePath);
+
+	/// <summary>
+	/// glTF ̃}eAAQƂĂ摜̗prW߂܂
+	/// sƓ摜̓t@Cŋʂ̂ŁAL[͏̃t@Cł
+	/// ɓo^Ă摜͏㏑܂
+	/// </summary>
+	/// <returns> ǂݍ߂Ȃꍇ false </returns>
+	bool CollectRoles(const std::wstring& modelPath, std::unordered_map<std::wstring, TextureRole>& roles);
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// eNX`̃~bvǂ܂ŏ풓邩߂XPW[ (GPU Ɉˑ܂)
+/// ŏ͏~bv (e[) 풓A`ŗvꂽ~bv1iׂĂ܂
+/// 풓~bv̍v\Z𒴂ꍇ́AłgĂȂeNX` (LRU) ׂ~bv̂Ă܂
+/// ߂ʂ Update() ̖߂lƂĕԂ̂ŁA\[X̍蒼͌Ăяoōs܂
+/// </summary>
+class TextureStreamer
+{
+public:
+	using Handle = uint32_t;
+	static constexpr Handle InvalidHandle = ~0u;
+
+	/// <summary>
+	/// Xg[~O̐ݒ
+	/// </summary>
+	struct Settings
+	{
+		uint64_t BudgetBytes = 256ull * 1024 * 1024;          //!< 풓~bv̍v̏ (e[͗\Z𒴂Ă풓܂)
+		uint64_t MaxUploadBytesPerFrame = 16ull * 1024 * 1024; //!< 1t[œǂݍރ~bv̍v̏ (Œ1i͓ǂݍ݂܂)
+		uint32_t TailSize = 128;                               //!< ӂ̃sNZȉ̃~bv͏ɏ풓
+		float MipBias = 0.0f;                                  //!< v~bv̂炵 (őeAōׂ)
+	};
+
+	/// <summary>
+	/// 풓~bv̕ύX (̔ԍׂ~bvȂ悤Ƀ\[X蒼܂)
+	/// </summary>
+	struct Change
+	{
+		Handle Texture;
+		uint32_t ResidentMip; //!< 풓łׂ~bv
+	};
+
+	/// <summary>
+	/// O Update() ̌
+	/// </summary>
+	struct Stats
+	{
+		uint32_t TextureCount = 0;    //!< o^ĂeNX`
+		uint64_t ResidentBytes = 0;   //!< 풓Ă~bv̍v
+		uint64_t UploadedBytes = 0;   //!< ̃t[œǂݍ񂾃~bv̍v
+		uint32_t LoadedMips = 0;      //!< ̃t[œǂݍ񂾃~bv
+		uint32_t EvictedMips = 0;     //!< ̃t[Ŏ̂Ă~bv
+		uint32_t PendingTextures = 0; //!< ve~bv풓ĂȂeNX`
+	};
+
+	//! @brief e[Ƃčŏ풓łׂ~bv
+	static uint32_t GetTailMip(uint32_t width, uint32_t height, uint32_t mipCount, uint32_t tailSize);
+
+	/// <summary>
+	/// ʏ̑傫Kvȃ~bv߂܂ (̓~bvԂ̕Ԃ̊)
+	/// </summary>
+	/// <param name="width"> eNX`̕ (~bv 0) </param>
+	/// <param name="height"> eNX`̍ (~bv 0) </param>
+	/// <param name="uvDensity"> bṼ[JԂ̒ 1  UV ̕ω (MeshData::ComputeUvDensity()) </param>
+	/// <param name="pixelsPerLocalUnit"> bṼ[JԂ̒ 1 ʏŉsNZɂȂ邩 </param>
+	static float ComputeMipLevel(uint32_t width, uint32_t height, float uvDensity, float pixelsPerLocalUnit);
+
+	void SetSettings(const Settings& settings) { m_Settings = settings; }
+	const Settings& GetSettings() const { return m_Settings; }
+
+	/// <summary>
+	/// eNX`o^܂ (e[܂ł풓ĂԂn߂܂)
+	/// </summary>
+	/// <param name="mipSizes"> e~bṽoCg (擪~bv 0) </param>
+	Handle Register(uint32_t width, uint32_t height, const std::vector<uint64_t>& mipSizes);
+
+	//! @brief 풓Ăłׂ~bv
+	uint32_t GetResidentMip(Handle handle) const { return m_Entries[handle].ResidentMip; }
+	//! @brief ɏ풓łׂ~bv
+	uint32_t GetTailMip(Handle handle) const { return m_Entries[handle].TailMip; }
+
+	/// <summary>
+	/// ̃t[ŕKvȃ~bvv܂ (eNX`ւ̗v͍łׂ̂g܂)
+	/// </summary>
+	/// <param name="mipLevel"> ComputeMipLevel() ̌ </param>
+	void Request(Handle handle, float mipLevel);
+
+	/// <summary>
+	/// vƗ\Zǂݍ݁Ej~bv߁At[i߂܂
+	/// </summary>
+	/// <returns> 풓~bvςeNX` ( Update() ܂ŗL) </returns>
+	const std::vector<Change>& Update();
+
+	//! @brief O Update() ŏ풓~bvςeNX`
+	const std::vector<Change>& GetChanges() const { return m_Changes; }
+	const Stats& GetStats() const { return m_Stats; }
+
+private:
+	struct Entry
+	{
+		std::vector<uint64_t> MipSizes;
+		uint32_t TailMip = 0;
+		uint32_t ResidentMip = 0;
+		uint32_t RequestedMip = 0; //!< ̃t[ŗvꂽłׂ~bv (vȂ TailMip)
+		uint64_t LastUsedFrame = 0;
+		bool IsChanged = false;
+	};
+
+	/// <summary>
+	/// exclude ȊÕeNX`ÂĂ~bv LRU 1iIŎ̂Ă܂
+	/// </summary>
+	/// <param name="isNeededEvictable"> ̃t[ŗvꂽ~bv̂ĂĂ悢 (\ZɎ܂Ȃꍇ̍Ō̎i) </param>
+	bool EvictOne(Handle exclude, bool isNeededEvictable);
+
+	Settings m_Settings;
+	std::vector<Entry> m_Entries;
+	std::vector<Change> m_Changes;
+	Stats m_Stats;
+	uint64_t m_Frame = 1;
+	uint64_t m_ResidentBytes = 0;
+};
@@ -1,5 +1,7 @@
 #pragma once
+#include <malloc.h>
 #include "Math/Matrix4x4.h"
+#include "Math/Matrix3x4.h"
 #include "Math/Quaternion.h"
 
 struct alignas(256) TransformBuffer
@@ -34,6 +36,19 @@ public:
 	}
 };
 
+//! @brief f`p̃IuWFNg̕ϊ ([g萔 48 oCg)
+struct ObjectTransform
+{
+	Matrix3x4 World; // [hϊs (HLSL  row_major float3x4)
+};
+
+//! @brief t[1xmۂJϊ
+struct CameraBuffer
+{
+	Matrix4x4 View = Matrix4x4::Identity();  // r[ϊs
+	Matrix4x4 Proj = Matrix4x4::Identity();  // vWFNVϊs
+};
+
 class Transform
 {
 public:
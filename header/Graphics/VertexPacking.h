@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "Graphics/MeshData.h"
+#include "Math/Bounds.h"
+
+/// <summary>
+/// k_ (16 oCgAVertex  44 oCg)
+/// ʒu̓bV AABB  16bit ŗʎqA@Ɛڐ͔ʑ̎ʑ 8bit x 2 ɁAUV ͔x_ɂ܂
+/// </summary>
+struct PackedVertex
+{
+	uint16_t Position[4];     //!< AABB ̈ʒu (R16G16B16A16_UNORM)Aw ͐ڋԂ̌ (0: -1, 65535: +1)
+	int8_t NormalTangent[4];  //!< ʑ̎ʑ@ (xy) Ɛڐ (zw) (R8G8B8A8_SNORM)
+	uint16_t TexCoord[2];     //!< UV (R16G16_FLOAT)
+};
+static_assert(sizeof(PackedVertex) == 16, "PackedVertex must be 16 bytes");
+
+/// <summary>
+/// kʒuɖ߂߂̒l (VF[_[փ[g萔Ƃēn܂)
+/// ʒu = Offset + ʎql (0`1) * Scale
+/// </summary>
+struct PositionQuantization
+{
+	Vector3D Offset;
+	float Padding0 = 0.0f;
+	Vector3D Scale;
+	float Padding1 = 0.0f;
+
+	//! @brief AABB Ŝʎq͈̔͂ɂ܂
+	static PositionQuantization FromBounds(const AABB& bounds)
+	{
+		PositionQuantization quantization;
+		quantization.Offset = bounds.Min;
+		quantization.Scale = bounds.Max - bounds.Min;
+		return quantization;
+	}
+};
+static_assert(sizeof(PositionQuantization) == sizeof(float) * 8, "PositionQuantization must be 8 floats");
+
+/// <summary>
+/// Vertex  PackedVertex ̕ϊ
+/// 4 _ MathSIMD ŌvZAŌ̐Exւ̕ϊXJ[ōs܂
+/// </summary>
+namespace VertexPacking
+{
+	/// <summary>
+	/// _k܂
+	/// </summary>
+	/// <param name="pSrc"> ̒_ </param>
+	/// <param name="count"> _ </param>
+	/// <param name="quantization"> ʒu̗ʎq͈ (S_܂ނ) </param>
+	/// <param name="pDst"> o͐ (count ̗̈AAbv[hobt@֒ڏ߂܂) </param>
+	void Encode(const Vertex* pSrc, size_t count, const PositionQuantization& quantization, PackedVertex* pDst);
+
+	/// <summary>
+	/// k_ɖ߂܂ (VF[_[̓WJƓvZł)
+	/// </summary>
+	void Decode(const PackedVertex* pSrc, size_t count, const PositionQuantization& quantization, Vertex* pDst);
+
+	//! @brief Px甼x֕ϊ (ŋߐڋւ̊ۂ)
+	uint16_t FloatToHalf(float value);
+	//! @brief xPx֕ϊ
+	float HalfToFloat(uint16_t value);
+}
@@ -0,0 +1,619 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cfloat>
+#include <cmath>
+#include <algorithm>
+#include "Vector3D.h"
+#include "Matrix4x4.h"
+#include "MathSIMD.h"
+
+// =======================
+// oEfBO{[ (AABBEEOBB) Ǝ
+// s Matrix4x4 ƓsxNg (v * M) KANbvԂ z  D3D Ɠ 0`1 ł
+// =======================
+
+//! @brief  (NormalEp + D = 0ANormal ͐Kς)
+struct Plane
+{
+    Vector3D Normal = Vector3D(0.0f, 1.0f, 0.0f);
+    float D = 0.0f;
+
+    //! @brief ʂ̌W琶 (@̒ŐK܂)
+    static Plane FromCoefficients(float a, float b, float c, float d) noexcept
+    {
+        const float len = std::sqrt(a * a + b * b + c * c);
+        const float inv = len > SMALL_NUMBER ? 1.0f / len : 0.0f;
+        Plane plane;
+        plane.Normal = Vector3D(a * inv, b * inv, c * inv);
+        plane.D = d * inv;
+        return plane;
+    }
+
+    //! @brief t (@)
+    float GetDistance(const Vector3D& point) const noexcept
+    {
+        return Normal.dot(point) + D;
+    }
+};
+
+//! @brief sE{bNX (Ԃ͋)
+struct AABB
+{
+    Vector3D Min = Vector3D(FLT_MAX);
+    Vector3D Max = Vector3D(-FLT_MAX);
+
+    static AABB FromMinMax(const Vector3D& min, const Vector3D& max) noexcept
+    {
+        AABB box;
+        box.Min = min;
+        box.Max = max;
+        return box;
+    }
+
+    static AABB FromCenterExtents(const Vector3D& center, const Vector3D& extents) noexcept
+    {
+        return FromMinMax(center - extents, center + extents);
+    }
+
+    bool IsValid() const noexcept
+    {
+        return Min.x <= Max.x && Min.y <= Max.y && Min.z <= Max.z;
+    }
+
+    Vector3D GetCenter() const noexcept
+    {
+        return (Min + Max) * 0.5f;
+    }
+
+    //! @brief Seʂ܂ł̋ (TCY̔)
+    Vector3D GetExtents() const noexcept
+    {
+        return (Max - Min) * 0.5f;
+    }
+
+    void Expand(const Vector3D& point) noexcept
+    {
+        Min = Vector3D((std::min)(Min.x, point.x), (std::min)(Min.y, point.y), (std::min)(Min.z, point.z));
+        Max = Vector3D((std::max)(Max.x, point.x), (std::max)(Max.y, point.y), (std::max)(Max.z, point.z));
+    }
+
+    void Merge(const AABB& box) noexcept
+    {
+        Min = Vector3D((std::min)(Min.x, box.Min.x), (std::min)(Min.y, box.Min.y), (std::min)(Min.z, box.Min.z));
+        Max = Vector3D((std::max)(Max.x, box.Max.x), (std::max)(Max.y, box.Max.y), (std::max)(Max.z, box.Max.z));
+    }
+
+    bool Contains(const Vector3D& point) const noexcept
+    {
+        return point.x >= Min.x && point.x <= Max.x
+            && point.y >= Min.y && point.y <= Max.y
+            && point.z >= Min.z && point.z <= Max.z;
+    }
+
+    bool Intersects(const AABB& box) const noexcept
+    {
+        return Min.x <= box.Max.x && Max.x >= box.Min.x
+            && Min.y <= box.Max.y && Max.y >= box.Min.y
+            && Min.z <= box.Max.z && Max.z >= box.Min.z;
+    }
+
+    // =======================
+    // _W̔z񂩂 AABB ߂
+    // positions ͐擪vf x wAevf stride oCgԊuŕł̂Ƃ܂
+    // (Vertex zȂǂWǂݎ܂)
+    // =======================
+    static AABB FromPoints(const float* positions, size_t count, size_t stride) noexcept
+    {
+        AABB box;
+        if (positions == nullptr || count == 0)
+        {
+            return box;
+        }
+        const uint8_t* base = reinterpret_cast<const uint8_t*>(positions);
+        auto at = [base, stride](size_t i) { return reinterpret_cast<const float*>(base + i * stride); };
+
+#if defined(MATH_SIMD_SSE) || defined(MATH_SIMD_NEON)
+        // 4vf[h w ɂׂ͗̒l邪AŌ xyz ôŖȂ
+        // Ō̗vf͔͈͊Oǂ܂Ȃ悤ʂɃ[h
+        const float* last = at(count - 1);
+        MathSIMD::float4 minA = MathSIMD::Set(last[0], last[1], last[2], 0.0f);
+        MathSIMD::float4 maxA = minA;
+        MathSIMD::float4 minB = minA;
+        MathSIMD::float4 maxB = minA;
+        size_t i = 0;
+        for (; i + 2 < count; i += 2)
+        {
+            const MathSIMD::float4 p0 = MathSIMD::Load(at(i));
+            const MathSIMD::float4 p1 = MathSIMD::Load(at(i + 1));
+            minA = MathSIMD::Min(minA, p0);
+            maxA = MathSIMD::Max(maxA, p0);
+            minB = MathSIMD::Min(minB, p1);
+            maxB = MathSIMD::Max(maxB, p1);
+        }
+        for (; i + 1 < count; ++i)
+        {
+            const MathSIMD::float4 p = MathSIMD::Load(at(i));
+            minA = MathSIMD::Min(minA, p);
+            maxA = MathSIMD::Max(maxA, p);
+        }
+        float outMin[4], outMax[4];
+        MathSIMD::Store(outMin, MathSIMD::Min(minA, minB));
+        MathSIMD::Store(outMax, MathSIMD::Max(maxA, maxB));
+        box.Min = Vector3D(outMin[0], outMin[1], outMin[2]);
+        box.Max = Vector3D(outMax[0], outMax[1], outMax[2]);
+#else
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float* p = at(i);
+            box.Expand(Vector3D(p[0], p[1], p[2]));
+        }
+#endif
+        return box;
+    }
+
+    static AABB FromPoints(const Vector3D* points, size_t count) noexcept
+    {
+        return FromPoints(count > 0 ? &points[0].x : nullptr, count, sizeof(Vector3D));
+    }
+
+    // =======================
+    // sŕϊ AABB ߂ (J. Arvo ̕@)
+    // ]̔ AABB  8 _̕ϊȂŋ߂܂
+    // =======================
+    static AABB Transform(const AABB& box, const Matrix4x4& matrix) noexcept
+    {
+        if (!box.IsValid())
+        {
+            return box;
+        }
+        const Vector3D center = Matrix4x4::Apply(matrix, box.GetCenter());
+        const Vector3D extents = box.GetExtents();
+        const auto& m = matrix.m_mat;
+        const Vector3D newExtents(
+            std::fabs(m[0][0]) * extents.x + std::fabs(m[1][0]) * extents.y + std::fabs(m[2][0]) * extents.z,
+            std::fabs(m[0][1]) * extents.x + std::fabs(m[1][1]) * extents.y + std::fabs(m[2][1]) * extents.z,
+            std::fabs(m[0][2]) * extents.x + std::fabs(m[1][2]) * extents.y + std::fabs(m[2][2]) * extents.z);
+        return FromCenterExtents(center, newExtents);
+    }
+};
+
+//! @brief E
+struct Sphere
+{
+    Vector3D Center = Vector3D();
+    float Radius = 0.0f;
+
+    static Sphere FromAABB(const AABB& box) noexcept
+    {
+        Sphere sphere;
+        sphere.Center = box.GetCenter();
+        sphere.Radius = box.GetExtents().length();
+        return sphere;
+    }
+
+    //! @brief AABB ̒S𒆐SƂAS_܂ލŏ̔a߂܂ (Ίp菬Ȃ܂)
+    static Sphere FromPoints(const float* positions, size_t count, size_t stride, const AABB& bounds) noexcept
+    {
+        Sphere sphere;
+        if (positions == nullptr || count == 0)
+        {
+            return sphere;
+        }
+        sphere.Center = bounds.GetCenter();
+        const uint8_t* base = reinterpret_cast<const uint8_t*>(positions);
+        float maxDistSq = 0.0f;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float* p = reinterpret_cast<const float*>(base + i * stride);
+            const float dx = p[0] - sphere.Center.x;
+            const float dy = p[1] - sphere.Center.y;
+            const float dz = p[2] - sphere.Center.z;
+            maxDistSq = (std::max)(maxDistSq, dx * dx + dy * dy + dz * dz);
+        }
+        sphere.Radius = std::sqrt(maxDistSq);
+        return sphere;
+    }
+
+    bool Intersects(const Sphere& sphere) const noexcept
+    {
+        const float r = Radius + sphere.Radius;
+        const Vector3D d = Center - sphere.Center;
+        return d.dot(d) <= r * r;
+    }
+
+    //! @brief s̍ő̎XP[ (ϊ̔a̔{)
+    static float GetMaxScale(const Matrix4x4& matrix) noexcept
+    {
+        const auto& m = matrix.m_mat;
+        const float sx = m[0][0] * m[0][0] + m[0][1] * m[0][1] + m[0][2] * m[0][2];
+        const float sy = m[1][0] * m[1][0] + m[1][1] * m[1][1] + m[1][2] * m[1][2];
+        const float sz = m[2][0] * m[2][0] + m[2][1] * m[2][1] + m[2][2] * m[2][2];
+        return std::sqrt((std::max)((std::max)(sx, sy), sz));
+    }
+
+    //! @brief sŕϊ (a͍ő̎XP[Ŋg債܂)
+    static Sphere Transform(const Sphere& sphere, const Matrix4x4& matrix) noexcept
+    {
+        Sphere out;
+        out.Center = Matrix4x4::Apply(matrix, sphere.Center);
+        out.Radius = sphere.Radius * GetMaxScale(matrix);
+        return out;
+    }
+};
+
+//! @brief LE{bNX (Axis ͐Kς݂̋Ǐ)
+struct OBB
+{
+    Vector3D Center = Vector3D();
+    Vector3D Extents = Vector3D();
+    Vector3D Axis[3] = { Vector3D(1.0f, 0.0f, 0.0f), Vector3D(0.0f, 1.0f, 0.0f), Vector3D(0.0f, 0.0f, 1.0f) };
+
+    //! @brief [JԂ AABB sŕϊ OBB (f͍l܂)
+    static OBB FromAABB(const AABB& box, const Matrix4x4& matrix) noexcept
+    {
+        OBB obb;
+        obb.Center = Matrix4x4::Apply(matrix, box.GetCenter());
+        const Vector3D extents = box.GetExtents();
+        const float e[3] = { extents.x, extents.y, extents.z };
+        float scaled[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            const Vector3D axis(matrix.m_mat[i][0], matrix.m_mat[i][1], matrix.m_mat[i][2]);
+            const float len = axis.length();
+            obb.Axis[i] = len > SMALL_NUMBER ? axis * (1.0f / len) : obb.Axis[i];
+            scaled[i] = e[i] * len;
+        }
+        obb.Extents = Vector3D(scaled[0], scaled[1], scaled[2]);
+        return obb;
+    }
+
+    //! @brief OBB  AABB
+    AABB GetAABB() const noexcept
+    {
+        const Vector3D extents(
+            std::fabs(Axis[0].x) * Extents.x + std::fabs(Axis[1].x) * Extents.y + std::fabs(Axis[2].x) * Extents.z,
+            std::fabs(Axis[0].y) * Extents.x + std::fabs(Axis[1].y) * Extents.y + std::fabs(Axis[2].y) * Extents.z,
+            std::fabs(Axis[0].z) * Extents.x + std::fabs(Axis[1].z) * Extents.y + std::fabs(Axis[2].z) * Extents.z);
+        return AABB::FromCenterExtents(Center, extents);
+    }
+};
+
+// =======================
+// 
+// eʂ̖@͓Ă܂
+// ͕ێI (̊pt߂ŊÔ̕Ɣ肷邱Ƃ܂)
+// =======================
+struct Frustum
+{
+    enum PlaneIndex
+    {
+        Left,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far,
+        PlaneCount,
+    };
+
+    Plane Planes[PlaneCount];
+
+    // =======================
+    // r[EvWFNVs񂩂畽ʂ𒊏o (Gribb / Hartmann ̕@)
+    // clip = v * M Ȃ̂ŁAxNg c_j = (M[0][j], M[1][j], M[2][j], M[3][j]) g܂
+    //   : c3 + c0  E: c3 - c0  : c3 + c1  : c3 - c1  : c2 (0 <= z)  : c3 - c2
+    // =======================
+    static Frustum FromViewProj(const Matrix4x4& viewProj) noexcept
+    {
+        const auto& m = viewProj.m_mat;
+        // c3 + s * cj
+        auto combine = [&m](int j, float s)
+            {
+                return Plane::FromCoefficients(
+                    m[0][3] + s * m[0][j],
+                    m[1][3] + s * m[1][j],
+                    m[2][3] + s * m[2][j],
+                    m[3][3] + s * m[3][j]);
+            };
+        Frustum frustum;
+        frustum.Planes[Left] = combine(0, 1.0f);
+        frustum.Planes[Right] = combine(0, -1.0f);
+        frustum.Planes[Bottom] = combine(1, 1.0f);
+        frustum.Planes[Top] = combine(1, -1.0f);
+        frustum.Planes[Near] = Plane::FromCoefficients(m[0][2], m[1][2], m[2][2], m[3][2]);
+        frustum.Planes[Far] = combine(2, -1.0f);
+        return frustum;
+    }
+
+    //! @brief w肵ʂ𔻒肩O܂ (ɓƂȂ镽ʂɒu܂)
+    void RemovePlane(PlaneIndex index) noexcept
+    {
+        Planes[index].Normal = Vector3D(0.0f, 0.0f, 0.0f);
+        Planes[index].D = FLT_MAX;
+    }
+
+    bool Contains(const Vector3D& point) const noexcept
+    {
+        for (const auto& plane : Planes)
+        {
+            if (plane.GetDistance(point) < 0.0f) return false;
+        }
+        return true;
+    }
+
+    bool Intersects(const AABB& box) const noexcept
+    {
+        const Vector3D center = box.GetCenter();
+        const Vector3D extents = box.GetExtents();
+        for (const auto& plane : Planes)
+        {
+            const float d = plane.GetDistance(center);
+            const float r = std::fabs(plane.Normal.x) * extents.x + std::fabs(plane.Normal.y) * extents.y + std::fabs(plane.Normal.z) * extents.z;
+            if (d + r < 0.0f) return false;
+        }
+        return true;
+    }
+
+    bool Intersects(const Sphere& sphere) const noexcept
+    {
+        for (const auto& plane : Planes)
+        {
+            if (plane.GetDistance(sphere.Center) + sphere.Radius < 0.0f) return false;
+        }
+        return true;
+    }
+
+    bool Intersects(const OBB& obb) const noexcept
+    {
+        for (const auto& plane : Planes)
+        {
+            const float d = plane.GetDistance(obb.Center);
+            const float r = std::fabs(plane.Normal.dot(obb.Axis[0])) * obb.Extents.x
+                + std::fabs(plane.Normal.dot(obb.Axis[1])) * obb.Extents.y
+                + std::fabs(plane.Normal.dot(obb.Axis[2])) * obb.Extents.z;
+            if (d + r < 0.0f) return false;
+        }
+        return true;
+    }
+
+    // =======================
+    // SIMD ɂꊇ
+    // ߂l̃rbg i Ă i Ԗڂƌ () Ă܂
+    // =======================
+    int IntersectsAABB4(const AABB* boxes) const noexcept;
+    int IntersectsSphere4(const Sphere* spheres) const noexcept;
+    int IntersectsAABB8(const AABB* boxes) const noexcept;
+    int IntersectsSphere8(const Sphere* spheres) const noexcept;
+
+    //! @brief count  AABB 𔻒肵Avisible[i]  0/1 ݂܂
+    //! @return ̌
+    size_t CullAABBs(const AABB* boxes, size_t count, uint8_t* visible) const noexcept;
+    //! @brief count ̋𔻒肵Avisible[i]  0/1 ݂܂
+    //! @return ̌
+    size_t CullSpheres(const Sphere* spheres, size_t count, uint8_t* visible) const noexcept;
+};
+
+namespace BoundsSIMD
+{
+    using MathSIMD::float4;
+
+    // ʂƂɌWƖ@̐ΒlWJ
+    struct FrustumPlanes4
+    {
+        float4 nx[Frustum::PlaneCount], ny[Frustum::PlaneCount], nz[Frustum::PlaneCount], d[Frustum::PlaneCount];
+        float4 ax[Frustum::PlaneCount], ay[Frustum::PlaneCount], az[Frustum::PlaneCount];
+
+        explicit FrustumPlanes4(const Frustum& frustum) noexcept
+        {
+            for (int i = 0; i < Frustum::PlaneCount; ++i)
+            {
+                const Plane& p = frustum.Planes[i];
+                nx[i] = MathSIMD::Splat(p.Normal.x);
+                ny[i] = MathSIMD::Splat(p.Normal.y);
+                nz[i] = MathSIMD::Splat(p.Normal.z);
+                d[i] = MathSIMD::Splat(p.D);
+                ax[i] = MathSIMD::Splat(std::fabs(p.Normal.x));
+                ay[i] = MathSIMD::Splat(std::fabs(p.Normal.y));
+                az[i] = MathSIMD::Splat(std::fabs(p.Normal.z));
+            }
+        }
+    };
+
+    //! @brief ʂ܂ł̕t (Plane::GetDistance Ɠɑ̂ŁACull ̒[XJ[Ŕ肵ĂE̔肪ς܂)
+    inline float4 Distance(const FrustumPlanes4& f, int i, float4 x, float4 y, float4 z) noexcept
+    {
+        float4 dist = MathSIMD::Mul(f.nx[i], x);
+        dist = MathSIMD::MulAdd(f.ny[i], y, dist);
+        dist = MathSIMD::MulAdd(f.nz[i], z, dist);
+        return MathSIMD::Add(dist, f.d[i]);
+    }
+
+    inline int TestAABB4(const FrustumPlanes4& f, const AABB* boxes) noexcept
+    {
+        float cx[4], cy[4], cz[4], ex[4], ey[4], ez[4];
+        for (int k = 0; k < 4; ++k)
+        {
+            const AABB& b = boxes[k];
+            cx[k] = (b.Min.x + b.Max.x) * 0.5f; ex[k] = (b.Max.x - b.Min.x) * 0.5f;
+            cy[k] = (b.Min.y + b.Max.y) * 0.5f; ey[k] = (b.Max.y - b.Min.y) * 0.5f;
+            cz[k] = (b.Min.z + b.Max.z) * 0.5f; ez[k] = (b.Max.z - b.Min.z) * 0.5f;
+        }
+        const float4 x = MathSIMD::Load(cx), y = MathSIMD::Load(cy), z = MathSIMD::Load(cz);
+        const float4 hx = MathSIMD::Load(ex), hy = MathSIMD::Load(ey), hz = MathSIMD::Load(ez);
+        const float4 zero = MathSIMD::Splat(0.0f);
+        float4 outside = MathSIMD::CmpLT(zero, zero);
+        for (int i = 0; i < Frustum::PlaneCount; ++i)
+        {
+            float4 r = MathSIMD::Mul(f.ax[i], hx);
+            r = MathSIMD::MulAdd(f.ay[i], hy, r);
+            r = MathSIMD::MulAdd(f.az[i], hz, r);
+            outside = MathSIMD::Or(outside, MathSIMD::CmpLT(MathSIMD::Add(Distance(f, i, x, y, z), r), zero));
+        }
+        return ~MathSIMD::MoveMask(outside) & 0xF;
+    }
+
+    inline int TestSphere4(const FrustumPlanes4& f, const Sphere* spheres) noexcept
+    {
+        float cx[4], cy[4], cz[4], rad[4];
+        for (int k = 0; k < 4; ++k)
+        {
+            cx[k] = spheres[k].Center.x;
+            cy[k] = spheres[k].Center.y;
+            cz[k] = spheres[k].Center.z;
+            rad[k] = spheres[k].Radius;
+        }
+        const float4 x = MathSIMD::Load(cx), y = MathSIMD::Load(cy), z = MathSIMD::Load(cz), r = MathSIMD::Load(rad);
+        const float4 zero = MathSIMD::Splat(0.0f);
+        float4 outside = MathSIMD::CmpLT(zero, zero);
+        for (int i = 0; i < Frustum::PlaneCount; ++i)
+        {
+            outside = MathSIMD::Or(outside, MathSIMD::CmpLT(MathSIMD::Add(Distance(f, i, x, y, z), r), zero));
+        }
+        return ~MathSIMD::MoveMask(outside) & 0xF;
+    }
+
+#if defined(MATH_SIMD_AVX)
+    // AVX ł 8  1 xɔ肷
+    struct FrustumPlanes8
+    {
+        __m256 nx[Frustum::PlaneCount], ny[Frustum::PlaneCount], nz[Frustum::PlaneCount], d[Frustum::PlaneCount];
+        __m256 ax[Frustum::PlaneCount], ay[Frustum::PlaneCount], az[Frustum::PlaneCount];
+
+        explicit FrustumPlanes8(const Frustum& frustum) noexcept
+        {
+            for (int i = 0; i < Frustum::PlaneCount; ++i)
+            {
+                const Plane& p = frustum.Planes[i];
+                nx[i] = _mm256_set1_ps(p.Normal.x);
+                ny[i] = _mm256_set1_ps(p.Normal.y);
+                nz[i] = _mm256_set1_ps(p.Normal.z);
+                d[i] = _mm256_set1_ps(p.D);
+                ax[i] = _mm256_set1_ps(std::fabs(p.Normal.x));
+                ay[i] = _mm256_set1_ps(std::fabs(p.Normal.y));
+                az[i] = _mm256_set1_ps(std::fabs(p.Normal.z));
+            }
+        }
+    };
+
+    //! @brief ʂ܂ł̕t (4  Distance Ɠɑ܂)
+    inline __m256 Distance(const FrustumPlanes8& f, int i, __m256 x, __m256 y, __m256 z) noexcept
+    {
+        __m256 dist = _mm256_mul_ps(f.nx[i], x);
+        dist = _mm256_add_ps(_mm256_mul_ps(f.ny[i], y), dist);
+        dist = _mm256_add_ps(_mm256_mul_ps(f.nz[i], z), dist);
+        return _mm256_add_ps(dist, f.d[i]);
+    }
+
+    inline int TestAABB8(const FrustumPlanes8& f, const AABB* boxes) noexcept
+    {
+        alignas(32) float cx[8], cy[8], cz[8], ex[8], ey[8], ez[8];
+        for (int k = 0; k < 8; ++k)
+        {
+            const AABB& b = boxes[k];
+            cx[k] = (b.Min.x + b.Max.x) * 0.5f; ex[k] = (b.Max.x - b.Min.x) * 0.5f;
+            cy[k] = (b.Min.y + b.Max.y) * 0.5f; ey[k] = (b.Max.y - b.Min.y) * 0.5f;
+            cz[k] = (b.Min.z + b.Max.z) * 0.5f; ez[k] = (b.Max.z - b.Min.z) * 0.5f;
+        }
+        const __m256 x = _mm256_load_ps(cx), y = _mm256_load_ps(cy), z = _mm256_load_ps(cz);
+        const __m256 hx = _mm256_load_ps(ex), hy = _mm256_load_ps(ey), hz = _mm256_load_ps(ez);
+        const __m256 zero = _mm256_setzero_ps();
+        __m256 outside = zero;
+        for (int i = 0; i < Frustum::PlaneCount; ++i)
+        {
+            __m256 r = _mm256_mul_ps(f.ax[i], hx);
+            r = _mm256_add_ps(_mm256_mul_ps(f.ay[i], hy), r);
+            r = _mm256_add_ps(_mm256_mul_ps(f.az[i], hz), r);
+            outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(Distance(f, i, x, y, z), r), zero, _CMP_LT_OQ));
+        }
+        return ~_mm256_movemask_ps(outside) & 0xFF;
+    }
+
+    inline int TestSphere8(const FrustumPlanes8& f, const Sphere* spheres) noexcept
+    {
+        alignas(32) float cx[8], cy[8], cz[8], rad[8];
+        for (int k = 0; k < 8; ++k)
+        {
+            cx[k] = spheres[k].Center.x;
+            cy[k] = spheres[k].Center.y;
+            cz[k] = spheres[k].Center.z;
+            rad[k] = spheres[k].Radius;
+        }
+        const __m256 x = _mm256_load_ps(cx), y = _mm256_load_ps(cy), z = _mm256_load_ps(cz), r = _mm256_load_ps(rad);
+        const __m256 zero = _mm256_setzero_ps();
+        __m256 outside = zero;
+        for (int i = 0; i < Frustum::PlaneCount; ++i)
+        {
+            outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(Distance(f, i, x, y, z), r), zero, _CMP_LT_OQ));
+        }
+        return ~_mm256_movemask_ps(outside) & 0xFF;
+    }
+#endif
+
+    template<typename T, typename Test4, typename Scalar>
+    size_t Cull(const Frustum& frustum, const T* items, size_t count, uint8_t* visible, Test4 test4, Scalar scalar) noexcept
+    {
+        const FrustumPlanes4 planes(frustum);
+        size_t visibleCount = 0;
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const int mask = test4(planes, items + i);
+            for (int k = 0; k < 4; ++k)
+            {
+                visible[i + k] = static_cast<uint8_t>((mask >> k) & 1);
+                visibleCount += visible[i + k];
+            }
+        }
+        for (; i < count; ++i)
+        {
+            visible[i] = scalar(items[i]) ? 1 : 0;
+            visibleCount += visible[i];
+        }
+        return visibleCount;
+    }
+}
+
+inline int Frustum::IntersectsAABB4(const AABB* boxes) const noexcept
+{
+    return BoundsSIMD::TestAABB4(BoundsSIMD::FrustumPlanes4(*this), boxes);
+}
+
+inline int Frustum::IntersectsSphere4(const Sphere* spheres) const noexcept
+{
+    return BoundsSIMD::TestSphere4(BoundsSIMD::FrustumPlanes4(*this), spheres);
+}
+
+inline int Frustum::IntersectsAABB8(const AABB* boxes) const noexcept
+{
+#if defined(MATH_SIMD_AVX)
+    return BoundsSIMD::TestAABB8(BoundsSIMD::FrustumPlanes8(*this), boxes);
+#else
+    const BoundsSIMD::FrustumPlanes4 planes(*this);
+    return BoundsSIMD::TestAABB4(planes, boxes) | (BoundsSIMD::TestAABB4(planes, boxes + 4) << 4);
+#endif
+}
+
+inline int Frustum::IntersectsSphere8(const Sphere* spheres) const noexcept
+{
+#if defined(MATH_SIMD_AVX)
+    return BoundsSIMD::TestSphere8(BoundsSIMD::FrustumPlanes8(*this), spheres);
+#else
+    const BoundsSIMD::FrustumPlanes4 planes(*this);
+    return BoundsSIMD::TestSphere4(planes, spheres) | (BoundsSIMD::TestSphere4(planes, spheres + 4) << 4);
+#endif
+}
+
+inline size_t Frustum::CullAABBs(const AABB* boxes, size_t count, uint8_t* visible) const noexcept
+{
+    return BoundsSIMD::Cull(*this, boxes, count, visible,
+        [](const BoundsSIMD::FrustumPlanes4& planes, const AABB* b) { return BoundsSIMD::TestAABB4(planes, b); },
+        [this](const AABB& b) { return Intersects(b); });
+}
+
+inline size_t Frustum::CullSpheres(const Sphere* spheres, size_t count, uint8_t* visible) const noexcept
+{
+    return BoundsSIMD::Cull(*this, spheres, count, visible,
+        [](const BoundsSIMD::FrustumPlanes4& planes, const Sphere* s) { return BoundsSIMD::TestSphere4(planes, s); },
+        [this](const Sphere& s) { return Intersects(s); });
+}
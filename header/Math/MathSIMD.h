@@ -0,0 +1,293 @@
+#pragma once
+
+// =======================
+// SIMD ߃Zbg̑I
+// MATH_FORCE_SCALAR `ƃXJ[(t@X)ɐ؂ւ܂
+// =======================
+#if !defined(MATH_FORCE_SCALAR)
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATH_SIMD_SSE 1
+#if defined(__AVX__)
+#define MATH_SIMD_AVX 1
+#endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define MATH_SIMD_NEON 1
+#endif
+#endif
+
+#include <cmath>
+
+#if defined(MATH_SIMD_AVX)
+#include <immintrin.h>
+#elif defined(MATH_SIMD_SSE)
+#include <emmintrin.h>
+#elif defined(MATH_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace MathSIMD
+{
+#if defined(MATH_SIMD_SSE)
+    using float4 = __m128;
+#elif defined(MATH_SIMD_NEON)
+    using float4 = float32x4_t;
+#else
+    struct float4 { float v[4]; };
+#endif
+
+    // e֐̓XJ[ƓZɂȂ悤ɂĂ܂
+    // (FMA ͎gȂ߁AXJ[łƃrbgPʂňv܂)
+
+    inline float4 Load(const float* p) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        return _mm_loadu_ps(p);
+#elif defined(MATH_SIMD_NEON)
+        return vld1q_f32(p);
+#else
+        return float4{ { p[0], p[1], p[2], p[3] } };
+#endif
+    }
+
+    inline void Store(float* p, float4 v) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        _mm_storeu_ps(p, v);
+#elif defined(MATH_SIMD_NEON)
+        vst1q_f32(p, v);
+#else
+        p[0] = v.v[0]; p[1] = v.v[1]; p[2] = v.v[2]; p[3] = v.v[3];
+#endif
+    }
+
+    inline float4 Set(float x, float y, float z, float w) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        return _mm_set_ps(w, z, y, x);
+#elif defined(MATH_SIMD_NEON)
+        const float tmp[4] = { x, y, z, w };
+        return vld1q_f32(tmp);
+#else
+        return float4{ { x, y, z, w } };
+#endif
+    }
+
+    inline float4 Splat(float s) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        return _mm_set1_ps(s);
+#elif defined(MATH_SIMD_NEON)
+        return vdupq_n_f32(s);
+#else
+        return float4{ { s, s, s, s } };
+#endif
+    }
+
+    inline float4 Add(float4 a, float4 b) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        return _mm_add_ps(a, b);
+#elif defined(MATH_SIMD_NEON)
+        return vaddq_f32(a, b);
+#else
+        return float4{ { a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] } };
+#endif
+    }
+
+    inline float4 Sub(float4 a, float4 b) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        return _mm_sub_ps(a, b);
+#elif defined(MATH_SIMD_NEON)
+        return vsubq_f32(a, b);
+#else
+        return float4{ { a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3] } };
+#endif
+    }
+
+    inline float4 Mul(float4 a, float4 b) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        return _mm_mul_ps(a, b);
+#elif defined(MATH_SIMD_NEON)
+        return vmulq_f32(a, b);
+#else
+        return float4{ { a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3] } };
+#endif
+    }
+
+    inline float4 Div(float4 a, float4 b) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        return _mm_div_ps(a, b);
+#elif defined(MATH_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+        return vdivq_f32(a, b);
+#elif defined(MATH_SIMD_NEON)
+        float ta[4], tb[4];
+        vst1q_f32(ta, a);
+        vst1q_f32(tb, b);
+        const float tmp[4] = { ta[0] / tb[0], ta[1] / tb[1], ta[2] / tb[2], ta[3] / tb[3] };
+        return vld1q_f32(tmp);
+#else
+        return float4{ { a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3] } };
+#endif
+    }
+
+    inline float4 Min(float4 a, float4 b) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        return _mm_min_ps(a, b);
+#elif defined(MATH_SIMD_NEON)
+        return vminq_f32(a, b);
+#else
+        float4 r;
+        for (int i = 0; i < 4; ++i) r.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i];
+        return r;
+#endif
+    }
+
+    inline float4 Max(float4 a, float4 b) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        return _mm_max_ps(a, b);
+#elif defined(MATH_SIMD_NEON)
+        return vmaxq_f32(a, b);
+#else
+        float4 r;
+        for (int i = 0; i < 4; ++i) r.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i];
+        return r;
+#endif
+    }
+
+    inline float4 Sqrt(float4 a) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        return _mm_sqrt_ps(a);
+#elif defined(MATH_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+        return vsqrtq_f32(a);
+#else
+        float tmp[4];
+        Store(tmp, a);
+        for (int i = 0; i < 4; ++i) tmp[i] = std::sqrt(tmp[i]);
+        return Load(tmp);
+#endif
+    }
+
+    //! @brief 1 / sqrt(a) ̋ߎl (j[g@1␳AΌ덷͂悻 1e-6 ȉ)
+    inline float4 RsqrtFast(float4 a) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        const __m128 e = _mm_rsqrt_ps(a);
+        // e' = e * (1.5 - 0.5 * a * e * e)
+        const __m128 half = _mm_mul_ps(_mm_set1_ps(0.5f), a);
+        return _mm_mul_ps(e, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(half, _mm_mul_ps(e, e))));
+#elif defined(MATH_SIMD_NEON)
+        const float32x4_t e = vrsqrteq_f32(a);
+        return vmulq_f32(e, vrsqrtsq_f32(vmulq_f32(a, e), e));
+#else
+        float4 r;
+        for (int i = 0; i < 4; ++i) r.v[i] = 1.f / std::sqrt(a.v[i]);
+        return r;
+#endif
+    }
+
+    // =======================
+    // rƃ}XNI
+    // }XN float4 ŕ\A𖞂[͑Srbg 1 ɂȂ܂
+    // =======================
+    inline float4 CmpLT(float4 a, float4 b) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        return _mm_cmplt_ps(a, b);
+#elif defined(MATH_SIMD_NEON)
+        return vreinterpretq_f32_u32(vcltq_f32(a, b));
+#else
+        float4 r;
+        for (int i = 0; i < 4; ++i) r.v[i] = a.v[i] < b.v[i] ? 1.f : 0.f;
+        return r;
+#endif
+    }
+
+    //! @brief mask Ă郌[ aAȊO b I
+    inline float4 Select(float4 mask, float4 a, float4 b) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+#elif defined(MATH_SIMD_NEON)
+        return vbslq_f32(vreinterpretq_u32_f32(mask), a, b);
+#else
+        float4 r;
+        for (int i = 0; i < 4; ++i) r.v[i] = mask.v[i] != 0.f ? a.v[i] : b.v[i];
+        return r;
+#endif
+    }
+
+    inline float4 Or(float4 a, float4 b) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        return _mm_or_ps(a, b);
+#elif defined(MATH_SIMD_NEON)
+        return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+#else
+        float4 r;
+        for (int i = 0; i < 4; ++i) r.v[i] = (a.v[i] != 0.f || b.v[i] != 0.f) ? 1.f : 0.f;
+        return r;
+#endif
+    }
+
+    //! @brief }XN̊e[rbg 0`3 ɂ܂Ƃ߂
+    inline int MoveMask(float4 mask) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        return _mm_movemask_ps(mask);
+#elif defined(MATH_SIMD_NEON)
+        const uint32x4_t bits = vshrq_n_u32(vreinterpretq_u32_f32(mask), 31);
+        return static_cast<int>(vgetq_lane_u32(bits, 0) | (vgetq_lane_u32(bits, 1) << 1)
+            | (vgetq_lane_u32(bits, 2) << 2) | (vgetq_lane_u32(bits, 3) << 3));
+#else
+        int r = 0;
+        for (int i = 0; i < 4; ++i) r |= (mask.v[i] != 0.f ? 1 : 0) << i;
+        return r;
+#endif
+    }
+
+    inline float4 Abs(float4 a) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        return _mm_andnot_ps(_mm_set1_ps(-0.f), a);
+#elif defined(MATH_SIMD_NEON)
+        return vabsq_f32(a);
+#else
+        float4 r;
+        for (int i = 0; i < 4; ++i) r.v[i] = std::fabs(a.v[i]);
+        return r;
+#endif
+    }
+
+    //! @brief a * b + c (ZȂ)
+    inline float4 MulAdd(float4 a, float4 b, float4 c) noexcept
+    {
+        return Add(Mul(a, b), c);
+    }
+
+    //! @brief 4x4 ̓]u (r0`r3 Ƃĕבւ)
+    inline void Transpose(float4& r0, float4& r1, float4& r2, float4& r3) noexcept
+    {
+#if defined(MATH_SIMD_SSE)
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+#elif defined(MATH_SIMD_NEON)
+        float32x4x2_t t01 = vtrnq_f32(r0, r1);
+        float32x4x2_t t23 = vtrnq_f32(r2, r3);
+        r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+        r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+        r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+        r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+#else
+        float4 t0 = r0, t1 = r1, t2 = r2, t3 = r3;
+        r0 = float4{ { t0.v[0], t1.v[0], t2.v[0], t3.v[0] } };
+        r1 = float4{ { t0.v[1], t1.v[1], t2.v[1], t3.v[1] } };
+        r2 = float4{ { t0.v[2], t1.v[2], t2.v[2], t3.v[2] } };
+        r3 = float4{ { t0.v[3], t1.v[3], t2.v[3], t3.v[3] } };
+#endif
+    }
+}
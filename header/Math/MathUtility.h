@@ -1,4 +1,11 @@
 #pragma once
+#include <cmath>
+
+// 0 Ƃ݂Ȃ臒l
+#ifndef SMALL_NUMBER
+#define SMALL_NUMBER 1.e-8f
+#endif
+
 namespace MathUtility
 {
     static constexpr float PI = 3.14159265359f;
@@ -0,0 +1,245 @@
+#pragma once
+#include <cstring>
+#include "Vector3D.h"
+#include "Quaternion.h"
+#include "Matrix4x4.h"
+#include "MathSIMD.h"
+
+// =======================
+// AtBϊs (3s4)
+// Matrix4x4 (sxNg v * M) ̍ 3x4 ]u`ŕێ܂
+//   m_mat[r] = ( M[0][r], M[1][r], M[2][r], M[3][r] )
+// ̂ HLSL  row_major float3x4 Ɠzu (48 oCg) ɂȂA
+// VF[_[ł mul(World, float4(pos, 1.0f)) ŕϊł܂
+// =======================
+class Matrix3x4
+{
+public:
+    // RXgN^
+    Matrix3x4() noexcept
+    {
+        setIdentity();
+    }
+
+    //! @brief Matrix4x4 ϊ (4ڂ͖܂)
+    explicit Matrix3x4(const Matrix4x4& matrix) noexcept
+    {
+        for (int r = 0; r < 3; ++r)
+        {
+            m_mat[r][0] = matrix.m_mat[0][r];
+            m_mat[r][1] = matrix.m_mat[1][r];
+            m_mat[r][2] = matrix.m_mat[2][r];
+            m_mat[r][3] = matrix.m_mat[3][r];
+        }
+    }
+
+    void setIdentity() noexcept
+    {
+        ::memset(m_mat, 0, sizeof(float) * 12);
+        m_mat[0][0] = 1.f;
+        m_mat[1][1] = 1.f;
+        m_mat[2][2] = 1.f;
+    }
+
+    static Matrix3x4 Identity() noexcept
+    {
+        return Matrix3x4();
+    }
+
+    // =======================
+    // Matrix4x4 Ƃ̑ݕϊ
+    // =======================
+    static Matrix3x4 FromMatrix4x4(const Matrix4x4& matrix) noexcept
+    {
+        return Matrix3x4(matrix);
+    }
+
+    Matrix4x4 ToMatrix4x4() const noexcept
+    {
+        Matrix4x4 mat;
+        for (int r = 0; r < 3; ++r)
+        {
+            mat.m_mat[0][r] = m_mat[r][0];
+            mat.m_mat[1][r] = m_mat[r][1];
+            mat.m_mat[2][r] = m_mat[r][2];
+            mat.m_mat[3][r] = m_mat[r][3];
+        }
+        mat.m_mat[0][3] = 0.f;
+        mat.m_mat[1][3] = 0.f;
+        mat.m_mat[2][3] = 0.f;
+        mat.m_mat[3][3] = 1.f;
+        return mat;
+    }
+
+    // =======================
+    // s̐
+    // Matrix4x4 Ɠ a * b ́ua KpĂ b KpvϊɂȂ܂
+    // =======================
+    Matrix3x4 operator*(const Matrix3x4& matrix) const noexcept
+    {
+        Matrix3x4 out;
+        Multiply(*this, matrix, out);
+        return out;
+    }
+
+    Matrix3x4& operator*=(const Matrix3x4& matrix) noexcept
+    {
+        Matrix3x4 out;
+        Multiply(*this, matrix, out);
+        *this = out;
+        return *this;
+    }
+
+    // 4sڂ (0,0,0,1) ł邱Ƃ𗘗pAZ 36 EZ 27 ōς܂܂
+    static void Multiply(const Matrix3x4& a, const Matrix3x4& b, Matrix3x4& out) noexcept
+    {
+#if defined(MATH_SIMD_SSE) || defined(MATH_SIMD_NEON)
+        const MathSIMD::float4 a0 = MathSIMD::Load(a.m_mat[0]);
+        const MathSIMD::float4 a1 = MathSIMD::Load(a.m_mat[1]);
+        const MathSIMD::float4 a2 = MathSIMD::Load(a.m_mat[2]);
+        MathSIMD::float4 r[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            MathSIMD::float4 v = MathSIMD::Mul(MathSIMD::Splat(b.m_mat[i][0]), a0);
+            v = MathSIMD::MulAdd(MathSIMD::Splat(b.m_mat[i][1]), a1, v);
+            v = MathSIMD::MulAdd(MathSIMD::Splat(b.m_mat[i][2]), a2, v);
+            r[i] = MathSIMD::Add(v, MathSIMD::Set(0.f, 0.f, 0.f, b.m_mat[i][3]));
+        }
+        // out  a, b ƓꍇɔđSČvZĂ珑
+        MathSIMD::Store(out.m_mat[0], r[0]);
+        MathSIMD::Store(out.m_mat[1], r[1]);
+        MathSIMD::Store(out.m_mat[2], r[2]);
+#else
+        float tmp[3][4];
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                tmp[i][j] = b.m_mat[i][0] * a.m_mat[0][j] + b.m_mat[i][1] * a.m_mat[1][j] + b.m_mat[i][2] * a.m_mat[2][j];
+            }
+            tmp[i][3] += b.m_mat[i][3];
+        }
+        ::memcpy(out.m_mat, tmp, sizeof(tmp));
+#endif
+    }
+
+    // =======================
+    // XP[E]Esړ̍
+    // Matrix4x4::Compose(scale, q, trans) ƓϊɂȂ܂
+    // =======================
+    static Matrix3x4 Compose(const Vector3D& scale, const Quaternion& q, const Vector3D& trans) noexcept
+    {
+        float xx = q.x * q.x * 2.f;
+        float yy = q.y * q.y * 2.f;
+        float zz = q.z * q.z * 2.f;
+        float xy = q.x * q.y * 2.f;
+        float xz = q.x * q.z * 2.f;
+        float yz = q.y * q.z * 2.f;
+        float wx = q.w * q.x * 2.f;
+        float wy = q.w * q.y * 2.f;
+        float wz = q.w * q.z * 2.f;
+
+        Matrix3x4 mat;
+        mat.m_mat[0][0] = (1.f - yy - zz) * scale.x;
+        mat.m_mat[0][1] = (xy - wz) * scale.y;
+        mat.m_mat[0][2] = (xz + wy) * scale.z;
+        mat.m_mat[0][3] = trans.x;
+
+        mat.m_mat[1][0] = (xy + wz) * scale.x;
+        mat.m_mat[1][1] = (1.f - xx - zz) * scale.y;
+        mat.m_mat[1][2] = (yz - wx) * scale.z;
+        mat.m_mat[1][3] = trans.y;
+
+        mat.m_mat[2][0] = (xz - wy) * scale.x;
+        mat.m_mat[2][1] = (yz + wx) * scale.y;
+        mat.m_mat[2][2] = (1.f - xx - yy) * scale.z;
+        mat.m_mat[2][3] = trans.z;
+        return mat;
+    }
+
+    // =======================
+    // ts
+    // 3x3 ]qWJŋ߁Asړ -(A^-1 * t) Ƃ܂
+    // f܂ވʂ̃AtBϊɑΉ܂ (قȏꍇ͒PʍsԂ܂)
+    // =======================
+    static Matrix3x4 inverse(const Matrix3x4& matrix) noexcept
+    {
+        const auto& m = matrix.m_mat;
+        const float c00 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+        const float c01 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+        const float c02 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+
+        const float det = m[0][0] * c00 + m[0][1] * c01 + m[0][2] * c02;
+        if (det == 0.f)
+        {
+            return Identity();
+        }
+        const float invDet = 1.f / det;
+
+        Matrix3x4 inv;
+        auto& o = inv.m_mat;
+        o[0][0] = c00 * invDet;
+        o[0][1] = (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * invDet;
+        o[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * invDet;
+
+        o[1][0] = c01 * invDet;
+        o[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * invDet;
+        o[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * invDet;
+
+        o[2][0] = c02 * invDet;
+        o[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * invDet;
+        o[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * invDet;
+
+        for (int r = 0; r < 3; ++r)
+        {
+            o[r][3] = -(o[r][0] * m[0][3] + o[r][1] * m[1][3] + o[r][2] * m[2][3]);
+        }
+        return inv;
+    }
+
+    static float getDeterminant(const Matrix3x4& matrix) noexcept
+    {
+        const auto& m = matrix.m_mat;
+        return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+             + m[0][1] * (m[1][2] * m[2][0] - m[1][0] * m[2][2])
+             + m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+    }
+
+    // =======================
+    // xNgϊ
+    // =======================
+    static Vector3D TransformPoint(const Matrix3x4& matrix, const Vector3D& vec) noexcept
+    {
+        const auto& m = matrix.m_mat;
+        return Vector3D(
+            m[0][0] * vec.x + m[0][1] * vec.y + m[0][2] * vec.z + m[0][3],
+            m[1][0] * vec.x + m[1][1] * vec.y + m[1][2] * vec.z + m[1][3],
+            m[2][0] * vec.x + m[2][1] * vec.y + m[2][2] * vec.z + m[2][3]);
+    }
+
+    static Vector3D TransformDirection(const Matrix3x4& matrix, const Vector3D& vec) noexcept
+    {
+        const auto& m = matrix.m_mat;
+        return Vector3D(
+            m[0][0] * vec.x + m[0][1] * vec.y + m[0][2] * vec.z,
+            m[1][0] * vec.x + m[1][1] * vec.y + m[1][2] * vec.z,
+            m[2][0] * vec.x + m[2][1] * vec.y + m[2][2] * vec.z);
+    }
+
+    Vector3D getTranslation() const noexcept
+    {
+        return Vector3D(m_mat[0][3], m_mat[1][3], m_mat[2][3]);
+    }
+
+    void setTranslation(const Vector3D& trans) noexcept
+    {
+        m_mat[0][3] = trans.x;
+        m_mat[1][3] = trans.y;
+        m_mat[2][3] = trans.z;
+    }
+
+public:
+    float m_mat[3][4] = {};
+};
+
+static_assert(sizeof(Matrix3x4) == 48, "Matrix3x4 must match HLSL row_major float3x4 (48 bytes)");
@@ -1,8 +1,10 @@
 #pragma once
-#include "pch.h"
+#include <cstring>
+#include <cmath>
 #include "Vector3D.h"
 #include "Vector4D.h"
 #include "Quaternion.h"
+#include "MathSIMD.h"
 
 class Matrix4x4
 {
@@ -78,17 +80,77 @@ public:
     Matrix4x4 operator*(const Matrix4x4& mat) const noexcept
     {
         Matrix4x4 out;
+        Multiply(*this, mat, out);
+        return out;
+    }
+
+    // =======================
+    // s out = a * b
+    // o͍s i = a[i][0] * bs0 + a[i][1] * bs1 + a[i][2] * bs2 + a[i][3] * bs3
+    // =======================
+    static void Multiply(const Matrix4x4& a, const Matrix4x4& b, Matrix4x4& out) noexcept
+    {
+#if defined(MATH_SIMD_AVX)
+        // 2s܂Ƃ߂ČvZ
+        const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b.m_mat[0]));
+        const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b.m_mat[1]));
+        const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b.m_mat[2]));
+        const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b.m_mat[3]));
+        for (int i = 0; i < 4; i += 2)
+        {
+            const __m256 a01 = _mm256_loadu_ps(a.m_mat[i]);
+            __m256 r = _mm256_mul_ps(_mm256_permute_ps(a01, 0x00), b0);
+            r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(a01, 0x55), b1));
+            r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(a01, 0xAA), b2));
+            r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(a01, 0xFF), b3));
+            _mm256_storeu_ps(out.m_mat[i], r);
+        }
+#elif defined(MATH_SIMD_SSE) || defined(MATH_SIMD_NEON)
+        const MathSIMD::float4 b0 = MathSIMD::Load(b.m_mat[0]);
+        const MathSIMD::float4 b1 = MathSIMD::Load(b.m_mat[1]);
+        const MathSIMD::float4 b2 = MathSIMD::Load(b.m_mat[2]);
+        const MathSIMD::float4 b3 = MathSIMD::Load(b.m_mat[3]);
+        for (int i = 0; i < 4; ++i)
+        {
+            MathSIMD::float4 r = MathSIMD::Mul(MathSIMD::Splat(a.m_mat[i][0]), b0);
+            r = MathSIMD::MulAdd(MathSIMD::Splat(a.m_mat[i][1]), b1, r);
+            r = MathSIMD::MulAdd(MathSIMD::Splat(a.m_mat[i][2]), b2, r);
+            r = MathSIMD::MulAdd(MathSIMD::Splat(a.m_mat[i][3]), b3, r);
+            MathSIMD::Store(out.m_mat[i], r);
+        }
+#else
+        // out  a/b ꍇɔĈꎞ̈ŌvZ
+        float tmp[4][4];
         for (int i = 0; i < 4; ++i)
         {
             for (int j = 0; j < 4; ++j)
             {
-                out.m_mat[i][j] =
-                    m_mat[i][0] * mat.m_mat[0][j] +
-                    m_mat[i][1] * mat.m_mat[1][j] +
-                    m_mat[i][2] * mat.m_mat[2][j] +
-                    m_mat[i][3] * mat.m_mat[3][j];
+                tmp[i][j] =
+                    a.m_mat[i][0] * b.m_mat[0][j] +
+                    a.m_mat[i][1] * b.m_mat[1][j] +
+                    a.m_mat[i][2] * b.m_mat[2][j] +
+                    a.m_mat[i][3] * b.m_mat[3][j];
             }
         }
+        ::memcpy(out.m_mat, tmp, sizeof(float) * 16);
+#endif
+    }
+
+    // =======================
+    // ]us
+    // =======================
+    static Matrix4x4 transpose(const Matrix4x4& matrix) noexcept
+    {
+        Matrix4x4 out;
+        MathSIMD::float4 r0 = MathSIMD::Load(matrix.m_mat[0]);
+        MathSIMD::float4 r1 = MathSIMD::Load(matrix.m_mat[1]);
+        MathSIMD::float4 r2 = MathSIMD::Load(matrix.m_mat[2]);
+        MathSIMD::float4 r3 = MathSIMD::Load(matrix.m_mat[3]);
+        MathSIMD::Transpose(r0, r1, r2, r3);
+        MathSIMD::Store(out.m_mat[0], r0);
+        MathSIMD::Store(out.m_mat[1], r1);
+        MathSIMD::Store(out.m_mat[2], r2);
+        MathSIMD::Store(out.m_mat[3], r3);
         return out;
     }
 
@@ -102,15 +164,21 @@ public:
     // =======================
     static Vector3D Apply(const Matrix4x4& matrix, const Vector3D& vec) noexcept
     {
+#if defined(MATH_SIMD_SSE) || defined(MATH_SIMD_NEON)
+        MathSIMD::float4 r = MathSIMD::Mul(MathSIMD::Splat(vec.x), MathSIMD::Load(matrix.m_mat[0]));
+        r = MathSIMD::MulAdd(MathSIMD::Splat(vec.y), MathSIMD::Load(matrix.m_mat[1]), r);
+        r = MathSIMD::MulAdd(MathSIMD::Splat(vec.z), MathSIMD::Load(matrix.m_mat[2]), r);
+        r = MathSIMD::Add(r, MathSIMD::Load(matrix.m_mat[3]));
+        float out[4];
+        MathSIMD::Store(out, r);
+        return Vector3D(out[0], out[1], out[2]);
+#else
         float x = vec.x * matrix.m_mat[0][0] + vec.y * matrix.m_mat[1][0] + vec.z * matrix.m_mat[2][0] + matrix.m_mat[3][0];
         float y = vec.x * matrix.m_mat[0][1] + vec.y * matrix.m_mat[1][1] + vec.z * matrix.m_mat[2][1] + matrix.m_mat[3][1];
         float z = vec.x * matrix.m_mat[0][2] + vec.y * matrix.m_mat[1][2] + vec.z * matrix.m_mat[2][2] + matrix.m_mat[3][2];
-        float w = vec.x * matrix.m_mat[0][3] + vec.y * matrix.m_mat[1][3] + vec.z * matrix.m_mat[2][3] + matrix.m_mat[3][3];
-
-        // wŊ鏈KvȏꍇiˉeϊȂǁj͂ōs
-        // if(w != 1.0f && w != 0.0f) { x /= w; y /= w; z /= w; }
 
         return Vector3D(x, y, z);
+#endif
     }
 
     // =======================
@@ -180,55 +248,110 @@ public:
         return mat;
     }
 
-    static Matrix4x4 inverse(const Matrix4x4& matrix)
+    // =======================
+    // ts (]qWJɂ`)
+    // 2x2 ̏s񎮂LČvZ邽߁Apow̌Ăяo͂܂
+    // ٍs̏ꍇ͒PʍsԂ܂
+    // =======================
+    static Matrix4x4 inverse(const Matrix4x4& matrix) noexcept
     {
-        uint32_t a, i, j;
-        Matrix4x4 out;
-        Vector4D v, vec[3];
-        float det = 1.0f;
+#if defined(MATH_SIMD_SSE)
+        return inverseSSE(matrix);
+#else
+        const auto& m = matrix.m_mat;
+        const float s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+        const float s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+        const float s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+        const float s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+        const float s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+        const float s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+
+        const float c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+        const float c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+        const float c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+        const float c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+        const float c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+        const float c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
 
-        det = Matrix4x4::getDeterminant(matrix);
-        if (det == 0) return out;
-        for (i = 0; i < 4; i++)
-        {
-            for (j = 0; j < 4; j++)
-            {
-                if (j != i)
-                {
-                    a = j;
-                    if (j > i) a = a - 1;
-                    vec[a].x = (matrix.m_mat[j][0]);
-                    vec[a].y = (matrix.m_mat[j][1]);
-                    vec[a].z = (matrix.m_mat[j][2]);
-                    vec[a].w = (matrix.m_mat[j][3]);
-                }
-            }
-            v = vec[0].cross(vec[1], vec[2]);
-
-            out.m_mat[0][i] = (float)pow(-1.0f, i) * v.x / det;
-            out.m_mat[1][i] = (float)pow(-1.0f, i) * v.y / det;
-            out.m_mat[2][i] = (float)pow(-1.0f, i) * v.z / det;
-            out.m_mat[3][i] = (float)pow(-1.0f, i) * v.w / det;
-        }
+        Matrix4x4 out;
+        const float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        if (det == 0.f) return out;
+        const float invDet = 1.f / det;
+
+        out.m_mat[0][0] = ( m[1][1] * c5 - m[1][2] * c4 + m[1][3] * c3) * invDet;
+        out.m_mat[0][1] = (-m[0][1] * c5 + m[0][2] * c4 - m[0][3] * c3) * invDet;
+        out.m_mat[0][2] = ( m[3][1] * s5 - m[3][2] * s4 + m[3][3] * s3) * invDet;
+        out.m_mat[0][3] = (-m[2][1] * s5 + m[2][2] * s4 - m[2][3] * s3) * invDet;
+
+        out.m_mat[1][0] = (-m[1][0] * c5 + m[1][2] * c2 - m[1][3] * c1) * invDet;
+        out.m_mat[1][1] = ( m[0][0] * c5 - m[0][2] * c2 + m[0][3] * c1) * invDet;
+        out.m_mat[1][2] = (-m[3][0] * s5 + m[3][2] * s2 - m[3][3] * s1) * invDet;
+        out.m_mat[1][3] = ( m[2][0] * s5 - m[2][2] * s2 + m[2][3] * s1) * invDet;
+
+        out.m_mat[2][0] = ( m[1][0] * c4 - m[1][1] * c2 + m[1][3] * c0) * invDet;
+        out.m_mat[2][1] = (-m[0][0] * c4 + m[0][1] * c2 - m[0][3] * c0) * invDet;
+        out.m_mat[2][2] = ( m[3][0] * s4 - m[3][1] * s2 + m[3][3] * s0) * invDet;
+        out.m_mat[2][3] = (-m[2][0] * s4 + m[2][1] * s2 - m[2][3] * s0) * invDet;
+
+        out.m_mat[3][0] = (-m[1][0] * c3 + m[1][1] * c1 - m[1][2] * c0) * invDet;
+        out.m_mat[3][1] = ( m[0][0] * c3 - m[0][1] * c1 + m[0][2] * c0) * invDet;
+        out.m_mat[3][2] = (-m[3][0] * s3 + m[3][1] * s1 - m[3][2] * s0) * invDet;
+        out.m_mat[3][3] = ( m[2][0] * s3 - m[2][1] * s1 + m[2][2] * s0) * invDet;
 
         return out;
+#endif
     }
 
-    static float getDeterminant(const Matrix4x4& matrix)
+    // =======================
+    // AtBϊ(]EXP[Esړ)p̋ts
+    // 3x3]uĊes̃XP[2ŊAsړ͕𔽓]ēKp܂
+    // ˉe܂ލsXP[0̍sɂ͎gpł܂
+    // =======================
+    static Matrix4x4 inverseAffine(const Matrix4x4& matrix) noexcept
     {
-        Vector4D mirror, v1, v2, v3;
-        float det;
-
-        v1 = Vector4D(matrix.m_mat[0][0], matrix.m_mat[1][0], matrix.m_mat[2][0], matrix.m_mat[3][0]);
-        v2 = Vector4D(matrix.m_mat[0][1], matrix.m_mat[1][1], matrix.m_mat[2][1], matrix.m_mat[3][1]);
-        v3 = Vector4D(matrix.m_mat[0][2], matrix.m_mat[1][2], matrix.m_mat[2][2], matrix.m_mat[3][2]);
-
+        const auto& m = matrix.m_mat;
+        const float invSq0 = 1.f / (m[0][0] * m[0][0] + m[0][1] * m[0][1] + m[0][2] * m[0][2]);
+        const float invSq1 = 1.f / (m[1][0] * m[1][0] + m[1][1] * m[1][1] + m[1][2] * m[1][2]);
+        const float invSq2 = 1.f / (m[2][0] * m[2][0] + m[2][1] * m[2][1] + m[2][2] * m[2][2]);
+
+        MathSIMD::float4 r0 = MathSIMD::Mul(MathSIMD::Set(m[0][0], m[0][1], m[0][2], 0.f), MathSIMD::Splat(invSq0));
+        MathSIMD::float4 r1 = MathSIMD::Mul(MathSIMD::Set(m[1][0], m[1][1], m[1][2], 0.f), MathSIMD::Splat(invSq1));
+        MathSIMD::float4 r2 = MathSIMD::Mul(MathSIMD::Set(m[2][0], m[2][1], m[2][2], 0.f), MathSIMD::Splat(invSq2));
+        MathSIMD::float4 r3 = MathSIMD::Splat(0.f);
+        MathSIMD::Transpose(r0, r1, r2, r3);
+
+        // sړ = -(t * R^-1)
+        MathSIMD::float4 t = MathSIMD::Mul(MathSIMD::Splat(m[3][0]), r0);
+        t = MathSIMD::MulAdd(MathSIMD::Splat(m[3][1]), r1, t);
+        t = MathSIMD::MulAdd(MathSIMD::Splat(m[3][2]), r2, t);
+        t = MathSIMD::Sub(MathSIMD::Set(0.f, 0.f, 0.f, 1.f), t);
 
-        mirror = v1.cross(v2, v3);
-        det = -(matrix.m_mat[0][3] * mirror.x + matrix.m_mat[1][3] * mirror.y + matrix.m_mat[2][3] * mirror.z +
-            matrix.m_mat[3][3] * mirror.w);
+        Matrix4x4 out;
+        MathSIMD::Store(out.m_mat[0], r0);
+        MathSIMD::Store(out.m_mat[1], r1);
+        MathSIMD::Store(out.m_mat[2], r2);
+        MathSIMD::Store(out.m_mat[3], t);
+        return out;
+    }
 
-        return det;
+    static float getDeterminant(const Matrix4x4& matrix) noexcept
+    {
+        const auto& m = matrix.m_mat;
+        const float s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+        const float s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+        const float s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+        const float s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+        const float s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+        const float s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+
+        const float c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+        const float c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+        const float c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+        const float c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+        const float c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+        const float c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+
+        return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
     }
     // NH[^jI]s
     static Matrix4x4 QuaternionToMatrix(const Quaternion& q) noexcept
@@ -267,6 +390,32 @@ public:
         return mat;
     }
 
+    // =======================
+    // XP[E]Esړ̍
+    // ScalingToMatrix(scale) * QuaternionToMatrix(q) * TransitionToMatrix(trans) Ɠʂ
+    // sςg킸ɁANH[^jIes𒼐ڋ߂܂ (]sĂg債Ȃ)
+    // =======================
+    static Matrix4x4 Compose(const Vector3D& scale, const Quaternion& q, const Vector3D& trans) noexcept
+    {
+        float xx = q.x * q.x * 2.f;
+        float yy = q.y * q.y * 2.f;
+        float zz = q.z * q.z * 2.f;
+        float xy = q.x * q.y * 2.f;
+        float xz = q.x * q.z * 2.f;
+        float yz = q.y * q.z * 2.f;
+        float wx = q.w * q.x * 2.f;
+        float wy = q.w * q.y * 2.f;
+        float wz = q.w * q.z * 2.f;
+
+        // vfɏނƒ 16 oCg̓ǂݏoŃXgAtH[fBOȂ߁AsWX^őgݗĂď
+        Matrix4x4 mat;
+        MathSIMD::Store(mat.m_mat[0], MathSIMD::Mul(MathSIMD::Set(1.f - yy - zz, xy + wz, xz - wy, 0.f), MathSIMD::Splat(scale.x)));
+        MathSIMD::Store(mat.m_mat[1], MathSIMD::Mul(MathSIMD::Set(xy - wz, 1.f - xx - zz, yz + wx, 0.f), MathSIMD::Splat(scale.y)));
+        MathSIMD::Store(mat.m_mat[2], MathSIMD::Mul(MathSIMD::Set(xz + wy, yz - wx, 1.f - xx - yy, 0.f), MathSIMD::Splat(scale.z)));
+        MathSIMD::Store(mat.m_mat[3], MathSIMD::Set(trans.x, trans.y, trans.z, 1.f));
+        return mat;
+    }
+
     // sړs
     static Matrix4x4 TransitionToMatrix(const Vector3D& trans) noexcept
     {
@@ -324,6 +473,86 @@ public:
         m_mat[2][2] = trans.z;
     }
 
+private:
+#if defined(MATH_SIMD_SSE)
+    // =======================
+    // SSE ɂts (2x2 ubNsg]qWJ)
+    // M = | A B |  Ƃ |M| ƊeubN̗]q߂܂
+    //     | C D |
+    // =======================
+    static __m128 Mat2Mul(__m128 a, __m128 b) noexcept
+    {
+        // 2x2 s a * b
+        return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+            _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+    }
+
+    static __m128 Mat2AdjMul(__m128 a, __m128 b) noexcept
+    {
+        // 2x2 s̗]qs adj(a) * b
+        return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+            _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+    }
+
+    static __m128 Mat2MulAdj(__m128 a, __m128 b) noexcept
+    {
+        // 2x2 s a * adj(b)
+        return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+            _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+    }
+
+    static Matrix4x4 inverseSSE(const Matrix4x4& matrix) noexcept
+    {
+        const __m128 row0 = _mm_loadu_ps(matrix.m_mat[0]);
+        const __m128 row1 = _mm_loadu_ps(matrix.m_mat[1]);
+        const __m128 row2 = _mm_loadu_ps(matrix.m_mat[2]);
+        const __m128 row3 = _mm_loadu_ps(matrix.m_mat[3]);
+
+        // 2x2 ̏s
+        const __m128 A = _mm_movelh_ps(row0, row1);
+        const __m128 B = _mm_movehl_ps(row1, row0);
+        const __m128 C = _mm_movelh_ps(row2, row3);
+        const __m128 D = _mm_movehl_ps(row3, row2);
+
+        // es̍s (|A| |B| |C| |D|)
+        const __m128 detSub = _mm_sub_ps(
+            _mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(3, 1, 3, 1))),
+            _mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(2, 0, 2, 0))));
+        const __m128 detA = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(0, 0, 0, 0));
+        const __m128 detB = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m128 detC = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(2, 2, 2, 2));
+        const __m128 detD = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+        const __m128 D_C = Mat2AdjMul(D, C);
+        const __m128 A_B = Mat2AdjMul(A, B);
+        __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), Mat2Mul(B, D_C));
+        __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), Mat2Mul(C, A_B));
+        __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), Mat2MulAdj(D, A_B));
+        __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), Mat2MulAdj(A, D_C));
+
+        // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+        __m128 tr = _mm_mul_ps(A_B, _mm_shuffle_ps(D_C, D_C, _MM_SHUFFLE(3, 1, 2, 0)));
+        tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(2, 3, 0, 1)));
+        tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(1, 0, 3, 2)));
+        const __m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+
+        Matrix4x4 out;
+        if (_mm_cvtss_f32(detM) == 0.f) return out;
+
+        const __m128 rDetM = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), detM);
+        X = _mm_mul_ps(X, rDetM);
+        Y = _mm_mul_ps(Y, rDetM);
+        Z = _mm_mul_ps(Z, rDetM);
+        W = _mm_mul_ps(W, rDetM);
+
+        _mm_storeu_ps(out.m_mat[0], _mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3)));
+        _mm_storeu_ps(out.m_mat[1], _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2)));
+        _mm_storeu_ps(out.m_mat[2], _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3)));
+        _mm_storeu_ps(out.m_mat[3], _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2)));
+        return out;
+    }
+#endif
+
 public:
     float m_mat[4][4] = {};
 };
@@ -1,8 +1,7 @@
 #pragma once
-#include "pch.h"
-#include "Matrix4x4.h"
+#include <cmath>
 #include "Vector3D.h"
-#include "Math/MathUtility.h"
+#include "MathUtility.h"
 
 class Quaternion
 {
@@ -0,0 +1,417 @@
+#pragma once
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include "Quaternion.h"
+#include "Matrix4x4.h"
+#include "Matrix3x4.h"
+#include "MathSIMD.h"
+#include "Utilities/Parallel.h"
+
+// =======================
+// NH[^jIz̈ꊇ (Aj[VĐp)
+// 4vf SoA ɓ]u SIMD ŏA[̓XJ[ŏ܂
+// vfꍇ Parallel::For ŕĕɏ܂
+// ͂Əo͂ɓzn(Cv[X)\ł
+// =======================
+namespace QuaternionBatch
+{
+    //! @brief xƑx̂ǂD悷邩
+    enum class Precision
+    {
+        Accurate,   //!< sqrtEZEOp֐g (P̂̊֐Ɠ̐x)
+        Fast,       //!< rsqrt ̋ߎ⑽ߎg (Ό덷 1e-6 x)
+    };
+
+    //! ̗vfȏŕ񏈗ɐ؂ւ
+    constexpr size_t ParallelThreshold = 1u << 15;
+    //! 񏈗1Wu̍ŏvf
+    constexpr size_t ParallelMinBatch = 1u << 13;
+
+    static_assert(sizeof(Quaternion) == sizeof(float) * 4, "Quaternion must be tightly packed");
+
+    namespace Detail
+    {
+        using MathSIMD::float4;
+
+        struct Quat4
+        {
+            float4 x, y, z, w;
+        };
+
+        inline Quat4 Load4(const Quaternion* q) noexcept
+        {
+            Quat4 r = { MathSIMD::Load(&q[0].x), MathSIMD::Load(&q[1].x), MathSIMD::Load(&q[2].x), MathSIMD::Load(&q[3].x) };
+            MathSIMD::Transpose(r.x, r.y, r.z, r.w);
+            return r;
+        }
+
+        inline void Store4(Quaternion* q, Quat4 r) noexcept
+        {
+            MathSIMD::Transpose(r.x, r.y, r.z, r.w);
+            MathSIMD::Store(&q[0].x, r.x);
+            MathSIMD::Store(&q[1].x, r.y);
+            MathSIMD::Store(&q[2].x, r.z);
+            MathSIMD::Store(&q[3].x, r.w);
+        }
+
+        inline float4 Dot(const Quat4& a, const Quat4& b) noexcept
+        {
+            float4 d = MathSIMD::Mul(a.x, b.x);
+            d = MathSIMD::MulAdd(a.y, b.y, d);
+            d = MathSIMD::MulAdd(a.z, b.z, d);
+            return MathSIMD::MulAdd(a.w, b.w, d);
+        }
+
+        //  0 ̃NH[^jI͒PʃNH[^jI (0,0,0,1) ɂ܂
+        inline Quat4 Normalize4(const Quat4& q, Precision precision) noexcept
+        {
+            const float4 lenSq = Dot(q, q);
+            const float4 invLen = precision == Precision::Fast
+                ? MathSIMD::RsqrtFast(lenSq)
+                : MathSIMD::Div(MathSIMD::Splat(1.f), MathSIMD::Sqrt(lenSq));
+            const float4 zero = MathSIMD::CmpLT(lenSq, MathSIMD::Splat(SMALL_NUMBER));
+            Quat4 r;
+            r.x = MathSIMD::Select(zero, MathSIMD::Splat(0.f), MathSIMD::Mul(q.x, invLen));
+            r.y = MathSIMD::Select(zero, MathSIMD::Splat(0.f), MathSIMD::Mul(q.y, invLen));
+            r.z = MathSIMD::Select(zero, MathSIMD::Splat(0.f), MathSIMD::Mul(q.z, invLen));
+            r.w = MathSIMD::Select(zero, MathSIMD::Splat(1.f), MathSIMD::Mul(q.w, invLen));
+            return r;
+        }
+
+        inline Quat4 Blend4(const Quat4& a, const Quat4& b, float4 wa, float4 wb) noexcept
+        {
+            Quat4 r;
+            r.x = MathSIMD::MulAdd(b.x, wb, MathSIMD::Mul(a.x, wa));
+            r.y = MathSIMD::MulAdd(b.y, wb, MathSIMD::Mul(a.y, wa));
+            r.z = MathSIMD::MulAdd(b.z, wb, MathSIMD::Mul(a.z, wa));
+            r.w = MathSIMD::MulAdd(b.w, wb, MathSIMD::Mul(a.w, wa));
+            return r;
+        }
+
+        // ς̏ꍇ b 𔽓]čŒZoHŕԂ
+        inline float4 ShortestSign(float4 d) noexcept
+        {
+            return MathSIMD::Select(MathSIMD::CmpLT(d, MathSIMD::Splat(0.f)), MathSIMD::Splat(-1.f), MathSIMD::Splat(1.f));
+        }
+
+        inline Quat4 Nlerp4(const Quat4& a, const Quat4& b, float t, Precision precision) noexcept
+        {
+            const float4 sign = ShortestSign(Dot(a, b));
+            const float4 wa = MathSIMD::Splat(1.f - t);
+            const float4 wb = MathSIMD::Mul(MathSIMD::Splat(t), sign);
+            return Normalize4(Blend4(a, b, wa, wb), precision);
+        }
+
+        // =======================
+        // ߎɂ Slerp
+        // D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP" ̋WJ
+        // SlerpTermCount őł؂AOp֐g킸 sin(t*)/sin() ߎ܂
+        // ŏI̕␳W   [0, /2] Ō덷̍őlŏ (7e-7 x) ɂȂ悤Ă܂
+        // =======================
+        constexpr int SlerpTermCount = 12;
+
+        struct SlerpCoefficients
+        {
+            float u[SlerpTermCount];
+            float v[SlerpTermCount];
+
+            SlerpCoefficients() noexcept
+            {
+                constexpr float onePlusMu = 1.89416f;
+                for (int i = 0; i < SlerpTermCount; ++i)
+                {
+                    const float k = static_cast<float>(i + 1);
+                    u[i] = 1.f / (k * (2.f * k + 1.f));
+                    v[i] = k / (2.f * k + 1.f);
+                }
+                u[SlerpTermCount - 1] *= onePlusMu;
+                v[SlerpTermCount - 1] *= onePlusMu;
+            }
+        };
+
+        inline const SlerpCoefficients& GetSlerpCoefficients() noexcept
+        {
+            static const SlerpCoefficients coefficients;
+            return coefficients;
+        }
+
+        // cos() - 1  x Ƃ sin(t*)/sin() ߂
+        inline float4 SlerpWeightFast(const SlerpCoefficients& c, float4 xm1, float t) noexcept
+        {
+            const float4 sqrT = MathSIMD::Splat(t * t);
+            const float4 one = MathSIMD::Splat(1.f);
+            float4 r = one;
+            for (int i = SlerpTermCount - 1; i >= 0; --i)
+            {
+                const float4 b = MathSIMD::Mul(MathSIMD::Sub(MathSIMD::Mul(MathSIMD::Splat(c.u[i]), sqrT), MathSIMD::Splat(c.v[i])), xm1);
+                r = MathSIMD::MulAdd(b, r, one);
+            }
+            return MathSIMD::Mul(MathSIMD::Splat(t), r);
+        }
+
+        inline void SlerpWeightsAccurate(float cosTheta, float t, float& wa, float& wb) noexcept
+        {
+            // قړ̏ꍇ sin()  0 ɋ߂Â߁Asin(t)/sin()  t(1 + (1 - t^2)^2/6) ̓WJg
+            // (^2  2(1 - cos())A`Ԃ̂܂܂ƒő ^2/8 قǒZȂ)
+            if (cosTheta > 1.f - 1.e-5f)
+            {
+                const float oneMinusCos = 1.f - (std::min)(cosTheta, 1.f);
+                const float s = 1.f - t;
+                wa = s * (1.f + (1.f - s * s) * oneMinusCos * (1.f / 3.f));
+                wb = t * (1.f + (1.f - t * t) * oneMinusCos * (1.f / 3.f));
+                return;
+            }
+            const float theta = std::acos((std::min)(cosTheta, 1.f));
+            const float invSin = 1.f / std::sin(theta);
+            wa = std::sin((1.f - t) * theta) * invSin;
+            wb = std::sin(t * theta) * invSin;
+        }
+
+        inline Quat4 Slerp4(const Quat4& a, const Quat4& b, float t, Precision precision) noexcept
+        {
+            const float4 d = Dot(a, b);
+            const float4 sign = ShortestSign(d);
+            const float4 cosTheta = MathSIMD::Mul(d, sign);
+            float4 wa, wb;
+            if (precision == Precision::Fast)
+            {
+                const SlerpCoefficients& c = GetSlerpCoefficients();
+                const float4 xm1 = MathSIMD::Sub(cosTheta, MathSIMD::Splat(1.f));
+                wa = SlerpWeightFast(c, xm1, 1.f - t);
+                wb = SlerpWeightFast(c, xm1, t);
+            }
+            else
+            {
+                float cosArray[4], waArray[4], wbArray[4];
+                MathSIMD::Store(cosArray, cosTheta);
+                for (int i = 0; i < 4; ++i)
+                {
+                    SlerpWeightsAccurate(cosArray[i], t, waArray[i], wbArray[i]);
+                }
+                wa = MathSIMD::Load(waArray);
+                wb = MathSIMD::Load(wbArray);
+            }
+            return Blend4(a, b, wa, MathSIMD::Mul(wb, sign));
+        }
+
+        // =======================
+        // ]sւ̕ϊ (Matrix4x4::QuaternionToMatrix Ɠ)
+        // Accurate ̏ꍇ͒ŊAKĂȂ͂ɂΉ܂
+        // =======================
+        struct Rotation4
+        {
+            float4 m[3][3];
+        };
+
+        inline Rotation4 ToRotation4(const Quat4& q, Precision precision) noexcept
+        {
+            float4 s = MathSIMD::Splat(2.f);
+            if (precision == Precision::Accurate)
+            {
+                const float4 lenSq = Dot(q, q);
+                const float4 valid = MathSIMD::CmpLT(MathSIMD::Splat(SMALL_NUMBER), lenSq);
+                s = MathSIMD::Select(valid, MathSIMD::Div(s, lenSq), MathSIMD::Splat(0.f));
+            }
+            const float4 one = MathSIMD::Splat(1.f);
+            const float4 xx = MathSIMD::Mul(MathSIMD::Mul(q.x, q.x), s);
+            const float4 yy = MathSIMD::Mul(MathSIMD::Mul(q.y, q.y), s);
+            const float4 zz = MathSIMD::Mul(MathSIMD::Mul(q.z, q.z), s);
+            const float4 xy = MathSIMD::Mul(MathSIMD::Mul(q.x, q.y), s);
+            const float4 xz = MathSIMD::Mul(MathSIMD::Mul(q.x, q.z), s);
+            const float4 yz = MathSIMD::Mul(MathSIMD::Mul(q.y, q.z), s);
+            const float4 wx = MathSIMD::Mul(MathSIMD::Mul(q.w, q.x), s);
+            const float4 wy = MathSIMD::Mul(MathSIMD::Mul(q.w, q.y), s);
+            const float4 wz = MathSIMD::Mul(MathSIMD::Mul(q.w, q.z), s);
+
+            Rotation4 r;
+            r.m[0][0] = MathSIMD::Sub(MathSIMD::Sub(one, yy), zz);
+            r.m[0][1] = MathSIMD::Add(xy, wz);
+            r.m[0][2] = MathSIMD::Sub(xz, wy);
+            r.m[1][0] = MathSIMD::Sub(xy, wz);
+            r.m[1][1] = MathSIMD::Sub(MathSIMD::Sub(one, xx), zz);
+            r.m[1][2] = MathSIMD::Add(yz, wx);
+            r.m[2][0] = MathSIMD::Add(xz, wy);
+            r.m[2][1] = MathSIMD::Sub(yz, wx);
+            r.m[2][2] = MathSIMD::Sub(MathSIMD::Sub(one, xx), yy);
+            return r;
+        }
+
+        // [p1vf[ 0 ɍڂď
+        inline Quat4 LoadOne(const Quaternion& q) noexcept
+        {
+            return { MathSIMD::Splat(q.x), MathSIMD::Splat(q.y), MathSIMD::Splat(q.z), MathSIMD::Splat(q.w) };
+        }
+
+        inline Quaternion StoreOne(const Quat4& r) noexcept
+        {
+            float x[4], y[4], z[4], w[4];
+            MathSIMD::Store(x, r.x);
+            MathSIMD::Store(y, r.y);
+            MathSIMD::Store(z, r.z);
+            MathSIMD::Store(w, r.w);
+            return Quaternion(x[0], y[0], z[0], w[0]);
+        }
+
+        template<typename Kernel>
+        void Run(size_t count, Kernel&& kernel)
+        {
+            if (count < ParallelThreshold)
+            {
+                kernel(static_cast<size_t>(0), count);
+                return;
+            }
+            Parallel::For(count, ParallelMinBatch, kernel);
+        }
+    }
+
+    // =======================
+    // K
+    // =======================
+    inline void Normalize(const Quaternion* src, Quaternion* dst, size_t count, Precision precision = Precision::Accurate)
+    {
+        Detail::Run(count, [=](size_t begin, size_t end)
+            {
+                size_t i = begin;
+                for (; i + 4 <= end; i += 4)
+                {
+                    Detail::Store4(dst + i, Detail::Normalize4(Detail::Load4(src + i), precision));
+                }
+                for (; i < end; ++i)
+                {
+                    dst[i] = Detail::StoreOne(Detail::Normalize4(Detail::LoadOne(src[i]), precision));
+                }
+            });
+    }
+
+    // =======================
+    // K` (ŒZoH)
+    // =======================
+    inline void Nlerp(const Quaternion* from, const Quaternion* to, float t, Quaternion* dst, size_t count, Precision precision = Precision::Accurate)
+    {
+        Detail::Run(count, [=](size_t begin, size_t end)
+            {
+                size_t i = begin;
+                for (; i + 4 <= end; i += 4)
+                {
+                    Detail::Store4(dst + i, Detail::Nlerp4(Detail::Load4(from + i), Detail::Load4(to + i), t, precision));
+                }
+                for (; i < end; ++i)
+                {
+                    dst[i] = Detail::StoreOne(Detail::Nlerp4(Detail::LoadOne(from[i]), Detail::LoadOne(to[i]), t, precision));
+                }
+            });
+    }
+
+    // =======================
+    // ʐ` (ŒZoH)
+    // ͂͐Kς݂ł邱ƂOƂ܂
+    // =======================
+    inline void Slerp(const Quaternion* from, const Quaternion* to, float t, Quaternion* dst, size_t count, Precision precision = Precision::Accurate)
+    {
+        Detail::Run(count, [=](size_t begin, size_t end)
+            {
+                size_t i = begin;
+                for (; i + 4 <= end; i += 4)
+                {
+                    Detail::Store4(dst + i, Detail::Slerp4(Detail::Load4(from + i), Detail::Load4(to + i), t, precision));
+                }
+                for (; i < end; ++i)
+                {
+                    dst[i] = Detail::StoreOne(Detail::Slerp4(Detail::LoadOne(from[i]), Detail::LoadOne(to[i]), t, precision));
+                }
+            });
+    }
+
+    // =======================
+    // ]sւ̈ꊇϊ
+    // Fast ͐Kς݂̓͂O Matrix4x4::QuaternionToMatrix ƓʂԂ܂
+    // =======================
+    inline void ToMatrix(const Quaternion* src, Matrix4x4* dst, size_t count, Precision precision = Precision::Fast)
+    {
+        Detail::Run(count, [=](size_t begin, size_t end)
+            {
+                const MathSIMD::float4 zero = MathSIMD::Splat(0.f);
+                size_t i = begin;
+                for (; i < end; i += 4)
+                {
+                    const size_t n = (std::min)(end - i, static_cast<size_t>(4));
+                    Detail::Quat4 q;
+                    if (n == 4)
+                    {
+                        q = Detail::Load4(src + i);
+                    }
+                    else
+                    {
+                        Quaternion tmp[4] = { Quaternion(0.f, 0.f, 0.f, 1.f), Quaternion(0.f, 0.f, 0.f, 1.f), Quaternion(0.f, 0.f, 0.f, 1.f), Quaternion(0.f, 0.f, 0.f, 1.f) };
+                        for (size_t k = 0; k < n; ++k) tmp[k] = src[i + k];
+                        q = Detail::Load4(tmp);
+                    }
+                    const Detail::Rotation4 r = Detail::ToRotation4(q, precision);
+
+                    // rows[row][k] = k Ԗڂ̍s row s
+                    MathSIMD::float4 rows[3][4];
+                    for (int row = 0; row < 3; ++row)
+                    {
+                        rows[row][0] = r.m[row][0];
+                        rows[row][1] = r.m[row][1];
+                        rows[row][2] = r.m[row][2];
+                        rows[row][3] = zero;
+                        MathSIMD::Transpose(rows[row][0], rows[row][1], rows[row][2], rows[row][3]);
+                    }
+                    for (size_t k = 0; k < n; ++k)
+                    {
+                        Matrix4x4& mat = dst[i + k];
+                        MathSIMD::Store(mat.m_mat[0], rows[0][k]);
+                        MathSIMD::Store(mat.m_mat[1], rows[1][k]);
+                        MathSIMD::Store(mat.m_mat[2], rows[2][k]);
+                        MathSIMD::Store(mat.m_mat[3], MathSIMD::Set(0.f, 0.f, 0.f, 1.f));
+                    }
+                }
+            });
+    }
+
+    //! @brief sړȂ Matrix3x4 Ƃďo (XLjOs̍\zp)
+    inline void ToMatrix3x4(const Quaternion* src, Matrix3x4* dst, size_t count, Precision precision = Precision::Fast)
+    {
+        Detail::Run(count, [=](size_t begin, size_t end)
+            {
+                const MathSIMD::float4 zero = MathSIMD::Splat(0.f);
+                size_t i = begin;
+                for (; i < end; i += 4)
+                {
+                    const size_t n = (std::min)(end - i, static_cast<size_t>(4));
+                    Detail::Quat4 q;
+                    if (n == 4)
+                    {
+                        q = Detail::Load4(src + i);
+                    }
+                    else
+                    {
+                        Quaternion tmp[4] = { Quaternion(0.f, 0.f, 0.f, 1.f), Quaternion(0.f, 0.f, 0.f, 1.f), Quaternion(0.f, 0.f, 0.f, 1.f), Quaternion(0.f, 0.f, 0.f, 1.f) };
+                        for (size_t k = 0; k < n; ++k) tmp[k] = src[i + k];
+                        q = Detail::Load4(tmp);
+                    }
+                    const Detail::Rotation4 r = Detail::ToRotation4(q, precision);
+
+                    // Matrix3x4  Matrix4x4 ̓]uȂ̂ŗׂ
+                    MathSIMD::float4 rows[3][4];
+                    for (int col = 0; col < 3; ++col)
+                    {
+                        rows[col][0] = r.m[0][col];
+                        rows[col][1] = r.m[1][col];
+                        rows[col][2] = r.m[2][col];
+                        rows[col][3] = zero;
+                        MathSIMD::Transpose(rows[col][0], rows[col][1], rows[col][2], rows[col][3]);
+                    }
+                    for (size_t k = 0; k < n; ++k)
+                    {
+                        Matrix3x4& mat = dst[i + k];
+                        MathSIMD::Store(mat.m_mat[0], rows[0][k]);
+                        MathSIMD::Store(mat.m_mat[1], rows[1][k]);
+                        MathSIMD::Store(mat.m_mat[2], rows[2][k]);
+                    }
+                }
+            });
+    }
+}
@@ -0,0 +1,278 @@
+#pragma once
+#include <cstddef>
+#include "Vector3D.h"
+#include "Matrix4x4.h"
+#include "MathSIMD.h"
+#include "Utilities/Parallel.h"
+
+// =======================
+// sɂ_ExNg̈ꊇϊ
+// AoS (Vector3D z)  SoA (x/y/z ʔz) ̗ɑΉ܂
+// vfꍇ Parallel::For ŕĕɏ܂
+// ͂Əo͂ɓzn(Cv[Xϊ)\ł
+// =======================
+namespace TransformBatch
+{
+    //! @brief ϊ̎
+    enum class Mode
+    {
+        Point,      //!< w = 1 Ƃĕϊ (sړ)
+        Direction,  //!< w = 0 Ƃĕϊ (sړȂ)
+        Project,    //!< w = 1 ƂĕϊAw ŏZ (ˉeϊp)
+    };
+
+    //! ̗vfȏŕ񏈗ɐ؂ւ
+    constexpr size_t ParallelThreshold = 1u << 16;
+    //! 񏈗1Wu̍ŏvf
+    constexpr size_t ParallelMinBatch = 1u << 14;
+
+    static_assert(sizeof(Vector3D) == sizeof(float) * 3, "Vector3D must be tightly packed");
+
+    namespace Detail
+    {
+        // s̊evf[ŜɓWJ
+        struct SplatMatrix
+        {
+            MathSIMD::float4 m[4][4];
+
+            explicit SplatMatrix(const Matrix4x4& matrix) noexcept
+            {
+                for (int row = 0; row < 4; ++row)
+                {
+                    for (int col = 0; col < 4; ++col)
+                    {
+                        m[row][col] = MathSIMD::Splat(matrix.m_mat[row][col]);
+                    }
+                }
+            }
+        };
+
+        // 1񕪂̌vZ (Matrix4x4::Apply ƓZ)
+        template<Mode mode>
+        inline MathSIMD::float4 Column(const SplatMatrix& s, int col,
+            MathSIMD::float4 x, MathSIMD::float4 y, MathSIMD::float4 z) noexcept
+        {
+            MathSIMD::float4 r = MathSIMD::Mul(x, s.m[0][col]);
+            r = MathSIMD::MulAdd(y, s.m[1][col], r);
+            r = MathSIMD::MulAdd(z, s.m[2][col], r);
+            if constexpr (mode != Mode::Direction)
+            {
+                r = MathSIMD::Add(r, s.m[3][col]);
+            }
+            return r;
+        }
+
+        // 4vf SoA ŕϊ
+        template<Mode mode>
+        inline void Transform4(const SplatMatrix& s,
+            MathSIMD::float4& x, MathSIMD::float4& y, MathSIMD::float4& z) noexcept
+        {
+            MathSIMD::float4 ox = Column<mode>(s, 0, x, y, z);
+            MathSIMD::float4 oy = Column<mode>(s, 1, x, y, z);
+            MathSIMD::float4 oz = Column<mode>(s, 2, x, y, z);
+            if constexpr (mode == Mode::Project)
+            {
+                const MathSIMD::float4 ow = Column<mode>(s, 3, x, y, z);
+                ox = MathSIMD::Div(ox, ow);
+                oy = MathSIMD::Div(oy, ow);
+                oz = MathSIMD::Div(oz, ow);
+            }
+            x = ox;
+            y = oy;
+            z = oz;
+        }
+
+        // 1vfXJ[ŕϊ ([p)
+        template<Mode mode>
+        inline void TransformOne(const Matrix4x4& matrix, float& x, float& y, float& z) noexcept
+        {
+            const auto& m = matrix.m_mat;
+            float out[4];
+            for (int col = 0; col < 4; ++col)
+            {
+                float r = x * m[0][col];
+                r = y * m[1][col] + r;
+                r = z * m[2][col] + r;
+                if constexpr (mode != Mode::Direction)
+                {
+                    r = r + m[3][col];
+                }
+                out[col] = r;
+            }
+            if constexpr (mode == Mode::Project)
+            {
+                out[0] /= out[3];
+                out[1] /= out[3];
+                out[2] /= out[3];
+            }
+            x = out[0];
+            y = out[1];
+            z = out[2];
+        }
+
+#if defined(MATH_SIMD_SSE)
+        // x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3 -> xxxx | yyyy | zzzz
+        inline void Deinterleave3(__m128 a, __m128 b, __m128 c, __m128& x, __m128& y, __m128& z) noexcept
+        {
+            const __m128 x23 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+            x = _mm_shuffle_ps(a, x23, _MM_SHUFFLE(2, 0, 3, 0));
+            const __m128 y01 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+            const __m128 y23 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+            y = _mm_shuffle_ps(y01, y23, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m128 z01 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+            z = _mm_shuffle_ps(z01, c, _MM_SHUFFLE(3, 0, 2, 0));
+        }
+
+        // xxxx | yyyy | zzzz -> x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+        inline void Interleave3(__m128 x, __m128 y, __m128 z, __m128& a, __m128& b, __m128& c) noexcept
+        {
+            const __m128 xy01 = _mm_unpacklo_ps(x, y);
+            const __m128 z0x1 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+            a = _mm_shuffle_ps(xy01, z0x1, _MM_SHUFFLE(2, 0, 1, 0));
+            const __m128 y1z1 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+            const __m128 x2y2 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2));
+            b = _mm_shuffle_ps(y1z1, x2y2, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m128 z2x3 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+            const __m128 y3z3 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+            c = _mm_shuffle_ps(z2x3, y3z3, _MM_SHUFFLE(2, 0, 2, 0));
+        }
+#endif
+
+        template<Mode mode>
+        void TransformRangeAoS(const Matrix4x4& matrix, const Vector3D* src, Vector3D* dst, size_t begin, size_t end) noexcept
+        {
+            size_t i = begin;
+#if defined(MATH_SIMD_SSE) || defined(MATH_SIMD_NEON)
+            const SplatMatrix s(matrix);
+            for (; i + 4 <= end; i += 4)
+            {
+                const float* in = &src[i].x;
+                float* out = &dst[i].x;
+#if defined(MATH_SIMD_SSE)
+                __m128 x, y, z;
+                Deinterleave3(_mm_loadu_ps(in), _mm_loadu_ps(in + 4), _mm_loadu_ps(in + 8), x, y, z);
+                Transform4<mode>(s, x, y, z);
+                __m128 a, b, c;
+                Interleave3(x, y, z, a, b, c);
+                _mm_storeu_ps(out, a);
+                _mm_storeu_ps(out + 4, b);
+                _mm_storeu_ps(out + 8, c);
+#else
+                float32x4x3_t v = vld3q_f32(in);
+                Transform4<mode>(s, v.val[0], v.val[1], v.val[2]);
+                vst3q_f32(out, v);
+#endif
+            }
+#endif
+            for (; i < end; ++i)
+            {
+                float x = src[i].x, y = src[i].y, z = src[i].z;
+                TransformOne<mode>(matrix, x, y, z);
+                dst[i] = Vector3D(x, y, z);
+            }
+        }
+
+        template<Mode mode>
+        void TransformRangeSoA(const Matrix4x4& matrix,
+            const float* inX, const float* inY, const float* inZ,
+            float* outX, float* outY, float* outZ, size_t begin, size_t end) noexcept
+        {
+            size_t i = begin;
+#if defined(MATH_SIMD_SSE) || defined(MATH_SIMD_NEON)
+            const SplatMatrix s(matrix);
+            for (; i + 4 <= end; i += 4)
+            {
+                MathSIMD::float4 x = MathSIMD::Load(inX + i);
+                MathSIMD::float4 y = MathSIMD::Load(inY + i);
+                MathSIMD::float4 z = MathSIMD::Load(inZ + i);
+                Transform4<mode>(s, x, y, z);
+                MathSIMD::Store(outX + i, x);
+                MathSIMD::Store(outY + i, y);
+                MathSIMD::Store(outZ + i, z);
+            }
+#endif
+            for (; i < end; ++i)
+            {
+                float x = inX[i], y = inY[i], z = inZ[i];
+                TransformOne<mode>(matrix, x, y, z);
+                outX[i] = x;
+                outY[i] = y;
+                outZ[i] = z;
+            }
+        }
+
+        template<Mode mode>
+        void TransformAoS(const Matrix4x4& matrix, const Vector3D* src, Vector3D* dst, size_t count)
+        {
+            if (count < ParallelThreshold)
+            {
+                TransformRangeAoS<mode>(matrix, src, dst, 0, count);
+                return;
+            }
+            Parallel::For(count, ParallelMinBatch, [&](size_t begin, size_t end)
+                {
+                    TransformRangeAoS<mode>(matrix, src, dst, begin, end);
+                });
+        }
+
+        template<Mode mode>
+        void TransformSoA(const Matrix4x4& matrix,
+            const float* inX, const float* inY, const float* inZ,
+            float* outX, float* outY, float* outZ, size_t count)
+        {
+            if (count < ParallelThreshold)
+            {
+                TransformRangeSoA<mode>(matrix, inX, inY, inZ, outX, outY, outZ, 0, count);
+                return;
+            }
+            Parallel::For(count, ParallelMinBatch, [&](size_t begin, size_t end)
+                {
+                    TransformRangeSoA<mode>(matrix, inX, inY, inZ, outX, outY, outZ, begin, end);
+                });
+        }
+    }
+
+    // =======================
+    // AoS (Vector3D z)
+    // =======================
+    inline void TransformPoints(const Matrix4x4& matrix, const Vector3D* src, Vector3D* dst, size_t count)
+    {
+        Detail::TransformAoS<Mode::Point>(matrix, src, dst, count);
+    }
+
+    inline void TransformDirections(const Matrix4x4& matrix, const Vector3D* src, Vector3D* dst, size_t count)
+    {
+        Detail::TransformAoS<Mode::Direction>(matrix, src, dst, count);
+    }
+
+    //! @brief ϊ w ŏZ܂ (w  0 ɂȂ_͌ĂяoŏOĂ)
+    inline void TransformPointsProject(const Matrix4x4& matrix, const Vector3D* src, Vector3D* dst, size_t count)
+    {
+        Detail::TransformAoS<Mode::Project>(matrix, src, dst, count);
+    }
+
+    // =======================
+    // SoA (x/y/z ʔz)
+    // =======================
+    inline void TransformPoints(const Matrix4x4& matrix,
+        const float* inX, const float* inY, const float* inZ,
+        float* outX, float* outY, float* outZ, size_t count)
+    {
+        Detail::TransformSoA<Mode::Point>(matrix, inX, inY, inZ, outX, outY, outZ, count);
+    }
+
+    inline void TransformDirections(const Matrix4x4& matrix,
+        const float* inX, const float* inY, const float* inZ,
+        float* outX, float* outY, float* outZ, size_t count)
+    {
+        Detail::TransformSoA<Mode::Direction>(matrix, inX, inY, inZ, outX, outY, outZ, count);
+    }
+
+    //! @brief ϊ w ŏZ܂ (w  0 ɂȂ_͌ĂяoŏOĂ)
+    inline void TransformPointsProject(const Matrix4x4& matrix,
+        const float* inX, const float* inY, const float* inZ,
+        float* outX, float* outY, float* outZ, size_t count)
+    {
+        Detail::TransformSoA<Mode::Project>(matrix, inX, inY, inZ, outX, outY, outZ, count);
+    }
+}
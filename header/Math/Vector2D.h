@@ -1,5 +1,6 @@
 #pragma once
-#include "pch.h"
+#include <cmath>
+#include "MathUtility.h"
 
 class Vector2D
 {
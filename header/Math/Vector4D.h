@@ -1,6 +1,6 @@
 #pragma once
-#pragma once
-#include "pch.h"
+#include <cmath>
+#include "MathUtility.h"
 
 class Vector4D
 {
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include "Utilities/MappedFile.h"
+
+/// <summary>
+/// t@CẽnbV (LbVÂȂ̔pŁAÍwIȋx͂܂)
+/// oCg񂾂狁߂̂ŁAWindows ƃc[𓮂 OS œlɂȂ܂
+/// </summary>
+namespace FileHash
+{
+    constexpr uint64_t FNVOffsetBasis = 14695981039346656037ULL;
+    constexpr uint64_t FNVPrime = 1099511628211ULL;
+
+    /// <summary>
+    /// FNV-1a  8 oCgPʂœKp܂
+    /// </summary>
+    inline uint64_t HashBytes(uint64_t hash, const uint8_t* pData, size_t size)
+    {
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+        {
+            uint64_t word;
+            std::memcpy(&word, pData + i, sizeof(uint64_t));
+            hash ^= word;
+            hash *= FNVPrime;
+        }
+        for (; i < size; ++i)
+        {
+            hash ^= pData[i];
+            hash *= FNVPrime;
+        }
+        return hash;
+    }
+
+    /// <summary>
+    /// t@C̃TCYƓe hash ɉ܂
+    /// </summary>
+    /// <returns> t@CJȂꍇ false (hash ͕ς܂) </returns>
+    inline bool HashFile(const std::wstring& filePath, uint64_t& hash)
+    {
+        MappedFile file(filePath);
+        if (!file.IsOpen())
+        {
+            return false;
+        }
+        const uint64_t size = file.GetSize();
+        hash = HashBytes(hash, reinterpret_cast<const uint8_t*>(&size), sizeof(size));
+        hash = HashBytes(hash, file.GetData(), file.GetSize());
+        return true;
+    }
+}
@@ -0,0 +1,371 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// ǂݎp JSON l (glTF ̂悤ȏȐݒt@C)
+/// IuWFNg͋Lq̂܂ܕێAL[͐`Tň܂
+/// </summary>
+class JsonValue
+{
+public:
+    enum class Type : uint8_t
+    {
+        Null,
+        Bool,
+        Number,
+        String,
+        Array,
+        Object,
+    };
+
+    Type GetType() const { return m_Type; }
+    bool IsNull() const { return m_Type == Type::Null; }
+    bool IsNumber() const { return m_Type == Type::Number; }
+    bool IsString() const { return m_Type == Type::String; }
+    bool IsArray() const { return m_Type == Type::Array; }
+    bool IsObject() const { return m_Type == Type::Object; }
+
+    bool GetBool(bool defaultValue = false) const
+    {
+        return m_Type == Type::Bool ? m_Bool : defaultValue;
+    }
+
+    double GetNumber(double defaultValue = 0.0) const
+    {
+        return m_Type == Type::Number ? m_Number : defaultValue;
+    }
+
+    //! @brief 񕉂̐ƂĎ擾 (lłȂEEȂ defaultValue)
+    int64_t GetIndex(int64_t defaultValue = -1) const
+    {
+        if (m_Type != Type::Number || m_Number < 0.0 || m_Number != static_cast<double>(static_cast<int64_t>(m_Number)))
+        {
+            return defaultValue;
+        }
+        return static_cast<int64_t>(m_Number);
+    }
+
+    const std::string& GetString() const
+    {
+        static const std::string empty;
+        return m_Type == Type::String ? m_String : empty;
+    }
+
+    //! @brief zEIuWFNg̗vf
+    size_t Size() const
+    {
+        if (m_Type == Type::Array) return m_Array.size();
+        if (m_Type == Type::Object) return m_Object.size();
+        return 0;
+    }
+
+    //! @brief z̗vf (͈͊OȂ Null)
+    const JsonValue& operator[](size_t index) const
+    {
+        return (m_Type == Type::Array && index < m_Array.size()) ? m_Array[index] : GetNull();
+    }
+
+    //! @brief IuWFNg̃o[܂ (Ȃ nullptr)
+    const JsonValue* Find(const char* key) const
+    {
+        if (m_Type != Type::Object) return nullptr;
+        for (const auto& member : m_Object)
+        {
+            if (member.first == key)
+            {
+                return &member.second;
+            }
+        }
+        return nullptr;
+    }
+
+    //! @brief IuWFNg̃o[ (Ȃ Null)
+    const JsonValue& operator[](const char* key) const
+    {
+        const JsonValue* pValue = Find(key);
+        return pValue != nullptr ? *pValue : GetNull();
+    }
+
+    const std::vector<JsonValue>& GetArray() const { return m_Array; }
+    const std::vector<std::pair<std::string, JsonValue>>& GetMembers() const { return m_Object; }
+
+    /// <summary>
+    /// UTF-8  JSON eLXg͂܂ (I[ '\0' ͕svł)
+    /// </summary>
+    /// <returns> ͂ɐ true </returns>
+    static bool Parse(const char* pText, size_t size, JsonValue& outValue)
+    {
+        Parser parser = { pText, pText + size };
+        outValue = JsonValue();
+        if (!parser.ParseValue(outValue, 0))
+        {
+            return false;
+        }
+        parser.SkipWhitespace();
+        return parser.pCur == parser.pEnd;
+    }
+
+private:
+    static const JsonValue& GetNull()
+    {
+        static const JsonValue null;
+        return null;
+    }
+
+    struct Parser
+    {
+        //! q̐[̏ (ꂽt@CŃX^bNg؂Ȃ悤)
+        static constexpr uint32_t MaxDepth = 256;
+
+        const char* pCur;
+        const char* pEnd;
+
+        void SkipWhitespace()
+        {
+            while (pCur < pEnd && (*pCur == ' ' || *pCur == '\t' || *pCur == '\n' || *pCur == '\r'))
+            {
+                ++pCur;
+            }
+        }
+
+        bool Consume(const char* pLiteral)
+        {
+            const char* p = pCur;
+            for (; *pLiteral != '\0'; ++pLiteral, ++p)
+            {
+                if (p >= pEnd || *p != *pLiteral) return false;
+            }
+            pCur = p;
+            return true;
+        }
+
+        bool ParseValue(JsonValue& out, uint32_t depth)
+        {
+            if (depth > MaxDepth) return false;
+            SkipWhitespace();
+            if (pCur >= pEnd) return false;
+
+            switch (*pCur)
+            {
+            case '{': return ParseObject(out, depth);
+            case '[': return ParseArray(out, depth);
+            case '"':
+                out.m_Type = Type::String;
+                return ParseString(out.m_String);
+            case 't':
+                out.m_Type = Type::Bool;
+                out.m_Bool = true;
+                return Consume("true");
+            case 'f':
+                out.m_Type = Type::Bool;
+                out.m_Bool = false;
+                return Consume("false");
+            case 'n':
+                out.m_Type = Type::Null;
+                return Consume("null");
+            default:
+                out.m_Type = Type::Number;
+                return ParseNumber(out.m_Number);
+            }
+        }
+
+        bool ParseObject(JsonValue& out, uint32_t depth)
+        {
+            out.m_Type = Type::Object;
+            ++pCur; // '{'
+            SkipWhitespace();
+            if (pCur < pEnd && *pCur == '}')
+            {
+                ++pCur;
+                return true;
+            }
+            for (;;)
+            {
+                SkipWhitespace();
+                if (pCur >= pEnd || *pCur != '"') return false;
+                out.m_Object.emplace_back();
+                auto& member = out.m_Object.back();
+                if (!ParseString(member.first)) return false;
+                SkipWhitespace();
+                if (pCur >= pEnd || *pCur != ':') return false;
+                ++pCur;
+                if (!ParseValue(member.second, depth + 1)) return false;
+                SkipWhitespace();
+                if (pCur >= pEnd) return false;
+                if (*pCur == ',')
+                {
+                    ++pCur;
+                    continue;
+                }
+                if (*pCur == '}')
+                {
+                    ++pCur;
+                    return true;
+                }
+                return false;
+            }
+        }
+
+        bool ParseArray(JsonValue& out, uint32_t depth)
+        {
+            out.m_Type = Type::Array;
+            ++pCur; // '['
+            SkipWhitespace();
+            if (pCur < pEnd && *pCur == ']')
+            {
+                ++pCur;
+                return true;
+            }
+            for (;;)
+            {
+                out.m_Array.emplace_back();
+                if (!ParseValue(out.m_Array.back(), depth + 1)) return false;
+                SkipWhitespace();
+                if (pCur >= pEnd) return false;
+                if (*pCur == ',')
+                {
+                    ++pCur;
+                    continue;
+                }
+                if (*pCur == ']')
+                {
+                    ++pCur;
+                    return true;
+                }
+                return false;
+            }
+        }
+
+        bool ParseNumber(double& out)
+        {
+            // }bveLXg '\0' ŏIĂȂ̂ŁAlRs[ strtod ɓn
+            const char* pBegin = pCur;
+            while (pCur < pEnd && ((*pCur >= '0' && *pCur <= '9') ||
+                *pCur == '-' || *pCur == '+' || *pCur == '.' || *pCur == 'e' || *pCur == 'E'))
+            {
+                ++pCur;
+            }
+            const size_t length = static_cast<size_t>(pCur - pBegin);
+            char buffer[64];
+            if (length == 0 || length >= sizeof(buffer)) return false;
+            for (size_t i = 0; i < length; ++i)
+            {
+                buffer[i] = pBegin[i];
+            }
+            buffer[length] = '\0';
+            char* pParsedEnd = nullptr;
+            out = std::strtod(buffer, &pParsedEnd);
+            return pParsedEnd == buffer + length;
+        }
+
+        bool ParseHex4(uint32_t& out)
+        {
+            if (pEnd - pCur < 4) return false;
+            out = 0;
+            for (int i = 0; i < 4; ++i, ++pCur)
+            {
+                const char c = *pCur;
+                out <<= 4;
+                if (c >= '0' && c <= '9') out |= static_cast<uint32_t>(c - '0');
+                else if (c >= 'a' && c <= 'f') out |= static_cast<uint32_t>(c - 'a' + 10);
+                else if (c >= 'A' && c <= 'F') out |= static_cast<uint32_t>(c - 'A' + 10);
+                else return false;
+            }
+            return true;
+        }
+
+        static void AppendUtf8(std::string& out, uint32_t codePoint)
+        {
+            if (codePoint < 0x80)
+            {
+                out += static_cast<char>(codePoint);
+            }
+            else if (codePoint < 0x800)
+            {
+                out += static_cast<char>(0xC0 | (codePoint >> 6));
+                out += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else if (codePoint < 0x10000)
+            {
+                out += static_cast<char>(0xE0 | (codePoint >> 12));
+                out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else
+            {
+                out += static_cast<char>(0xF0 | (codePoint >> 18));
+                out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+        }
+
+        bool ParseString(std::string& out)
+        {
+            ++pCur; // '"'
+            // GXP[v̂ȂԂ͂܂Ƃ߂Ēǉ
+            const char* pRun = pCur;
+            while (pCur < pEnd)
+            {
+                const char c = *pCur;
+                if (c == '"')
+                {
+                    out.append(pRun, pCur);
+                    ++pCur;
+                    return true;
+                }
+                if (c != '\\')
+                {
+                    ++pCur;
+                    continue;
+                }
+
+                out.append(pRun, pCur);
+                ++pCur;
+                if (pCur >= pEnd) return false;
+                const char escape = *pCur++;
+                switch (escape)
+                {
+                case '"': out += '"'; break;
+                case '\\': out += '\\'; break;
+                case '/': out += '/'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'n': out += '\n'; break;
+                case 'r': out += '\r'; break;
+                case 't': out += '\t'; break;
+                case 'u':
+                {
+                    uint32_t codePoint = 0;
+                    if (!ParseHex4(codePoint)) return false;
+                    // TQ[gyA
+                    if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+                    {
+                        uint32_t low = 0;
+                        if (!Consume("\\u") || !ParseHex4(low) || low < 0xDC00 || low > 0xDFFF) return false;
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    AppendUtf8(out, codePoint);
+                    break;
+                }
+                default:
+                    return false;
+                }
+                pRun = pCur;
+            }
+            return false;
+        }
+    };
+
+    Type m_Type = Type::Null;
+    bool m_Bool = false;
+    double m_Number = 0.0;
+    std::string m_String;
+    std::vector<JsonValue> m_Array;
+    std::vector<std::pair<std::string, JsonValue>> m_Object;
+};
@@ -0,0 +1,154 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#ifdef _WIN32
+#include "pch.h"
+#else
+#include <filesystem>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/// <summary>
+/// ǂݎpŃ}bvt@C
+/// Windows ȊOł mmap ĝŁA[_[c[g܂
+/// </summary>
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::wstring& filePath)
+    {
+        Open(filePath);
+    }
+    ~MappedFile()
+    {
+        Close();
+    }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// <summary>
+    /// t@CJă}bv܂
+    /// </summary>
+    /// <returns>  true (t@CƂ GetSize() == 0 ɂȂ܂) </returns>
+    bool Open(const std::wstring& filePath)
+    {
+        Close();
+#ifdef _WIN32
+        m_File = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (m_File == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER size = {};
+        if (!GetFileSizeEx(m_File, &size))
+        {
+            Close();
+            return false;
+        }
+        m_Size = static_cast<size_t>(size.QuadPart);
+        if (m_Size == 0)
+        {
+            return true;
+        }
+
+        m_Mapping = CreateFileMappingW(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (m_Mapping == nullptr)
+        {
+            Close();
+            return false;
+        }
+        m_pData = static_cast<const uint8_t*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0));
+        if (m_pData == nullptr)
+        {
+            Close();
+            return false;
+        }
+        return true;
+#else
+        m_File = open(std::filesystem::path(filePath).c_str(), O_RDONLY);
+        if (m_File < 0)
+        {
+            return false;
+        }
+
+        struct stat st = {};
+        if (fstat(m_File, &st) != 0)
+        {
+            Close();
+            return false;
+        }
+        m_Size = static_cast<size_t>(st.st_size);
+        if (m_Size == 0)
+        {
+            return true;
+        }
+
+        void* pData = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, m_File, 0);
+        if (pData == MAP_FAILED)
+        {
+            Close();
+            return false;
+        }
+        m_pData = static_cast<const uint8_t*>(pData);
+        return true;
+#endif
+    }
+
+    void Close()
+    {
+#ifdef _WIN32
+        if (m_pData != nullptr)
+        {
+            UnmapViewOfFile(m_pData);
+            m_pData = nullptr;
+        }
+        if (m_Mapping != nullptr)
+        {
+            CloseHandle(m_Mapping);
+            m_Mapping = nullptr;
+        }
+        if (m_File != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(m_File);
+            m_File = INVALID_HANDLE_VALUE;
+        }
+#else
+        if (m_pData != nullptr)
+        {
+            munmap(const_cast<uint8_t*>(m_pData), m_Size);
+            m_pData = nullptr;
+        }
+        if (m_File >= 0)
+        {
+            close(m_File);
+            m_File = -1;
+        }
+#endif
+        m_Size = 0;
+    }
+
+#ifdef _WIN32
+    bool IsOpen() const { return m_File != INVALID_HANDLE_VALUE; }
+#else
+    bool IsOpen() const { return m_File >= 0; }
+#endif
+    const uint8_t* GetData() const { return m_pData; }
+    size_t GetSize() const { return m_Size; }
+
+private:
+#ifdef _WIN32
+    HANDLE m_File = INVALID_HANDLE_VALUE;
+    HANDLE m_Mapping = nullptr;
+#else
+    int m_File = -1;
+#endif
+    const uint8_t* m_pData = nullptr;
+    size_t m_Size = 0;
+};
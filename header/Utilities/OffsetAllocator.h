@@ -0,0 +1,228 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// [0, capacity) ͈̔͂ItZbgPʂŐ؂蕪AP[^
+/// ͎̂Ȃ̂ŁAGPU obt@̃TuAP[VȂǂɎg܂ (D3D12 Ɉˑ܂)
+/// 󂫗̈̓TCYɂێA܂钆ōł̈悩mۂ܂ (best-fit)
+/// </summary>
+class OffsetAllocator
+{
+public:
+    //! mۂɎsꍇ̃ItZbg
+    static constexpr uint64_t InvalidOffset = UINT64_MAX;
+
+    /// <summary>
+    /// Defragment() ɂړ (ړړ Size oCgRs[Ă)
+    /// </summary>
+    struct Move
+    {
+        uint64_t SrcOffset = 0;
+        uint64_t DstOffset = 0;
+        uint64_t Size = 0;
+    };
+
+    explicit OffsetAllocator(uint64_t capacity = 0)
+    {
+        Reset(capacity);
+    }
+
+    //! @brief SĂ̊mۂjAeʂݒ肵܂
+    void Reset(uint64_t capacity)
+    {
+        m_Capacity = capacity;
+        m_UsedSize = 0;
+        m_FreeBlocks.clear();
+        m_FreeBySize.clear();
+        m_Allocations.clear();
+        if (capacity > 0)
+        {
+            InsertFreeBlock(0, capacity);
+        }
+    }
+
+    /// <summary>
+    /// ̈mۂ܂
+    /// </summary>
+    /// <param name="size"> TCY (0 傫) </param>
+    /// <param name="alignment"> 擪̔zuE (2 ̗ݏłȂĂ\܂) </param>
+    /// <returns> 擪̃ItZbg (܂󂫗̈悪Ȃ InvalidOffset) </returns>
+    uint64_t Allocate(uint64_t size, uint64_t alignment = 1)
+    {
+        assert(size > 0 && alignment > 0);
+        for (auto it = m_FreeBySize.lower_bound({ size, 0 }); it != m_FreeBySize.end(); ++it)
+        {
+            const uint64_t blockSize = it->first;
+            const uint64_t blockOffset = it->second;
+            const uint64_t offset = AlignUp(blockOffset, alignment);
+            if (offset + size > blockOffset + blockSize)
+            {
+                continue;
+            }
+
+            // zuE܂ł̌Ԃƌ̗]͋󂫗̈ɖ߂
+            EraseFreeBlock(blockOffset, blockSize);
+            if (offset > blockOffset)
+            {
+                InsertFreeBlock(blockOffset, offset - blockOffset);
+            }
+            if (offset + size < blockOffset + blockSize)
+            {
+                InsertFreeBlock(offset + size, blockOffset + blockSize - offset - size);
+            }
+            m_Allocations[offset] = { size, alignment };
+            m_UsedSize += size;
+            return offset;
+        }
+        return InvalidOffset;
+    }
+
+    //! @brief Allocate() Ŋmۂ̈AŐ󂫗̈ƌ܂
+    void Free(uint64_t offset)
+    {
+        auto it = m_Allocations.find(offset);
+        if (it == m_Allocations.end())
+        {
+            assert(false && "mۂĂȂItZbgł");
+            return;
+        }
+        uint64_t size = it->second.Size;
+        m_UsedSize -= size;
+        m_Allocations.erase(it);
+
+        // ̋󂫗̈ƌ
+        auto next = m_FreeBlocks.find(offset + size);
+        if (next != m_FreeBlocks.end())
+        {
+            size += next->second;
+            EraseFreeBlock(next->first, next->second);
+        }
+        // Ő󂫗̈ƌ
+        auto prev = m_FreeBlocks.lower_bound(offset);
+        if (prev != m_FreeBlocks.begin())
+        {
+            --prev;
+            if (prev->first + prev->second == offset)
+            {
+                offset = prev->first;
+                size += prev->second;
+                EraseFreeBlock(prev->first, prev->second);
+            }
+        }
+        InsertFreeBlock(offset, size);
+    }
+
+    //! @brief eʂ𑝂₵܂ (mۍς݂̗̈͂̂܂܂ł)
+    void Grow(uint64_t newCapacity)
+    {
+        if (newCapacity <= m_Capacity)
+        {
+            return;
+        }
+        uint64_t offset = m_Capacity;
+        uint64_t size = newCapacity - m_Capacity;
+        // 󂢂ĂΌq
+        if (!m_FreeBlocks.empty())
+        {
+            auto last = std::prev(m_FreeBlocks.end());
+            if (last->first + last->second == m_Capacity)
+            {
+                offset = last->first;
+                size += last->second;
+                EraseFreeBlock(last->first, last->second);
+            }
+        }
+        InsertFreeBlock(offset, size);
+        m_Capacity = newCapacity;
+    }
+
+    /// <summary>
+    /// mۍς݂̗̈ItZbgɐ擪lߒA󂫗̈𖖔ɂ܂Ƃ߂܂
+    /// ë̔zuE͕ۂ܂
+    /// </summary>
+    /// <returns> ʒuς̈ (ItZbgAړ͈ړOȂ̂ŁȀɃRs[Γobt@ł㏑܂) </returns>
+    std::vector<Move> Defragment()
+    {
+        std::vector<Move> moves;
+        std::map<uint64_t, Allocation> allocations;
+        m_FreeBlocks.clear();
+        m_FreeBySize.clear();
+
+        uint64_t cursor = 0;
+        for (const auto& [offset, allocation] : m_Allocations)
+        {
+            const uint64_t newOffset = AlignUp(cursor, allocation.Alignment);
+            if (newOffset > cursor)
+            {
+                InsertFreeBlock(cursor, newOffset - cursor);
+            }
+            if (newOffset != offset)
+            {
+                moves.push_back({ offset, newOffset, allocation.Size });
+            }
+            allocations[newOffset] = allocation;
+            cursor = newOffset + allocation.Size;
+        }
+        if (cursor < m_Capacity)
+        {
+            InsertFreeBlock(cursor, m_Capacity - cursor);
+        }
+        m_Allocations.swap(allocations);
+        return moves;
+    }
+
+    uint64_t GetCapacity() const { return m_Capacity; }
+    //! @brief mۍς݂̃TCY̍v (zuEɂ錄Ԃ͊܂݂܂)
+    uint64_t GetUsedSize() const { return m_UsedSize; }
+    uint64_t GetFreeSize() const { return m_Capacity - m_UsedSize; }
+    //! @brief ł傫󂫗̈̃TCY
+    uint64_t GetLargestFreeBlock() const { return m_FreeBySize.empty() ? 0 : m_FreeBySize.rbegin()->first; }
+    size_t GetAllocationCount() const { return m_Allocations.size(); }
+    size_t GetFreeBlockCount() const { return m_FreeBlocks.size(); }
+    //! @brief fЉ̓x (0: 󂫂1ɂ܂Ƃ܂ĂA1 ɋ߂قǍא؂)
+    float GetFragmentation() const
+    {
+        const uint64_t freeSize = GetFreeSize();
+        return freeSize > 0 ? 1.0f - static_cast<float>(GetLargestFreeBlock()) / static_cast<float>(freeSize) : 0.0f;
+    }
+
+private:
+    struct Allocation
+    {
+        uint64_t Size = 0;
+        uint64_t Alignment = 1;
+    };
+
+    static uint64_t AlignUp(uint64_t value, uint64_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    void InsertFreeBlock(uint64_t offset, uint64_t size)
+    {
+        m_FreeBlocks[offset] = size;
+        m_FreeBySize.insert({ size, offset });
+    }
+
+    void EraseFreeBlock(uint64_t offset, uint64_t size)
+    {
+        m_FreeBlocks.erase(offset);
+        m_FreeBySize.erase({ size, offset });
+    }
+
+    uint64_t m_Capacity = 0;
+    uint64_t m_UsedSize = 0;
+    //! 󂫗̈ (ItZbg -> TCYÂ)
+    std::map<uint64_t, uint64_t> m_FreeBlocks;
+    //! 󂫗̈ (TCY, ItZbgAbest-fit ̌̂)
+    std::set<std::pair<uint64_t, uint64_t>> m_FreeBySize;
+    //! mۍς݂̗̈ (ItZbg -> TCYƔzuE)
+    std::map<uint64_t, Allocation> m_Allocations;
+};
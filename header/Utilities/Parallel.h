@@ -0,0 +1,101 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace Parallel
+{
+    /// <summary>
+    /// gp\ȃn[hEFAXbh擾܂
+    /// </summary>
+    inline uint32_t GetWorkerCount()
+    {
+        const uint32_t count = std::thread::hardware_concurrency();
+        return count == 0 ? 1u : count;
+    }
+
+    /// <summary>
+    /// [0, count)  minBatch ȏ̋ԂɕAfunc(begin, end) Ɏs܂
+    /// Ԑ1ɂȂꍇ͌ĂяõXbhł̂܂܎s܂
+    /// </summary>
+    template<typename Func>
+    void For(size_t count, size_t minBatch, Func&& func)
+    {
+        if (count == 0) return;
+        minBatch = (std::max)(minBatch, static_cast<size_t>(1));
+
+        const size_t maxJobs = (count + minBatch - 1) / minBatch;
+        const size_t jobCount = (std::min)(static_cast<size_t>(GetWorkerCount()), maxJobs);
+        if (jobCount <= 1)
+        {
+            func(static_cast<size_t>(0), count);
+            return;
+        }
+
+        const size_t chunk = (count + jobCount - 1) / jobCount;
+        std::vector<std::thread> workers;
+        workers.reserve(jobCount - 1);
+        for (size_t job = 1; job < jobCount; ++job)
+        {
+            const size_t begin = job * chunk;
+            const size_t end = (std::min)(count, begin + chunk);
+            if (begin >= end) break;
+            workers.emplace_back([&func, begin, end]() { func(begin, end); });
+        }
+
+        // 擪̋Ԃ͌ĂяõXbhŏ
+        func(static_cast<size_t>(0), (std::min)(count, chunk));
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    /// <summary>
+    /// [0, count) ̊evfɂ func(index) Ɏs܂
+    /// vfƂ̏ʂ傫΂ꍇŁAeXbh atomic JE^1vfo܂
+    /// </summary>
+    template<typename Func>
+    void ForEach(size_t count, Func&& func)
+    {
+        if (count == 0) return;
+
+        const size_t jobCount = (std::min)(static_cast<size_t>(GetWorkerCount()), count);
+        if (jobCount <= 1)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                func(i);
+            }
+            return;
+        }
+
+        std::atomic<size_t> next(0);
+        auto worker = [&func, &next, count]()
+            {
+                for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1))
+                {
+                    func(i);
+                }
+            };
+
+        std::vector<std::thread> workers;
+        workers.reserve(jobCount - 1);
+        for (size_t job = 1; job < jobCount; ++job)
+        {
+            workers.emplace_back(worker);
+        }
+
+        // ĂяõXbhɎQ
+        worker();
+
+        for (auto& thread : workers)
+        {
+            thread.join();
+        }
+    }
+}
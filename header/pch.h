@@ -24,7 +24,6 @@
 #include <wrl/client.h>
 
 template<typename T> using ComPtr = Microsoft::WRL::ComPtr<T>;
-#define SMALL_NUMBER 1.e-8f
 
 #pragma comment(lib, "d3d12.lib")
 #pragma comment(lib, "dxgi.lib")
@@ -0,0 +1,389 @@
+// header/Math ̊eZ̑ (ns/op) 𑪂R}hCc[
+// g: MathBench [--filter <Öꕔ>] [--count N] [--repeat N]
+// ō N ̓͂ɉZ1񂸂KpA1񂠂̎Ԃ̍ŒZ\܂
+// TransformBatchEQuaternionBatchEFrustum ̈ꊇ N ܂Ƃ߂ďA1vf̎Ԃ1vf̏Ɣׂ܂
+
+#include "Math/MathUtility.h"
+#include "Math/Vector2D.h"
+#include "Math/Vector3D.h"
+#include "Math/Vector4D.h"
+#include "Math/Quaternion.h"
+#include "Math/Matrix3x4.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Bounds.h"
+#include "Math/TransformBatch.h"
+#include "Math/QuaternionBatch.h"
+#include "ScalarReference.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+	/// <summary>
+	/// R}hC̐ݒ
+	/// </summary>
+	struct Options
+	{
+		std::string Filter;        //!< Oɂ̕܂މZ𑪂
+		size_t Count = 4096;       //!< ͂̐ (L1/L2 Ɏ܂x)
+		uint32_t RepeatCount = 15; //!< vJԂAŒZ̎Ԃg
+	};
+
+	bool ParseOptions(int argc, char** argv, Options& outOptions)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string arg = argv[i];
+			if (arg == "--filter" && i + 1 < argc)
+			{
+				outOptions.Filter = argv[++i];
+			}
+			else if (arg == "--count" && i + 1 < argc)
+			{
+				outOptions.Count = static_cast<size_t>((std::max)(std::atoi(argv[++i]), 1));
+			}
+			else if (arg == "--repeat" && i + 1 < argc)
+			{
+				outOptions.RepeatCount = static_cast<uint32_t>((std::max)(std::atoi(argv[++i]), 1));
+			}
+			else
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	const char* GetInstructionSetName()
+	{
+#if defined(MATH_SIMD_AVX)
+		return "AVX";
+#elif defined(MATH_SIMD_SSE)
+		return "SSE";
+#elif defined(MATH_SIMD_NEON)
+		return "NEON";
+#else
+		return "scalar";
+#endif
+	}
+
+	/// <summary>
+	/// Z̓͂Əo (o͍͂Ōɓǂނ̂ŁAvZœKŏ邱Ƃ͂Ȃ)
+	/// </summary>
+	struct Data
+	{
+		std::vector<float> Scalars;
+		std::vector<Vector2D> Vec2A, Vec2B, Vec2Out;
+		std::vector<Vector3D> Vec3A, Vec3B, Vec3Out;
+		std::vector<Vector4D> Vec4A, Vec4B, Vec4C, Vec4Out;
+		std::vector<Quaternion> QuatA, QuatB, QuatOut;
+		std::vector<Matrix4x4> MatA, MatB, Affine, MatOut;
+		std::vector<Matrix3x4> Mat3A, Mat3B, Mat3Out;
+		std::vector<float> FloatOut;
+		std::vector<float> X, Y, Z, XOut, YOut, ZOut; //!< Vec3A  SoA ƁASoA ̏o
+		std::vector<AABB> Boxes;
+		std::vector<Sphere> Spheres;
+		std::vector<uint8_t> Visible;
+		Matrix4x4 ViewProj;
+		Frustum Camera;
+
+		explicit Data(size_t count)
+		{
+			std::mt19937 engine(12345);
+			auto random = [&](float lo, float hi) { return std::uniform_real_distribution<float>(lo, hi)(engine); };
+			auto randomVec3 = [&]() { return Vector3D(random(-10.0f, 10.0f), random(-10.0f, 10.0f), random(-10.0f, 10.0f)); };
+			auto randomVec4 = [&]() { return Vector4D(random(-10.0f, 10.0f), random(-10.0f, 10.0f), random(-10.0f, 10.0f), random(-10.0f, 10.0f)); };
+			auto randomQuat = [&]()
+				{
+					Quaternion q(random(-1.0f, 1.0f), random(-1.0f, 1.0f), random(-1.0f, 1.0f), random(-1.0f, 1.0f));
+					return q.normalize();
+				};
+			auto randomMatrix = [&]()
+				{
+					Matrix4x4 m;
+					for (auto& row : m.m_mat)
+					{
+						for (auto& value : row)
+						{
+							value = random(-10.0f, 10.0f);
+						}
+					}
+					return m;
+				};
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				Scalars.push_back(random(-180.0f, 180.0f));
+				Vec2A.emplace_back(random(-10.0f, 10.0f), random(-10.0f, 10.0f));
+				Vec2B.emplace_back(random(-10.0f, 10.0f), random(-10.0f, 10.0f));
+				Vec3A.push_back(randomVec3());
+				Vec3B.push_back(randomVec3());
+				Vec4A.push_back(randomVec4());
+				Vec4B.push_back(randomVec4());
+				Vec4C.push_back(randomVec4());
+				QuatA.push_back(randomQuat());
+				QuatB.push_back(randomQuat());
+				MatA.push_back(randomMatrix());
+				MatB.push_back(randomMatrix());
+				Affine.push_back(Matrix4x4::Compose(Vector3D(random(0.5f, 2.0f), random(0.5f, 2.0f), random(0.5f, 2.0f)), QuatA.back(), randomVec3()));
+				Mat3A.emplace_back(Affine.back());
+				Mat3B.push_back(Matrix3x4::Compose(Vector3D(random(0.5f, 2.0f), random(0.5f, 2.0f), random(0.5f, 2.0f)), QuatB.back(), randomVec3()));
+				X.push_back(Vec3A.back().x);
+				Y.push_back(Vec3A.back().y);
+				Z.push_back(Vec3A.back().z);
+				Boxes.push_back(AABB::FromCenterExtents(Vec3B.back() * 3.0f, Vector3D(random(0.1f, 2.0f), random(0.1f, 2.0f), random(0.1f, 2.0f))));
+				Spheres.push_back(Sphere::FromAABB(Boxes.back()));
+			}
+			// _̕J (͂̔x̊OɂȂ)
+			ViewProj = Matrix4x4::setLookAtLH(Vector3D(0.0f, 0.0f, -40.0f), Vector3D(0.0f, 0.0f, 0.0f), Vector3D(0.0f, 1.0f, 0.0f))
+				* Matrix4x4::setPerspectiveFovLH(0.8f, 1.5f, 0.1f, 100.0f);
+			Camera = Frustum::FromViewProj(ViewProj);
+			Vec2Out.resize(count);
+			Vec3Out.resize(count);
+			Vec4Out.resize(count);
+			QuatOut.resize(count);
+			MatOut.resize(count);
+			Mat3Out.resize(count);
+			FloatOut.resize(count);
+			XOut.resize(count);
+			YOut.resize(count);
+			ZOut.resize(count);
+			Visible.resize(count);
+		}
+
+		//! @brief oׂ͂ēǂ1̒lɂ܂Ƃ߂
+		float GetChecksum() const
+		{
+			float sum = 0.0f;
+			for (size_t i = 0; i < FloatOut.size(); ++i)
+			{
+				sum += FloatOut[i] + Vec2Out[i].x + Vec3Out[i].x + Vec4Out[i].x + QuatOut[i].x + MatOut[i].m_mat[3][2] + Mat3Out[i].m_mat[2][3]
+					+ XOut[i] + YOut[i] + ZOut[i] + Visible[i];
+			}
+			return sum;
+		}
+	};
+
+	/// <summary>
+	/// Z͂̐JԂA1񂠂̎Ԃ\܂
+	/// baselineNanoseconds nƁA̎Ԃɑ΂鑬x\܂
+	/// RunBatch ͓͑Ŝ1ŏ鉉Z𑪂A1vf̎Ԃ\܂
+	/// </summary>
+	class Runner
+	{
+	public:
+		Runner(const Options& options) : m_Options(options) {}
+
+		template<typename Func>
+		double Run(const char* pName, Func&& func, double baselineNanoseconds = 0.0)
+		{
+			const size_t count = m_Options.Count;
+			return RunBatch(pName, [&]()
+				{
+					for (size_t i = 0; i < count; ++i)
+					{
+						func(i);
+					}
+				}, baselineNanoseconds);
+		}
+
+		template<typename Func>
+		double RunBatch(const char* pName, Func&& func, double baselineNanoseconds = 0.0)
+		{
+			if (!m_Options.Filter.empty() && std::string(pName).find(m_Options.Filter) == std::string::npos)
+			{
+				return 0.0;
+			}
+
+			// 1̌vZƎv̕\ɖ̂ŁA 1 ms ɂȂ܂œ͂JԂ
+			const size_t count = m_Options.Count;
+			auto pass = [&](uint32_t passCount)
+				{
+					const auto start = std::chrono::steady_clock::now();
+					for (uint32_t p = 0; p < passCount; ++p)
+					{
+						func();
+					}
+					return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+				};
+			const double warmup = pass(1);
+			const uint32_t passCount = static_cast<uint32_t>((std::max)(1.0, 1.0e-3 / (std::max)(warmup, 1.0e-9)));
+
+			double bestSeconds = 0.0;
+			for (uint32_t repeat = 0; repeat < m_Options.RepeatCount; ++repeat)
+			{
+				const double seconds = pass(passCount);
+				bestSeconds = repeat == 0 ? seconds : (std::min)(bestSeconds, seconds);
+			}
+			const double nanoseconds = bestSeconds * 1.0e9 / (static_cast<double>(count) * passCount);
+			if (baselineNanoseconds > 0.0)
+			{
+				std::printf("  %-40s %9.2f ns/op  x%.2f\n", pName, nanoseconds, baselineNanoseconds / nanoseconds);
+			}
+			else
+			{
+				std::printf("  %-40s %9.2f ns/op\n", pName, nanoseconds);
+			}
+			return nanoseconds;
+		}
+
+	private:
+		const Options& m_Options;
+	};
+}
+
+int main(int argc, char** argv)
+{
+	Options options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		std::fprintf(stderr, "usage: MathBench [--filter <name>] [--count N] [--repeat N]\n");
+		return 2;
+	}
+
+	std::printf("instruction set: %s, inputs: %zu\n", GetInstructionSetName(), options.Count);
+	Data d(options.Count);
+	Runner runner(options);
+
+	std::printf("MathUtility\n");
+	runner.Run("DegreeToRadian", [&](size_t i) { d.FloatOut[i] = MathUtility::DegreeToRadian(d.Scalars[i]); });
+	runner.Run("RadianToDegree", [&](size_t i) { d.FloatOut[i] = MathUtility::RadianToDegree(d.Scalars[i]); });
+
+	std::printf("Vector2D\n");
+	runner.Run("Vector2D operator+", [&](size_t i) { d.Vec2Out[i] = d.Vec2A[i] + d.Vec2B[i]; });
+	runner.Run("Vector2D operator-", [&](size_t i) { d.Vec2Out[i] = d.Vec2A[i] - d.Vec2B[i]; });
+	runner.Run("Vector2D operator* (scalar)", [&](size_t i) { d.Vec2Out[i] = d.Vec2A[i] * d.Scalars[i]; });
+	runner.Run("Vector2D::dot", [&](size_t i) { d.FloatOut[i] = d.Vec2A[i].dot(d.Vec2B[i]); });
+	runner.Run("Vector2D::length", [&](size_t i) { d.FloatOut[i] = d.Vec2A[i].length(); });
+	runner.Run("Vector2D::cross", [&](size_t i) { d.Vec2Out[i] = d.Vec2A[i].cross(d.Vec2B[i]); });
+	runner.Run("Vector2D::GetSafeNormal", [&](size_t i) { d.Vec2Out[i] = d.Vec2A[i].GetSafeNormal(); });
+
+	std::printf("Vector3D\n");
+	runner.Run("Vector3D operator+", [&](size_t i) { d.Vec3Out[i] = d.Vec3A[i] + d.Vec3B[i]; });
+	runner.Run("Vector3D operator-", [&](size_t i) { d.Vec3Out[i] = d.Vec3A[i] - d.Vec3B[i]; });
+	runner.Run("Vector3D operator* (scalar)", [&](size_t i) { d.Vec3Out[i] = d.Vec3A[i] * d.Scalars[i]; });
+	runner.Run("Vector3D::dot", [&](size_t i) { d.FloatOut[i] = d.Vec3A[i].dot(d.Vec3B[i]); });
+	runner.Run("Vector3D::length", [&](size_t i) { d.FloatOut[i] = d.Vec3A[i].length(); });
+	runner.Run("Vector3D::cross", [&](size_t i) { d.Vec3Out[i] = d.Vec3A[i].cross(d.Vec3B[i]); });
+	runner.Run("Vector3D::GetSafeNormal", [&](size_t i) { d.Vec3Out[i] = d.Vec3A[i].GetSafeNormal(); });
+
+	std::printf("Vector4D\n");
+	runner.Run("Vector4D operator+", [&](size_t i) { d.Vec4Out[i] = d.Vec4A[i] + d.Vec4B[i]; });
+	runner.Run("Vector4D operator-", [&](size_t i) { d.Vec4Out[i] = d.Vec4A[i] - d.Vec4B[i]; });
+	runner.Run("Vector4D operator* (scalar)", [&](size_t i) { d.Vec4Out[i] = d.Vec4A[i] * d.Scalars[i]; });
+	runner.Run("Vector4D::dot", [&](size_t i) { d.FloatOut[i] = d.Vec4A[i].dot(d.Vec4B[i]); });
+	runner.Run("Vector4D::length", [&](size_t i) { d.FloatOut[i] = d.Vec4A[i].length(); });
+	runner.Run("Vector4D::cross (3 vectors)", [&](size_t i) { d.Vec4Out[i] = d.Vec4A[i].cross(d.Vec4B[i], d.Vec4C[i]); });
+	runner.Run("Vector4D::GetSafeNormal", [&](size_t i) { d.Vec4Out[i] = d.Vec4A[i].GetSafeNormal(); });
+
+	std::printf("Quaternion\n");
+	runner.Run("Quaternion operator*", [&](size_t i) { d.QuatOut[i] = d.QuatA[i] * d.QuatB[i]; });
+	runner.Run("Quaternion operator*=", [&](size_t i) { d.QuatOut[i] = d.QuatA[i]; d.QuatOut[i] *= d.QuatB[i]; });
+	runner.Run("Quaternion::normalize", [&](size_t i) { d.QuatOut[i] = d.QuatA[i]; d.QuatOut[i].normalize(); });
+	runner.Run("Quaternion::Euler", [&](size_t i) { d.QuatOut[i] = Quaternion::Euler(d.Vec3A[i] * 18.0f); });
+	runner.Run("Quaternion::EulerAngles", [&](size_t i) { d.Vec3Out[i] = Quaternion::EulerAngles(d.QuatA[i]); });
+	runner.Run("Quaternion::AngleAxis", [&](size_t i) { d.QuatOut[i] = Quaternion::AngleAxis(d.Scalars[i], d.Vec3A[i]); });
+
+	std::printf("Matrix4x4\n");
+	runner.Run("Matrix4x4 operator*", [&](size_t i) { d.MatOut[i] = d.MatA[i] * d.MatB[i]; });
+	runner.Run("Matrix4x4::Apply", [&](size_t i) { d.Vec3Out[i] = Matrix4x4::Apply(d.MatA[i], d.Vec3A[i]); });
+	runner.Run("Matrix4x4::transpose", [&](size_t i) { d.MatOut[i] = Matrix4x4::transpose(d.MatA[i]); });
+	runner.Run("Matrix4x4::inverse", [&](size_t i) { d.MatOut[i] = Matrix4x4::inverse(d.MatA[i]); });
+	runner.Run("Matrix4x4::inverseAffine", [&](size_t i) { d.MatOut[i] = Matrix4x4::inverseAffine(d.Affine[i]); });
+	runner.Run("Matrix4x4::getDeterminant", [&](size_t i) { d.FloatOut[i] = Matrix4x4::getDeterminant(d.MatA[i]); });
+	runner.Run("Matrix4x4::QuaternionToMatrix", [&](size_t i) { d.MatOut[i] = Matrix4x4::QuaternionToMatrix(d.QuatA[i]); });
+	runner.Run("Matrix4x4::Compose", [&](size_t i) { d.MatOut[i] = Matrix4x4::Compose(d.Vec3A[i], d.QuatA[i], d.Vec3B[i]); });
+	runner.Run("Matrix4x4::RotationToMatrix", [&](size_t i) { d.MatOut[i] = Matrix4x4::RotationToMatrix(d.Vec3A[i] * 18.0f); });
+	runner.Run("Matrix4x4::setLookAtLH", [&](size_t i) { d.MatOut[i] = Matrix4x4::setLookAtLH(d.Vec3A[i], d.Vec3B[i], Vector3D(0.0f, 1.0f, 0.0f)); });
+	runner.Run("Matrix4x4::setPerspectiveFovLH", [&](size_t i) { d.MatOut[i] = Matrix4x4::setPerspectiveFovLH(1.0f, 1.5f, 0.1f, 100.0f + d.Scalars[i]); });
+	runner.Run("Matrix4x4::setOrthoOffsetLH", [&](size_t i) { d.MatOut[i] = Matrix4x4::setOrthoOffsetLH(-1.0f, 1.0f, -1.0f, 1.0f, 0.1f, 200.0f + d.Scalars[i]); });
+
+	// Matrix3x4 ͓AtBϊ Matrix4x4 ɑ΂鑬x\
+	std::printf("Matrix3x4 (vs Matrix4x4 on affine matrices)\n");
+	const double affineMultiplyNs = runner.Run("Matrix4x4 operator* (affine)", [&](size_t i) { d.MatOut[i] = d.Affine[i] * d.MatB[i]; });
+	runner.Run("Matrix3x4 operator*", [&](size_t i) { d.Mat3Out[i] = d.Mat3A[i] * d.Mat3B[i]; }, affineMultiplyNs);
+	const double affineComposeNs = runner.Run("Matrix4x4::Compose (for Matrix3x4)", [&](size_t i) { d.MatOut[i] = Matrix4x4::Compose(d.Vec3A[i], d.QuatA[i], d.Vec3B[i]); });
+	runner.Run("Matrix3x4::Compose", [&](size_t i) { d.Mat3Out[i] = Matrix3x4::Compose(d.Vec3A[i], d.QuatA[i], d.Vec3B[i]); }, affineComposeNs);
+	const double affineInverseNs = runner.Run("Matrix4x4::inverse (affine)", [&](size_t i) { d.MatOut[i] = Matrix4x4::inverse(d.Affine[i]); });
+	runner.Run("Matrix3x4::inverse", [&](size_t i) { d.Mat3Out[i] = Matrix3x4::inverse(d.Mat3A[i]); }, affineInverseNs);
+	const double affineApplyNs = runner.Run("Matrix4x4::Apply (affine)", [&](size_t i) { d.Vec3Out[i] = Matrix4x4::Apply(d.Affine[i], d.Vec3A[i]); });
+	runner.Run("Matrix3x4::TransformPoint", [&](size_t i) { d.Vec3Out[i] = Matrix3x4::TransformPoint(d.Mat3A[i], d.Vec3A[i]); }, affineApplyNs);
+	runner.Run("Matrix3x4::TransformDirection", [&](size_t i) { d.Vec3Out[i] = Matrix3x4::TransformDirection(d.Mat3A[i], d.Vec3A[i]); });
+	runner.Run("Matrix3x4::getDeterminant", [&](size_t i) { d.FloatOut[i] = Matrix3x4::getDeterminant(d.Mat3A[i]); });
+	runner.Run("Matrix3x4(Matrix4x4)", [&](size_t i) { d.Mat3Out[i] = Matrix3x4(d.Affine[i]); });
+	runner.Run("Matrix3x4::ToMatrix4x4", [&](size_t i) { d.MatOut[i] = d.Mat3A[i].ToMatrix4x4(); });
+
+	std::printf("SIMD vs previous scalar code (ScalarReference.h)\n");
+	const double multiplyNs = runner.Run("scalar Multiply", [&](size_t i) { d.MatOut[i] = ScalarReference::Multiply(d.MatA[i], d.MatB[i]); });
+	runner.Run("Matrix4x4 operator*", [&](size_t i) { d.MatOut[i] = d.MatA[i] * d.MatB[i]; }, multiplyNs);
+	const double applyNs = runner.Run("scalar Apply", [&](size_t i) { d.Vec3Out[i] = ScalarReference::Apply(d.MatA[i], d.Vec3A[i]); });
+	runner.Run("Matrix4x4::Apply", [&](size_t i) { d.Vec3Out[i] = Matrix4x4::Apply(d.MatA[i], d.Vec3A[i]); }, applyNs);
+	const double transposeNs = runner.Run("scalar Transpose", [&](size_t i) { d.MatOut[i] = ScalarReference::Transpose(d.MatA[i]); });
+	runner.Run("Matrix4x4::transpose", [&](size_t i) { d.MatOut[i] = Matrix4x4::transpose(d.MatA[i]); }, transposeNs);
+	const double composeNs = runner.Run("scalar S * R * T", [&](size_t i) { d.MatOut[i] = ScalarReference::Compose(d.Vec3A[i], d.QuatA[i], d.Vec3B[i]); });
+	runner.Run("Matrix4x4::Compose", [&](size_t i) { d.MatOut[i] = Matrix4x4::Compose(d.Vec3A[i], d.QuatA[i], d.Vec3B[i]); }, composeNs);
+
+	std::printf("inverse vs previous scalar code (ScalarReference.h)\n");
+	const double inverseNs = runner.Run("scalar Inverse (cross + pow)", [&](size_t i) { d.MatOut[i] = ScalarReference::Inverse(d.MatA[i]); });
+	runner.Run("Matrix4x4::inverse", [&](size_t i) { d.MatOut[i] = Matrix4x4::inverse(d.MatA[i]); }, inverseNs);
+	runner.Run("Matrix4x4::inverseAffine", [&](size_t i) { d.MatOut[i] = Matrix4x4::inverseAffine(d.Affine[i]); }, inverseNs);
+	const double determinantNs = runner.Run("scalar GetDeterminant", [&](size_t i) { d.FloatOut[i] = ScalarReference::GetDeterminant(d.MatA[i]); });
+	runner.Run("Matrix4x4::getDeterminant", [&](size_t i) { d.FloatOut[i] = Matrix4x4::getDeterminant(d.MatA[i]); }, determinantNs);
+
+	// ꊇ͓͑Ŝ1ŏA1vf̏ɑ΂鑬x\
+	// (--count  ParallelThreshold ȏȂ񏈗̌oH܂ށB--filter TransformEQuaternionEFrustum Ŕřꏏɑ)
+	const size_t count = options.Count;
+	std::printf("TransformBatch (vs Matrix4x4::Apply per element)\n");
+	const double pointNs = runner.Run("Apply (TransformBatch baseline)", [&](size_t i) { d.Vec3Out[i] = Matrix4x4::Apply(d.Affine[0], d.Vec3A[i]); });
+	runner.RunBatch("TransformPoints (AoS)", [&]() { TransformBatch::TransformPoints(d.Affine[0], d.Vec3A.data(), d.Vec3Out.data(), count); }, pointNs);
+	runner.RunBatch("TransformPoints (SoA)", [&]() { TransformBatch::TransformPoints(d.Affine[0], d.X.data(), d.Y.data(), d.Z.data(), d.XOut.data(), d.YOut.data(), d.ZOut.data(), count); }, pointNs);
+	runner.RunBatch("TransformDirections (AoS)", [&]() { TransformBatch::TransformDirections(d.Affine[0], d.Vec3A.data(), d.Vec3Out.data(), count); }, pointNs);
+	runner.RunBatch("TransformPointsProject (AoS)", [&]() { TransformBatch::TransformPointsProject(d.ViewProj, d.Vec3A.data(), d.Vec3Out.data(), count); });
+	runner.RunBatch("TransformPointsProject (SoA)", [&]() { TransformBatch::TransformPointsProject(d.ViewProj, d.X.data(), d.Y.data(), d.Z.data(), d.XOut.data(), d.YOut.data(), d.ZOut.data(), count); });
+
+	std::printf("QuaternionBatch (vs Quaternion / Matrix4x4 per element)\n");
+	const double normalizeNs = runner.Run("normalize (QuaternionBatch baseline)", [&](size_t i) { d.QuatOut[i] = d.QuatA[i]; d.QuatOut[i].normalize(); });
+	runner.RunBatch("QuaternionBatch::Normalize (Accurate)", [&]() { QuaternionBatch::Normalize(d.QuatA.data(), d.QuatOut.data(), count, QuaternionBatch::Precision::Accurate); }, normalizeNs);
+	runner.RunBatch("QuaternionBatch::Normalize (Fast)", [&]() { QuaternionBatch::Normalize(d.QuatA.data(), d.QuatOut.data(), count, QuaternionBatch::Precision::Fast); }, normalizeNs);
+	runner.RunBatch("QuaternionBatch::Nlerp (Accurate)", [&]() { QuaternionBatch::Nlerp(d.QuatA.data(), d.QuatB.data(), 0.3f, d.QuatOut.data(), count, QuaternionBatch::Precision::Accurate); });
+	runner.RunBatch("QuaternionBatch::Slerp (Accurate)", [&]() { QuaternionBatch::Slerp(d.QuatA.data(), d.QuatB.data(), 0.3f, d.QuatOut.data(), count, QuaternionBatch::Precision::Accurate); });
+	runner.RunBatch("QuaternionBatch::Slerp (Fast)", [&]() { QuaternionBatch::Slerp(d.QuatA.data(), d.QuatB.data(), 0.3f, d.QuatOut.data(), count, QuaternionBatch::Precision::Fast); });
+	const double toMatrixNs = runner.Run("QuaternionToMatrix (QuaternionBatch base)", [&](size_t i) { d.MatOut[i] = Matrix4x4::QuaternionToMatrix(d.QuatA[i]); });
+	runner.RunBatch("QuaternionBatch::ToMatrix (Accurate)", [&]() { QuaternionBatch::ToMatrix(d.QuatA.data(), d.MatOut.data(), count, QuaternionBatch::Precision::Accurate); }, toMatrixNs);
+	runner.RunBatch("QuaternionBatch::ToMatrix (Fast)", [&]() { QuaternionBatch::ToMatrix(d.QuatA.data(), d.MatOut.data(), count, QuaternionBatch::Precision::Fast); }, toMatrixNs);
+	runner.RunBatch("QuaternionBatch::ToMatrix3x4 (Fast)", [&]() { QuaternionBatch::ToMatrix3x4(d.QuatA.data(), d.Mat3Out.data(), count, QuaternionBatch::Precision::Fast); }, toMatrixNs);
+
+	std::printf("Frustum culling (vs Frustum::Intersects per element)\n");
+	const double aabbNs = runner.Run("Frustum::Intersects(AABB)", [&](size_t i) { d.Visible[i] = d.Camera.Intersects(d.Boxes[i]) ? 1 : 0; });
+	runner.RunBatch("Frustum::CullAABBs", [&]() { d.Camera.CullAABBs(d.Boxes.data(), count, d.Visible.data()); }, aabbNs);
+	runner.RunBatch("Frustum::IntersectsAABB8", [&]()
+		{
+			for (size_t i = 0; i + 8 <= count; i += 8)
+			{
+				const int mask = d.Camera.IntersectsAABB8(d.Boxes.data() + i);
+				d.Visible[i] = static_cast<uint8_t>(mask);
+			}
+		}, aabbNs);
+	const double sphereNs = runner.Run("Frustum::Intersects(Sphere)", [&](size_t i) { d.Visible[i] = d.Camera.Intersects(d.Spheres[i]) ? 1 : 0; });
+	runner.RunBatch("Frustum::CullSpheres", [&]() { d.Camera.CullSpheres(d.Spheres.data(), count, d.Visible.data()); }, sphereNs);
+	runner.RunBatch("Frustum::IntersectsSphere8", [&]()
+		{
+			for (size_t i = 0; i + 8 <= count; i += 8)
+			{
+				const int mask = d.Camera.IntersectsSphere8(d.Spheres.data() + i);
+				d.Visible[i] = static_cast<uint8_t>(mask);
+			}
+		}, sphereNs);
+	runner.Run("AABB::Transform", [&](size_t i) { const AABB box = AABB::Transform(d.Boxes[i], d.Affine[i]); d.Vec3Out[i] = box.Max; });
+	runner.Run("Sphere::Transform", [&](size_t i) { const Sphere sphere = Sphere::Transform(d.Spheres[i], d.Affine[i]); d.FloatOut[i] = sphere.Radius; });
+
+	// o͂ǂŁAvZĂȂƂۏ؂
+	std::printf("checksum: %g\n", d.GetChecksum());
+	return 0;
+}
@@ -0,0 +1,255 @@
+// Frustum () ̕ʂ̒oƁA4 E8 ܂Ƃ߂Ă̔ECullAABBsECullSpheres 1̔ƔׂeXg
+//   ʂ̒o: FromViewProj ̊eʂ{x Gribb / Hartmann ̕ʂƔׁAD3D  0`1 ̋ߕʂ z = near ɂ邱Ƃm߂܂
+//   ꊇ: ʂ܂EAʂ̂OẾA4E8 ̔{łȂ ([̓XJ[Ŕ) 
+//             IntersectsAABB4EIntersectsSphere4EIntersectsAABB8EIntersectsSphere8ECullAABBsECullSpheres ̌ʂ
+//             Intersects(AABB)EIntersects(Sphere) ƃrbgPʂňv邱Ƃm߂܂ (т̈ʒuɂĉEsɂȂȂ)
+// MATH_AVX=ON Ńrh 8 ̔ AVX ̌oHʂ܂
+// g: MathBoundsTest (s 0 ȊOԂ܂)
+
+#include "Math/Bounds.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Vector3D.h"
+#include "TestUtility.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using TestUtility::ErrorStats;
+using TestUtility::Random;
+
+namespace
+{
+	constexpr int ViewCount = 200;
+	constexpr int ItemsPerView = 1000;
+
+	Vector3D RandomVector3(Random& random, float range)
+	{
+		return Vector3D(random.Range(-range, range), random.Range(-range, range), random.Range(-range, range));
+	}
+
+	struct Camera
+	{
+		Matrix4x4 ViewProj;
+		Vector3D Position;
+		Vector3D Forward;
+		float Near = 0.0f;
+		float Far = 0.0f;
+	};
+
+	/// <summary>
+	/// ̃J (eƁAꕔ͐ˉe)
+	/// </summary>
+	Camera RandomCamera(Random& random, int index)
+	{
+		Camera camera;
+		camera.Position = RandomVector3(random, 50.0f);
+		const Vector3D target = camera.Position + RandomVector3(random, 1.0f).GetSafeNormal() * 10.0f;
+		camera.Forward = (target - camera.Position).GetSafeNormal();
+		camera.Near = random.Range(0.05f, 2.0f);
+		camera.Far = camera.Near * random.Range(20.0f, 2000.0f);
+		const Matrix4x4 view = Matrix4x4::setLookAtLH(camera.Position, target, Vector3D(0.0f, 1.0f, 0.0f));
+		const Matrix4x4 proj = index % 5 == 4
+			? Matrix4x4::setOrthoLH(random.Range(5.0f, 50.0f), random.Range(5.0f, 50.0f), camera.Near, camera.Far)
+			: Matrix4x4::setPerspectiveFovLH(random.Range(0.3f, 2.0f), random.Range(0.5f, 2.5f), camera.Near, camera.Far);
+		camera.ViewProj = view * proj;
+		return camera;
+	}
+
+	/// <summary>
+	/// FromViewProj ̕ʂ{xŒoʂƔׂ܂
+	/// </summary>
+	void TestExtraction(Random& random)
+	{
+		std::printf("Frustum::FromViewProj\n");
+		// W float őĂ琳K̂ŁA̕W̑傫ł ULP ő
+		ErrorStats planes("planes vs double Gribb / Hartmann", 8);
+		ErrorStats nearPlane("near plane at z = near (view space)", 8);
+		for (int view = 0; view < ViewCount; ++view)
+		{
+			const Camera camera = RandomCamera(random, view);
+			const Frustum frustum = Frustum::FromViewProj(camera.ViewProj);
+			const auto& m = camera.ViewProj.m_mat;
+			// : c3 + c0  E: c3 - c0  : c3 + c1  : c3 - c1  : c2  : c3 - c2
+			const int columns[Frustum::PlaneCount] = { 0, 0, 1, 1, 2, 2 };
+			const double signs[Frustum::PlaneCount] = { 1.0, -1.0, 1.0, -1.0, 0.0, -1.0 };
+			for (int i = 0; i < Frustum::PlaneCount; ++i)
+			{
+				double coefficients[4];
+				double magnitude[4];
+				for (int row = 0; row < 4; ++row)
+				{
+					const double c3 = m[row][3];
+					const double cj = m[row][columns[i]];
+					coefficients[row] = i == Frustum::Near ? cj : c3 + signs[i] * cj;
+					magnitude[row] = i == Frustum::Near ? std::abs(cj) : std::abs(c3) + std::abs(cj);
+				}
+				const double length = std::sqrt(coefficients[0] * coefficients[0] + coefficients[1] * coefficients[1] + coefficients[2] * coefficients[2]);
+				const Plane& plane = frustum.Planes[i];
+				planes.Add(plane.Normal.x, coefficients[0] / length, magnitude[0] / length);
+				planes.Add(plane.Normal.y, coefficients[1] / length, magnitude[1] / length);
+				planes.Add(plane.Normal.z, coefficients[2] / length, magnitude[2] / length);
+				planes.Add(plane.D, coefficients[3] / length, magnitude[3] / length);
+			}
+
+			// D3D  0`1: ߕʂ͎_ near O (OpenGL  -1`1 Ȃ c3 + c2 ŕʂ̈ʒuɂȂ)
+			const Plane& nearP = frustum.Planes[Frustum::Near];
+			const Vector3D onNear = camera.Position + camera.Forward * camera.Near;
+			// _̍WƖ@̓ς͐Ƃɑł̂ŁAƂ̑傫̘a덷̎ړxɂ
+			const double scale = std::abs(nearP.D) + std::abs(nearP.Normal.x * onNear.x) + std::abs(nearP.Normal.y * onNear.y) + std::abs(nearP.Normal.z * onNear.z);
+			nearPlane.Add(nearP.GetDistance(onNear), 0.0, scale);
+			nearPlane.Add(nearP.Normal.dot(camera.Forward), 1.0, 1.0);
+			const Plane& farP = frustum.Planes[Frustum::Far];
+			TEST_CHECK(farP.GetDistance(camera.Position + camera.Forward * (camera.Far * 0.999f)) > 0.0f);
+			TEST_CHECK(farP.GetDistance(camera.Position + camera.Forward * (camera.Far * 1.001f)) < 0.0f);
+			TEST_CHECK(nearP.GetDistance(camera.Position + camera.Forward * (camera.Near * 0.99f)) < 0.0f);
+			TEST_CHECK(nearP.GetDistance(camera.Position + camera.Forward * (camera.Near * 1.01f)) > 0.0f);
+		}
+		planes.Report();
+		nearPlane.Report();
+
+		// ߕʂ̂OE̋Ɣ (_̑OɂĂ near OȂ猩Ȃ)
+		const Camera camera = RandomCamera(random, 0);
+		const Frustum frustum = Frustum::FromViewProj(camera.ViewProj);
+		const float radius = camera.Near * 0.1f;
+		Sphere before, after;
+		before.Center = camera.Position + camera.Forward * (camera.Near - radius * 1.05f);
+		after.Center = camera.Position + camera.Forward * (camera.Near - radius * 0.95f);
+		before.Radius = after.Radius = radius;
+		TEST_CHECK(!frustum.Intersects(before));
+		TEST_CHECK(frustum.Intersects(after));
+	}
+
+	/// <summary>
+	/// ̕ʂ܂́EOÊ𑽂̂܂ޔƋ܂
+	/// </summary>
+	void MakeItems(Random& random, const Camera& camera, const Frustum& frustum, std::vector<AABB>& boxes, std::vector<Sphere>& spheres)
+	{
+		boxes.resize(ItemsPerView);
+		spheres.resize(ItemsPerView);
+		for (int k = 0; k < ItemsPerView; ++k)
+		{
+			const float depth = random.Range(-0.2f, 1.2f) * (k % 3 == 0 ? camera.Far : camera.Near * 20.0f);
+			Vector3D center = camera.Position + camera.Forward * depth + RandomVector3(random, depth * 0.8f + 1.0f);
+			const float size = random.Range(0.0f, 1.0f) * (k % 7 == 0 ? 0.0f : depth * 0.1f + 0.5f);
+			if (k % 2 == 0)
+			{
+				// ʂ̏ɈڂA傫xOɂ炷 (ʂ܂́Eڂ)
+				const Plane& plane = frustum.Planes[k % Frustum::PlaneCount];
+				center = center - plane.Normal * (plane.GetDistance(center) + size * random.Range(-1.5f, 1.5f));
+			}
+			const Vector3D extents(size * random.Range(0.1f, 1.0f), size * random.Range(0.1f, 1.0f), size * random.Range(0.1f, 1.0f));
+			boxes[k] = AABB::FromCenterExtents(center, extents);
+			spheres[k].Center = center;
+			spheres[k].Radius = size;
+		}
+	}
+
+	/// <summary>
+	/// ꊇ1̔Ɣׂ܂
+	/// </summary>
+	void TestBatch(Random& random)
+	{
+#if defined(MATH_SIMD_AVX)
+		std::printf("batched frustum tests (8-wide: AVX)\n");
+#else
+		std::printf("batched frustum tests (8-wide: 2 x 4-wide)\n");
+#endif
+		uint64_t mismatch4 = 0, mismatch8 = 0, mismatchCull = 0, countMismatch = 0;
+		uint64_t total = 0, visible = 0, straddling = 0;
+		std::vector<AABB> boxes;
+		std::vector<Sphere> spheres;
+		std::vector<uint8_t> flags;
+		for (int view = 0; view < ViewCount; ++view)
+		{
+			const Camera camera = RandomCamera(random, view);
+			const Frustum frustum = Frustum::FromViewProj(camera.ViewProj);
+			MakeItems(random, camera, frustum, boxes, spheres);
+
+			std::vector<uint8_t> expectedBoxes(ItemsPerView), expectedSpheres(ItemsPerView);
+			for (int k = 0; k < ItemsPerView; ++k)
+			{
+				expectedBoxes[k] = frustum.Intersects(boxes[k]) ? 1 : 0;
+				expectedSpheres[k] = frustum.Intersects(spheres[k]) ? 1 : 0;
+				visible += expectedBoxes[k] + expectedSpheres[k];
+				// ꂩ̕ʂ܂
+				for (const auto& plane : frustum.Planes)
+				{
+					if (std::abs(plane.GetDistance(spheres[k].Center)) < spheres[k].Radius)
+					{
+						++straddling;
+						break;
+					}
+				}
+			}
+			total += 2 * ItemsPerView;
+
+			for (int k = 0; k + 8 <= ItemsPerView; k += 8)
+			{
+				const int box4 = frustum.IntersectsAABB4(&boxes[k]) | (frustum.IntersectsAABB4(&boxes[k + 4]) << 4);
+				const int sphere4 = frustum.IntersectsSphere4(&spheres[k]) | (frustum.IntersectsSphere4(&spheres[k + 4]) << 4);
+				const int box8 = frustum.IntersectsAABB8(&boxes[k]);
+				const int sphere8 = frustum.IntersectsSphere8(&spheres[k]);
+				for (int bit = 0; bit < 8; ++bit)
+				{
+					mismatch4 += ((box4 >> bit) & 1) != expectedBoxes[k + bit] ? 1 : 0;
+					mismatch4 += ((sphere4 >> bit) & 1) != expectedSpheres[k + bit] ? 1 : 0;
+					mismatch8 += ((box8 >> bit) & 1) != expectedBoxes[k + bit] ? 1 : 0;
+					mismatch8 += ((sphere8 >> bit) & 1) != expectedSpheres[k + bit] ? 1 : 0;
+				}
+			}
+
+			// ςĐ擪画肷 (4 ̔{łȂ͖XJ[Ŕ肷)
+			const size_t counts[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 13, 17, static_cast<size_t>(ItemsPerView - 1), static_cast<size_t>(ItemsPerView) };
+			for (const size_t count : counts)
+			{
+				// 擪炵āA SIMD ̖{̂ƒ[̗Ŕ肳悤ɂ
+				const size_t offset = count % 4;
+				const size_t n = (std::min)(count, ItemsPerView - offset);
+				flags.assign(n + 1, 0xCD);
+				size_t expectedCount = 0;
+				const size_t boxCount = frustum.CullAABBs(boxes.data() + offset, n, flags.data());
+				for (size_t k = 0; k < n; ++k)
+				{
+					mismatchCull += flags[k] != expectedBoxes[offset + k] ? 1 : 0;
+					expectedCount += expectedBoxes[offset + k];
+				}
+				countMismatch += boxCount != expectedCount || flags[n] != 0xCD ? 1 : 0;
+
+				flags.assign(n + 1, 0xCD);
+				expectedCount = 0;
+				const size_t sphereCount = frustum.CullSpheres(spheres.data() + offset, n, flags.data());
+				for (size_t k = 0; k < n; ++k)
+				{
+					mismatchCull += flags[k] != expectedSpheres[offset + k] ? 1 : 0;
+					expectedCount += expectedSpheres[offset + k];
+				}
+				countMismatch += sphereCount != expectedCount || flags[n] != 0xCD ? 1 : 0;
+			}
+		}
+		std::printf("  %llu items (%.1f%% visible, %.1f%% of spheres straddle a plane)\n", static_cast<unsigned long long>(total),
+			100.0 * visible / total, 200.0 * straddling / total);
+		std::printf("  %-6s IntersectsAABB4 / IntersectsSphere4 vs Intersects   %llu mismatches\n", mismatch4 == 0 ? "ok" : "FAILED", static_cast<unsigned long long>(mismatch4));
+		std::printf("  %-6s IntersectsAABB8 / IntersectsSphere8 vs Intersects   %llu mismatches\n", mismatch8 == 0 ? "ok" : "FAILED", static_cast<unsigned long long>(mismatch8));
+		std::printf("  %-6s CullAABBs / CullSpheres vs Intersects (with tails)  %llu mismatches, %llu bad counts or overruns\n",
+			mismatchCull + countMismatch == 0 ? "ok" : "FAILED", static_cast<unsigned long long>(mismatchCull), static_cast<unsigned long long>(countMismatch));
+		TEST_CHECK(mismatch4 == 0);
+		TEST_CHECK(mismatch8 == 0);
+		TEST_CHECK(mismatchCull == 0);
+		TEST_CHECK(countMismatch == 0);
+	}
+}
+
+int main()
+{
+#if defined(MATH_SIMD_SSE) || defined(MATH_SIMD_NEON)
+	std::printf("MathBoundsTest (SIMD)\n");
+#else
+	std::printf("MathBoundsTest (scalar)\n");
+#endif
+
+	Random random(7);
+	TestExtraction(random);
+	TestBatch(random);
+	return TestUtility::Finish("MathBoundsTest");
+}
@@ -0,0 +1,213 @@
+// Matrix4x4::inverse (`̗]qWJBSSE ł inverseSSE)AȑO inverse (ScalarReference.h) 
+// inverseAffine ̐xA{x̃KEXEW_@ŋ߂tsƔׂeXg
+// 덷͋ts̐̍ől ULP ő܂B̑傫s͌덷Ⴕđ傫Ȃ̂ŁA
+// ̍s͏ (m)  MaxCondition ȉ̂̂g܂
+// g: MathInverseTest (s 0 ȊOԂ܂)
+
+#include "Math/Matrix4x4.h"
+#include "Math/Quaternion.h"
+#include "Math/Vector3D.h"
+#include "ScalarReference.h"
+#include "TestUtility.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+using TestUtility::ErrorStats;
+using TestUtility::Random;
+
+namespace
+{
+	constexpr int SampleCount = 20000;
+	constexpr double MaxCondition = 100.0;
+
+	/// <summary>
+	/// {xŋ߂tsƁA덷𑪂傫
+	/// </summary>
+	struct ReferenceInverse
+	{
+		double m[4][4] = {};
+		double Magnitude = 0.0; //!< ts̐̍ől
+		double Condition = 0.0; //!< |M| * |M^-1|
+		bool IsValid = false;
+	};
+
+	double GetInfinityNorm(const double (&m)[4][4])
+	{
+		double norm = 0.0;
+		for (const auto& row : m)
+		{
+			norm = (std::max)(norm, std::abs(row[0]) + std::abs(row[1]) + std::abs(row[2]) + std::abs(row[3]));
+		}
+		return norm;
+	}
+
+	//! @brief s{bgIt̃KEXEW_@
+	ReferenceInverse InvertReference(const Matrix4x4& matrix)
+	{
+		double a[4][4];
+		ReferenceInverse result;
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				a[i][j] = matrix.m_mat[i][j];
+				result.m[i][j] = i == j ? 1.0 : 0.0;
+			}
+		}
+		const double norm = GetInfinityNorm(a);
+
+		for (int col = 0; col < 4; ++col)
+		{
+			int pivot = col;
+			for (int row = col + 1; row < 4; ++row)
+			{
+				if (std::abs(a[row][col]) > std::abs(a[pivot][col]))
+				{
+					pivot = row;
+				}
+			}
+			if (a[pivot][col] == 0.0)
+			{
+				return result;
+			}
+			std::swap(a[pivot], a[col]);
+			std::swap(result.m[pivot], result.m[col]);
+
+			const double invPivot = 1.0 / a[col][col];
+			for (int j = 0; j < 4; ++j)
+			{
+				a[col][j] *= invPivot;
+				result.m[col][j] *= invPivot;
+			}
+			for (int row = 0; row < 4; ++row)
+			{
+				if (row == col)
+				{
+					continue;
+				}
+				const double factor = a[row][col];
+				for (int j = 0; j < 4; ++j)
+				{
+					a[row][j] -= factor * a[col][j];
+					result.m[row][j] -= factor * result.m[col][j];
+				}
+			}
+		}
+
+		double maxElement = 0.0;
+		for (const auto& row : result.m)
+		{
+			for (double value : row)
+			{
+				maxElement = (std::max)(maxElement, std::abs(value));
+			}
+		}
+		result.Magnitude = maxElement;
+		result.Condition = norm * GetInfinityNorm(result.m);
+		result.IsValid = true;
+		return result;
+	}
+
+	void AddInverse(ErrorStats& stats, const Matrix4x4& actual, const ReferenceInverse& reference)
+	{
+		for (int row = 0; row < 4; ++row)
+		{
+			for (int col = 0; col < 4; ++col)
+			{
+				stats.Add(actual.m_mat[row][col], reference.m[row][col], reference.Magnitude);
+			}
+		}
+	}
+
+	Vector3D RandomVector3(Random& random, float range)
+	{
+		return Vector3D(random.Range(-range, range), random.Range(-range, range), random.Range(-range, range));
+	}
+
+	Matrix4x4 RandomMatrix(Random& random, float range)
+	{
+		Matrix4x4 m;
+		for (auto& row : m.m_mat)
+		{
+			for (auto& value : row)
+			{
+				value = random.Range(-range, range);
+			}
+		}
+		return m;
+	}
+
+	//! @brief XP[E]EsړȂAtBϊ (Transform::Update sƓ`)
+	Matrix4x4 RandomAffine(Random& random)
+	{
+		Quaternion q(random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f));
+		q.normalize();
+		const Vector3D scale(random.Range(0.1f, 10.0f), random.Range(0.1f, 10.0f), random.Range(0.1f, 10.0f));
+		return Matrix4x4::Compose(scale, q, RandomVector3(random, 100.0f));
+	}
+
+	bool IsIdentity(const Matrix4x4& matrix)
+	{
+		return std::memcmp(matrix.m_mat, Matrix4x4::Identity().m_mat, sizeof(matrix.m_mat)) == 0;
+	}
+}
+
+int main()
+{
+#if defined(MATH_SIMD_SSE)
+	std::printf("MathInverseTest (inverseSSE)\n");
+#else
+	std::printf("MathInverseTest (scalar cofactor)\n");
+#endif
+
+	Random random(21);
+	{
+		std::printf("random matrices (elements in [-10, 10])\n");
+		ErrorStats current("Matrix4x4::inverse", 64);
+		ErrorStats previous("previous inverse (cross + pow)", 64);
+		int skippedCount = 0;
+		for (int i = 0; i < SampleCount; ++i)
+		{
+			const Matrix4x4 m = RandomMatrix(random, 10.0f);
+			const ReferenceInverse reference = InvertReference(m);
+			if (!reference.IsValid || reference.Condition > MaxCondition)
+			{
+				++skippedCount;
+				continue;
+			}
+			AddInverse(current, Matrix4x4::inverse(m), reference);
+			AddInverse(previous, ScalarReference::Inverse(m), reference);
+		}
+		std::printf("  (%d of %d matrices skipped: condition number > %g)\n", skippedCount, SampleCount, MaxCondition);
+	}
+	{
+		std::printf("affine matrices (scale in [0.1, 10], translation in [-100, 100])\n");
+		ErrorStats current("Matrix4x4::inverse", 64);
+		ErrorStats previous("previous inverse (cross + pow)", 64);
+		// inverseAffine ͊ۂ߂ R^-1 畽sړ -(t * R^-1) ߂̂ŁA|t| 傫قǌ덷
+		ErrorStats affine("Matrix4x4::inverseAffine", 512);
+		for (int i = 0; i < SampleCount; ++i)
+		{
+			const Matrix4x4 m = RandomAffine(random);
+			const ReferenceInverse reference = InvertReference(m);
+			AddInverse(current, Matrix4x4::inverse(m), reference);
+			AddInverse(previous, ScalarReference::Inverse(m), reference);
+			AddInverse(affine, Matrix4x4::inverseAffine(m), reference);
+		}
+	}
+
+	// ٍs͈ȑOƓPʍsԂ
+	Matrix4x4 singular = RandomMatrix(random, 10.0f);
+	for (int col = 0; col < 4; ++col)
+	{
+		singular.m_mat[3][col] = 0.0f;
+	}
+	TEST_CHECK(IsIdentity(Matrix4x4::inverse(singular)));
+	TEST_CHECK(IsIdentity(ScalarReference::Inverse(singular)));
+
+	return TestUtility::Finish("MathInverseTest");
+}
@@ -0,0 +1,466 @@
+// header/Math ̊eZ{x̎QƒlƔׁA덷 (ULP) e͈͂Ɏ܂邩m߂eXg
+// ꊇ SIMD ƃXJ[̔r͕ʂ̃eXgōs܂
+//   TransformBatch: TransformBatchTest.cpp  QuaternionBatch: QuaternionBatchTest.cpp  Bounds (Frustum): BoundsTest.cpp  Matrix3x4: Matrix3x4Test.cpp
+// g: MathTest (s 0 ȊOԂ܂)
+
+#include "Math/MathUtility.h"
+#include "Math/Vector2D.h"
+#include "Math/Vector3D.h"
+#include "Math/Vector4D.h"
+#include "Math/Quaternion.h"
+#include "Math/Matrix4x4.h"
+#include "TestUtility.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+using TestUtility::ErrorStats;
+using TestUtility::Random;
+
+namespace
+{
+	constexpr int SampleCount = 10000;
+	constexpr double Pi = 3.14159265358979323846;
+
+	Vector3D RandomVector3(Random& random, float range)
+	{
+		return Vector3D(random.Range(-range, range), random.Range(-range, range), random.Range(-range, range));
+	}
+
+	Vector4D RandomVector4(Random& random, float range)
+	{
+		return Vector4D(random.Range(-range, range), random.Range(-range, range), random.Range(-range, range), random.Range(-range, range));
+	}
+
+	Quaternion RandomRotation(Random& random)
+	{
+		Quaternion q(random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f));
+		return q.normalize();
+	}
+
+	Matrix4x4 RandomMatrix(Random& random, float range)
+	{
+		Matrix4x4 m;
+		for (auto& row : m.m_mat)
+		{
+			for (auto& value : row)
+			{
+				value = random.Range(-range, range);
+			}
+		}
+		return m;
+	}
+
+	//! @brief {x 4x4 s (QƒľvZp)
+	struct Matrix4d
+	{
+		double m[4][4];
+
+		explicit Matrix4d(const Matrix4x4& source)
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				for (int j = 0; j < 4; ++j)
+				{
+					m[i][j] = source.m_mat[i][j];
+				}
+			}
+		}
+
+		double Determinant() const
+		{
+			// 1sڂ̗]qWJ
+			double det = 0.0;
+			for (int col = 0; col < 4; ++col)
+			{
+				det += (col % 2 == 0 ? 1.0 : -1.0) * m[0][col] * Minor3(0, col);
+			}
+			return det;
+		}
+
+		//! @brief s񎮂̓WJɌ鍀̐Βl̘a (덷𑪂傫)
+		double DeterminantMagnitude() const
+		{
+			double magnitude = 0.0;
+			for (int col = 0; col < 4; ++col)
+			{
+				magnitude += std::abs(m[0][col]) * Minor3(0, col, true);
+			}
+			return magnitude;
+		}
+
+		//! @brief row sEcol  3x3 ̍s (isMagnitude Ȃe̐Βl̘a)
+		double Minor3(int row, int col, bool isMagnitude = false) const
+		{
+			double sub[3][3];
+			for (int i = 0, si = 0; i < 4; ++i)
+			{
+				if (i == row)
+				{
+					continue;
+				}
+				for (int j = 0, sj = 0; j < 4; ++j)
+				{
+					if (j != col)
+					{
+						sub[si][sj++] = m[i][j];
+					}
+				}
+				++si;
+			}
+			if (isMagnitude)
+			{
+				for (auto& subRow : sub)
+				{
+					for (auto& value : subRow)
+					{
+						value = std::abs(value);
+					}
+				}
+				return sub[0][0] * (sub[1][1] * sub[2][2] + sub[1][2] * sub[2][1])
+					+ sub[0][1] * (sub[1][0] * sub[2][2] + sub[1][2] * sub[2][0])
+					+ sub[0][2] * (sub[1][0] * sub[2][1] + sub[1][1] * sub[2][0]);
+			}
+			return sub[0][0] * (sub[1][1] * sub[2][2] - sub[1][2] * sub[2][1])
+				- sub[0][1] * (sub[1][0] * sub[2][2] - sub[1][2] * sub[2][0])
+				+ sub[0][2] * (sub[1][0] * sub[2][1] - sub[1][1] * sub[2][0]);
+		}
+	};
+
+	//! @brief s̐ς (row, col) Ɍ鍀̐Βl̘a
+	double GetProductMagnitude(const Matrix4x4& a, const Matrix4x4& b, int row, int col)
+	{
+		double magnitude = 0.0;
+		for (int k = 0; k < 4; ++k)
+		{
+			magnitude += std::abs(static_cast<double>(a.m_mat[row][k]) * b.m_mat[k][col]);
+		}
+		return magnitude;
+	}
+
+	void TestVector()
+	{
+		std::printf("Vector2D / Vector3D / Vector4D\n");
+		Random random(1);
+		ErrorStats add("Vector3D operator+ / operator-", 0);
+		ErrorStats scale("Vector3D operator* (scalar)", 0);
+		ErrorStats dot2("Vector2D::dot", 2);
+		ErrorStats dot3("Vector3D::dot", 2);
+		ErrorStats dot4("Vector4D::dot", 4);
+		ErrorStats length3("Vector3D::length", 2);
+		ErrorStats cross3("Vector3D::cross", 2);
+		ErrorStats cross2("Vector2D::cross", 2);
+		ErrorStats cross4("Vector4D::cross (3 vectors)", 8);
+		ErrorStats normal3("Vector3D::GetSafeNormal", 3);
+		ErrorStats normal4("Vector4D::GetSafeNormal", 3);
+		for (int i = 0; i < SampleCount; ++i)
+		{
+			const Vector3D a = RandomVector3(random, 100.0f);
+			const Vector3D b = RandomVector3(random, 100.0f);
+			const float s = random.Range(-10.0f, 10.0f);
+
+			const Vector3D sum = a + b;
+			const Vector3D diff = a - b;
+			add.Add(sum.x, static_cast<float>(a.x + b.x));
+			add.Add(diff.z, static_cast<float>(a.z - b.z));
+			scale.Add((a * s).y, static_cast<float>(a.y * s));
+
+			const double ax = a.x, ay = a.y, az = a.z, bx = b.x, by = b.y, bz = b.z;
+			dot3.Add(a.dot(b), ax * bx + ay * by + az * bz, std::abs(ax * bx) + std::abs(ay * by) + std::abs(az * bz));
+			length3.Add(a.length(), std::sqrt(ax * ax + ay * ay + az * az));
+			const Vector3D c = a.cross(b);
+			cross3.Add(c.x, ay * bz - az * by, std::abs(ay * bz) + std::abs(az * by));
+			cross3.Add(c.y, az * bx - ax * bz, std::abs(az * bx) + std::abs(ax * bz));
+			cross3.Add(c.z, ax * by - ay * bx, std::abs(ax * by) + std::abs(ay * bx));
+			const double len = std::sqrt(ax * ax + ay * ay + az * az);
+			const Vector3D n = a.GetSafeNormal();
+			normal3.Add(n.x, ax / len);
+			normal3.Add(n.y, ay / len);
+			normal3.Add(n.z, az / len);
+
+			const Vector2D a2(a.x, a.y);
+			const Vector2D b2(b.x, b.y);
+			dot2.Add(a2.dot(b2), ax * bx + ay * by, std::abs(ax * bx) + std::abs(ay * by));
+			cross2.Add(a2.cross(b2).x, ax * by - ay * bx, std::abs(ax * by) + std::abs(ay * bx));
+
+			const Vector4D p = RandomVector4(random, 10.0f);
+			const Vector4D q = RandomVector4(random, 10.0f);
+			const Vector4D r = RandomVector4(random, 10.0f);
+			const double pq[4] = { static_cast<double>(p.x) * q.x, static_cast<double>(p.y) * q.y,
+				static_cast<double>(p.z) * q.z, static_cast<double>(p.w) * q.w };
+			dot4.Add(p.dot(q), pq[0] + pq[1] + pq[2] + pq[3], std::abs(pq[0]) + std::abs(pq[1]) + std::abs(pq[2]) + std::abs(pq[3]));
+			const double p4 = std::sqrt(static_cast<double>(p.x) * p.x + static_cast<double>(p.y) * p.y
+				+ static_cast<double>(p.z) * p.z + static_cast<double>(p.w) * p.w);
+			normal4.Add(p.GetSafeNormal().w, p.w / p4);
+
+			// 4̊Oς̊e p, q, r ׂ 3x4 ̍s񂩂1s (͌)
+			Matrix4x4 rows;
+			const Vector4D inputs[3] = { p, q, r };
+			for (int row = 0; row < 3; ++row)
+			{
+				rows.m_mat[row][0] = inputs[row].x;
+				rows.m_mat[row][1] = inputs[row].y;
+				rows.m_mat[row][2] = inputs[row].z;
+				rows.m_mat[row][3] = inputs[row].w;
+			}
+			const Matrix4d rows64(rows);
+			const Vector4D cross = p.cross(q, r);
+			cross4.Add(cross.x, rows64.Minor3(3, 0), rows64.Minor3(3, 0, true));
+			cross4.Add(cross.y, -rows64.Minor3(3, 1), rows64.Minor3(3, 1, true));
+			cross4.Add(cross.z, rows64.Minor3(3, 2), rows64.Minor3(3, 2, true));
+			cross4.Add(cross.w, -rows64.Minor3(3, 3), rows64.Minor3(3, 3, true));
+		}
+
+		//  0 ɋ߂xNg 0 Ԃ
+		TEST_CHECK(Vector3D(0.0f).GetSafeNormal().length() == 0.0f);
+		TEST_CHECK(Vector2D(1e-9f, 0.0f).GetSafeNormal().length() == 0.0f);
+		TEST_CHECK(Vector4D(0.0f).GetSafeNormal().length() == 0.0f);
+	}
+
+	void TestMathUtility()
+	{
+		std::printf("MathUtility\n");
+		ErrorStats toRadian("MathUtility::DegreeToRadian", 1);
+		ErrorStats roundTrip("MathUtility::RadianToDegree(DegreeToRadian)", 1);
+		for (int degree = -720; degree <= 720; ++degree)
+		{
+			const float value = static_cast<float>(degree);
+			toRadian.Add(MathUtility::DegreeToRadian(value), degree * Pi / 180.0);
+			roundTrip.Add(MathUtility::RadianToDegree(MathUtility::DegreeToRadian(value)), degree);
+		}
+	}
+
+	void TestQuaternion()
+	{
+		std::printf("Quaternion\n");
+		Random random(2);
+		ErrorStats multiply("Quaternion operator*", 4);
+		ErrorStats normalize("Quaternion::normalize (length)", 4);
+		ErrorStats angleAxis("Quaternion::AngleAxis (rotated vector)", 16);
+		ErrorStats euler("Quaternion::EulerAngles(Euler) (degree)", 256);
+		for (int i = 0; i < SampleCount; ++i)
+		{
+			const Quaternion a = RandomRotation(random);
+			const Quaternion b = RandomRotation(random);
+			const Quaternion c = a * b;
+			const double x1 = a.x, y1 = a.y, z1 = a.z, w1 = a.w, x2 = b.x, y2 = b.y, z2 = b.z, w2 = b.w;
+			multiply.Add(c.x, w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2, std::abs(w1 * x2) + std::abs(x1 * w2) + std::abs(y1 * z2) + std::abs(z1 * y2));
+			multiply.Add(c.y, w1 * y2 + y1 * w2 + z1 * x2 - x1 * z2, std::abs(w1 * y2) + std::abs(y1 * w2) + std::abs(z1 * x2) + std::abs(x1 * z2));
+			multiply.Add(c.z, w1 * z2 + z1 * w2 + x1 * y2 - y1 * x2, std::abs(w1 * z2) + std::abs(z1 * w2) + std::abs(x1 * y2) + std::abs(y1 * x2));
+			multiply.Add(c.w, w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2, std::abs(w1 * w2) + std::abs(x1 * x2) + std::abs(y1 * y2) + std::abs(z1 * z2));
+
+			Quaternion compound = a;
+			compound *= b;
+			TEST_CHECK(compound.x == c.x && compound.y == c.y && compound.z == c.z && compound.w == c.w);
+
+			Quaternion scaled = a;
+			scaled *= random.Range(0.1f, 10.0f);
+			normalize.Add(scaled.normalize().length(), 1.0);
+
+			// ̉] Rodrigues ̎Ɣׂ
+			const Vector3D axis = RandomVector3(random, 1.0f);
+			const float angle = random.Range(-180.0f, 180.0f);
+			const Vector3D v = RandomVector3(random, 10.0f);
+			const Matrix4x4 rotation = Matrix4x4::QuaternionToMatrix(Quaternion::AngleAxis(angle, axis));
+			const Vector3D rotated = Matrix4x4::Apply(rotation, v);
+			const double axisLength = std::sqrt(static_cast<double>(axis.x) * axis.x + static_cast<double>(axis.y) * axis.y
+				+ static_cast<double>(axis.z) * axis.z);
+			const double kx = axis.x / axisLength, ky = axis.y / axisLength, kz = axis.z / axisLength;
+			const double theta = angle * Pi / 180.0;
+			const double vx = v.x, vy = v.y, vz = v.z;
+			const double kv = kx * vx + ky * vy + kz * vz;
+			const double cosT = std::cos(theta), sinT = std::sin(theta);
+			const double vLength = std::sqrt(vx * vx + vy * vy + vz * vz);
+			angleAxis.Add(rotated.x, vx * cosT + (ky * vz - kz * vy) * sinT + kx * kv * (1.0 - cosT), vLength);
+			angleAxis.Add(rotated.y, vy * cosT + (kz * vx - kx * vz) * sinT + ky * kv * (1.0 - cosT), vLength);
+			angleAxis.Add(rotated.z, vz * cosT + (kx * vy - ky * vx) * sinT + kz * kv * (1.0 - cosT), vLength);
+
+			// WobN̋߂IC[p̉
+			const Vector3D degree(random.Range(-85.0f, 85.0f), random.Range(-175.0f, 175.0f), random.Range(-175.0f, 175.0f));
+			const Vector3D back = Quaternion::EulerAngles(Quaternion::Euler(degree));
+			euler.Add(back.x, degree.x, 180.0);
+			euler.Add(back.y, degree.y, 180.0);
+			euler.Add(back.z, degree.z, 180.0);
+		}
+	}
+
+	void TestMatrix4x4()
+	{
+		std::printf("Matrix4x4\n");
+		Random random(3);
+		ErrorStats multiply("Matrix4x4 operator*", 4);
+		ErrorStats apply("Matrix4x4::Apply", 4);
+		ErrorStats determinant("Matrix4x4::getDeterminant", 32);
+		ErrorStats inverse("Matrix4x4::inverse (M * M^-1 = I)", 32);
+		// XP[͍̔ő 40 {Ȃ̂ŁA̕e͈͂L
+		ErrorStats inverseAffine("Matrix4x4::inverseAffine (M * M^-1 = I)", 128);
+		ErrorStats compose("Matrix4x4::Compose (vs S * R * T)", 4);
+		ErrorStats euler("Matrix4x4::RotationToMatrix (vs Euler)", 16);
+		ErrorStats orthonormal("QuaternionToMatrix (R * R^T = I)", 16);
+		for (int i = 0; i < SampleCount; ++i)
+		{
+			const Matrix4x4 a = RandomMatrix(random, 10.0f);
+			const Matrix4x4 b = RandomMatrix(random, 10.0f);
+			const Matrix4x4 ab = a * b;
+			for (int row = 0; row < 4; ++row)
+			{
+				for (int col = 0; col < 4; ++col)
+				{
+					double expected = 0.0;
+					for (int k = 0; k < 4; ++k)
+					{
+						expected += static_cast<double>(a.m_mat[row][k]) * b.m_mat[k][col];
+					}
+					multiply.Add(ab.m_mat[row][col], expected, GetProductMagnitude(a, b, row, col));
+				}
+			}
+
+			Matrix4x4 compound = a;
+			compound *= b;
+			TEST_CHECK(std::memcmp(compound.m_mat, ab.m_mat, sizeof(ab.m_mat)) == 0);
+
+			const Matrix4x4 t = Matrix4x4::transpose(a);
+			bool isTransposed = true;
+			for (int row = 0; row < 4; ++row)
+			{
+				for (int col = 0; col < 4; ++col)
+				{
+					isTransposed &= t.m_mat[row][col] == a.m_mat[col][row];
+				}
+			}
+			TEST_CHECK(isTransposed);
+
+			const Vector3D v = RandomVector3(random, 10.0f);
+			const Vector3D p = Matrix4x4::Apply(a, v);
+			const float out[3] = { p.x, p.y, p.z };
+			for (int col = 0; col < 3; ++col)
+			{
+				const double terms[4] = { static_cast<double>(v.x) * a.m_mat[0][col], static_cast<double>(v.y) * a.m_mat[1][col],
+					static_cast<double>(v.z) * a.m_mat[2][col], a.m_mat[3][col] };
+				apply.Add(out[col], terms[0] + terms[1] + terms[2] + terms[3],
+					std::abs(terms[0]) + std::abs(terms[1]) + std::abs(terms[2]) + std::abs(terms[3]));
+			}
+
+			const Matrix4d a64(a);
+			determinant.Add(Matrix4x4::getDeterminant(a), a64.Determinant(), a64.DeterminantMagnitude());
+
+			// ̈s邽߁AΊp傫s̋tsm߂
+			Matrix4x4 wellConditioned = RandomMatrix(random, 1.0f);
+			for (int k = 0; k < 4; ++k)
+			{
+				wellConditioned.m_mat[k][k] += 4.0f;
+			}
+			const Matrix4x4 inverted = Matrix4x4::inverse(wellConditioned);
+			const Matrix4x4 identity = wellConditioned * inverted;
+			for (int row = 0; row < 4; ++row)
+			{
+				for (int col = 0; col < 4; ++col)
+				{
+					inverse.Add(identity.m_mat[row][col], row == col ? 1.0 : 0.0, (std::max)(1.0, GetProductMagnitude(wellConditioned, inverted, row, col)));
+				}
+			}
+
+			// XP[E]Esړ (XP[̔䂪傫قǋtš덷͑傫Ȃ邽߁AM * M^-1 ̌덷 1  ULP ő)
+			const Quaternion q = RandomRotation(random);
+			const Vector3D scale(random.Range(0.1f, 4.0f), random.Range(0.1f, 4.0f), random.Range(0.1f, 4.0f));
+			const Vector3D translation = RandomVector3(random, 100.0f);
+			const Matrix4x4 srt = Matrix4x4::Compose(scale, q, translation);
+			const Matrix4x4 reference = Matrix4x4::ScalingToMatrix(scale) * Matrix4x4::QuaternionToMatrix(q) * Matrix4x4::TransitionToMatrix(translation);
+			const Matrix4x4 affineInverted = Matrix4x4::inverseAffine(srt);
+			const Matrix4x4 affineIdentity = srt * affineInverted;
+			const Matrix4x4 rotation = Matrix4x4::QuaternionToMatrix(q);
+			const Matrix4x4 rrt = rotation * Matrix4x4::transpose(rotation);
+			for (int row = 0; row < 4; ++row)
+			{
+				for (int col = 0; col < 4; ++col)
+				{
+					compose.Add(srt.m_mat[row][col], reference.m_mat[row][col]);
+					inverseAffine.Add(affineIdentity.m_mat[row][col], row == col ? 1.0 : 0.0, (std::max)(1.0, GetProductMagnitude(srt, affineInverted, row, col)));
+					orthonormal.Add(rrt.m_mat[row][col], row == col ? 1.0 : 0.0, 1.0);
+				}
+			}
+
+			// IC[p̉]s̓NH[^jIoRƓ]ɂȂ
+			const Vector3D degree(random.Range(-180.0f, 180.0f), random.Range(-180.0f, 180.0f), random.Range(-180.0f, 180.0f));
+			const Matrix4x4 fromEuler = Matrix4x4::RotationToMatrix(degree);
+			const Matrix4x4 fromQuaternion = Matrix4x4::QuaternionToMatrix(Quaternion::Euler(degree));
+			for (int row = 0; row < 3; ++row)
+			{
+				for (int col = 0; col < 3; ++col)
+				{
+					euler.Add(fromEuler.m_mat[row][col], fromQuaternion.m_mat[row][col], 1.0);
+				}
+			}
+		}
+
+		// ٍs̋ts͒Pʍs
+		Matrix4x4 singular;
+		singular.m_mat[2][2] = 0.0f;
+		const Matrix4x4 singularInverse = Matrix4x4::inverse(singular);
+		TEST_CHECK(std::memcmp(singularInverse.m_mat, Matrix4x4::Identity().m_mat, sizeof(singularInverse.m_mat)) == 0);
+	}
+
+	void TestProjection()
+	{
+		std::printf("Matrix4x4 view / projection\n");
+		Random random(4);
+		ErrorStats lookAt("setLookAtLH (target on +Z)", 16);
+		ErrorStats perspective("setPerspectiveFovLH (near 0, far 1)", 16);
+		ErrorStats ortho("setOrthoOffsetLH (corners to NDC)", 16);
+		for (int i = 0; i < SampleCount; ++i)
+		{
+			const Vector3D eye = RandomVector3(random, 50.0f);
+			const Vector3D target = RandomVector3(random, 50.0f);
+			const Matrix4x4 view = Matrix4x4::setLookAtLH(eye, target, Vector3D(0.0f, 1.0f, 0.0f));
+			const Vector3D local = Matrix4x4::Apply(view, target);
+			// r[s̕sړ eye ̑傫A]̍W target ̑傫̒l̘aɂȂ
+			const double extent = static_cast<double>(eye.length()) + target.length();
+			lookAt.Add(local.x, 0.0, extent);
+			lookAt.Add(local.y, 0.0, extent);
+			lookAt.Add(local.z, (target - eye).length(), extent);
+
+			//  nearEfar ʂ͐[x 0E1 ɂȂ (w Ŋ)
+			const float znear = random.Range(0.01f, 1.0f);
+			const float zfar = random.Range(10.0f, 1000.0f);
+			const Matrix4x4 proj = Matrix4x4::setPerspectiveFovLH(random.Range(0.5f, 2.0f), random.Range(0.5f, 2.0f), znear, zfar);
+			const Vector3D nearPoint = Matrix4x4::Apply(proj, Vector3D(0.0f, 0.0f, znear));
+			const Vector3D farPoint = Matrix4x4::Apply(proj, Vector3D(0.0f, 0.0f, zfar));
+			perspective.Add(nearPoint.z / znear, 0.0, 1.0);
+			perspective.Add(farPoint.z / zfar, 1.0);
+
+			const float left = random.Range(-100.0f, -1.0f);
+			const float right = random.Range(1.0f, 100.0f);
+			const float bottom = random.Range(-100.0f, -1.0f);
+			const float top = random.Range(1.0f, 100.0f);
+			const Matrix4x4 offset = Matrix4x4::setOrthoOffsetLH(left, right, bottom, top, znear, zfar);
+			const Vector3D minCorner = Matrix4x4::Apply(offset, Vector3D(left, bottom, znear));
+			const Vector3D maxCorner = Matrix4x4::Apply(offset, Vector3D(right, top, zfar));
+			ortho.Add(minCorner.x, -1.0);
+			ortho.Add(minCorner.y, -1.0);
+			ortho.Add(minCorner.z, 0.0, 1.0);
+			ortho.Add(maxCorner.x, 1.0);
+			ortho.Add(maxCorner.y, 1.0);
+			ortho.Add(maxCorner.z, 1.0);
+		}
+	}
+}
+
+int main()
+{
+#if defined(MATH_SIMD_AVX)
+	std::printf("MathTest (AVX)\n");
+#elif defined(MATH_SIMD_SSE)
+	std::printf("MathTest (SSE)\n");
+#elif defined(MATH_SIMD_NEON)
+	std::printf("MathTest (NEON)\n");
+#else
+	std::printf("MathTest (scalar)\n");
+#endif
+	TestVector();
+	TestMathUtility();
+	TestQuaternion();
+	TestMatrix4x4();
+	TestProjection();
+	return TestUtility::Finish("MathTest");
+}
@@ -0,0 +1,175 @@
+// Matrix3x4 ̍EρEtsExNgϊAϊ Matrix4x4 ̌ʂƔׂeXg
+// ρEEϊ Matrix4x4 Ɠő̂ŃrbgPʂňvAts͌vZ@Ⴄ̂ ULP Ŕׂ܂
+// g: MathMatrix3x4Test (s 0 ȊOԂ܂)
+
+#include "Math/Matrix3x4.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Quaternion.h"
+#include "Math/Vector3D.h"
+#include "TestUtility.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+using TestUtility::ErrorStats;
+using TestUtility::Random;
+
+namespace
+{
+	constexpr int SampleCount = 50000;
+
+	Vector3D RandomVector3(Random& random, float range)
+	{
+		return Vector3D(random.Range(-range, range), random.Range(-range, range), random.Range(-range, range));
+	}
+
+	Quaternion RandomRotation(Random& random)
+	{
+		Quaternion q(random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f));
+		return q.normalize();
+	}
+
+	//! @brief f܂ވʂ̃AtBϊ (3x3 ̑Ίp傫ď})
+	Matrix4x4 RandomAffine(Random& random)
+	{
+		Matrix4x4 m;
+		for (int row = 0; row < 3; ++row)
+		{
+			for (int col = 0; col < 3; ++col)
+			{
+				m.m_mat[row][col] = random.Range(-1.0f, 1.0f) + (row == col ? 3.0f : 0.0f);
+			}
+			m.m_mat[row][3] = 0.0f;
+		}
+		const Vector3D translation = RandomVector3(random, 100.0f);
+		m.m_mat[3][0] = translation.x;
+		m.m_mat[3][1] = translation.y;
+		m.m_mat[3][2] = translation.z;
+		m.m_mat[3][3] = 1.0f;
+		return m;
+	}
+
+	void AddMatrix(ErrorStats& stats, const Matrix3x4& actual, const Matrix3x4& expected)
+	{
+		for (int row = 0; row < 3; ++row)
+		{
+			for (int col = 0; col < 4; ++col)
+			{
+				stats.AddExact(actual.m_mat[row][col], expected.m_mat[row][col]);
+			}
+		}
+	}
+
+	void AddVector(ErrorStats& stats, const Vector3D& actual, const Vector3D& expected)
+	{
+		stats.AddExact(actual.x, expected.x);
+		stats.AddExact(actual.y, expected.y);
+		stats.AddExact(actual.z, expected.z);
+	}
+
+	bool IsIdentity(const Matrix3x4& matrix)
+	{
+		return std::memcmp(matrix.m_mat, Matrix3x4::Identity().m_mat, sizeof(matrix.m_mat)) == 0;
+	}
+}
+
+int main()
+{
+#if defined(MATH_SIMD_SSE) || defined(MATH_SIMD_NEON)
+	std::printf("MathMatrix3x4Test (SIMD)\n");
+#else
+	std::printf("MathMatrix3x4Test (scalar)\n");
+#endif
+
+	Random random(31);
+	ErrorStats roundTrip("Matrix3x4(M).ToMatrix4x4() == M", 0);
+	ErrorStats compose("Compose vs Matrix4x4::Compose", 0);
+	ErrorStats multiply("operator* vs Matrix4x4 operator*", 0);
+	ErrorStats compound("operator*= (aliased) vs Matrix4x4", 0);
+	ErrorStats point("TransformPoint vs Matrix4x4::Apply", 0);
+	ErrorStats direction("TransformDirection vs Apply (no translation)", 0);
+	ErrorStats inverse("inverse vs Matrix4x4::inverse", 16);
+	ErrorStats determinant("getDeterminant vs Matrix4x4", 16);
+	for (int i = 0; i < SampleCount; ++i)
+	{
+		const Matrix4x4 a = RandomAffine(random);
+		const Matrix4x4 b = RandomAffine(random);
+		const Matrix3x4 a3(a);
+		const Matrix3x4 b3(b);
+
+		const Matrix4x4 back = a3.ToMatrix4x4();
+		for (int row = 0; row < 4; ++row)
+		{
+			for (int col = 0; col < 4; ++col)
+			{
+				roundTrip.AddExact(back.m_mat[row][col], a.m_mat[row][col]);
+			}
+		}
+
+		const Vector3D scale(random.Range(0.1f, 10.0f), random.Range(0.1f, 10.0f), random.Range(0.1f, 10.0f));
+		const Quaternion q = RandomRotation(random);
+		const Vector3D translation = RandomVector3(random, 100.0f);
+		AddMatrix(compose, Matrix3x4::Compose(scale, q, translation), Matrix3x4(Matrix4x4::Compose(scale, q, translation)));
+
+		AddMatrix(multiply, a3 * b3, Matrix3x4(a * b));
+		Matrix3x4 squared = a3;
+		squared *= squared;
+		AddMatrix(compound, squared, Matrix3x4(a * a));
+
+		const Vector3D v = RandomVector3(random, 100.0f);
+		AddVector(point, Matrix3x4::TransformPoint(a3, v), Matrix4x4::Apply(a, v));
+		Matrix4x4 linear = a;
+		linear.setTranslation(Vector3D(0.0f, 0.0f, 0.0f));
+		AddVector(direction, Matrix3x4::TransformDirection(a3, v), Matrix4x4::Apply(linear, v));
+
+		// ts͐̍ől ULP Ŕׂ (3x3  4x4 ̗]qWJł͊ۂ߂̏Ⴄ)
+		const Matrix3x4 inverse3 = Matrix3x4::inverse(a3);
+		const Matrix3x4 inverse4(Matrix4x4::inverse(a));
+		double maxElement = 0.0;
+		for (const auto& row : inverse4.m_mat)
+		{
+			for (float value : row)
+			{
+				maxElement = (std::max)(maxElement, static_cast<double>(std::abs(value)));
+			}
+		}
+		for (int row = 0; row < 3; ++row)
+		{
+			for (int col = 0; col < 4; ++col)
+			{
+				inverse.Add(inverse3.m_mat[row][col], inverse4.m_mat[row][col], maxElement);
+			}
+		}
+
+		const float det4 = Matrix4x4::getDeterminant(a);
+		determinant.Add(Matrix3x4::getDeterminant(a3), det4);
+	}
+	roundTrip.Report();
+	compose.Report();
+	multiply.Report();
+	compound.Report();
+	point.Report();
+	direction.Report();
+	inverse.Report();
+	determinant.Report();
+
+	// قȍs̋ts͒Pʍs
+	Matrix3x4 singular = Matrix3x4::Compose(Vector3D(1.0f, 0.0f, 1.0f), Quaternion(0.0f, 0.0f, 0.0f, 1.0f), Vector3D(1.0f, 2.0f, 3.0f));
+	TEST_CHECK(IsIdentity(Matrix3x4::inverse(singular)));
+
+	// tsƂ̐ς͒PʍsɂȂ
+	const Matrix3x4 m = Matrix3x4::Compose(Vector3D(2.0f, 0.5f, 4.0f), RandomRotation(random), Vector3D(10.0f, -20.0f, 30.0f));
+	const Matrix3x4 identity = m * Matrix3x4::inverse(m);
+	for (int row = 0; row < 3; ++row)
+	{
+		for (int col = 0; col < 4; ++col)
+		{
+			const float expected = row == col ? 1.0f : 0.0f;
+			TEST_CHECK(std::abs(identity.m_mat[row][col] - expected) < 1e-4f);
+		}
+	}
+
+	return TestUtility::Finish("MathMatrix3x4Test");
+}
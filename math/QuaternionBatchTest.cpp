@@ -0,0 +1,414 @@
+// QuaternionBatch ̈ꊇAXJ[ QuaternionEMatrix4x4 ̃R[hƔ{x̎QƒlƔׂeXg
+// NormalizeENlerpESlerp  Accurate  Fast ̗ ULP (̑傫 1 ł ULP) Ɖ]p̌덷Ŋm߂܂
+// Slerp  t = 0E1 Ƃ̋߂Aقړ̑g (Accurate `Ԃɐ؂ւpx̑O)AŒZoH̔]A90 xꂽg܂݂܂
+// ToMatrixEToMatrix3x4  Fast  Matrix4x4::QuaternionToMatrix ƃrbgPʂňvAAccurate ͐KĂȂ͂m߂܂
+// vf͒[ (4 ̔{łȂ) ƕ񏈗ɐ؂ւ鐔 (ParallelThreshold ȏ) ̗ʂ܂
+// g: MathQuaternionBatchTest (s 0 ȊOԂ܂)
+
+#include "Math/Matrix3x4.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Quaternion.h"
+#include "Math/QuaternionBatch.h"
+#include "TestUtility.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using QuaternionBatch::Precision;
+using TestUtility::ErrorStats;
+using TestUtility::Random;
+
+namespace
+{
+	//! vf ([E4 vfƒ[E񏈗ƒ[)
+	constexpr size_t Counts[] = { 1, 7, QuaternionBatch::ParallelThreshold + 5 };
+	constexpr size_t MaxCount = QuaternionBatch::ParallelThreshold + 5;
+
+	struct Quatd
+	{
+		double x, y, z, w;
+	};
+
+	Quatd ToDouble(const Quaternion& q)
+	{
+		return { q.x, q.y, q.z, q.w };
+	}
+
+	double Dot(const Quatd& a, const Quatd& b)
+	{
+		return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+	}
+
+	Quatd Normalize(const Quatd& q)
+	{
+		const double length = std::sqrt(Dot(q, q));
+		return { q.x / length, q.y / length, q.z / length, q.w / length };
+	}
+
+	Quatd Blend(const Quatd& a, const Quatd& b, double wa, double wb)
+	{
+		return { a.x * wa + b.x * wb, a.y * wa + b.y * wb, a.z * wa + b.z * wb, a.w * wa + b.w * wb };
+	}
+
+	/// <summary>
+	/// ŒZoHɂ邽߂ b ̕
+	/// ς 0 ɋ߂ (90 xꂽ) g͂ǂ̌oĤŁAQuaternionBatch Ɠ float őς̕ɍ킹
+	/// </summary>
+	double GetShortestSign(const Quaternion& a, const Quaternion& b)
+	{
+		float d = a.x * b.x;
+		d = a.y * b.y + d;
+		d = a.z * b.z + d;
+		d = a.w * b.w + d;
+		return d < 0.0f ? -1.0 : 1.0;
+	}
+
+	//! @brief ŒZoH̐K` ({x)
+	Quatd NlerpReference(const Quaternion& from, const Quaternion& to, double t)
+	{
+		const double sign = GetShortestSign(from, to);
+		return Normalize(Blend(ToDouble(from), ToDouble(to), 1.0 - t, t * sign));
+	}
+
+	//! @brief ŒZoH̋ʐ` ({xA͂͐KĎg)
+	Quatd SlerpReference(const Quaternion& from, const Quaternion& to, double t)
+	{
+		const Quatd a = Normalize(ToDouble(from));
+		const Quatd b = Normalize(ToDouble(to));
+		const double sign = GetShortestSign(from, to);
+		// sin()    cos 狁߂  ƂɌ̂ŁÃm狁߂
+		const Quatd difference = Blend(a, b, 1.0, -sign);
+		const double theta = 2.0 * std::asin((std::min)(std::sqrt(Dot(difference, difference)) * 0.5, 1.0));
+		if (theta == 0.0)
+		{
+			return a;
+		}
+		const double invSin = 1.0 / std::sin(theta);
+		return Blend(a, b, std::sin((1.0 - t) * theta) * invSin, std::sin(t * theta) * invSin * sign);
+	}
+
+	//! @brief 2̒PʃNH[^jI\]̊px̍ (WAAq  -q ͓])
+	double GetRotationError(const Quaternion& actual, const Quatd& expected)
+	{
+		const Quatd a = Normalize(ToDouble(actual));
+		const double sign = Dot(a, expected) < 0.0 ? -1.0 : 1.0;
+		const Quatd difference = Blend(a, expected, 1.0, -sign);
+		return 4.0 * std::asin((std::min)(std::sqrt(Dot(difference, difference)) * 0.5, 1.0));
+	}
+
+	/// <summary>
+	/// NH[^jI̊e ULP (̑傫 1 ł ULP) ŁA]̍pxŔׂ܂
+	/// </summary>
+	class QuaternionStats
+	{
+	public:
+		QuaternionStats(const char* pName, double maxUlp, double maxRadians) : m_Ulp(pName, maxUlp), m_pName(pName), m_MaxRadiansLimit(maxRadians) {}
+
+		~QuaternionStats()
+		{
+			m_Ulp.Report();
+			std::printf("  %-6s %-44s max %8.2g rad (limit %g)\n", m_MaxRadians <= m_MaxRadiansLimit ? "ok" : "FAILED", m_pName, m_MaxRadians, m_MaxRadiansLimit);
+			TEST_CHECK(m_MaxRadians <= m_MaxRadiansLimit);
+		}
+
+		void Add(const Quaternion& actual, const Quatd& expected)
+		{
+			m_Ulp.Add(actual.x, expected.x, 1.0);
+			m_Ulp.Add(actual.y, expected.y, 1.0);
+			m_Ulp.Add(actual.z, expected.z, 1.0);
+			m_Ulp.Add(actual.w, expected.w, 1.0);
+			const double error = GetRotationError(actual, expected);
+			m_MaxRadians = std::isnan(error) ? error : (std::max)(m_MaxRadians, error);
+		}
+
+	private:
+		ErrorStats m_Ulp;
+		const char* m_pName;
+		double m_MaxRadiansLimit;
+		double m_MaxRadians = 0.0;
+	};
+
+	Quaternion RandomRotation(Random& random)
+	{
+		Quaternion q(random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f));
+		return q.normalize();
+	}
+
+	//! @brief q  angle (NH[^jIԂ̊pxAWA) ꂽPʃNH[^jI
+	Quaternion RotateBy(const Quaternion& q, double angle, Random& random)
+	{
+		// q ɒA~ɉē
+		const Quatd a = ToDouble(q);
+		Quatd direction = { random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f) };
+		direction = Normalize(Blend(direction, a, 1.0, -Dot(direction, a)));
+		const Quatd r = Normalize(Blend(a, direction, std::cos(angle), std::sin(angle)));
+		return Quaternion(static_cast<float>(r.x), static_cast<float>(r.y), static_cast<float>(r.z), static_cast<float>(r.w));
+	}
+
+	/// <summary>
+	/// Ԃ̓͂̑g (_EقړE΂̔E90 xꂽ) ܂
+	/// </summary>
+	void MakePairs(Random& random, std::vector<Quaternion>& from, std::vector<Quaternion>& to)
+	{
+		// Accurate  Slerp  cos() > 1 - 1e-5 ( <  4.5e-3) Ő`Ԃɐ؂ւ
+		constexpr double Angles[] = { 1.0e-7, 1.0e-5, 1.0e-4, 1.0e-3, 4.0e-3, 4.5e-3, 5.0e-3, 1.0e-2, 0.1, 1.0, 1.5707963 };
+		from.resize(MaxCount);
+		to.resize(MaxCount);
+		for (size_t i = 0; i < MaxCount; ++i)
+		{
+			from[i] = RandomRotation(random);
+			switch (i % 4)
+			{
+			case 0:
+				to[i] = RandomRotation(random);
+				break;
+			case 1:
+				to[i] = RotateBy(from[i], Angles[(i / 4) % (sizeof(Angles) / sizeof(Angles[0]))], random);
+				break;
+			case 2:
+			{
+				// ΂̔ (ŒZoĤ߂ɕ𔽓]Kv)
+				const Quaternion q = RotateBy(from[i], Angles[(i / 4) % (sizeof(Angles) / sizeof(Angles[0]))], random);
+				to[i] = Quaternion(-q.x, -q.y, -q.z, -q.w);
+				break;
+			}
+			default:
+				to[i] = RotateBy(from[i], random.Range(0.0f, 1.5707963f), random);
+				break;
+			}
+		}
+	}
+
+	void TestNormalize(Random& random)
+	{
+		std::printf("Normalize\n");
+		std::vector<Quaternion> source(MaxCount);
+		for (size_t i = 0; i < MaxCount; ++i)
+		{
+			const float scale = random.Range(0.01f, 100.0f);
+			source[i] = Quaternion(random.Range(-1.0f, 1.0f) * scale, random.Range(-1.0f, 1.0f) * scale, random.Range(-1.0f, 1.0f) * scale, random.Range(-1.0f, 1.0f) * scale);
+		}
+		source[3] = Quaternion(0.0f);
+
+		for (const Precision precision : { Precision::Accurate, Precision::Fast })
+		{
+			const bool isAccurate = precision == Precision::Accurate;
+			// Fast  rsqrt ̋ߎ + Newton @1 (Ό덷 1e-6 x)
+			ErrorStats scalar(isAccurate ? "Accurate vs Quaternion::normalize" : "Fast vs Quaternion::normalize", isAccurate ? 2 : 4);
+			QuaternionStats reference(isAccurate ? "Accurate vs double" : "Fast vs double", isAccurate ? 2 : 4, 1.0e-6);
+			ErrorStats inPlace(isAccurate ? "Accurate in-place == out-of-place" : "Fast in-place == out-of-place", 0);
+			bool isZeroIdentity = true;
+			for (const size_t count : Counts)
+			{
+				std::vector<Quaternion> out(count);
+				QuaternionBatch::Normalize(source.data(), out.data(), count, precision);
+				std::vector<Quaternion> same(source.begin(), source.begin() + count);
+				QuaternionBatch::Normalize(same.data(), same.data(), count, precision);
+				for (size_t i = 0; i < count; ++i)
+				{
+					inPlace.AddExact(same[i].x, out[i].x);
+					inPlace.AddExact(same[i].w, out[i].w);
+					if (i == 3)
+					{
+						isZeroIdentity = isZeroIdentity && out[i].x == 0.0f && out[i].y == 0.0f && out[i].z == 0.0f && out[i].w == 1.0f;
+						continue;
+					}
+					Quaternion expected = source[i];
+					expected.normalize();
+					scalar.Add(out[i].x, expected.x, 1.0);
+					scalar.Add(out[i].y, expected.y, 1.0);
+					scalar.Add(out[i].z, expected.z, 1.0);
+					scalar.Add(out[i].w, expected.w, 1.0);
+					reference.Add(out[i], Normalize(ToDouble(source[i])));
+				}
+			}
+			scalar.Report();
+			inPlace.Report();
+			TEST_CHECK(isZeroIdentity);
+		}
+	}
+
+	void TestInterpolation(Random& random)
+	{
+		std::vector<Quaternion> from, to;
+		MakePairs(random, from, to);
+		// t = 0E1 Ƃ̋߂AԂ̒l
+		constexpr float Ts[] = { 0.0f, 1.0e-6f, 1.0e-3f, 0.25f, 0.5f, 0.7f, 0.999f, 1.0f - 1.0e-6f, 1.0f };
+
+		std::printf("Nlerp\n");
+		for (const Precision precision : { Precision::Accurate, Precision::Fast })
+		{
+			const bool isAccurate = precision == Precision::Accurate;
+			QuaternionStats nlerp(isAccurate ? "Nlerp Accurate vs double" : "Nlerp Fast vs double", isAccurate ? 2 : 4, 1.0e-6);
+			for (const float t : Ts)
+			{
+				for (const size_t count : Counts)
+				{
+					std::vector<Quaternion> out(count);
+					QuaternionBatch::Nlerp(from.data(), to.data(), t, out.data(), count, precision);
+					for (size_t i = 0; i < count; ++i)
+					{
+						nlerp.Add(out[i], NlerpReference(from[i], to[i], t));
+					}
+				}
+			}
+		}
+
+		std::printf("Slerp\n");
+		{
+			// Accurate  float  acosEsin g ( Ƃ sin(t)/sin() ̓WJ)
+			QuaternionStats accurate("Slerp Accurate vs double", 4, 1.0e-6);
+			// Fast (Eberly ̑ߎ) ͏d݂̑Ό덷 7e-7 x
+			QuaternionStats fast("Slerp Fast vs double", 12, 2.0e-6);
+			// [_̋߂ƁAقړ̑gWv (ߎ̌덷ڗ₷)
+			QuaternionStats fastEnds("Slerp Fast vs double (t near 0 or 1)", 4, 1.0e-6);
+			QuaternionStats fastParallel("Slerp Fast vs double (angle < 1e-2)", 4, 1.0e-6);
+			ErrorStats fastEndpoints("Slerp Fast t = 0 / t = 1 vs endpoints", 2);
+			for (const float t : Ts)
+			{
+				for (const size_t count : Counts)
+				{
+					std::vector<Quaternion> outAccurate(count), outFast(count);
+					QuaternionBatch::Slerp(from.data(), to.data(), t, outAccurate.data(), count, Precision::Accurate);
+					QuaternionBatch::Slerp(from.data(), to.data(), t, outFast.data(), count, Precision::Fast);
+					for (size_t i = 0; i < count; ++i)
+					{
+						const Quatd expected = SlerpReference(from[i], to[i], t);
+						accurate.Add(outAccurate[i], expected);
+						fast.Add(outFast[i], expected);
+						if (t < 1.0e-2f || t > 0.99f)
+						{
+							fastEnds.Add(outFast[i], expected);
+						}
+						if (GetRotationError(from[i], Normalize(ToDouble(to[i]))) < 2.0e-2)
+						{
+							fastParallel.Add(outFast[i], expected);
+						}
+						if (t == 0.0f || t == 1.0f)
+						{
+							const Quaternion& endpoint = t == 0.0f ? from[i] : to[i];
+							const float sign = t == 1.0f ? static_cast<float>(GetShortestSign(from[i], to[i])) : 1.0f;
+							fastEndpoints.Add(outFast[i].x, endpoint.x * sign, 1.0);
+							fastEndpoints.Add(outFast[i].y, endpoint.y * sign, 1.0);
+							fastEndpoints.Add(outFast[i].z, endpoint.z * sign, 1.0);
+							fastEndpoints.Add(outFast[i].w, endpoint.w * sign, 1.0);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	void TestToMatrix(Random& random)
+	{
+		std::printf("ToMatrix / ToMatrix3x4\n");
+		std::vector<Quaternion> unit(MaxCount), scaled(MaxCount);
+		for (size_t i = 0; i < MaxCount; ++i)
+		{
+			unit[i] = RandomRotation(random);
+			const float scale = random.Range(0.1f, 3.0f);
+			scaled[i] = Quaternion(unit[i].x * scale, unit[i].y * scale, unit[i].z * scale, unit[i].w * scale);
+		}
+		scaled[2] = Quaternion(0.0f);
+
+		ErrorStats fast("ToMatrix Fast vs QuaternionToMatrix", 0);
+		ErrorStats fast3x4("ToMatrix3x4 Fast vs Matrix3x4(QuaternionToMatrix)", 0);
+		// Accurate ͒2Ŋ̂ŁAfloat ŐK (킸 1 łȂ) ͂ł QuaternionToMatrix Ɛ ULP قȂ
+		ErrorStats accurate("ToMatrix Accurate vs QuaternionToMatrix", 8);
+		ErrorStats accurateScaled("ToMatrix Accurate (|q| != 1) vs double", 4);
+		ErrorStats accurate3x4("ToMatrix3x4 Accurate == ToMatrix Accurate", 0);
+		bool isZeroIdentity = true;
+		for (const size_t count : Counts)
+		{
+			std::vector<Matrix4x4> matrices(count);
+			std::vector<Matrix3x4> matrices3x4(count);
+			QuaternionBatch::ToMatrix(unit.data(), matrices.data(), count, Precision::Fast);
+			QuaternionBatch::ToMatrix3x4(unit.data(), matrices3x4.data(), count, Precision::Fast);
+			for (size_t i = 0; i < count; ++i)
+			{
+				const Matrix4x4 expected = Matrix4x4::QuaternionToMatrix(unit[i]);
+				const Matrix3x4 expected3x4(expected);
+				for (int row = 0; row < 4; ++row)
+				{
+					for (int col = 0; col < 4; ++col)
+					{
+						fast.AddExact(matrices[i].m_mat[row][col], expected.m_mat[row][col]);
+						if (row < 3)
+						{
+							fast3x4.AddExact(matrices3x4[i].m_mat[row][col], expected3x4.m_mat[row][col]);
+						}
+					}
+				}
+			}
+
+			QuaternionBatch::ToMatrix(unit.data(), matrices.data(), count, Precision::Accurate);
+			for (size_t i = 0; i < count; ++i)
+			{
+				const Matrix4x4 expected = Matrix4x4::QuaternionToMatrix(unit[i]);
+				for (int row = 0; row < 4; ++row)
+				{
+					for (int col = 0; col < 4; ++col)
+					{
+						accurate.Add(matrices[i].m_mat[row][col], expected.m_mat[row][col], 1.0);
+					}
+				}
+			}
+
+			QuaternionBatch::ToMatrix(scaled.data(), matrices.data(), count, Precision::Accurate);
+			QuaternionBatch::ToMatrix3x4(scaled.data(), matrices3x4.data(), count, Precision::Accurate);
+			for (size_t i = 0; i < count; ++i)
+			{
+				const Matrix3x4 converted(matrices[i]);
+				for (int row = 0; row < 3; ++row)
+				{
+					for (int col = 0; col < 4; ++col)
+					{
+						accurate3x4.AddExact(matrices3x4[i].m_mat[row][col], converted.m_mat[row][col]);
+					}
+				}
+				if (i == 2)
+				{
+					isZeroIdentity = isZeroIdentity && std::memcmp(matrices[i].m_mat, Matrix4x4::Identity().m_mat, sizeof(matrices[i].m_mat)) == 0;
+					continue;
+				}
+				// {xŐKĂ]s
+				const Quatd q = Normalize(ToDouble(scaled[i]));
+				const double expected[3][3] = {
+					{ 1 - 2 * (q.y * q.y + q.z * q.z), 2 * (q.x * q.y + q.w * q.z), 2 * (q.x * q.z - q.w * q.y) },
+					{ 2 * (q.x * q.y - q.w * q.z), 1 - 2 * (q.x * q.x + q.z * q.z), 2 * (q.y * q.z + q.w * q.x) },
+					{ 2 * (q.x * q.z + q.w * q.y), 2 * (q.y * q.z - q.w * q.x), 1 - 2 * (q.x * q.x + q.y * q.y) } };
+				for (int row = 0; row < 3; ++row)
+				{
+					for (int col = 0; col < 3; ++col)
+					{
+						accurateScaled.Add(matrices[i].m_mat[row][col], expected[row][col], 1.0);
+					}
+				}
+			}
+		}
+		fast.Report();
+		fast3x4.Report();
+		accurate.Report();
+		accurateScaled.Report();
+		accurate3x4.Report();
+		TEST_CHECK(isZeroIdentity);
+	}
+}
+
+int main()
+{
+#if defined(MATH_SIMD_SSE) || defined(MATH_SIMD_NEON)
+	std::printf("MathQuaternionBatchTest (SIMD)\n");
+#else
+	std::printf("MathQuaternionBatchTest (scalar)\n");
+#endif
+
+	Random random(5);
+	TestNormalize(random);
+	TestInterpolation(random);
+	TestToMatrix(random);
+	return TestUtility::Finish("MathQuaternionBatchTest");
+}
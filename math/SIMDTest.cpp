@@ -0,0 +1,102 @@
+// Matrix4x4  SIMD ̌oH (MathSIMD.h)  SIMD ÕXJ[R[h (ScalarReference.h) 
+// rbgPʂœʂԂm߂eXg
+// SIMD ̌oH̓XJ[R[hƓőAFMA gȂ̂ŁA덷̋e͈͂ 0 ULP ł
+// g: MathSIMDTest (s 0 ȊOԂ܂)
+
+#include "Math/Matrix4x4.h"
+#include "Math/Quaternion.h"
+#include "Math/Vector3D.h"
+#include "ScalarReference.h"
+#include "TestUtility.h"
+
+#include <cmath>
+#include <cstdio>
+
+using TestUtility::ErrorStats;
+using TestUtility::Random;
+
+namespace
+{
+	constexpr int SampleCount = 100000;
+
+	//! @brief ̑傫 10^-3  10^3 ܂ŎU炵̍s (̈Ⴄl̘aŊۂ߂̍o₷)
+	Matrix4x4 RandomMatrix(Random& random)
+	{
+		Matrix4x4 m;
+		for (auto& row : m.m_mat)
+		{
+			for (auto& value : row)
+			{
+				value = random.Range(-1.0f, 1.0f) * std::pow(10.0f, random.Range(-3.0f, 3.0f));
+			}
+		}
+		return m;
+	}
+
+	Vector3D RandomVector3(Random& random, float range)
+	{
+		return Vector3D(random.Range(-range, range), random.Range(-range, range), random.Range(-range, range));
+	}
+
+	void AddMatrix(ErrorStats& stats, const Matrix4x4& actual, const Matrix4x4& expected)
+	{
+		for (int row = 0; row < 4; ++row)
+		{
+			for (int col = 0; col < 4; ++col)
+			{
+				stats.AddExact(actual.m_mat[row][col], expected.m_mat[row][col]);
+			}
+		}
+	}
+}
+
+int main()
+{
+#if defined(MATH_SIMD_AVX)
+	std::printf("MathSIMDTest (AVX)\n");
+#elif defined(MATH_SIMD_SSE)
+	std::printf("MathSIMDTest (SSE)\n");
+#elif defined(MATH_SIMD_NEON)
+	std::printf("MathSIMDTest (NEON)\n");
+#else
+	std::printf("MathSIMDTest (scalar)\n");
+#endif
+
+	Random random(11);
+	ErrorStats multiply("Matrix4x4 operator* vs scalar", 0);
+	ErrorStats compound("Matrix4x4 operator*= vs scalar", 0);
+	ErrorStats apply("Matrix4x4::Apply vs scalar", 0);
+	ErrorStats transpose("Matrix4x4::transpose vs scalar", 0);
+	ErrorStats compose("Matrix4x4::Compose vs scalar S * R * T", 0);
+	for (int i = 0; i < SampleCount; ++i)
+	{
+		const Matrix4x4 a = RandomMatrix(random);
+		const Matrix4x4 b = RandomMatrix(random);
+		AddMatrix(multiply, a * b, ScalarReference::Multiply(a, b));
+
+		Matrix4x4 product = a;
+		product *= b;
+		AddMatrix(compound, product, ScalarReference::Multiply(a, b));
+
+		AddMatrix(transpose, Matrix4x4::transpose(a), ScalarReference::Transpose(a));
+
+		const Vector3D v = RandomVector3(random, 1000.0f);
+		const Vector3D p = Matrix4x4::Apply(a, v);
+		const Vector3D expected = ScalarReference::Apply(a, v);
+		apply.AddExact(p.x, expected.x);
+		apply.AddExact(p.y, expected.y);
+		apply.AddExact(p.z, expected.z);
+
+		Quaternion q(random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f));
+		q.normalize();
+		const Vector3D scale(random.Range(0.01f, 100.0f), random.Range(0.01f, 100.0f), random.Range(0.01f, 100.0f));
+		const Vector3D translation = RandomVector3(random, 1000.0f);
+		AddMatrix(compose, Matrix4x4::Compose(scale, q, translation), ScalarReference::Compose(scale, q, translation));
+	}
+	multiply.Report();
+	compound.Report();
+	apply.Report();
+	transpose.Report();
+	compose.Report();
+	return TestUtility::Finish("MathSIMDTest");
+}
@@ -0,0 +1,114 @@
+#pragma once
+// SIMD E`O Matrix4x4 ̎ (baseline ̃XJ[R[ĥ܂܎c)
+// ȑOƓʁExԂm߂eXgƁAׂx`}[NŎg܂
+
+#include "Math/Matrix4x4.h"
+#include "Math/Quaternion.h"
+#include "Math/Vector3D.h"
+#include "Math/Vector4D.h"
+
+#include <cmath>
+#include <cstdint>
+
+namespace ScalarReference
+{
+	//! @brief ȑO Matrix4x4::operator* (e4̘aŋ߂)
+	inline Matrix4x4 Multiply(const Matrix4x4& a, const Matrix4x4& b) noexcept
+	{
+		Matrix4x4 out;
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				out.m_mat[i][j] =
+					a.m_mat[i][0] * b.m_mat[0][j] +
+					a.m_mat[i][1] * b.m_mat[1][j] +
+					a.m_mat[i][2] * b.m_mat[2][j] +
+					a.m_mat[i][3] * b.m_mat[3][j];
+			}
+		}
+		return out;
+	}
+
+	//! @brief ȑO Matrix4x4::Apply (w ł͊Ȃ)
+	inline Vector3D Apply(const Matrix4x4& matrix, const Vector3D& vec) noexcept
+	{
+		const float x = vec.x * matrix.m_mat[0][0] + vec.y * matrix.m_mat[1][0] + vec.z * matrix.m_mat[2][0] + matrix.m_mat[3][0];
+		const float y = vec.x * matrix.m_mat[0][1] + vec.y * matrix.m_mat[1][1] + vec.z * matrix.m_mat[2][1] + matrix.m_mat[3][1];
+		const float z = vec.x * matrix.m_mat[0][2] + vec.y * matrix.m_mat[1][2] + vec.z * matrix.m_mat[2][2] + matrix.m_mat[3][2];
+		return Vector3D(x, y, z);
+	}
+
+	//! @brief Yւ邾̓]u
+	inline Matrix4x4 Transpose(const Matrix4x4& matrix) noexcept
+	{
+		Matrix4x4 out;
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				out.m_mat[i][j] = matrix.m_mat[j][i];
+			}
+		}
+		return out;
+	}
+
+	//! @brief ȑO Matrix4x4::getDeterminant (4̊Oςŗ]q߂)
+	inline float GetDeterminant(const Matrix4x4& matrix)
+	{
+		Vector4D mirror, v1, v2, v3;
+		float det;
+
+		v1 = Vector4D(matrix.m_mat[0][0], matrix.m_mat[1][0], matrix.m_mat[2][0], matrix.m_mat[3][0]);
+		v2 = Vector4D(matrix.m_mat[0][1], matrix.m_mat[1][1], matrix.m_mat[2][1], matrix.m_mat[3][1]);
+		v3 = Vector4D(matrix.m_mat[0][2], matrix.m_mat[1][2], matrix.m_mat[2][2], matrix.m_mat[3][2]);
+
+		mirror = v1.cross(v2, v3);
+		det = -(matrix.m_mat[0][3] * mirror.x + matrix.m_mat[1][3] * mirror.y + matrix.m_mat[2][3] * mirror.z +
+			matrix.m_mat[3][3] * mirror.w);
+
+		return det;
+	}
+
+	//! @brief ȑO Matrix4x4::inverse (sƂ3s̊OςApow ŕtBٍs͒Pʍs)
+	inline Matrix4x4 Inverse(const Matrix4x4& matrix)
+	{
+		uint32_t a, i, j;
+		Matrix4x4 out;
+		Vector4D v, vec[3];
+		float det = 1.0f;
+
+		det = GetDeterminant(matrix);
+		if (det == 0) return out;
+		for (i = 0; i < 4; i++)
+		{
+			for (j = 0; j < 4; j++)
+			{
+				if (j != i)
+				{
+					a = j;
+					if (j > i) a = a - 1;
+					vec[a].x = (matrix.m_mat[j][0]);
+					vec[a].y = (matrix.m_mat[j][1]);
+					vec[a].z = (matrix.m_mat[j][2]);
+					vec[a].w = (matrix.m_mat[j][3]);
+				}
+			}
+			v = vec[0].cross(vec[1], vec[2]);
+
+			out.m_mat[0][i] = (float)pow(-1.0f, i) * v.x / det;
+			out.m_mat[1][i] = (float)pow(-1.0f, i) * v.y / det;
+			out.m_mat[2][i] = (float)pow(-1.0f, i) * v.z / det;
+			out.m_mat[3][i] = (float)pow(-1.0f, i) * v.w / det;
+		}
+
+		return out;
+	}
+
+	//! @brief ȑO Transform::Update ̍s̑gݗ (S * R * T 2̐ςŋ߂)
+	inline Matrix4x4 Compose(const Vector3D& scale, const Quaternion& rotation, const Vector3D& translation) noexcept
+	{
+		return Multiply(Multiply(Matrix4x4::ScalingToMatrix(scale), Matrix4x4::QuaternionToMatrix(rotation)),
+			Matrix4x4::TransitionToMatrix(translation));
+	}
+}
@@ -0,0 +1,138 @@
+#pragma once
+// math/ ȉ̃eXgŋʂ̔E덷̏WvE
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+
+namespace TestUtility
+{
+	//! @brief s̐ (main ̖߂lɎg܂)
+	inline int& GetFailureCount()
+	{
+		static int count = 0;
+		return count;
+	}
+
+	/// <summary>
+	/// value ̑傫ł float 1 ULP (ׂ̕\\ȒlƂ̊Ԋu)
+	/// </summary>
+	inline double GetUlpSize(double value)
+	{
+		const float magnitude = static_cast<float>(std::abs(value));
+		if (magnitude == 0.0f)
+		{
+			return std::numeric_limits<float>::denorm_min();
+		}
+		return static_cast<double>(std::nextafter(magnitude, std::numeric_limits<float>::infinity())) - magnitude;
+	}
+
+	/// <summary>
+	/// 𔻒肵Asꏊ\܂
+	/// </summary>
+	inline bool Check(bool condition, const char* pExpression, const char* pFile, int line)
+	{
+		if (!condition)
+		{
+			std::printf("  FAILED  %s:%d: %s\n", pFile, line, pExpression);
+			++GetFailureCount();
+		}
+		return condition;
+	}
+
+	/// <summary>
+	/// ނ̌vŽ덷W߁Aő̌덷Ƌe͈͂\܂
+	/// 덷͌vZ̓rɌl̑傫ł ULP ő܂
+	/// (a⍷ŌvZ͌ʂ 0 ɋ߂ĂȂ傫ɔႵ덷o邽)
+	/// </summary>
+	class ErrorStats
+	{
+	public:
+		ErrorStats(const char* pName, double maxUlp) : m_pName(pName), m_MaxUlpLimit(maxUlp) {}
+
+		~ErrorStats()
+		{
+			Report();
+		}
+
+		/// <summary>
+		/// actual  expected ({xȂǂŋ߂Qƒl) Ɣׂ܂
+		/// </summary>
+		/// <param name="magnitude"> vZɌl̑傫 (aȂe̐Βl̘a)Bexpected ̐Βl菬 expected g܂ </param>
+		void Add(float actual, double expected, double magnitude = 0.0)
+		{
+			const double error = std::abs(static_cast<double>(actual) - expected)
+				/ GetUlpSize((std::max)(std::abs(expected), magnitude));
+			if (!(error <= m_MaxUlpLimit))
+			{
+				if (m_FailedCount == 0)
+				{
+					std::printf("  FAILED  %s: %.9g (expected %.9g, %.1f ulp)\n", m_pName, actual, expected, error);
+				}
+				++m_FailedCount;
+			}
+			m_MaxUlp = std::isnan(error) ? error : (std::max)(m_MaxUlp, error);
+			++m_Count;
+		}
+
+		//! @brief lɂȂ͂2̌ʂׂ܂
+		void AddExact(float actual, float expected)
+		{
+			Add(actual, expected, 0.0);
+		}
+
+		void Report()
+		{
+			if (m_IsReported)
+			{
+				return;
+			}
+			m_IsReported = true;
+			std::printf("  %-6s %-44s %7llu samples, max %8.2f ulp (limit %g)\n",
+				m_FailedCount == 0 ? "ok" : "FAILED", m_pName, static_cast<unsigned long long>(m_Count), m_MaxUlp, m_MaxUlpLimit);
+			if (m_FailedCount > 0)
+			{
+				++GetFailureCount();
+			}
+		}
+
+	private:
+		const char* m_pName;
+		double m_MaxUlpLimit;
+		uint64_t m_Count = 0;
+		uint64_t m_FailedCount = 0;
+		double m_MaxUlp = 0.0;
+		bool m_IsReported = false;
+	};
+
+	/// <summary>
+	/// Čł悤ɎŒ肵
+	/// </summary>
+	class Random
+	{
+	public:
+		explicit Random(uint32_t seed = 12345) : m_Engine(seed) {}
+
+		float Range(float lo, float hi)
+		{
+			return std::uniform_real_distribution<float>(lo, hi)(m_Engine);
+		}
+
+	private:
+		std::mt19937 m_Engine;
+	};
+
+	//! @brief eXǧʂ܂Ƃ߂ĕ\Amain ̖߂lԂ܂
+	inline int Finish(const char* pName)
+	{
+		const int failureCount = GetFailureCount();
+		std::printf("%s: %s (%d failure%s)\n", pName, failureCount == 0 ? "passed" : "FAILED", failureCount, failureCount == 1 ? "" : "s");
+		return failureCount == 0 ? 0 : 1;
+	}
+}
+
+#define TEST_CHECK(condition) ::TestUtility::Check((condition), #condition, __FILE__, __LINE__)
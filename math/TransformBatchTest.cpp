@@ -0,0 +1,231 @@
+// TransformBatch ̈ꊇϊA1vf̕ϊ (Matrix4x4::Apply Ɠő) ƃrbgPʂŔׂeXg
+// AoSESoAA_EEˉeACv[XϊA4 ̔{łȂ[A񏈗ɐ؂ւvf (ParallelThreshold ȏ) m߂܂
+// 񏈗̋Ԃ̋ڂ 4 ̔{Ƃ͌Ȃ̂ŁAParallel::For ƓŋԂ𒼐ڎw肵ϊׂ܂
+// (n[hEFAXbh1̊ł Parallel::For ͌ĂяõXbhőŜ邽)
+// g: MathTransformBatchTest (s 0 ȊOԂ܂)
+
+#include "Math/Matrix4x4.h"
+#include "Math/TransformBatch.h"
+#include "Math/Vector3D.h"
+#include "TestUtility.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using TestUtility::Random;
+
+namespace
+{
+	using TransformBatch::Mode;
+
+	//! vf ([E臒l̑OE񏈗̋Ԃ 4 Ŋ؂Ȃ)
+	constexpr size_t Counts[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 13, 64, 1001, TransformBatch::ParallelThreshold - 1,
+		TransformBatch::ParallelThreshold, TransformBatch::ParallelThreshold + 3, 200003 };
+
+	Vector3D RandomVector3(Random& random, float range)
+	{
+		return Vector3D(random.Range(-range, range), random.Range(-range, range), random.Range(-range, range));
+	}
+
+	Matrix4x4 RandomAffine(Random& random)
+	{
+		Matrix4x4 m;
+		for (int row = 0; row < 3; ++row)
+		{
+			for (int col = 0; col < 3; ++col)
+			{
+				m.m_mat[row][col] = random.Range(-2.0f, 2.0f);
+			}
+		}
+		const Vector3D translation = RandomVector3(random, 100.0f);
+		m.m_mat[3][0] = translation.x;
+		m.m_mat[3][1] = translation.y;
+		m.m_mat[3][2] = translation.z;
+		return m;
+	}
+
+	/// <summary>
+	/// 1vf̕ϊ (_ Matrix4x4::Apply ̂́AEˉe͓ő)
+	/// </summary>
+	template<Mode mode>
+	Vector3D TransformOne(const Matrix4x4& matrix, const Vector3D& v)
+	{
+		const auto& m = matrix.m_mat;
+		if constexpr (mode == Mode::Point)
+		{
+			return Matrix4x4::Apply(matrix, v);
+		}
+		else if constexpr (mode == Mode::Direction)
+		{
+			return Vector3D(
+				v.x * m[0][0] + v.y * m[1][0] + v.z * m[2][0],
+				v.x * m[0][1] + v.y * m[1][1] + v.z * m[2][1],
+				v.x * m[0][2] + v.y * m[1][2] + v.z * m[2][2]);
+		}
+		else
+		{
+			const Vector3D p = Matrix4x4::Apply(matrix, v);
+			const float w = v.x * m[0][3] + v.y * m[1][3] + v.z * m[2][3] + m[3][3];
+			return Vector3D(p.x / w, p.y / w, p.z / w);
+		}
+	}
+
+	bool IsSame(const Vector3D& a, const Vector3D& b)
+	{
+		return std::memcmp(&a, &b, sizeof(Vector3D)) == 0;
+	}
+
+	/// <summary>
+	/// ϊʂ1vf̕ϊƔׁAvȂvfԂ܂
+	/// </summary>
+	template<Mode mode>
+	size_t CountMismatches(const Matrix4x4& matrix, const std::vector<Vector3D>& src, const Vector3D* pResult, size_t count)
+	{
+		size_t mismatchCount = 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			mismatchCount += IsSame(pResult[i], TransformOne<mode>(matrix, src[i])) ? 0 : 1;
+		}
+		return mismatchCount;
+	}
+
+	void CallAoS(Mode mode, const Matrix4x4& matrix, const Vector3D* src, Vector3D* dst, size_t count)
+	{
+		switch (mode)
+		{
+		case Mode::Point: TransformBatch::TransformPoints(matrix, src, dst, count); break;
+		case Mode::Direction: TransformBatch::TransformDirections(matrix, src, dst, count); break;
+		case Mode::Project: TransformBatch::TransformPointsProject(matrix, src, dst, count); break;
+		}
+	}
+
+	void CallSoA(Mode mode, const Matrix4x4& matrix, const float* inX, const float* inY, const float* inZ,
+		float* outX, float* outY, float* outZ, size_t count)
+	{
+		switch (mode)
+		{
+		case Mode::Point: TransformBatch::TransformPoints(matrix, inX, inY, inZ, outX, outY, outZ, count); break;
+		case Mode::Direction: TransformBatch::TransformDirections(matrix, inX, inY, inZ, outX, outY, outZ, count); break;
+		case Mode::Project: TransformBatch::TransformPointsProject(matrix, inX, inY, inZ, outX, outY, outZ, count); break;
+		}
+	}
+
+	/// <summary>
+	/// 1̕ϊ̎ނɂāASĂ̗vf AoSESoAECv[XEԎw̕ϊׂ܂
+	/// </summary>
+	template<Mode mode>
+	void TestMode(const char* pName, const Matrix4x4& matrix, const std::vector<Vector3D>& source)
+	{
+		const float nan = std::numeric_limits<float>::quiet_NaN();
+		size_t aosMismatches = 0;
+		size_t inPlaceMismatches = 0;
+		size_t soaMismatches = 0;
+		size_t soaInPlaceMismatches = 0;
+		size_t rangeMismatches = 0;
+		size_t overrunCount = 0;
+		for (const size_t count : Counts)
+		{
+			// o̖͂ɔԕuA߂ȂƂm߂
+			const std::vector<Vector3D> src(source.begin() + 1, source.begin() + 1 + count);
+			std::vector<Vector3D> dst(count + 1, Vector3D(nan));
+			CallAoS(mode, matrix, src.data(), dst.data(), count);
+			aosMismatches += CountMismatches<mode>(matrix, src, dst.data(), count);
+			overrunCount += std::isnan(dst[count].x) ? 0 : 1;
+
+			std::vector<Vector3D> inPlace = src;
+			CallAoS(mode, matrix, inPlace.data(), inPlace.data(), count);
+			inPlaceMismatches += CountMismatches<mode>(matrix, src, inPlace.data(), count);
+
+			// SoA ̓͂͐擪 1 vf炵A16 oCgEɑȂzʂ
+			std::vector<float> x(count + 1), y(count + 1), z(count + 1);
+			for (size_t i = 0; i < count; ++i)
+			{
+				x[i + 1] = src[i].x;
+				y[i + 1] = src[i].y;
+				z[i + 1] = src[i].z;
+			}
+			std::vector<float> outX(count + 1, nan), outY(count + 1, nan), outZ(count + 1, nan);
+			CallSoA(mode, matrix, x.data() + 1, y.data() + 1, z.data() + 1, outX.data(), outY.data(), outZ.data(), count);
+			std::vector<Vector3D> soa(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				soa[i] = Vector3D(outX[i], outY[i], outZ[i]);
+			}
+			soaMismatches += CountMismatches<mode>(matrix, src, soa.data(), count);
+			overrunCount += std::isnan(outX[count]) && std::isnan(outY[count]) && std::isnan(outZ[count]) ? 0 : 1;
+
+			// Parallel::For Ɠ ceil(count / jobs) ɕԂʁXɕϊ (2`7 Wu)
+			if (count >= TransformBatch::ParallelThreshold)
+			{
+				for (size_t jobCount = 2; jobCount <= 7; ++jobCount)
+				{
+					std::vector<Vector3D> ranges(count, Vector3D(nan));
+					const size_t chunk = (count + jobCount - 1) / jobCount;
+					for (size_t begin = 0; begin < count; begin += chunk)
+					{
+						TransformBatch::Detail::TransformRangeAoS<mode>(matrix, src.data(), ranges.data(), begin, (std::min)(count, begin + chunk));
+					}
+					rangeMismatches += CountMismatches<mode>(matrix, src, ranges.data(), count);
+
+					std::vector<float> rangeX(count, nan), rangeY(count, nan), rangeZ(count, nan);
+					for (size_t begin = 0; begin < count; begin += chunk)
+					{
+						TransformBatch::Detail::TransformRangeSoA<mode>(matrix, x.data() + 1, y.data() + 1, z.data() + 1,
+							rangeX.data(), rangeY.data(), rangeZ.data(), begin, (std::min)(count, begin + chunk));
+					}
+					for (size_t i = 0; i < count; ++i)
+					{
+						ranges[i] = Vector3D(rangeX[i], rangeY[i], rangeZ[i]);
+					}
+					rangeMismatches += CountMismatches<mode>(matrix, src, ranges.data(), count);
+				}
+			}
+
+			CallSoA(mode, matrix, x.data() + 1, y.data() + 1, z.data() + 1, x.data() + 1, y.data() + 1, z.data() + 1, count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				soa[i] = Vector3D(x[i + 1], y[i + 1], z[i + 1]);
+			}
+			soaInPlaceMismatches += CountMismatches<mode>(matrix, src, soa.data(), count);
+		}
+
+		const size_t total = aosMismatches + inPlaceMismatches + soaMismatches + soaInPlaceMismatches + rangeMismatches + overrunCount;
+		std::printf("  %-6s %-22s AoS %zu, in-place %zu, SoA %zu, SoA in-place %zu, split ranges %zu mismatches, %zu overruns\n",
+			total == 0 ? "ok" : "FAILED", pName, aosMismatches, inPlaceMismatches, soaMismatches, soaInPlaceMismatches, rangeMismatches, overrunCount);
+		TEST_CHECK(total == 0);
+	}
+}
+
+int main()
+{
+#if defined(MATH_SIMD_SSE) || defined(MATH_SIMD_NEON)
+	std::printf("MathTransformBatchTest (SIMD)\n");
+#else
+	std::printf("MathTransformBatchTest (scalar)\n");
+#endif
+
+	Random random(3);
+	const size_t maxCount = Counts[sizeof(Counts) / sizeof(Counts[0]) - 1];
+	std::vector<Vector3D> source(maxCount + 1);
+	for (auto& v : source)
+	{
+		v = RandomVector3(random, 100.0f);
+	}
+	// 0 ƕ 0 ĕ܂ňv邩m߂
+	source[5] = Vector3D(0.0f, -0.0f, 0.0f);
+	source[6] = Vector3D(-0.0f, 0.0f, -0.0f);
+
+	const Matrix4x4 affine = RandomAffine(random);
+	const Matrix4x4 projection = Matrix4x4::setLookAtLH(Vector3D(10.0f, 20.0f, -300.0f), Vector3D(0.0f, 0.0f, 0.0f), Vector3D(0.0f, 1.0f, 0.0f))
+		* Matrix4x4::setPerspectiveFovLH(1.0f, 1.5f, 0.1f, 1000.0f);
+
+	std::printf("TransformBatch vs per-element transform (bit-exact)\n");
+	TestMode<Mode::Point>("TransformPoints", affine, source);
+	TestMode<Mode::Direction>("TransformDirections", affine, source);
+	TestMode<Mode::Project>("TransformPointsProject", projection, source);
+	return TestUtility::Finish("MathTransformBatchTest");
+}
@@ -1,11 +1,15 @@
 #include "Framework/Editor.h"
 #include "Framework/Scene.h"
+#include "Framework/Renderer.h"
 
 #include "Graphics/Model.h"
+#include "Graphics/Mesh.h"
+#include "Graphics/GeometryArena.h"
 
 #include <imgui.h>
 
-Editor::Editor(Scene* pScene)
+Editor::Editor(Scene* pScene, Renderer* pRenderer)
+	: m_pRenderer(pRenderer)
 {
 	ImGuiStyleSettings();
 
@@ -19,6 +23,7 @@ void Editor::Update(float deltaTime)
 {
 	this->deltaTime = deltaTime;
 	ModelSelectionWindow();
+	RenderStatsWindow();
 }
 
 void Editor::SetScene(Scene* newScene)
@@ -62,7 +67,7 @@ void Editor::LoadModelFilePaths(std::string path, std::string originalPath)
 		std::string filePath = file.path().string();
 		std::string fileType = filePath.substr(filePath.find_last_of(".") + 1, filePath.size());
 
-		if (fileType == "gltf")
+		if (fileType == "gltf" || fileType == "glb")
 		{
 			m_ComboDisplayNames.push_back(filePath.substr(filePath.find_last_of("\\") + 1));
 			m_ModelFilePaths.push_back(filePath.c_str());
@@ -107,5 +112,204 @@ void Editor::ModelSelectionWindow()
 		}
 	}
 
+	// ǂݍݎ (擾ɔrł悤ɕ\)
+	ImGui::Separator();
+	for (const auto& model : m_pScene->GetModels())
+	{
+		const char* pSourceName = "assimp";
+		switch (model->GetImportSource())
+		{
+		case Model::ImportSource::Gltf: pSourceName = "gltf"; break;
+		case Model::ImportSource::Cache: pSourceName = "cache"; break;
+		default: break;
+		}
+		ImGui::Text("%s", model->GetName().c_str());
+		ImGui::Text("  %.1f ms (%s %.1f ms)", model->GetLoadTimeMs(), pSourceName, model->GetImportTimeMs());
+		ImGui::Text("  Textures %u (%.1f ms)", model->GetTextureCount(), model->GetTextureLoadTimeMs());
+		const auto& before = model->GetCacheStatsBefore();
+		const auto& after = model->GetCacheStatsAfter();
+		ImGui::Text("  ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+			before.GetACMR(), after.GetACMR(), before.GetATVR(), after.GetATVR());
+		const auto& weld = model->GetWeldStats();
+		ImGui::Text("  Weld %u -> %u vertices (-%.1f%%), %u degenerate",
+			weld.VertexCountBefore, weld.VertexCountAfter, weld.GetReduction() * 100.0f, weld.DegenerateTriangles);
+
+		// _`ƒ_obt@̃TCY
+		uint64_t vertexBufferSize = 0;
+		for (const auto& mesh : model->GetMeshes())
+		{
+			vertexBufferSize += mesh->GetVertexBufferSize();
+		}
+		const bool isPacked = model->IsPackedVertex();
+		ImGui::Text("  Vertex %s (%zu B), %.2f MB", isPacked ? "packed" : "float",
+			isPacked ? sizeof(PackedVertex) : sizeof(Vertex), vertexBufferSize / (1024.0 * 1024.0));
+
+		// 16bit CfbNXɂbV̐ƁAŌTCY
+		uint32_t index16Count = 0;
+		for (const auto& mesh : model->GetMeshes())
+		{
+			if (mesh->Is16BitIndex())
+			{
+				++index16Count;
+			}
+		}
+		ImGui::Text("  Index 16bit %u / %zu meshes, %.2f MB (saved %.2f MB)",
+			index16Count, model->GetMeshes().size(),
+			model->GetIndexBufferSize() / (1024.0 * 1024.0), model->GetIndexBufferSaving() / (1024.0 * 1024.0));
+
+		// bVbgƁA@R[ŔwʃJOł̂̐
+		size_t meshletCount = 0;
+		size_t coneCount = 0;
+		for (const auto& mesh : model->GetMeshes())
+		{
+			for (const auto& meshlet : mesh->GetMeshlets())
+			{
+				++meshletCount;
+				if (meshlet.ConeCutoff < 1.0f)
+				{
+					++coneCount;
+				}
+			}
+		}
+		ImGui::Text("  Meshlets %zu (cone %zu)", meshletCount, coneCount);
+
+		// LOD ̎Op` ( LOD bV̍v) ƍő̌덷
+		for (uint32_t lod = 0; ; ++lod)
+		{
+			uint64_t triangleCount = 0;
+			float maxError = 0.0f;
+			bool hasLod = false;
+			for (const auto& mesh : model->GetMeshes())
+			{
+				const auto& lods = mesh->GetLods();
+				if (lod < lods.size())
+				{
+					triangleCount += lods[lod].IndexCount / 3;
+					maxError = (std::max)(maxError, lods[lod].Error);
+					hasLod = true;
+				}
+			}
+			if (!hasLod)
+			{
+				break;
+			}
+			ImGui::Text("  LOD%u: %llu tris (error %.4f)", lod, static_cast<unsigned long long>(triangleCount), maxError);
+		}
+	}
+
+	ImGui::End();
+}
+
+void Editor::RenderStatsWindow()
+{
+	ImGui::Begin("Render Stats");
+	bool isCullingEnabled = m_pRenderer->IsFrustumCullingEnabled();
+	if (ImGui::Checkbox("Frustum Culling", &isCullingEnabled))
+	{
+		m_pRenderer->SetFrustumCullingEnabled(isCullingEnabled);
+	}
+	bool isPackedVertexEnabled = m_pRenderer->IsPackedVertexEnabled();
+	if (ImGui::Checkbox("Packed Vertex (next load)", &isPackedVertexEnabled))
+	{
+		m_pRenderer->SetPackedVertexEnabled(isPackedVertexEnabled);
+	}
+	bool isLodEnabled = m_pRenderer->IsLodEnabled();
+	if (ImGui::Checkbox("LOD", &isLodEnabled))
+	{
+		m_pRenderer->SetLodEnabled(isLodEnabled);
+	}
+	float lodErrorThreshold = m_pRenderer->GetLodErrorThreshold();
+	if (ImGui::SliderFloat("LOD Error (px)", &lodErrorThreshold, 0.1f, 16.0f, "%.1f"))
+	{
+		m_pRenderer->SetLodErrorThreshold(lodErrorThreshold);
+	}
+	bool isMeshletCullingEnabled = m_pRenderer->IsMeshletCullingEnabled();
+	if (ImGui::Checkbox("Meshlet Culling", &isMeshletCullingEnabled))
+	{
+		m_pRenderer->SetMeshletCullingEnabled(isMeshletCullingEnabled);
+	}
+	bool isMeshletConeCullingEnabled = m_pRenderer->IsMeshletConeCullingEnabled();
+	if (ImGui::Checkbox("Meshlet Cone Culling", &isMeshletConeCullingEnabled))
+	{
+		m_pRenderer->SetMeshletConeCullingEnabled(isMeshletConeCullingEnabled);
+	}
+
+	const auto& stats = m_pRenderer->GetRenderStats();
+	ImGui::Text("Models     : %u / %u visible", stats.VisibleModels, stats.TotalModels);
+	ImGui::Text("Meshes     : %u / %u visible (%u culled)",
+		stats.VisibleMeshes, stats.TotalMeshes, stats.TotalMeshes - stats.VisibleMeshes);
+	ImGui::Text("Draw Calls : %u", stats.DrawCalls);
+	ImGui::Text("Triangles  : %llu", static_cast<unsigned long long>(stats.Triangles));
+	ImGui::Text("Meshlets   : %u / %u visible (%u backface)",
+		stats.VisibleMeshlets, stats.TotalMeshlets, stats.ConeCulledMeshlets);
+	ImGui::Text("Culling    : %.3f ms", stats.CullingTimeMs);
+
+	ImGui::Separator();
+	ImGui::Text("Shadow");
+	ImGui::Text("Casters    : %u / %u visible (%u culled)",
+		stats.ShadowVisibleCasters, stats.ShadowTotalCasters,
+		stats.ShadowTotalCasters - stats.ShadowVisibleCasters);
+	ImGui::Text("Triangles  : %llu", static_cast<unsigned long long>(stats.ShadowTriangles));
+	ImGui::Text("Culling    : %.3f ms", stats.ShadowCullingTimeMs);
+
+	// LWIgobt@̎gp
+	ImGui::Separator();
+	ImGui::Text("Geometry Arena");
+	auto pArena = m_pRenderer->GetGeometryArena();
+	const char* arenaNames[] = { "Vertex", "Index " };
+	for (auto type : { GeometryArena::BufferType::Vertex, GeometryArena::BufferType::Index })
+	{
+		const auto arenaStats = pArena->GetStats(type);
+		ImGui::Text("%s     : %.2f / %.2f MB, %zu blocks (frag %.2f)", arenaNames[static_cast<size_t>(type)],
+			arenaStats.UsedSize / (1024.0 * 1024.0), arenaStats.Capacity / (1024.0 * 1024.0),
+			arenaStats.AllocationCount, arenaStats.Fragmentation);
+	}
+	ImGui::Text("Relocations: %u", pArena->GetRelocationCount());
+	if (ImGui::Button("Defragment"))
+	{
+		pArena->Defragment();
+	}
+
+	// eNX`̃~bṽXg[~O
+	ImGui::Separator();
+	ImGui::Text("Texture Streaming");
+	bool isTextureStreamingEnabled = m_pRenderer->IsTextureStreamingEnabled();
+	if (ImGui::Checkbox("Streaming (next load)", &isTextureStreamingEnabled))
+	{
+		m_pRenderer->SetTextureStreamingEnabled(isTextureStreamingEnabled);
+	}
+	// ~bv̂Ȃ摜 (ϊĂȂ PNG Ȃ) ̃~bvktB^
+	const char* filterNames[] = { "Box", "Kaiser" };
+	const std::pair<TextureCook::TextureRole, const char*> mipFilterRoles[] = {
+		{ TextureCook::TextureRole::Color, "Mip Filter Color (next load)" },
+		{ TextureCook::TextureRole::Normal, "Mip Filter Normal (next load)" },
+		{ TextureCook::TextureRole::Mask, "Mip Filter Mask (next load)" },
+	};
+	for (const auto& [role, pLabel] : mipFilterRoles)
+	{
+		int filter = static_cast<int>(m_pRenderer->GetMipFilter(role));
+		if (ImGui::Combo(pLabel, &filter, filterNames, IM_ARRAYSIZE(filterNames)))
+		{
+			m_pRenderer->SetMipFilter(role, static_cast<MipGenerator::Filter>(filter));
+		}
+	}
+	auto& streamer = m_pRenderer->GetTextureStreamer();
+	auto streamSettings = streamer.GetSettings();
+	int budgetMB = static_cast<int>(streamSettings.BudgetBytes / (1024 * 1024));
+	if (ImGui::SliderInt("Budget (MB)", &budgetMB, 16, 4096))
+	{
+		streamSettings.BudgetBytes = static_cast<uint64_t>(budgetMB) * 1024 * 1024;
+		streamer.SetSettings(streamSettings);
+	}
+	if (ImGui::SliderFloat("Mip Bias", &streamSettings.MipBias, -2.0f, 4.0f, "%.1f"))
+	{
+		streamer.SetSettings(streamSettings);
+	}
+	const auto& streamStats = streamer.GetStats();
+	ImGui::Text("Resident   : %.2f / %.2f MB, %u textures (%u pending)",
+		streamStats.ResidentBytes / (1024.0 * 1024.0), streamSettings.BudgetBytes / (1024.0 * 1024.0),
+		streamStats.TextureCount, streamStats.PendingTextures);
+	ImGui::Text("Mips       : %u loaded (%.2f MB), %u evicted",
+		streamStats.LoadedMips, streamStats.UploadedBytes / (1024.0 * 1024.0), streamStats.EvictedMips);
 	ImGui::End();
 }
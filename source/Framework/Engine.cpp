@@ -31,7 +31,7 @@ Engine::Engine(uint32_t width, uint32_t height)
 	RegisterWindowClass();
 	m_pRenderer = std::make_unique<Renderer>(width, height);
 	m_pActiveScene = std::make_unique<Scene>(m_pRenderer.get(), width, height);
-	m_pEditor = std::make_unique<Editor>(m_pActiveScene.get());
+	m_pEditor = std::make_unique<Editor>(m_pActiveScene.get(), m_pRenderer.get());
 
 	m_pRenderer->SetScene(m_pActiveScene.get());
 	m_pEditor->SetScene(m_pActiveScene.get());
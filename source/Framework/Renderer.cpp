@@ -12,6 +12,7 @@
 #include "Graphics/DX12DescriptorHeap.h"
 
 #include "Graphics/Model.h"
+#include "Graphics/GeometryArena.h"
 #include "Graphics/ConstantBuffer.h"
 #include "Graphics/Transform.h"
 #include "Graphics/Texture.h"
@@ -43,6 +44,8 @@ Renderer::Renderer(uint32_t width, uint32_t height)
 	// R}h̐
 	m_pDirectCommand = std::make_unique<DX12Commands>(pDevice, D3D12_COMMAND_LIST_TYPE_DIRECT);
 	m_pCopyCommand = std::make_unique<DX12Commands>(pDevice, D3D12_COMMAND_LIST_TYPE_COPY);
+	// Sf̒_ECfbNXf[^uLobt@
+	m_pGeometryArena = std::make_unique<GeometryArena>(this);
 
 	// EBhE̍쐬
 	m_pWindow = std::make_unique<Window>(this, Utility::windowClassName, width, height);
@@ -107,6 +110,8 @@ void Renderer::Render()
 
 	pCommandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 	pCommandList->SetDescriptorHeaps(1, m_pCBV_SRV_UAV->GetHeap().GetAddressOf());
+	// eNX`g`OɁA~bv̓]L^
+	UpdateTextureStreaming(pCommandList);
 	// SceneRender
 	m_pShadowStage->RecordStage(pCommandList);
 
@@ -130,6 +135,12 @@ void Renderer::Render()
 
 	// GPȔҋ@
 	m_pDirectCommand->WaitGpu(INFINITE);
+
+	// ~bv̓]ÎŃAbv[hpobt@j
+	for (const auto& change : m_TextureStreamer.GetChanges())
+	{
+		m_StreamingTextures[change.Texture]->ReleaseUploadBuffer();
+	}
 }
 
 void Renderer::Update(float deltaTime)
@@ -154,10 +165,50 @@ void Renderer::SetScene(Scene* newScene)
 
 void Renderer::CreateTextureFromFile(const std::wstring& filePath)
 {
-	auto id = DX12Utility::StringHash(filePath.c_str());
-	if (m_pTextures.find(id) != m_pTextures.end()) return;
-	auto fullFilePath = Utility::GetCurrentDir() + L"/assets/textures/" + filePath;
-	m_pTextures[id] = std::make_unique<Texture>(this, fullFilePath);
+	CreateTexturesFromFiles({ filePath }, { TextureCook::GuessRoleFromName(filePath) });
+}
+
+uint32_t Renderer::CreateTexturesFromFiles(const std::vector<std::wstring>& filePaths, const std::vector<TextureCook::TextureRole>& roles)
+{
+	assert(roles.size() == filePaths.size());
+	std::vector<TextureID> ids;
+	std::vector<std::wstring> fullFilePaths;
+	std::vector<TextureCook::TextureRole> fileRoles;
+	std::vector<MipGenerator::Filter> fileMipFilters;
+	for (size_t i = 0; i < filePaths.size(); ++i)
+	{
+		auto id = DX12Utility::StringHash(filePaths[i].c_str());
+		if (m_pTextures.find(id) != m_pTextures.end()) continue;
+		if (std::find(ids.begin(), ids.end(), id) != ids.end()) continue;
+		ids.push_back(id);
+		fullFilePaths.push_back(Utility::GetCurrentDir() + L"/assets/textures/" + filePaths[i]);
+		fileRoles.push_back(roles[i]);
+		fileMipFilters.push_back(GetMipFilter(roles[i]));
+	}
+
+	const uint32_t streamingTailSize = m_IsTextureStreamingEnabled ? m_TextureStreamer.GetSettings().TailSize : 0;
+	auto textures = Texture::CreateFromFiles(this, fullFilePaths, fileRoles, fileMipFilters, streamingTailSize);
+	for (size_t i = 0; i < textures.size(); ++i)
+	{
+		if (textures[i]->IsStreamable())
+		{
+			const auto handle = m_TextureStreamer.Register(textures[i]->GetWidth(), textures[i]->GetHeight(), textures[i]->GetMipSizes());
+			assert(m_TextureStreamer.GetResidentMip(handle) == textures[i]->GetResidentMip());
+			textures[i]->SetStreamHandle(handle);
+			m_StreamingTextures.push_back(textures[i].get());
+		}
+		m_pTextures[ids[i]] = std::move(textures[i]);
+	}
+	return static_cast<uint32_t>(textures.size());
+}
+
+void Renderer::UpdateTextureStreaming(ID3D12GraphicsCommandList* pCommandList)
+{
+	// Õt[ GPU ̏ Render() ̍Ōő҂Ă̂ŁAÂ\[X͂ŔjĂ悢
+	for (const auto& change : m_TextureStreamer.Update())
+	{
+		m_StreamingTextures[change.Texture]->SetResidentMip(this, change.ResidentMip, pCommandList);
+	}
 }
 
 void Renderer::CreateConstantBuffer()
@@ -0,0 +1,1883 @@
+#include "Graphics/BlockCompressor.h"
+#include "Math/MathSIMD.h"
+#include "Utilities/Parallel.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+// pbg̒TɎg߃Zbg (MathSIMD Ɠ MATH_FORCE_SCALAR ŃXJ[)
+#if defined(MATH_SIMD_SSE) && defined(__AVX2__)
+#define BLOCK_SIMD_AVX2 1
+#include <immintrin.h>
+#elif defined(MATH_SIMD_SSE)
+#define BLOCK_SIMD_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace BlockCompressorInternal
+{
+	using BlockCompressor::Format;
+	using BlockCompressor::Quality;
+
+	//! 1ubN̉f
+	constexpr uint32_t BlockPixelCount = 16;
+	//! 1̃Wuł܂Ƃ߂ĈkubN̍s
+	constexpr uint32_t RowsPerJob = 4;
+
+	/// <summary>
+	/// 4x4 ̉f (`lɕׂ 0`255 ̒l)
+	/// </summary>
+	struct Block
+	{
+		alignas(32) float Channels[4][BlockPixelCount];
+	};
+
+	/// <summary>
+	/// [_ԂF̌ (ő 16 F)
+	/// </summary>
+	struct Palette
+	{
+		alignas(32) float Channels[4][BlockPixelCount];
+		uint32_t Count = 0;
+	};
+
+	/// <summary>
+	/// iƂ̒T̗
+	/// </summary>
+	struct QualityParams
+	{
+		uint32_t RefineIterations;  //!< ŏ@Œ[_lߒ
+		uint32_t SearchPasses;      //!< ʎq[_ }1 ĒT
+		bool IsPBitSearch;          //!< BC7  p rbg̑gݍ킹ׂĎ
+		uint32_t BC7PartitionCount; //!< BC7 [h 1 ŎۂɈkĂ݂镪̐
+	};
+	const QualityParams QualityTable[] =
+	{
+		{ 0, 0, false, 0 },  // Fast
+		{ 1, 0, true, 2 },   // Normal
+		{ 2, 2, true, 8 },   // High
+	};
+
+	const QualityParams& GetQualityParams(Quality quality)
+	{
+		return QualityTable[static_cast<uint32_t>(quality)];
+	}
+
+	// =======================
+	// pbg̒T (SIMD)
+	// =======================
+
+	/// <summary>
+	/// efɍł߂pbg̔ԍƓ덷߂܂ (덷Ȃԍ̏)
+	/// 덷͑S`l̓aŁAe߃Zbgœő̂Ōʂ͈v܂
+	/// </summary>
+	void FindNearest(const Block& block, const Palette& palette, uint8_t (&outIndices)[BlockPixelCount], float (&outErrors)[BlockPixelCount])
+	{
+#if defined(BLOCK_SIMD_AVX2)
+		for (uint32_t i = 0; i < BlockPixelCount; i += 8)
+		{
+			const __m256 r = _mm256_load_ps(&block.Channels[0][i]);
+			const __m256 g = _mm256_load_ps(&block.Channels[1][i]);
+			const __m256 b = _mm256_load_ps(&block.Channels[2][i]);
+			const __m256 a = _mm256_load_ps(&block.Channels[3][i]);
+			__m256 best = _mm256_set1_ps((std::numeric_limits<float>::max)());
+			__m256i bestIndex = _mm256_setzero_si256();
+			for (uint32_t k = 0; k < palette.Count; ++k)
+			{
+				const __m256 dr = _mm256_sub_ps(r, _mm256_broadcast_ss(&palette.Channels[0][k]));
+				const __m256 dg = _mm256_sub_ps(g, _mm256_broadcast_ss(&palette.Channels[1][k]));
+				const __m256 db = _mm256_sub_ps(b, _mm256_broadcast_ss(&palette.Channels[2][k]));
+				const __m256 da = _mm256_sub_ps(a, _mm256_broadcast_ss(&palette.Channels[3][k]));
+				const __m256 error = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+					_mm256_mul_ps(dr, dr), _mm256_mul_ps(dg, dg)), _mm256_mul_ps(db, db)), _mm256_mul_ps(da, da));
+				const __m256 isBetter = _mm256_cmp_ps(error, best, _CMP_LT_OQ);
+				best = _mm256_blendv_ps(best, error, isBetter);
+				bestIndex = _mm256_blendv_epi8(bestIndex, _mm256_set1_epi32(static_cast<int>(k)), _mm256_castps_si256(isBetter));
+			}
+			alignas(32) int32_t indices[8];
+			_mm256_store_si256(reinterpret_cast<__m256i*>(indices), bestIndex);
+			_mm256_storeu_ps(&outErrors[i], best);
+			for (uint32_t j = 0; j < 8; ++j)
+			{
+				outIndices[i + j] = static_cast<uint8_t>(indices[j]);
+			}
+		}
+#elif defined(BLOCK_SIMD_SSE)
+		for (uint32_t i = 0; i < BlockPixelCount; i += 4)
+		{
+			const __m128 r = _mm_load_ps(&block.Channels[0][i]);
+			const __m128 g = _mm_load_ps(&block.Channels[1][i]);
+			const __m128 b = _mm_load_ps(&block.Channels[2][i]);
+			const __m128 a = _mm_load_ps(&block.Channels[3][i]);
+			__m128 best = _mm_set1_ps((std::numeric_limits<float>::max)());
+			__m128i bestIndex = _mm_setzero_si128();
+			for (uint32_t k = 0; k < palette.Count; ++k)
+			{
+				const __m128 dr = _mm_sub_ps(r, _mm_set1_ps(palette.Channels[0][k]));
+				const __m128 dg = _mm_sub_ps(g, _mm_set1_ps(palette.Channels[1][k]));
+				const __m128 db = _mm_sub_ps(b, _mm_set1_ps(palette.Channels[2][k]));
+				const __m128 da = _mm_sub_ps(a, _mm_set1_ps(palette.Channels[3][k]));
+				const __m128 error = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+					_mm_mul_ps(dr, dr), _mm_mul_ps(dg, dg)), _mm_mul_ps(db, db)), _mm_mul_ps(da, da));
+				const __m128 isBetter = _mm_cmplt_ps(error, best);
+				const __m128i betterMask = _mm_castps_si128(isBetter);
+				best = _mm_or_ps(_mm_and_ps(isBetter, error), _mm_andnot_ps(isBetter, best));
+				bestIndex = _mm_or_si128(_mm_and_si128(betterMask, _mm_set1_epi32(static_cast<int>(k))), _mm_andnot_si128(betterMask, bestIndex));
+			}
+			alignas(16) int32_t indices[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(indices), bestIndex);
+			_mm_storeu_ps(&outErrors[i], best);
+			for (uint32_t j = 0; j < 4; ++j)
+			{
+				outIndices[i + j] = static_cast<uint8_t>(indices[j]);
+			}
+		}
+#else
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			float best = (std::numeric_limits<float>::max)();
+			uint32_t bestIndex = 0;
+			for (uint32_t k = 0; k < palette.Count; ++k)
+			{
+				const float dr = block.Channels[0][i] - palette.Channels[0][k];
+				const float dg = block.Channels[1][i] - palette.Channels[1][k];
+				const float db = block.Channels[2][i] - palette.Channels[2][k];
+				const float da = block.Channels[3][i] - palette.Channels[3][k];
+				const float error = dr * dr + dg * dg + db * db + da * da;
+				if (error < best)
+				{
+					best = error;
+					bestIndex = k;
+				}
+			}
+			outIndices[i] = static_cast<uint8_t>(bestIndex);
+			outErrors[i] = best;
+		}
+#endif
+	}
+
+	/// <summary>
+	/// 1`lł FindNearest (BC4EBC5EBC3 ̃At@)
+	/// </summary>
+	float FindNearest1(const float (&values)[BlockPixelCount], const float (&palette)[8], uint8_t (&outIndices)[BlockPixelCount])
+	{
+		alignas(32) float errors[BlockPixelCount];
+#if defined(BLOCK_SIMD_AVX2)
+		for (uint32_t i = 0; i < BlockPixelCount; i += 8)
+		{
+			const __m256 v = _mm256_loadu_ps(&values[i]);
+			__m256 best = _mm256_set1_ps((std::numeric_limits<float>::max)());
+			__m256i bestIndex = _mm256_setzero_si256();
+			for (uint32_t k = 0; k < 8; ++k)
+			{
+				const __m256 d = _mm256_sub_ps(v, _mm256_broadcast_ss(&palette[k]));
+				const __m256 error = _mm256_mul_ps(d, d);
+				const __m256 isBetter = _mm256_cmp_ps(error, best, _CMP_LT_OQ);
+				best = _mm256_blendv_ps(best, error, isBetter);
+				bestIndex = _mm256_blendv_epi8(bestIndex, _mm256_set1_epi32(static_cast<int>(k)), _mm256_castps_si256(isBetter));
+			}
+			alignas(32) int32_t indices[8];
+			_mm256_store_si256(reinterpret_cast<__m256i*>(indices), bestIndex);
+			_mm256_store_ps(&errors[i], best);
+			for (uint32_t j = 0; j < 8; ++j)
+			{
+				outIndices[i + j] = static_cast<uint8_t>(indices[j]);
+			}
+		}
+#elif defined(BLOCK_SIMD_SSE)
+		for (uint32_t i = 0; i < BlockPixelCount; i += 4)
+		{
+			const __m128 v = _mm_loadu_ps(&values[i]);
+			__m128 best = _mm_set1_ps((std::numeric_limits<float>::max)());
+			__m128i bestIndex = _mm_setzero_si128();
+			for (uint32_t k = 0; k < 8; ++k)
+			{
+				const __m128 d = _mm_sub_ps(v, _mm_set1_ps(palette[k]));
+				const __m128 error = _mm_mul_ps(d, d);
+				const __m128 isBetter = _mm_cmplt_ps(error, best);
+				const __m128i betterMask = _mm_castps_si128(isBetter);
+				best = _mm_or_ps(_mm_and_ps(isBetter, error), _mm_andnot_ps(isBetter, best));
+				bestIndex = _mm_or_si128(_mm_and_si128(betterMask, _mm_set1_epi32(static_cast<int>(k))), _mm_andnot_si128(betterMask, bestIndex));
+			}
+			alignas(16) int32_t indices[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(indices), bestIndex);
+			_mm_store_ps(&errors[i], best);
+			for (uint32_t j = 0; j < 4; ++j)
+			{
+				outIndices[i + j] = static_cast<uint8_t>(indices[j]);
+			}
+		}
+#else
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			float best = (std::numeric_limits<float>::max)();
+			uint32_t bestIndex = 0;
+			for (uint32_t k = 0; k < 8; ++k)
+			{
+				const float d = values[i] - palette[k];
+				const float error = d * d;
+				if (error < best)
+				{
+					best = error;
+					bestIndex = k;
+				}
+			}
+			outIndices[i] = static_cast<uint8_t>(bestIndex);
+			errors[i] = best;
+		}
+#endif
+		float total = 0.0f;
+		for (const float error : errors)
+		{
+			total += error;
+		}
+		return total;
+	}
+
+	//! @brief mask Ɋ܂܂f̌덷̍v
+	float SumErrors(const float (&errors)[BlockPixelCount], uint32_t mask)
+	{
+		float total = 0.0f;
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			if (mask & (1u << i))
+			{
+				total += errors[i];
+			}
+		}
+		return total;
+	}
+
+	// =======================
+	// [_̐
+	// =======================
+
+	/// <summary>
+	/// mask ̉f̕ςƁA΂őɂȂ (Us̍őŗLľŗLxNg)
+	/// </summary>
+	struct AxisFit
+	{
+		float Mean[4] = {};
+		float Axis[4] = {};
+		float TotalVariance = 0.0f; //!< e`l̕U̘a (f{)
+	};
+
+	AxisFit FitAxis(const Block& block, uint32_t mask, uint32_t channelCount)
+	{
+		AxisFit fit;
+		uint32_t count = 0;
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			if (mask & (1u << i))
+			{
+				for (uint32_t c = 0; c < channelCount; ++c)
+				{
+					fit.Mean[c] += block.Channels[c][i];
+				}
+				++count;
+			}
+		}
+		if (count == 0)
+		{
+			return fit;
+		}
+		for (uint32_t c = 0; c < channelCount; ++c)
+		{
+			fit.Mean[c] /= static_cast<float>(count);
+		}
+
+		float covariance[4][4] = {};
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			if (!(mask & (1u << i)))
+			{
+				continue;
+			}
+			float d[4];
+			for (uint32_t c = 0; c < channelCount; ++c)
+			{
+				d[c] = block.Channels[c][i] - fit.Mean[c];
+			}
+			for (uint32_t r = 0; r < channelCount; ++r)
+			{
+				for (uint32_t c = r; c < channelCount; ++c)
+				{
+					covariance[r][c] += d[r] * d[c];
+				}
+			}
+		}
+
+		// Uő̃`l̍sp@ŌŗLxNg߂
+		uint32_t largest = 0;
+		for (uint32_t c = 0; c < channelCount; ++c)
+		{
+			for (uint32_t r = c + 1; r < channelCount; ++r)
+			{
+				covariance[r][c] = covariance[c][r];
+			}
+			fit.TotalVariance += covariance[c][c];
+			if (covariance[c][c] > covariance[largest][largest])
+			{
+				largest = c;
+			}
+		}
+		if (fit.TotalVariance <= 0.0f)
+		{
+			return fit;
+		}
+		float axis[4] = {};
+		for (uint32_t c = 0; c < channelCount; ++c)
+		{
+			axis[c] = covariance[largest][c];
+		}
+		for (int iteration = 0; iteration < 8; ++iteration)
+		{
+			float next[4] = {};
+			float lengthSq = 0.0f;
+			for (uint32_t r = 0; r < channelCount; ++r)
+			{
+				for (uint32_t c = 0; c < channelCount; ++c)
+				{
+					next[r] += covariance[r][c] * axis[c];
+				}
+				lengthSq += next[r] * next[r];
+			}
+			if (lengthSq <= 1.0e-12f)
+			{
+				break;
+			}
+			const float length = std::sqrt(lengthSq);
+			for (uint32_t c = 0; c < channelCount; ++c)
+			{
+				axis[c] = next[c] / length;
+			}
+		}
+		std::memcpy(fit.Axis, axis, sizeof(axis));
+		return fit;
+	}
+
+	/// <summary>
+	/// 听̕ɕׂf̗[[_ɂ܂
+	/// </summary>
+	void GetAxisEndpoints(const Block& block, uint32_t mask, uint32_t channelCount, const AxisFit& fit, float (&outEndpoints)[2][4])
+	{
+		float minT = (std::numeric_limits<float>::max)();
+		float maxT = -(std::numeric_limits<float>::max)();
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			if (!(mask & (1u << i)))
+			{
+				continue;
+			}
+			float t = 0.0f;
+			for (uint32_t c = 0; c < channelCount; ++c)
+			{
+				t += (block.Channels[c][i] - fit.Mean[c]) * fit.Axis[c];
+			}
+			minT = (std::min)(minT, t);
+			maxT = (std::max)(maxT, t);
+		}
+		if (minT > maxT)
+		{
+			minT = maxT = 0.0f;
+		}
+		for (uint32_t c = 0; c < 4; ++c)
+		{
+			const bool isUsed = c < channelCount;
+			outEndpoints[0][c] = isUsed ? (std::min)((std::max)(fit.Mean[c] + fit.Axis[c] * minT, 0.0f), 255.0f) : 255.0f;
+			outEndpoints[1][c] = isUsed ? (std::min)((std::max)(fit.Mean[c] + fit.Axis[c] * maxT, 0.0f), 255.0f) : 255.0f;
+		}
+	}
+
+	/// <summary>
+	/// ef̔ԍŒ肵AԌʂƂ̓덷ŏɂȂ[_ŏ@ŋ߂܂
+	/// </summary>
+	/// <param name="weights"> ԍƂ̒[_ 1 ̏d (̔ԍ͒[_Ɩ֌WȌŒlȂ̂ŏO) </param>
+	/// <returns> Ȃ (Sfd݂) ꍇ false </returns>
+	bool SolveEndpoints(const float (&values)[4][BlockPixelCount], uint32_t mask, uint32_t channelCount,
+		const uint8_t (&indices)[BlockPixelCount], const float* weights, float (&outEndpoints)[2][4])
+	{
+		float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+		float ax[4] = {}, bx[4] = {};
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			const float t = weights[indices[i]];
+			if (!(mask & (1u << i)) || t < 0.0f)
+			{
+				continue;
+			}
+			const float s = 1.0f - t;
+			aa += s * s;
+			ab += s * t;
+			bb += t * t;
+			for (uint32_t c = 0; c < channelCount; ++c)
+			{
+				ax[c] += s * values[c][i];
+				bx[c] += t * values[c][i];
+			}
+		}
+		const float determinant = aa * bb - ab * ab;
+		if (std::fabs(determinant) < 1.0e-6f)
+		{
+			return false;
+		}
+		const float inverse = 1.0f / determinant;
+		for (uint32_t c = 0; c < 4; ++c)
+		{
+			if (c >= channelCount)
+			{
+				outEndpoints[0][c] = outEndpoints[1][c] = 255.0f;
+				continue;
+			}
+			outEndpoints[0][c] = (std::min)((std::max)((ax[c] * bb - bx[c] * ab) * inverse, 0.0f), 255.0f);
+			outEndpoints[1][c] = (std::min)((std::max)((bx[c] * aa - ax[c] * ab) * inverse, 0.0f), 255.0f);
+		}
+		return true;
+	}
+
+	//! @brief bitCount rbg̒l 8 rbgɍL (ʃrbgʂɌJԂ)
+	uint32_t Expand(uint32_t value, uint32_t bitCount)
+	{
+		return bitCount >= 8 ? value : (value << (8 - bitCount)) | (value >> (2 * bitCount - 8));
+	}
+
+	/// <summary>
+	/// LƂ value ɍł߂Ȃ bitCount rbg̒l (ʂɌŒ lowBit tꍇ lowBitCount = 1)
+	/// </summary>
+	uint32_t QuantizeComponent(float value, uint32_t bitCount, uint32_t lowBit = 0, uint32_t lowBitCount = 0)
+	{
+		const uint32_t maxValue = (1u << bitCount) - 1;
+		const uint32_t totalBits = bitCount + lowBitCount;
+		const float scaled = value * static_cast<float>((1u << totalBits) - 1) / 255.0f;
+		const int guess = static_cast<int>((scaled - static_cast<float>(lowBit)) / static_cast<float>(1u << lowBitCount) + 0.5f);
+		uint32_t best = 0;
+		float bestError = (std::numeric_limits<float>::max)();
+		for (int candidate = guess - 1; candidate <= guess + 1; ++candidate)
+		{
+			if (candidate < 0 || candidate > static_cast<int>(maxValue))
+			{
+				continue;
+			}
+			const uint32_t expanded = Expand((static_cast<uint32_t>(candidate) << lowBitCount) | lowBit, totalBits);
+			const float error = std::fabs(static_cast<float>(expanded) - value);
+			if (error < bestError)
+			{
+				bestError = error;
+				best = static_cast<uint32_t>(candidate);
+			}
+		}
+		return best;
+	}
+
+	// =======================
+	// BC1 (BC3 ̐F)
+	// =======================
+
+	//! BC1  4 F[h̔ԍƂ̒[_ 1 ̏d
+	const float BC1FourColorWeights[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+	//! BC1  3 F[h̔ԍƂ̒[_ 1 ̏d (3 ͓)
+	const float BC1ThreeColorWeights[4] = { 0.0f, 1.0f, 0.5f, -1.0f };
+
+	uint16_t PackColor565(const uint32_t (&components)[3])
+	{
+		return static_cast<uint16_t>((components[0] << 11) | (components[1] << 5) | components[2]);
+	}
+
+	void UnpackColor565(uint16_t color, uint32_t (&outComponents)[3])
+	{
+		outComponents[0] = (color >> 11) & 0x1F;
+		outComponents[1] = (color >> 5) & 0x3F;
+		outComponents[2] = color & 0x1F;
+	}
+
+	/// <summary>
+	/// BC1  4 F̃pbg (RGBA8)
+	/// BC3 ̐F͒[_̑召Ɋւ炸 4 F[hł
+	/// </summary>
+	void MakeBC1Palette(uint16_t color0, uint16_t color1, bool isFourColor, uint8_t (&outPalette)[4][4])
+	{
+		const uint32_t Bits[3] = { 5, 6, 5 };
+		uint32_t c0[3], c1[3];
+		UnpackColor565(color0, c0);
+		UnpackColor565(color1, c1);
+		for (uint32_t c = 0; c < 3; ++c)
+		{
+			const uint32_t a = Expand(c0[c], Bits[c]);
+			const uint32_t b = Expand(c1[c], Bits[c]);
+			outPalette[0][c] = static_cast<uint8_t>(a);
+			outPalette[1][c] = static_cast<uint8_t>(b);
+			if (isFourColor)
+			{
+				outPalette[2][c] = static_cast<uint8_t>((2 * a + b + 1) / 3);
+				outPalette[3][c] = static_cast<uint8_t>((a + 2 * b + 1) / 3);
+			}
+			else
+			{
+				outPalette[2][c] = static_cast<uint8_t>((a + b + 1) / 2);
+				outPalette[3][c] = 0;
+			}
+		}
+		outPalette[0][3] = outPalette[1][3] = outPalette[2][3] = 255;
+		outPalette[3][3] = isFourColor ? 255 : 0;
+	}
+
+	/// <summary>
+	/// BC1 ̒[_Ɣԍ̌
+	/// </summary>
+	struct BC1Candidate
+	{
+		uint16_t Colors[2] = {};
+		bool IsFourColor = true;
+		uint8_t Indices[BlockPixelCount] = {};
+		float Error = (std::numeric_limits<float>::max)();
+	};
+
+	/// <summary>
+	/// [_ BC1 ̃pbgAsȉf̔ԍƌ덷߂܂ (ȉf 3 F[h 3)
+	/// block ̃At@ 0 ɂĂ܂
+	/// </summary>
+	void EvaluateBC1(const Block& block, uint32_t opaqueMask, BC1Candidate& candidate)
+	{
+		uint8_t colors[4][4];
+		MakeBC1Palette(candidate.Colors[0], candidate.Colors[1], candidate.IsFourColor, colors);
+		Palette palette;
+		palette.Count = candidate.IsFourColor ? 4 : 3;
+		for (uint32_t k = 0; k < palette.Count; ++k)
+		{
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				palette.Channels[c][k] = colors[k][c];
+			}
+			palette.Channels[3][k] = 0.0f;
+		}
+		float errors[BlockPixelCount];
+		FindNearest(block, palette, candidate.Indices, errors);
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			if (!(opaqueMask & (1u << i)))
+			{
+				candidate.Indices[i] = 3;
+			}
+		}
+		candidate.Error = SumErrors(errors, opaqueMask);
+	}
+
+	void QuantizeBC1Endpoints(const float (&endpoints)[2][4], BC1Candidate& candidate)
+	{
+		const uint32_t Bits[3] = { 5, 6, 5 };
+		for (uint32_t e = 0; e < 2; ++e)
+		{
+			uint32_t components[3];
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				components[c] = QuantizeComponent(endpoints[e][c], Bits[c]);
+			}
+			candidate.Colors[e] = PackColor565(components);
+		}
+	}
+
+	/// <summary>
+	/// 1̃[h (4 F/3 F) Œ[_T܂
+	/// </summary>
+	BC1Candidate SearchBC1(const Block& block, uint32_t opaqueMask, bool isFourColor, const QualityParams& params)
+	{
+		const float* weights = isFourColor ? BC1FourColorWeights : BC1ThreeColorWeights;
+
+		BC1Candidate best;
+		best.IsFourColor = isFourColor;
+		float endpoints[2][4];
+		GetAxisEndpoints(block, opaqueMask, 3, FitAxis(block, opaqueMask, 3), endpoints);
+		QuantizeBC1Endpoints(endpoints, best);
+		EvaluateBC1(block, opaqueMask, best);
+
+		for (uint32_t iteration = 0; iteration < params.RefineIterations && best.Error > 0.0f; ++iteration)
+		{
+			if (!SolveEndpoints(block.Channels, opaqueMask, 3, best.Indices, weights, endpoints))
+			{
+				break;
+			}
+			BC1Candidate candidate = best;
+			QuantizeBC1Endpoints(endpoints, candidate);
+			EvaluateBC1(block, opaqueMask, candidate);
+			if (candidate.Error >= best.Error)
+			{
+				break;
+			}
+			best = candidate;
+		}
+
+		// 565 ̊e }1 AǂȂ̗p
+		const uint32_t MaxValues[3] = { 31, 63, 31 };
+		for (uint32_t pass = 0; pass < params.SearchPasses && best.Error > 0.0f; ++pass)
+		{
+			bool isImproved = false;
+			for (uint32_t e = 0; e < 2; ++e)
+			{
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					for (int delta = -1; delta <= 1; delta += 2)
+					{
+						uint32_t components[3];
+						UnpackColor565(best.Colors[e], components);
+						const int value = static_cast<int>(components[c]) + delta;
+						if (value < 0 || value > static_cast<int>(MaxValues[c]))
+						{
+							continue;
+						}
+						components[c] = static_cast<uint32_t>(value);
+						BC1Candidate candidate = best;
+						candidate.Colors[e] = PackColor565(components);
+						EvaluateBC1(block, opaqueMask, candidate);
+						if (candidate.Error < best.Error)
+						{
+							best = candidate;
+							isImproved = true;
+						}
+					}
+				}
+			}
+			if (!isImproved)
+			{
+				break;
+			}
+		}
+		return best;
+	}
+
+	/// <summary>
+	/// BC1 ̐F̃ubN (8 oCg) ܂
+	/// </summary>
+	/// <param name="isBC3"> BC3 ̐F̕ ( 4 F[hŁAAt@͕ʂɎ) </param>
+	void EncodeColorBlock(const Block& source, Quality quality, bool isBC3, uint8_t* pOut)
+	{
+		const QualityParams& params = GetQualityParams(quality);
+
+		// FŔׂ̂ŃAt@ 0 ɂĂ
+		Block block = source;
+		std::fill(std::begin(block.Channels[3]), std::end(block.Channels[3]), 0.0f);
+
+		// BC1 ̓At@̉f 3 F[h̓ŕ\
+		uint32_t opaqueMask = 0xFFFF;
+		if (!isBC3)
+		{
+			for (uint32_t i = 0; i < BlockPixelCount; ++i)
+			{
+				if (source.Channels[3][i] < 128.0f)
+				{
+					opaqueMask &= ~(1u << i);
+				}
+			}
+		}
+
+		BC1Candidate best;
+		if (opaqueMask == 0)
+		{
+			best.IsFourColor = false;
+			std::fill(std::begin(best.Indices), std::end(best.Indices), static_cast<uint8_t>(3));
+		}
+		else if (opaqueMask != 0xFFFF)
+		{
+			best = SearchBC1(block, opaqueMask, false, params);
+		}
+		else
+		{
+			best = SearchBC1(block, opaqueMask, true, params);
+			// sł 3 F[h̕ubN (BC3  4 F[hȂ)
+			if (!isBC3 && quality != Quality::Fast && best.Error > 0.0f)
+			{
+				const BC1Candidate threeColor = SearchBC1(block, opaqueMask, false, params);
+				if (threeColor.Error < best.Error)
+				{
+					best = threeColor;
+				}
+			}
+		}
+
+		// [h͒[_̑召ŕ\̂ŁA悤ɓւ
+		uint16_t color0 = best.Colors[0];
+		uint16_t color1 = best.Colors[1];
+		if (best.IsFourColor ? color0 < color1 : color0 > color1)
+		{
+			std::swap(color0, color1);
+			const uint8_t Swapped[4] = { 1, 0, static_cast<uint8_t>(best.IsFourColor ? 3 : 2), static_cast<uint8_t>(best.IsFourColor ? 2 : 3) };
+			for (auto& index : best.Indices)
+			{
+				index = Swapped[index];
+			}
+		}
+		else if (best.IsFourColor && color0 == color1)
+		{
+			// [_ 3 F[hƂēWĴŁA 3 gȂ悤Sf[_ 0 ɂ
+			std::fill(std::begin(best.Indices), std::end(best.Indices), static_cast<uint8_t>(0));
+		}
+
+		uint32_t indexBits = 0;
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			indexBits |= static_cast<uint32_t>(best.Indices[i]) << (2 * i);
+		}
+		pOut[0] = static_cast<uint8_t>(color0 & 0xFF);
+		pOut[1] = static_cast<uint8_t>(color0 >> 8);
+		pOut[2] = static_cast<uint8_t>(color1 & 0xFF);
+		pOut[3] = static_cast<uint8_t>(color1 >> 8);
+		std::memcpy(pOut + 4, &indexBits, sizeof(indexBits));
+	}
+
+	void DecodeColorBlock(const uint8_t* pBlock, bool isBC3, uint8_t (&outPixels)[BlockPixelCount][4])
+	{
+		const uint16_t color0 = static_cast<uint16_t>(pBlock[0] | (pBlock[1] << 8));
+		const uint16_t color1 = static_cast<uint16_t>(pBlock[2] | (pBlock[3] << 8));
+		uint32_t indexBits;
+		std::memcpy(&indexBits, pBlock + 4, sizeof(indexBits));
+		uint8_t palette[4][4];
+		MakeBC1Palette(color0, color1, isBC3 || color0 > color1, palette);
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			std::memcpy(outPixels[i], palette[(indexBits >> (2 * i)) & 3], 4);
+		}
+	}
+
+	// =======================
+	// BC4 (BC3 ̃At@EBC5)
+	// =======================
+
+	//! BC4  8 iK[h ([_ 0 > [_ 1) ̔ԍƂ̒[_ 1 ̏d
+	const float BC4EightValueWeights[8] = { 0.0f, 1.0f, 1.0f / 7.0f, 2.0f / 7.0f, 3.0f / 7.0f, 4.0f / 7.0f, 5.0f / 7.0f, 6.0f / 7.0f };
+	//! BC4  6 iK[h ([_ 0 <= [_ 1) ̔ԍƂ̒[_ 1 ̏d (6, 7  0  255 ̌Œl)
+	const float BC4SixValueWeights[8] = { 0.0f, 1.0f, 1.0f / 5.0f, 2.0f / 5.0f, 3.0f / 5.0f, 4.0f / 5.0f, -1.0f, -1.0f };
+
+	void MakeBC4Palette(uint32_t value0, uint32_t value1, uint8_t (&outPalette)[8])
+	{
+		outPalette[0] = static_cast<uint8_t>(value0);
+		outPalette[1] = static_cast<uint8_t>(value1);
+		if (value0 > value1)
+		{
+			for (uint32_t i = 2; i < 8; ++i)
+			{
+				outPalette[i] = static_cast<uint8_t>(((8 - i) * value0 + (i - 1) * value1 + 3) / 7);
+			}
+		}
+		else
+		{
+			for (uint32_t i = 2; i < 6; ++i)
+			{
+				outPalette[i] = static_cast<uint8_t>(((6 - i) * value0 + (i - 1) * value1 + 2) / 5);
+			}
+			outPalette[6] = 0;
+			outPalette[7] = 255;
+		}
+	}
+
+	/// <summary>
+	/// BC4 ̒[_Ɣԍ̌
+	/// </summary>
+	struct BC4Candidate
+	{
+		uint32_t Values[2] = {};
+		uint8_t Indices[BlockPixelCount] = {};
+		float Error = (std::numeric_limits<float>::max)();
+	};
+
+	void EvaluateBC4(const float (&values)[BlockPixelCount], BC4Candidate& candidate)
+	{
+		uint8_t palette[8];
+		MakeBC4Palette(candidate.Values[0], candidate.Values[1], palette);
+		float paletteValues[8];
+		for (uint32_t k = 0; k < 8; ++k)
+		{
+			paletteValues[k] = palette[k];
+		}
+		candidate.Error = FindNearest1(values, paletteValues, candidate.Indices);
+	}
+
+	/// <summary>
+	/// ŏ@ŋlߒ[_ (8 iK[hȂ傫[_ 0 ɂ)
+	/// </summary>
+	bool RefineBC4(const float (&values)[BlockPixelCount], const BC4Candidate& current, BC4Candidate& outCandidate)
+	{
+		const bool isEightValue = current.Values[0] > current.Values[1];
+		float channels[4][BlockPixelCount];
+		std::memcpy(channels[0], values, sizeof(values));
+		float endpoints[2][4];
+		if (!SolveEndpoints(channels, 0xFFFF, 1, current.Indices, isEightValue ? BC4EightValueWeights : BC4SixValueWeights, endpoints))
+		{
+			return false;
+		}
+		uint32_t value0 = static_cast<uint32_t>(endpoints[0][0] + 0.5f);
+		uint32_t value1 = static_cast<uint32_t>(endpoints[1][0] + 0.5f);
+		if (isEightValue ? value0 < value1 : value0 > value1)
+		{
+			std::swap(value0, value1);
+		}
+		if (isEightValue && value0 == value1)
+		{
+			return false;
+		}
+		outCandidate.Values[0] = value0;
+		outCandidate.Values[1] = value1;
+		EvaluateBC4(values, outCandidate);
+		return true;
+	}
+
+	/// <summary>
+	/// 1`l̃ubN (8 oCg) ܂
+	/// </summary>
+	void EncodeAlphaBlock(const float (&values)[BlockPixelCount], Quality quality, uint8_t* pOut)
+	{
+		const QualityParams& params = GetQualityParams(quality);
+
+		float minValue = values[0];
+		float maxValue = values[0];
+		for (const float value : values)
+		{
+			minValue = (std::min)(minValue, value);
+			maxValue = (std::max)(maxValue, value);
+		}
+
+		BC4Candidate best;
+		best.Values[0] = static_cast<uint32_t>(maxValue + 0.5f);
+		best.Values[1] = static_cast<uint32_t>(minValue + 0.5f);
+		EvaluateBC4(values, best);
+
+		if (best.Error > 0.0f && best.Values[0] != best.Values[1])
+		{
+			auto refine = [&](BC4Candidate candidate)
+				{
+					for (uint32_t iteration = 0; iteration < params.RefineIterations && candidate.Error > 0.0f; ++iteration)
+					{
+						BC4Candidate refined;
+						if (!RefineBC4(values, candidate, refined) || refined.Error >= candidate.Error)
+						{
+							break;
+						}
+						candidate = refined;
+					}
+					return candidate;
+				};
+			best = refine(best);
+
+			// 0  255 ŒlŎĂ 6 iK[h ([_ 0E255 ȊỎf͈̔)
+			if (quality != Quality::Fast)
+			{
+				float innerMin = 255.0f;
+				float innerMax = 0.0f;
+				for (const float value : values)
+				{
+					if (value > 0.0f && value < 255.0f)
+					{
+						innerMin = (std::min)(innerMin, value);
+						innerMax = (std::max)(innerMax, value);
+					}
+				}
+				if (innerMin <= innerMax)
+				{
+					BC4Candidate sixValue;
+					sixValue.Values[0] = static_cast<uint32_t>(innerMin + 0.5f);
+					sixValue.Values[1] = static_cast<uint32_t>(innerMax + 0.5f);
+					EvaluateBC4(values, sixValue);
+					sixValue = refine(sixValue);
+					if (sixValue.Error < best.Error)
+					{
+						best = sixValue;
+					}
+				}
+			}
+
+			// [_̎ӂ𑍓ŒT ([hςȂ͈)
+			if (params.SearchPasses > 0 && best.Error > 0.0f)
+			{
+				const bool isEightValue = best.Values[0] > best.Values[1];
+				const int center0 = static_cast<int>(best.Values[0]);
+				const int center1 = static_cast<int>(best.Values[1]);
+				const int radius = static_cast<int>(params.SearchPasses);
+				for (int value0 = center0 - radius; value0 <= center0 + radius; ++value0)
+				{
+					for (int value1 = center1 - radius; value1 <= center1 + radius; ++value1)
+					{
+						if (value0 < 0 || value0 > 255 || value1 < 0 || value1 > 255 || (value0 > value1) != isEightValue)
+						{
+							continue;
+						}
+						BC4Candidate candidate;
+						candidate.Values[0] = static_cast<uint32_t>(value0);
+						candidate.Values[1] = static_cast<uint32_t>(value1);
+						EvaluateBC4(values, candidate);
+						if (candidate.Error < best.Error)
+						{
+							best = candidate;
+						}
+					}
+				}
+			}
+		}
+
+		uint64_t indexBits = 0;
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			indexBits |= static_cast<uint64_t>(best.Indices[i]) << (3 * i);
+		}
+		pOut[0] = static_cast<uint8_t>(best.Values[0]);
+		pOut[1] = static_cast<uint8_t>(best.Values[1]);
+		for (uint32_t i = 0; i < 6; ++i)
+		{
+			pOut[2 + i] = static_cast<uint8_t>(indexBits >> (8 * i));
+		}
+	}
+
+	void DecodeAlphaBlock(const uint8_t* pBlock, uint8_t (&outValues)[BlockPixelCount])
+	{
+		uint8_t palette[8];
+		MakeBC4Palette(pBlock[0], pBlock[1], palette);
+		uint64_t indexBits = 0;
+		for (uint32_t i = 0; i < 6; ++i)
+		{
+			indexBits |= static_cast<uint64_t>(pBlock[2 + i]) << (8 * i);
+		}
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			outValues[i] = palette[(indexBits >> (3 * i)) & 7];
+		}
+	}
+
+	// =======================
+	// BC7
+	// =======================
+
+	/// <summary>
+	/// BC7 ̊e[h̃rbg
+	/// </summary>
+	struct BC7ModeInfo
+	{
+		uint8_t SubsetCount;
+		uint8_t PartitionBits;
+		uint8_t RotationBits;
+		uint8_t IndexSelectionBits;
+		uint8_t ColorBits;
+		uint8_t AlphaBits;
+		uint8_t EndpointPBits;  //!< [_Ƃ p rbg
+		uint8_t SharedPBits;    //!< Ƃ2̒[_ŋL p rbg
+		uint8_t IndexBits;
+		uint8_t SecondaryIndexBits; //!< [h 4, 5 ̃At@ (܂͐F) ̔ԍ
+	};
+	const BC7ModeInfo BC7Modes[8] =
+	{
+		{ 3, 4, 0, 0, 4, 0, 1, 0, 3, 0 },
+		{ 2, 6, 0, 0, 6, 0, 0, 1, 3, 0 },
+		{ 3, 6, 0, 0, 5, 0, 0, 0, 2, 0 },
+		{ 2, 6, 0, 0, 7, 0, 1, 0, 2, 0 },
+		{ 1, 0, 2, 1, 5, 6, 0, 0, 2, 3 },
+		{ 1, 0, 2, 0, 7, 8, 0, 0, 2, 2 },
+		{ 1, 0, 0, 0, 7, 7, 1, 0, 4, 0 },
+		{ 2, 6, 0, 0, 5, 5, 1, 0, 2, 0 },
+	};
+
+	//! ԍ̃rbgƂ̕Ԃ̏d (/64)
+	const uint8_t BC7Weights2[4] = { 0, 21, 43, 64 };
+	const uint8_t BC7Weights3[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+	const uint8_t BC7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	const uint8_t* GetBC7Weights(uint32_t indexBits)
+	{
+		return indexBits == 2 ? BC7Weights2 : indexBits == 3 ? BC7Weights3 : BC7Weights4;
+	}
+
+	//! 2̌` (rbg i f i ̕ԍ)
+	const uint16_t BC7Partitions2[64] =
+	{
+		0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+		0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+		0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+		0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+		0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+		0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+		0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+		0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22,
+	};
+
+	//! 3̌` (fƂ̕ԍ)
+	const uint8_t BC7Partitions3[64][BlockPixelCount] =
+	{
+		{ 0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 1, 2, 2, 2, 2 }, { 0, 0, 0, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 2, 1 },
+		{ 0, 0, 0, 0, 2, 0, 0, 1, 2, 2, 1, 1, 2, 2, 1, 1 }, { 0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 1, 0, 1, 1, 1 },
+		{ 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2 }, { 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 2, 2 },
+		{ 0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1 }, { 0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1 },
+		{ 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2 }, { 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2 },
+		{ 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2 }, { 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2 },
+		{ 0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2 }, { 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2 },
+		{ 0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2, 1, 2, 2, 2 }, { 0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0, 2, 2, 2, 0 },
+		{ 0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2 }, { 0, 1, 1, 1, 0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0 },
+		{ 0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2 }, { 0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1 },
+		{ 0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2, 0, 2, 2, 2 }, { 0, 0, 0, 1, 0, 0, 0, 1, 2, 2, 2, 1, 2, 2, 2, 1 },
+		{ 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2 }, { 0, 0, 0, 0, 1, 1, 0, 0, 2, 2, 1, 0, 2, 2, 1, 0 },
+		{ 0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1, 0, 0, 0, 0 }, { 0, 0, 1, 2, 0, 0, 1, 2, 1, 1, 2, 2, 2, 2, 2, 2 },
+		{ 0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1, 0, 1, 1, 0 }, { 0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1 },
+		{ 0, 0, 2, 2, 1, 1, 0, 2, 1, 1, 0, 2, 0, 0, 2, 2 }, { 0, 1, 1, 0, 0, 1, 1, 0, 2, 0, 0, 2, 2, 2, 2, 2 },
+		{ 0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1 }, { 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 1, 1, 2, 2, 2, 1 },
+		{ 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 2, 2, 2 }, { 0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 2, 0, 0, 1, 1 },
+		{ 0, 0, 1, 1, 0, 0, 1, 2, 0, 0, 2, 2, 0, 2, 2, 2 }, { 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0 },
+		{ 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0 }, { 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0 },
+		{ 0, 1, 2, 0, 2, 0, 1, 2, 1, 2, 0, 1, 0, 1, 2, 0 }, { 0, 0, 1, 1, 2, 2, 0, 0, 1, 1, 2, 2, 0, 0, 1, 1 },
+		{ 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0, 1, 1 }, { 0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2 },
+		{ 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1 }, { 0, 0, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2, 1, 1, 2, 2 },
+		{ 0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 1, 1 }, { 0, 2, 2, 0, 1, 2, 2, 1, 0, 2, 2, 0, 1, 2, 2, 1 },
+		{ 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 0, 1, 0, 1 }, { 0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1 },
+		{ 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2 }, { 0, 2, 2, 2, 0, 1, 1, 1, 0, 2, 2, 2, 0, 1, 1, 1 },
+		{ 0, 0, 0, 2, 1, 1, 1, 2, 0, 0, 0, 2, 1, 1, 1, 2 }, { 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2 },
+		{ 0, 2, 2, 2, 0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2 }, { 0, 0, 0, 2, 1, 1, 1, 2, 1, 1, 1, 2, 0, 0, 0, 2 },
+		{ 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2 }, { 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2 },
+		{ 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2, 2, 2, 2, 2 }, { 0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2 },
+		{ 0, 0, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2 }, { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2 },
+		{ 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1 }, { 0, 2, 2, 2, 1, 2, 2, 2, 0, 2, 2, 2, 1, 2, 2, 2 },
+		{ 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 }, { 0, 1, 1, 1, 2, 0, 1, 1, 2, 2, 0, 1, 2, 2, 2, 0 },
+	};
+
+	//! 2̕ 1 ̑\f (ԍ̍ŏʃrbgȗf)
+	const uint8_t BC7Anchors2[64] =
+	{
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 2, 8, 2, 2, 8, 8, 15, 2, 8, 2, 2, 8, 8, 2, 2,
+		15, 15, 6, 8, 2, 8, 15, 15, 2, 8, 2, 2, 2, 15, 15, 6,
+		6, 2, 6, 8, 15, 15, 2, 2, 15, 15, 15, 15, 15, 2, 2, 15,
+	};
+	//! 3̕ 1 ̑\f
+	const uint8_t BC7Anchors3Second[64] =
+	{
+		3, 3, 15, 15, 8, 3, 15, 15, 8, 8, 6, 6, 6, 5, 3, 3,
+		3, 3, 8, 15, 3, 3, 6, 10, 5, 8, 8, 6, 8, 5, 15, 15,
+		8, 15, 3, 5, 6, 10, 8, 15, 15, 3, 15, 5, 15, 15, 15, 15,
+		3, 15, 5, 5, 5, 8, 5, 10, 5, 10, 8, 13, 15, 12, 3, 3,
+	};
+	//! 3̕ 2 ̑\f
+	const uint8_t BC7Anchors3Third[64] =
+	{
+		15, 8, 8, 3, 15, 15, 3, 8, 15, 15, 15, 15, 15, 15, 15, 8,
+		15, 8, 15, 3, 15, 8, 15, 8, 3, 15, 6, 10, 15, 15, 10, 8,
+		15, 3, 15, 10, 10, 8, 9, 10, 6, 15, 8, 15, 3, 6, 6, 8,
+		15, 3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3, 15, 15, 8,
+	};
+
+	uint32_t GetBC7Subset(uint32_t subsetCount, uint32_t partition, uint32_t pixel)
+	{
+		switch (subsetCount)
+		{
+		case 2: return (BC7Partitions2[partition] >> pixel) & 1;
+		case 3: return BC7Partitions3[partition][pixel];
+		default: return 0;
+		}
+	}
+
+	bool IsBC7Anchor(uint32_t subsetCount, uint32_t partition, uint32_t pixel)
+	{
+		if (pixel == 0)
+		{
+			return true;
+		}
+		switch (subsetCount)
+		{
+		case 2: return pixel == BC7Anchors2[partition];
+		case 3: return pixel == BC7Anchors3Second[partition] || pixel == BC7Anchors3Third[partition];
+		default: return false;
+		}
+	}
+
+	/// <summary>
+	/// 128 rbg̃ubNɉʃrbg珇ɏ݂܂
+	/// </summary>
+	struct BitWriter
+	{
+		uint8_t Bytes[16] = {};
+		uint32_t Position = 0;
+
+		void Write(uint32_t value, uint32_t bitCount)
+		{
+			for (uint32_t i = 0; i < bitCount; ++i, ++Position)
+			{
+				Bytes[Position >> 3] |= static_cast<uint8_t>(((value >> i) & 1) << (Position & 7));
+			}
+		}
+	};
+
+	/// <summary>
+	/// 128 rbg̃ubNʃrbg珇ɓǂݏo܂
+	/// </summary>
+	struct BitReader
+	{
+		const uint8_t* pBytes = nullptr;
+		uint32_t Position = 0;
+
+		uint32_t Read(uint32_t bitCount)
+		{
+			uint32_t value = 0;
+			for (uint32_t i = 0; i < bitCount; ++i, ++Position)
+			{
+				value |= static_cast<uint32_t>((pBytes[Position >> 3] >> (Position & 7)) & 1) << i;
+			}
+			return value;
+		}
+	};
+
+	/// <summary>
+	/// GR[_[g[h (1  6) 1̌̕`
+	/// </summary>
+	struct BC7SubsetFormat
+	{
+		uint32_t ChannelCount;   //!< 4 ȂAt@[_Ɏ (3 ȂAt@ 255)
+		uint32_t ComponentBits;  //!< p rbg[_̃rbg
+		bool IsSharedPBit;       //!< 2̒[_ p rbgL
+		uint32_t IndexBits;
+	};
+	const BC7SubsetFormat BC7Mode6Format = { 4, 7, false, 4 };
+	const BC7SubsetFormat BC7Mode1Format = { 3, 6, true, 3 };
+
+	/// <summary>
+	/// 1̗̕ʎq[_Ɣԍ
+	/// </summary>
+	struct BC7Subset
+	{
+		uint8_t Components[2][4] = {}; //!< p rbgʎql
+		uint8_t PBits[2] = {};
+		uint8_t Indices[BlockPixelCount] = {};
+		float Error = (std::numeric_limits<float>::max)();
+	};
+
+	void EvaluateBC7Subset(const Block& block, uint32_t mask, const BC7SubsetFormat& format, BC7Subset& subset)
+	{
+		uint32_t endpoints[2][4];
+		for (uint32_t e = 0; e < 2; ++e)
+		{
+			for (uint32_t c = 0; c < 4; ++c)
+			{
+				endpoints[e][c] = c < format.ChannelCount
+					? Expand((static_cast<uint32_t>(subset.Components[e][c]) << 1) | subset.PBits[e], format.ComponentBits + 1)
+					: 255;
+			}
+		}
+		const uint8_t* weights = GetBC7Weights(format.IndexBits);
+		Palette palette;
+		palette.Count = 1u << format.IndexBits;
+		for (uint32_t k = 0; k < palette.Count; ++k)
+		{
+			for (uint32_t c = 0; c < 4; ++c)
+			{
+				palette.Channels[c][k] = static_cast<float>(((64 - weights[k]) * endpoints[0][c] + weights[k] * endpoints[1][c] + 32) >> 6);
+			}
+		}
+		float errors[BlockPixelCount];
+		FindNearest(block, palette, subset.Indices, errors);
+		subset.Error = SumErrors(errors, mask);
+	}
+
+	/// <summary>
+	/// [_ʎqĕ]Abest ǂΒu܂
+	/// p rbǵATȂꍇ͒[_Ƃɗʎq덷Iт܂
+	/// </summary>
+	void TryBC7Endpoints(const Block& block, uint32_t mask, const BC7SubsetFormat& format, bool isPBitSearch,
+		const float (&endpoints)[2][4], BC7Subset& best)
+	{
+		auto quantize = [&](uint32_t e, uint32_t pBit, BC7Subset& subset)
+			{
+				float error = 0.0f;
+				for (uint32_t c = 0; c < format.ChannelCount; ++c)
+				{
+					const uint32_t value = QuantizeComponent(endpoints[e][c], format.ComponentBits, pBit, 1);
+					subset.Components[e][c] = static_cast<uint8_t>(value);
+					const float d = static_cast<float>(Expand((value << 1) | pBit, format.ComponentBits + 1)) - endpoints[e][c];
+					error += d * d;
+				}
+				subset.PBits[e] = static_cast<uint8_t>(pBit);
+				return error;
+			};
+
+		if (!isPBitSearch)
+		{
+			BC7Subset candidate;
+			BC7Subset other;
+			if (format.IsSharedPBit)
+			{
+				const float error0 = quantize(0, 0, candidate) + quantize(1, 0, candidate);
+				const float error1 = quantize(0, 1, other) + quantize(1, 1, other);
+				if (error1 < error0)
+				{
+					candidate = other;
+				}
+			}
+			else
+			{
+				for (uint32_t e = 0; e < 2; ++e)
+				{
+					const float error0 = quantize(e, 0, candidate);
+					if (quantize(e, 1, other) < error0)
+					{
+						std::memcpy(candidate.Components[e], other.Components[e], sizeof(candidate.Components[e]));
+						candidate.PBits[e] = 1;
+					}
+				}
+			}
+			EvaluateBC7Subset(block, mask, format, candidate);
+			if (candidate.Error < best.Error)
+			{
+				best = candidate;
+			}
+			return;
+		}
+
+		const uint32_t combinationCount = format.IsSharedPBit ? 2 : 4;
+		for (uint32_t combination = 0; combination < combinationCount; ++combination)
+		{
+			const uint32_t pBit0 = format.IsSharedPBit ? combination : (combination & 1);
+			const uint32_t pBit1 = format.IsSharedPBit ? combination : (combination >> 1);
+			BC7Subset candidate;
+			quantize(0, pBit0, candidate);
+			quantize(1, pBit1, candidate);
+			EvaluateBC7Subset(block, mask, format, candidate);
+			if (candidate.Error < best.Error)
+			{
+				best = candidate;
+			}
+		}
+	}
+
+	/// <summary>
+	/// 1̒̕[_T܂
+	/// </summary>
+	BC7Subset EncodeBC7Subset(const Block& block, uint32_t mask, const BC7SubsetFormat& format, const QualityParams& params)
+	{
+		BC7Subset best;
+		float endpoints[2][4];
+		GetAxisEndpoints(block, mask, format.ChannelCount, FitAxis(block, mask, format.ChannelCount), endpoints);
+		TryBC7Endpoints(block, mask, format, params.IsPBitSearch, endpoints, best);
+
+		float weights[BlockPixelCount];
+		const uint8_t* pWeights = GetBC7Weights(format.IndexBits);
+		for (uint32_t k = 0; k < (1u << format.IndexBits); ++k)
+		{
+			weights[k] = pWeights[k] / 64.0f;
+		}
+		for (uint32_t iteration = 0; iteration < params.RefineIterations && best.Error > 0.0f; ++iteration)
+		{
+			const float previousError = best.Error;
+			if (!SolveEndpoints(block.Channels, mask, format.ChannelCount, best.Indices, weights, endpoints))
+			{
+				break;
+			}
+			TryBC7Endpoints(block, mask, format, params.IsPBitSearch, endpoints, best);
+			if (best.Error >= previousError)
+			{
+				break;
+			}
+		}
+
+		// ʎqe }1 AǂȂ̗p
+		const int maxValue = (1 << format.ComponentBits) - 1;
+		for (uint32_t pass = 0; pass < params.SearchPasses && best.Error > 0.0f; ++pass)
+		{
+			bool isImproved = false;
+			for (uint32_t e = 0; e < 2; ++e)
+			{
+				for (uint32_t c = 0; c < format.ChannelCount; ++c)
+				{
+					for (int delta = -1; delta <= 1; delta += 2)
+					{
+						const int value = best.Components[e][c] + delta;
+						if (value < 0 || value > maxValue)
+						{
+							continue;
+						}
+						BC7Subset candidate = best;
+						candidate.Components[e][c] = static_cast<uint8_t>(value);
+						EvaluateBC7Subset(block, mask, format, candidate);
+						if (candidate.Error < best.Error)
+						{
+							best = candidate;
+							isImproved = true;
+						}
+					}
+				}
+			}
+			if (!isImproved)
+			{
+				break;
+			}
+		}
+		return best;
+	}
+
+	/// <summary>
+	/// \f̔ԍ̍ŏʃrbg 0 ɂȂ悤AKvȂ[_ւĔԍ𔽓]܂
+	/// </summary>
+	void FixBC7Anchor(BC7Subset& subset, uint32_t mask, uint32_t anchor, uint32_t indexBits)
+	{
+		const uint32_t maxIndex = (1u << indexBits) - 1;
+		if (subset.Indices[anchor] <= (maxIndex >> 1))
+		{
+			return;
+		}
+		std::swap(subset.Components[0], subset.Components[1]);
+		std::swap(subset.PBits[0], subset.PBits[1]);
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			if (mask & (1u << i))
+			{
+				subset.Indices[i] = static_cast<uint8_t>(maxIndex - subset.Indices[i]);
+			}
+		}
+	}
+
+	void WriteBC7Mode6(BC7Subset subset, uint8_t* pOut)
+	{
+		FixBC7Anchor(subset, 0xFFFF, 0, 4);
+		BitWriter writer;
+		writer.Write(1u << 6, 7);
+		for (uint32_t c = 0; c < 4; ++c)
+		{
+			writer.Write(subset.Components[0][c], 7);
+			writer.Write(subset.Components[1][c], 7);
+		}
+		writer.Write(subset.PBits[0], 1);
+		writer.Write(subset.PBits[1], 1);
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			writer.Write(subset.Indices[i], i == 0 ? 3 : 4);
+		}
+		assert(writer.Position == 128);
+		std::memcpy(pOut, writer.Bytes, sizeof(writer.Bytes));
+	}
+
+	void WriteBC7Mode1(uint32_t partition, BC7Subset (&subsets)[2], uint8_t* pOut)
+	{
+		const uint32_t masks[2] = { ~static_cast<uint32_t>(BC7Partitions2[partition]) & 0xFFFF, BC7Partitions2[partition] };
+		FixBC7Anchor(subsets[0], masks[0], 0, 3);
+		FixBC7Anchor(subsets[1], masks[1], BC7Anchors2[partition], 3);
+
+		BitWriter writer;
+		writer.Write(1u << 1, 2);
+		writer.Write(partition, 6);
+		for (uint32_t c = 0; c < 3; ++c)
+		{
+			for (const auto& subset : subsets)
+			{
+				writer.Write(subset.Components[0][c], 6);
+				writer.Write(subset.Components[1][c], 6);
+			}
+		}
+		writer.Write(subsets[0].PBits[0], 1);
+		writer.Write(subsets[1].PBits[0], 1);
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			const auto& subset = subsets[(masks[1] >> i) & 1];
+			writer.Write(subset.Indices[i], IsBC7Anchor(2, partition, i) ? 2 : 3);
+		}
+		assert(writer.Position == 128);
+		std::memcpy(pOut, writer.Bytes, sizeof(writer.Bytes));
+	}
+
+	/// <summary>
+	/// f̘aƐς̘aAUő̕ɏȂ̕U (f{) ߂܂
+	/// 3x3 ̑Ώ̍s̍őŗLl͎Op֐ɂ̌ŋ߂܂
+	/// </summary>
+	float ComputeLineResidual(const float (&sums)[3], const float (&products)[6], float count)
+	{
+		if (count <= 0.0f)
+		{
+			return 0.0f;
+		}
+		const float inverseCount = 1.0f / count;
+		const float c00 = products[0] - sums[0] * sums[0] * inverseCount;
+		const float c01 = products[1] - sums[0] * sums[1] * inverseCount;
+		const float c02 = products[2] - sums[0] * sums[2] * inverseCount;
+		const float c11 = products[3] - sums[1] * sums[1] * inverseCount;
+		const float c12 = products[4] - sums[1] * sums[2] * inverseCount;
+		const float c22 = products[5] - sums[2] * sums[2] * inverseCount;
+		const float trace = c00 + c11 + c22;
+
+		const float offDiagonal = c01 * c01 + c02 * c02 + c12 * c12;
+		const float q = trace / 3.0f;
+		const float d0 = c00 - q, d1 = c11 - q, d2 = c22 - q;
+		const float p = std::sqrt((d0 * d0 + d1 * d1 + d2 * d2 + 2.0f * offDiagonal) / 6.0f);
+		if (p <= 1.0e-6f)
+		{
+			// SɓU΂Ă (܂1F)
+			return trace - q;
+		}
+		const float inverseP = 1.0f / p;
+		const float b00 = d0 * inverseP, b11 = d1 * inverseP, b22 = d2 * inverseP;
+		const float b01 = c01 * inverseP, b02 = c02 * inverseP, b12 = c12 * inverseP;
+		const float halfDeterminant = 0.5f * (b00 * (b11 * b22 - b12 * b12) - b01 * (b01 * b22 - b12 * b02) + b02 * (b01 * b12 - b11 * b02));
+		const float phi = std::acos((std::min)((std::max)(halfDeterminant, -1.0f), 1.0f)) / 3.0f;
+		const float largest = q + 2.0f * p * std::cos(phi);
+		return (std::max)(trace - largest, 0.0f);
+	}
+
+	/// <summary>
+	/// [h 1  64 ʂ̕ꂼɂāA2̕𒼐ŋߎƂ̌덷ς܂
+	///  0 ̘a̓ubNŜ̘a番 1 ̘aċ߂܂
+	/// </summary>
+	void EstimateBC7Partitions(const Block& block, float (&outErrors)[64])
+	{
+		float products[BlockPixelCount][6];
+		float totalSums[3] = {};
+		float totalProducts[6] = {};
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			const float r = block.Channels[0][i];
+			const float g = block.Channels[1][i];
+			const float b = block.Channels[2][i];
+			products[i][0] = r * r;
+			products[i][1] = r * g;
+			products[i][2] = r * b;
+			products[i][3] = g * g;
+			products[i][4] = g * b;
+			products[i][5] = b * b;
+			totalSums[0] += r;
+			totalSums[1] += g;
+			totalSums[2] += b;
+			for (uint32_t k = 0; k < 6; ++k)
+			{
+				totalProducts[k] += products[i][k];
+			}
+		}
+
+		for (uint32_t partition = 0; partition < 64; ++partition)
+		{
+			float sums[2][3] = {};
+			float productSums[2][6] = {};
+			float counts[2] = {};
+			for (uint32_t i = 0; i < BlockPixelCount; ++i)
+			{
+				if (!((BC7Partitions2[partition] >> i) & 1))
+				{
+					continue;
+				}
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					sums[1][c] += block.Channels[c][i];
+				}
+				for (uint32_t k = 0; k < 6; ++k)
+				{
+					productSums[1][k] += products[i][k];
+				}
+				counts[1] += 1.0f;
+			}
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				sums[0][c] = totalSums[c] - sums[1][c];
+			}
+			for (uint32_t k = 0; k < 6; ++k)
+			{
+				productSums[0][k] = totalProducts[k] - productSums[1][k];
+			}
+			counts[0] = static_cast<float>(BlockPixelCount) - counts[1];
+			outErrors[partition] = ComputeLineResidual(sums[0], productSums[0], counts[0]) + ComputeLineResidual(sums[1], productSums[1], counts[1]);
+		}
+	}
+
+	/// <summary>
+	/// BC7 ̃ubN܂
+	/// Sf1̒[_̑gŕ\[h 6 {ƂAsȃubNł 2 ̃[h 1 ܂
+	/// [h 1 ͕ƂɎ听̊OŌ݂tAʂ̕ۂɈk܂
+	/// </summary>
+	void EncodeBC7Block(const Block& block, Quality quality, uint8_t* pOut)
+	{
+		const QualityParams& params = GetQualityParams(quality);
+		const BC7Subset mode6 = EncodeBC7Subset(block, 0xFFFF, BC7Mode6Format, params);
+
+		bool isOpaque = true;
+		for (const float alpha : block.Channels[3])
+		{
+			isOpaque = isOpaque && alpha == 255.0f;
+		}
+		if (params.BC7PartitionCount == 0 || !isOpaque || mode6.Error == 0.0f)
+		{
+			WriteBC7Mode6(mode6, pOut);
+			return;
+		}
+
+		// eŒɏȂ̕Uς
+		float partitionErrors[64];
+		EstimateBC7Partitions(block, partitionErrors);
+		struct PartitionEstimate
+		{
+			float Error;
+			uint32_t Partition;
+		};
+		PartitionEstimate estimates[64];
+		for (uint32_t partition = 0; partition < 64; ++partition)
+		{
+			estimates[partition].Error = partitionErrors[partition];
+			estimates[partition].Partition = partition;
+		}
+		const uint32_t candidateCount = (std::min)(params.BC7PartitionCount, 64u);
+		std::partial_sort(estimates, estimates + candidateCount, estimates + 64,
+			[](const PartitionEstimate& a, const PartitionEstimate& b) { return a.Error < b.Error || (a.Error == b.Error && a.Partition < b.Partition); });
+
+		float bestError = mode6.Error;
+		uint32_t bestPartition = 64;
+		BC7Subset bestSubsets[2];
+		for (uint32_t i = 0; i < candidateCount; ++i)
+		{
+			const uint32_t partition = estimates[i].Partition;
+			const uint32_t mask1 = BC7Partitions2[partition];
+			const uint32_t mask0 = ~mask1 & 0xFFFF;
+			BC7Subset subsets[2] =
+			{
+				EncodeBC7Subset(block, mask0, BC7Mode1Format, params),
+				EncodeBC7Subset(block, mask1, BC7Mode1Format, params),
+			};
+			const float error = subsets[0].Error + subsets[1].Error;
+			if (error < bestError)
+			{
+				bestError = error;
+				bestPartition = partition;
+				bestSubsets[0] = subsets[0];
+				bestSubsets[1] = subsets[1];
+			}
+		}
+
+		if (bestPartition < 64)
+		{
+			WriteBC7Mode1(bestPartition, bestSubsets, pOut);
+		}
+		else
+		{
+			WriteBC7Mode6(mode6, pOut);
+		}
+	}
+
+	void DecodeBC7Block(const uint8_t* pBlock, uint8_t (&outPixels)[BlockPixelCount][4])
+	{
+		BitReader reader;
+		reader.pBytes = pBlock;
+		uint32_t mode = 0;
+		while (mode < 8 && reader.Read(1) == 0)
+		{
+			++mode;
+		}
+		if (mode >= 8)
+		{
+			// \񂳂ꂽ[h͓ȍƂēWJ
+			std::memset(outPixels, 0, sizeof(outPixels));
+			return;
+		}
+
+		const BC7ModeInfo& info = BC7Modes[mode];
+		const uint32_t partition = reader.Read(info.PartitionBits);
+		const uint32_t rotation = reader.Read(info.RotationBits);
+		const uint32_t indexSelection = reader.Read(info.IndexSelectionBits);
+
+		const uint32_t endpointCount = info.SubsetCount * 2u;
+		uint32_t endpoints[6][4] = {};
+		for (uint32_t c = 0; c < 3; ++c)
+		{
+			for (uint32_t e = 0; e < endpointCount; ++e)
+			{
+				endpoints[e][c] = reader.Read(info.ColorBits);
+			}
+		}
+		for (uint32_t e = 0; e < endpointCount; ++e)
+		{
+			endpoints[e][3] = reader.Read(info.AlphaBits);
+		}
+
+		uint32_t colorBits = info.ColorBits;
+		uint32_t alphaBits = info.AlphaBits;
+		if (info.EndpointPBits || info.SharedPBits)
+		{
+			uint32_t pBits[6] = {};
+			for (uint32_t e = 0; e < endpointCount; ++e)
+			{
+				if (info.EndpointPBits)
+				{
+					pBits[e] = reader.Read(1);
+				}
+			}
+			for (uint32_t s = 0; s < info.SubsetCount && info.SharedPBits; ++s)
+			{
+				pBits[2 * s] = pBits[2 * s + 1] = reader.Read(1);
+			}
+			for (uint32_t e = 0; e < endpointCount; ++e)
+			{
+				for (uint32_t c = 0; c < 4; ++c)
+				{
+					endpoints[e][c] = (endpoints[e][c] << 1) | pBits[e];
+				}
+			}
+			++colorBits;
+			alphaBits = alphaBits ? alphaBits + 1 : 0;
+		}
+		for (uint32_t e = 0; e < endpointCount; ++e)
+		{
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				endpoints[e][c] = Expand(endpoints[e][c], colorBits);
+			}
+			endpoints[e][3] = alphaBits ? Expand(endpoints[e][3], alphaBits) : 255;
+		}
+
+		uint32_t indices[BlockPixelCount] = {};
+		uint32_t secondaryIndices[BlockPixelCount] = {};
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			const bool isAnchor = IsBC7Anchor(info.SubsetCount, partition, i);
+			indices[i] = reader.Read(info.IndexBits - (isAnchor ? 1 : 0));
+		}
+		for (uint32_t i = 0; i < BlockPixelCount && info.SecondaryIndexBits; ++i)
+		{
+			secondaryIndices[i] = reader.Read(info.SecondaryIndexBits - (i == 0 ? 1 : 0));
+		}
+
+		// [h 4, 5 ͐FƃAt@ŕʂ̔ԍ ([h 4  indexSelection œւ)
+		const bool isSwapped = indexSelection != 0;
+		const uint32_t colorIndexBits = isSwapped ? info.SecondaryIndexBits : info.IndexBits;
+		const uint32_t alphaIndexBits = info.SecondaryIndexBits ? (isSwapped ? info.IndexBits : info.SecondaryIndexBits) : info.IndexBits;
+		const uint8_t* colorWeights = GetBC7Weights(colorIndexBits);
+		const uint8_t* alphaWeights = GetBC7Weights(alphaIndexBits);
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			const uint32_t subset = GetBC7Subset(info.SubsetCount, partition, i);
+			const uint32_t* e0 = endpoints[2 * subset];
+			const uint32_t* e1 = endpoints[2 * subset + 1];
+			const uint32_t colorIndex = isSwapped ? secondaryIndices[i] : indices[i];
+			const uint32_t alphaIndex = info.SecondaryIndexBits ? (isSwapped ? indices[i] : secondaryIndices[i]) : indices[i];
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				const uint32_t w = colorWeights[colorIndex];
+				outPixels[i][c] = static_cast<uint8_t>(((64 - w) * e0[c] + w * e1[c] + 32) >> 6);
+			}
+			const uint32_t w = alphaWeights[alphaIndex];
+			outPixels[i][3] = static_cast<uint8_t>(((64 - w) * e0[3] + w * e1[3] + 32) >> 6);
+			if (rotation != 0)
+			{
+				std::swap(outPixels[i][3], outPixels[i][rotation - 1]);
+			}
+		}
+	}
+
+	// =======================
+	// 摜ƃubN
+	// =======================
+
+	/// <summary>
+	/// 摜 4x4 ̉fo܂ (͂ݏo͒[̉fJԂ)
+	/// </summary>
+	void LoadBlock(const BlockCompressor::SourceImage& source, uint32_t blockX, uint32_t blockY, Block& outBlock)
+	{
+		for (uint32_t y = 0; y < 4; ++y)
+		{
+			const uint32_t sourceY = (std::min)(blockY * 4 + y, source.Height - 1);
+			const uint8_t* pRow = source.pPixels + sourceY * source.RowPitch;
+			for (uint32_t x = 0; x < 4; ++x)
+			{
+				const uint8_t* pPixel = pRow + (std::min)(blockX * 4 + x, source.Width - 1) * 4;
+				for (uint32_t c = 0; c < 4; ++c)
+				{
+					outBlock.Channels[c][y * 4 + x] = pPixel[c];
+				}
+			}
+		}
+	}
+
+	void EncodeBlock(const Block& block, Format format, Quality quality, uint8_t* pOut)
+	{
+		switch (format)
+		{
+		case Format::BC1:
+			EncodeColorBlock(block, quality, false, pOut);
+			break;
+		case Format::BC3:
+			EncodeAlphaBlock(block.Channels[3], quality, pOut);
+			EncodeColorBlock(block, quality, true, pOut + 8);
+			break;
+		case Format::BC4:
+			EncodeAlphaBlock(block.Channels[0], quality, pOut);
+			break;
+		case Format::BC5:
+			EncodeAlphaBlock(block.Channels[0], quality, pOut);
+			EncodeAlphaBlock(block.Channels[1], quality, pOut + 8);
+			break;
+		case Format::BC7:
+			EncodeBC7Block(block, quality, pOut);
+			break;
+		}
+	}
+
+	void DecodeBlock(const uint8_t* pBlock, Format format, uint8_t (&outPixels)[BlockPixelCount][4])
+	{
+		uint8_t values[BlockPixelCount];
+		switch (format)
+		{
+		case Format::BC1:
+			DecodeColorBlock(pBlock, false, outPixels);
+			break;
+		case Format::BC3:
+			DecodeColorBlock(pBlock + 8, true, outPixels);
+			DecodeAlphaBlock(pBlock, values);
+			for (uint32_t i = 0; i < BlockPixelCount; ++i)
+			{
+				outPixels[i][3] = values[i];
+			}
+			break;
+		case Format::BC4:
+			DecodeAlphaBlock(pBlock, values);
+			for (uint32_t i = 0; i < BlockPixelCount; ++i)
+			{
+				outPixels[i][0] = values[i];
+				outPixels[i][1] = outPixels[i][2] = 0;
+				outPixels[i][3] = 255;
+			}
+			break;
+		case Format::BC5:
+			DecodeAlphaBlock(pBlock, values);
+			for (uint32_t i = 0; i < BlockPixelCount; ++i)
+			{
+				outPixels[i][0] = values[i];
+				outPixels[i][2] = 0;
+				outPixels[i][3] = 255;
+			}
+			DecodeAlphaBlock(pBlock + 8, values);
+			for (uint32_t i = 0; i < BlockPixelCount; ++i)
+			{
+				outPixels[i][1] = values[i];
+			}
+			break;
+		case Format::BC7:
+			DecodeBC7Block(pBlock, outPixels);
+			break;
+		}
+	}
+}
+using namespace BlockCompressorInternal;
+
+const char* BlockCompressor::GetFormatName(Format format)
+{
+	switch (format)
+	{
+	case Format::BC1: return "BC1";
+	case Format::BC3: return "BC3";
+	case Format::BC4: return "BC4";
+	case Format::BC5: return "BC5";
+	case Format::BC7: return "BC7";
+	default: return "?";
+	}
+}
+
+const char* BlockCompressor::GetQualityName(Quality quality)
+{
+	switch (quality)
+	{
+	case Quality::Fast: return "fast";
+	case Quality::Normal: return "normal";
+	case Quality::High: return "high";
+	default: return "?";
+	}
+}
+
+const char* BlockCompressor::GetInstructionSetName()
+{
+#if defined(BLOCK_SIMD_AVX2)
+	return "avx2";
+#elif defined(BLOCK_SIMD_SSE)
+	return "sse2";
+#else
+	return "scalar";
+#endif
+}
+
+size_t BlockCompressor::GetBlockSize(Format format)
+{
+	return format == Format::BC1 || format == Format::BC4 ? 8 : 16;
+}
+
+size_t BlockCompressor::GetCompressedSize(Format format, uint32_t width, uint32_t height)
+{
+	const size_t blocksX = (static_cast<size_t>(width) + 3) / 4;
+	const size_t blocksY = (static_cast<size_t>(height) + 3) / 4;
+	return blocksX * blocksY * GetBlockSize(format);
+}
+
+void BlockCompressor::Compress(const SourceImage& source, Format format, const Settings& settings, uint8_t* pOutBlocks)
+{
+	if (source.Width == 0 || source.Height == 0)
+	{
+		return;
+	}
+	const uint32_t blocksX = (source.Width + 3) / 4;
+	const uint32_t blocksY = (source.Height + 3) / 4;
+	const size_t blockSize = GetBlockSize(format);
+
+	// ubN̏d͏ꏊŕ΂̂ŁAs󂢂XbhɊ蓖Ă
+	const uint32_t jobCount = (blocksY + RowsPerJob - 1) / RowsPerJob;
+	auto encodeRows = [&](size_t job)
+		{
+			Block block;
+			const uint32_t endY = (std::min)(static_cast<uint32_t>(job + 1) * RowsPerJob, blocksY);
+			for (uint32_t blockY = static_cast<uint32_t>(job) * RowsPerJob; blockY < endY; ++blockY)
+			{
+				for (uint32_t blockX = 0; blockX < blocksX; ++blockX)
+				{
+					LoadBlock(source, blockX, blockY, block);
+					EncodeBlock(block, format, settings.Level, pOutBlocks + (static_cast<size_t>(blockY) * blocksX + blockX) * blockSize);
+				}
+			}
+		};
+	if (settings.IsParallel)
+	{
+		Parallel::ForEach(jobCount, encodeRows);
+	}
+	else
+	{
+		for (uint32_t job = 0; job < jobCount; ++job)
+		{
+			encodeRows(job);
+		}
+	}
+}
+
+void BlockCompressor::Decompress(const uint8_t* pBlocks, Format format, uint32_t width, uint32_t height, uint8_t* pOutPixels)
+{
+	const uint32_t blocksX = (width + 3) / 4;
+	const uint32_t blocksY = (height + 3) / 4;
+	const size_t blockSize = GetBlockSize(format);
+	for (uint32_t blockY = 0; blockY < blocksY; ++blockY)
+	{
+		for (uint32_t blockX = 0; blockX < blocksX; ++blockX)
+		{
+			uint8_t pixels[BlockPixelCount][4];
+			DecodeBlock(pBlocks + (static_cast<size_t>(blockY) * blocksX + blockX) * blockSize, format, pixels);
+			for (uint32_t y = 0; y < 4 && blockY * 4 + y < height; ++y)
+			{
+				for (uint32_t x = 0; x < 4 && blockX * 4 + x < width; ++x)
+				{
+					std::memcpy(pOutPixels + ((static_cast<size_t>(blockY) * 4 + y) * width + blockX * 4 + x) * 4, pixels[y * 4 + x], 4);
+				}
+			}
+		}
+	}
+}
+
+double BlockCompressor::ComputePSNR(const SourceImage& source, const uint8_t* pDecoded, Format format)
+{
+	const uint32_t channelCount = format == Format::BC4 ? 1 : format == Format::BC5 ? 2 : 4;
+	uint64_t squaredError = 0;
+	for (uint32_t y = 0; y < source.Height; ++y)
+	{
+		const uint8_t* pSource = source.pPixels + y * source.RowPitch;
+		const uint8_t* pResult = pDecoded + static_cast<size_t>(y) * source.Width * 4;
+		for (uint32_t x = 0; x < source.Width; ++x)
+		{
+			for (uint32_t c = 0; c < channelCount; ++c)
+			{
+				const int d = static_cast<int>(pSource[x * 4 + c]) - static_cast<int>(pResult[x * 4 + c]);
+				squaredError += static_cast<uint64_t>(d * d);
+			}
+		}
+	}
+	if (squaredError == 0)
+	{
+		return std::numeric_limits<double>::infinity();
+	}
+	const double meanSquaredError = static_cast<double>(squaredError) / (static_cast<double>(source.Width) * source.Height * channelCount);
+	return 10.0 * std::log10(255.0 * 255.0 / meanSquaredError);
+}
@@ -23,8 +23,10 @@ void Camera::Update()
 
 	// r[švZ
 	m_View = Matrix4x4::setLookAtLH(m_Position, m_Target, m_Upward);
-	// r[tšvZ
-	m_ViewInv = Matrix4x4::inverse(m_View);
+	// r[tšvZ (r[s͍̕ϊȂ̂ŃAtBp̍łgp)
+	m_ViewInv = Matrix4x4::inverseAffine(m_View);
+	// r[EvWFNVs (QƂŕԂ߃oɕێ)
+	m_ViewProj = m_View * m_Proj;
 
 	// JǑvZ
 	m_Forward = Vector3D(m_ViewInv.m_mat[2][0], m_ViewInv.m_mat[2][1], m_ViewInv.m_mat[2][2]);
@@ -190,7 +192,7 @@ const Matrix4x4& Camera::GetViewProj()
 	if (m_IsDirty)
 		Update();
 
-	return m_View * m_Proj;
+	return m_ViewProj;
 }
 
 const Matrix4x4& Camera::GetViewInv()
@@ -0,0 +1,273 @@
+#include "Graphics/GeometryArena.h"
+#include "Graphics/DX12Utilities.h"
+#include "Framework/Renderer.h"
+#include "Utilities/Parallel.h"
+
+#include <unordered_map>
+
+namespace GeometryArenaInternal
+{
+	//! Abv[hobt@ł̊ë̔zuE (oCg)
+	constexpr uint64_t UploadAlignment = 16;
+
+	constexpr uint64_t AlignUp(uint64_t value, uint64_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+}
+using namespace GeometryArenaInternal;
+
+GeometryArena::GeometryArena(Renderer* pRenderer)
+	: m_pRenderer(pRenderer)
+{
+	const uint64_t capacities[] = { InitialVertexCapacity, InitialIndexCapacity };
+	for (size_t i = 0; i < static_cast<size_t>(BufferType::Count); ++i)
+	{
+		m_Arenas[i].pBuffer = CreateBuffer(capacities[i], D3D12_HEAP_TYPE_DEFAULT);
+		m_Arenas[i].Allocator.Reset(capacities[i]);
+	}
+}
+
+GeometryArena::~GeometryArena()
+{
+}
+
+GeometryArena::Handle GeometryArena::Allocate(BufferType type, uint64_t size, uint64_t stride)
+{
+	if (size == 0)
+	{
+		return InvalidHandle;
+	}
+
+	auto& allocator = m_Arenas[static_cast<size_t>(type)].Allocator;
+	uint64_t offset = allocator.Allocate(size, stride);
+	if (offset == OffsetAllocator::InvalidOffset && allocator.GetFreeSize() >= size + stride)
+	{
+		// 󂫂̍v͑Ă̂ŁAlߒĖɂ܂Ƃ߂
+		Relocate(type, allocator.GetCapacity());
+		offset = allocator.Allocate(size, stride);
+	}
+	if (offset == OffsetAllocator::InvalidOffset)
+	{
+		// ȂΑ傫obt@ֈڂ
+		const uint64_t capacity = (std::max)(allocator.GetCapacity() * 2, allocator.GetUsedSize() + (size + stride) * 2);
+		Relocate(type, capacity);
+		offset = allocator.Allocate(size, stride);
+	}
+	if (offset == OffsetAllocator::InvalidOffset)
+	{
+		assert(false && "WIgobt@̊mۂɎs܂");
+		return InvalidHandle;
+	}
+
+	Handle handle;
+	if (!m_FreeHandles.empty())
+	{
+		handle = m_FreeHandles.back();
+		m_FreeHandles.pop_back();
+	}
+	else
+	{
+		handle = static_cast<Handle>(m_Blocks.size());
+		m_Blocks.emplace_back();
+	}
+	m_Blocks[handle] = { offset, size, type, true };
+	return handle;
+}
+
+void GeometryArena::Free(Handle handle)
+{
+	if (handle == InvalidHandle)
+	{
+		return;
+	}
+	auto& block = m_Blocks[handle];
+	assert(block.IsUsed);
+	m_Arenas[static_cast<size_t>(block.Type)].Allocator.Free(block.Offset);
+	block.IsUsed = false;
+	m_FreeHandles.push_back(handle);
+}
+
+void GeometryArena::Upload(const std::vector<Handle>& handles, const std::function<void(size_t, uint8_t*)>& write)
+{
+	// Abv[hobt@̔zu
+	std::vector<uint64_t> uploadOffsets(handles.size());
+	uint64_t uploadSize = 0;
+	for (size_t i = 0; i < handles.size(); ++i)
+	{
+		uploadOffsets[i] = uploadSize;
+		uploadSize = AlignUp(uploadSize + GetSize(handles[i]), UploadAlignment);
+	}
+	if (uploadSize == 0)
+	{
+		return;
+	}
+
+	// ꎞ\[XȂ̂Ŋ֐I (ExecuteCopy Ŋ҂) ɔj
+	auto pUploadBuffer = CreateBuffer(uploadSize, D3D12_HEAP_TYPE_UPLOAD);
+	uint8_t* pMapped = nullptr;
+	auto hr = pUploadBuffer->Map(0, nullptr, reinterpret_cast<void**>(&pMapped));
+	DX12MSGThrowIfFailed(hr, "Abv[hobt@̃}bsOɎs܂");
+	Parallel::ForEach(handles.size(), [&](size_t i)
+		{
+			if (handles[i] != InvalidHandle)
+			{
+				write(i, pMapped + uploadOffsets[i]);
+			}
+		});
+	pUploadBuffer->Unmap(0, nullptr);
+
+	// obt@ COMMON  COPY_DESTE_/CfbNXobt@ֈÖقɏiA
+	// R}hXg̎sI COMMON ɖ߂̂ŁAoA͕sv
+	ExecuteCopy([&](ID3D12GraphicsCommandList* pCommandList)
+		{
+			for (size_t i = 0; i < handles.size(); ++i)
+			{
+				if (handles[i] == InvalidHandle)
+				{
+					continue;
+				}
+				const auto& block = m_Blocks[handles[i]];
+				pCommandList->CopyBufferRegion(m_Arenas[static_cast<size_t>(block.Type)].pBuffer.Get(), block.Offset,
+					pUploadBuffer.Get(), uploadOffsets[i], block.Size);
+			}
+		});
+}
+
+void GeometryArena::Defragment()
+{
+	for (size_t i = 0; i < static_cast<size_t>(BufferType::Count); ++i)
+	{
+		const auto& allocator = m_Arenas[i].Allocator;
+		if (allocator.GetFreeBlockCount() > 1)
+		{
+			Relocate(static_cast<BufferType>(i), allocator.GetCapacity());
+		}
+	}
+}
+
+D3D12_VERTEX_BUFFER_VIEW GeometryArena::GetVBV(uint32_t stride) const
+{
+	const auto& arena = m_Arenas[static_cast<size_t>(BufferType::Vertex)];
+	D3D12_VERTEX_BUFFER_VIEW vbv = {};
+	vbv.BufferLocation = arena.pBuffer->GetGPUVirtualAddress();
+	vbv.SizeInBytes = static_cast<UINT>(arena.Allocator.GetCapacity());
+	vbv.StrideInBytes = stride;
+	return vbv;
+}
+
+D3D12_INDEX_BUFFER_VIEW GeometryArena::GetIBV(DXGI_FORMAT format) const
+{
+	const auto& arena = m_Arenas[static_cast<size_t>(BufferType::Index)];
+	D3D12_INDEX_BUFFER_VIEW ibv = {};
+	ibv.BufferLocation = arena.pBuffer->GetGPUVirtualAddress();
+	ibv.SizeInBytes = static_cast<UINT>(arena.Allocator.GetCapacity());
+	ibv.Format = format;
+	return ibv;
+}
+
+GeometryArena::Stats GeometryArena::GetStats(BufferType type) const
+{
+	const auto& allocator = m_Arenas[static_cast<size_t>(type)].Allocator;
+	Stats stats;
+	stats.Capacity = allocator.GetCapacity();
+	stats.UsedSize = allocator.GetUsedSize();
+	stats.AllocationCount = allocator.GetAllocationCount();
+	stats.Fragmentation = allocator.GetFragmentation();
+	return stats;
+}
+
+ComPtr<ID3D12Resource> GeometryArena::CreateBuffer(uint64_t size, D3D12_HEAP_TYPE heapType)
+{
+	// q[vvpeB
+	D3D12_HEAP_PROPERTIES prop = {};
+	prop.Type = heapType;
+	prop.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+	prop.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+	prop.CreationNodeMask = 1;
+	prop.VisibleNodeMask = 1;
+
+	// \[X̐ݒ
+	D3D12_RESOURCE_DESC desc = {};
+	desc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+	desc.Alignment = 0;
+	desc.Width = size;
+	desc.Height = 1;
+	desc.DepthOrArraySize = 1;
+	desc.MipLevels = 1;
+	desc.Format = DXGI_FORMAT_UNKNOWN;
+	desc.SampleDesc.Count = 1;
+	desc.SampleDesc.Quality = 0;
+	desc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+	desc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+	ComPtr<ID3D12Resource> pBuffer;
+	auto hr = m_pRenderer->GetDevice()->CreateCommittedResource(
+		&prop,
+		D3D12_HEAP_FLAG_NONE,
+		&desc,
+		heapType == D3D12_HEAP_TYPE_UPLOAD ? D3D12_RESOURCE_STATE_GENERIC_READ : D3D12_RESOURCE_STATE_COMMON,
+		nullptr,
+		IID_PPV_ARGS(pBuffer.GetAddressOf())
+	);
+	DX12MSGThrowIfFailed(hr, "WIgobt@̐Ɏs܂");
+	return pBuffer;
+}
+
+void GeometryArena::Relocate(BufferType type, uint64_t newCapacity)
+{
+	auto& arena = m_Arenas[static_cast<size_t>(type)];
+
+	// lߒ̈ʒu (Ȃ̈Vobt@փRs[)
+	std::unordered_map<uint64_t, uint64_t> newOffsets;
+	for (const auto& move : arena.Allocator.Defragment())
+	{
+		newOffsets[move.SrcOffset] = move.DstOffset;
+	}
+	arena.Allocator.Grow(newCapacity);
+
+	auto pNewBuffer = CreateBuffer(arena.Allocator.GetCapacity(), D3D12_HEAP_TYPE_DEFAULT);
+	ExecuteCopy([&](ID3D12GraphicsCommandList* pCommandList)
+		{
+			for (auto& block : m_Blocks)
+			{
+				if (!block.IsUsed || block.Type != type)
+				{
+					continue;
+				}
+				auto it = newOffsets.find(block.Offset);
+				const uint64_t newOffset = it != newOffsets.end() ? it->second : block.Offset;
+				pCommandList->CopyBufferRegion(pNewBuffer.Get(), newOffset, arena.pBuffer.Get(), block.Offset, block.Size);
+				block.Offset = newOffset;
+			}
+		});
+
+	// Rs[̊҂Ă̂ŁAÂobt@͂Ŕjł
+	arena.pBuffer = pNewBuffer;
+	++m_RelocationCount;
+}
+
+void GeometryArena::ExecuteCopy(const std::function<void(ID3D12GraphicsCommandList*)>& record)
+{
+	auto pDevice = m_pRenderer->GetDevice();
+	ComPtr<ID3D12CommandAllocator> tempAllocator;
+	ComPtr<ID3D12GraphicsCommandList> tempCommandList;
+
+	auto hr = pDevice->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(tempAllocator.GetAddressOf()));
+	ThrowFailed(hr);
+
+	// CreateCommandList Open ԂȂ̂ Reset sv
+	hr = pDevice->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, tempAllocator.Get(), nullptr, IID_PPV_ARGS(tempCommandList.GetAddressOf()));
+	ThrowFailed(hr);
+
+	record(tempCommandList.Get());
+	tempCommandList->Close();
+
+	// s (L[Renderer̂̂gp)
+	auto pCommands = m_pRenderer->GetCommands(D3D12_COMMAND_LIST_TYPE_DIRECT);
+	ID3D12CommandList* ppCommandLists[] = { tempCommandList.Get() };
+	pCommands->GetCommandQueue()->ExecuteCommandLists(1, ppCommandLists);
+
+	// ]܂őҋ@
+	pCommands->WaitGpu(INFINITE);
+}
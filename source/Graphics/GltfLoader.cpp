@@ -0,0 +1,975 @@
+#include "Graphics/GltfLoader.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Quaternion.h"
+#include "Math/TransformBatch.h"
+#include "Utilities/Json.h"
+#include "Utilities/MappedFile.h"
+#include "Utilities/Parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+
+namespace GltfLoaderInternal
+{
+	constexpr uint32_t GLBMagic = 0x46546C67;     // "glTF"
+	constexpr uint32_t GLBChunkJSON = 0x4E4F534A; // "JSON"
+	constexpr uint32_t GLBChunkBIN = 0x004E4942;  // "BIN\0"
+	constexpr size_t GLBHeaderSize = 12;
+	constexpr size_t GLBChunkHeaderSize = 8;
+
+	// ANZT componentType
+	constexpr uint32_t ComponentByte = 5120;
+	constexpr uint32_t ComponentUnsignedByte = 5121;
+	constexpr uint32_t ComponentShort = 5122;
+	constexpr uint32_t ComponentUnsignedShort = 5123;
+	constexpr uint32_t ComponentUnsignedInt = 5125;
+	constexpr uint32_t ComponentFloat = 5126;
+
+	// v~eBu mode
+	constexpr int64_t ModeTriangles = 4;
+	constexpr int64_t ModeTriangleStrip = 5;
+	constexpr int64_t ModeTriangleFan = 6;
+
+	//! m[hKw̐[̏ (zQƂꂽt@C΍)
+	constexpr uint32_t MaxNodeDepth = 256;
+
+	//! ǂݍ݂ɑΉĂK{g (_̐^͐K݂œǂ߂邽)
+	const char* const SupportedRequiredExtensions[] = { "KHR_mesh_quantization" };
+
+	struct BufferRange
+	{
+		const uint8_t* pData = nullptr;
+		size_t Size = 0;
+	};
+
+	/// <summary>
+	/// ǂݍݒ̃t@C (JSON ƃobt@̎̂ێ܂)
+	/// </summary>
+	struct Document
+	{
+		JsonValue Root;
+		std::filesystem::path BaseDir;
+		std::vector<std::unique_ptr<MappedFile>> Files;    //!< }bv .glb / .bin
+		std::vector<std::vector<uint8_t>> DecodedBuffers;  //!< data URI fR[hobt@
+		std::vector<BufferRange> Buffers;                  //!< buffers[] ̏
+	};
+
+	/// <summary>
+	/// obt@̃ANZT̔zu (vf i  pData + i * Stride n܂܂)
+	/// </summary>
+	struct Accessor
+	{
+		const uint8_t* pData = nullptr;
+		size_t Count = 0;
+		size_t Stride = 0;
+		uint32_t ComponentType = 0;
+		uint32_t ComponentCount = 0;
+		bool Normalized = false;
+	};
+
+	/// <summary>
+	/// V[HČv~eBu (bV𕡐̃m[hQƂĂΕʁXɍ܂)
+	/// </summary>
+	struct PrimitiveInstance
+	{
+		const JsonValue* pPrimitive = nullptr;
+		const JsonValue* pMesh = nullptr;
+		Matrix4x4 World;
+	};
+
+	bool SetError(std::string* pError, const std::string& message)
+	{
+		if (pError != nullptr)
+		{
+			*pError = message;
+		}
+		return false;
+	}
+
+	uint32_t GetComponentSize(uint32_t componentType)
+	{
+		switch (componentType)
+		{
+		case ComponentByte:
+		case ComponentUnsignedByte: return 1;
+		case ComponentShort:
+		case ComponentUnsignedShort: return 2;
+		case ComponentUnsignedInt:
+		case ComponentFloat: return 4;
+		default: return 0;
+		}
+	}
+
+	uint32_t GetComponentCount(const std::string& type)
+	{
+		if (type == "SCALAR") return 1;
+		if (type == "VEC2") return 2;
+		if (type == "VEC3") return 3;
+		if (type == "VEC4") return 4;
+		if (type == "MAT2") return 4;
+		if (type == "MAT3") return 9;
+		if (type == "MAT4") return 16;
+		return 0;
+	}
+
+	//! @brief vf1 float Ƃēǂݎ܂ (K glTF ̋K -1`1 / 0`1 ɕϊ)
+	float ReadComponent(const uint8_t* pSrc, uint32_t componentType, bool normalized)
+	{
+		switch (componentType)
+		{
+		case ComponentFloat:
+		{
+			float value;
+			std::memcpy(&value, pSrc, sizeof(float));
+			return value;
+		}
+		case ComponentUnsignedByte:
+			return normalized ? pSrc[0] / 255.0f : static_cast<float>(pSrc[0]);
+		case ComponentByte:
+		{
+			const float value = static_cast<float>(static_cast<int8_t>(pSrc[0]));
+			return normalized ? (std::max)(value / 127.0f, -1.0f) : value;
+		}
+		case ComponentUnsignedShort:
+		{
+			uint16_t value;
+			std::memcpy(&value, pSrc, sizeof(uint16_t));
+			return normalized ? value / 65535.0f : static_cast<float>(value);
+		}
+		case ComponentShort:
+		{
+			int16_t value;
+			std::memcpy(&value, pSrc, sizeof(int16_t));
+			return normalized ? (std::max)(value / 32767.0f, -1.0f) : static_cast<float>(value);
+		}
+		case ComponentUnsignedInt:
+		{
+			uint32_t value;
+			std::memcpy(&value, pSrc, sizeof(uint32_t));
+			return static_cast<float>(value);
+		}
+		default:
+			return 0.0f;
+		}
+	}
+
+	bool DecodeBase64(const char* pSrc, size_t size, std::vector<uint8_t>& out)
+	{
+		auto decodeChar = [](char c) -> int
+			{
+				if (c >= 'A' && c <= 'Z') return c - 'A';
+				if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+				if (c >= '0' && c <= '9') return c - '0' + 52;
+				if (c == '+' || c == '-') return 62;
+				if (c == '/' || c == '_') return 63;
+				return -1;
+			};
+
+		out.resize(size / 4 * 3 + 3);
+		size_t outSize = 0;
+		uint32_t bits = 0;
+		int bitCount = 0;
+		for (size_t i = 0; i < size; ++i)
+		{
+			if (pSrc[i] == '=') break;
+			const int value = decodeChar(pSrc[i]);
+			if (value < 0) return false;
+			bits = (bits << 6) | static_cast<uint32_t>(value);
+			bitCount += 6;
+			if (bitCount >= 8)
+			{
+				bitCount -= 8;
+				out[outSize++] = static_cast<uint8_t>((bits >> bitCount) & 0xFF);
+			}
+		}
+		out.resize(outSize);
+		return true;
+	}
+
+	//! @brief URI  %XX fR[h܂
+	std::string DecodeUri(const std::string& uri)
+	{
+		auto hexValue = [](char c) -> int
+			{
+				if (c >= '0' && c <= '9') return c - '0';
+				if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+				if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+				return -1;
+			};
+
+		std::string decoded;
+		decoded.reserve(uri.size());
+		for (size_t i = 0; i < uri.size(); ++i)
+		{
+			if (uri[i] == '%' && i + 2 < uri.size())
+			{
+				const int high = hexValue(uri[i + 1]);
+				const int low = hexValue(uri[i + 2]);
+				if (high >= 0 && low >= 0)
+				{
+					decoded += static_cast<char>(high * 16 + low);
+					i += 2;
+					continue;
+				}
+			}
+			decoded += uri[i];
+		}
+		return decoded;
+	}
+
+	bool IsDataUri(const std::string& uri)
+	{
+		return uri.compare(0, 5, "data:") == 0;
+	}
+
+	/// <summary>
+	/// buffers[] ܂ (.bin ̓}bvAdata URI ̓fR[hAURI Ȃ GLB  BIN `N)
+	/// </summary>
+	bool LoadBuffers(Document& doc, const BufferRange& glbBinChunk, std::string* pError)
+	{
+		const auto& buffers = doc.Root["buffers"];
+		doc.Buffers.resize(buffers.Size());
+		doc.DecodedBuffers.reserve(buffers.Size());
+		for (size_t i = 0; i < buffers.Size(); ++i)
+		{
+			const auto& buffer = buffers[i];
+			const auto byteLength = buffer["byteLength"].GetIndex();
+			if (byteLength < 0)
+			{
+				return SetError(pError, "buffer  byteLength sł");
+			}
+
+			BufferRange range;
+			const auto* pUri = buffer.Find("uri");
+			if (pUri == nullptr)
+			{
+				if (i != 0 || glbBinChunk.pData == nullptr)
+				{
+					return SetError(pError, "uri ̂Ȃ buffer  GLB ̐擪obt@ɂg܂");
+				}
+				range = glbBinChunk;
+			}
+			else if (IsDataUri(pUri->GetString()))
+			{
+				const auto& uri = pUri->GetString();
+				const auto comma = uri.find(',');
+				if (comma == std::string::npos || uri.rfind(";base64", comma) == std::string::npos)
+				{
+					return SetError(pError, "base64 ȊO data URI ɂ͑ΉĂ܂");
+				}
+				doc.DecodedBuffers.emplace_back();
+				auto& decoded = doc.DecodedBuffers.back();
+				if (!DecodeBase64(uri.data() + comma + 1, uri.size() - comma - 1, decoded))
+				{
+					return SetError(pError, "data URI ̃fR[hɎs܂");
+				}
+				range.pData = decoded.data();
+				range.Size = decoded.size();
+			}
+			else
+			{
+				const auto path = doc.BaseDir / std::filesystem::u8path(DecodeUri(pUri->GetString()));
+				auto pFile = std::make_unique<MappedFile>();
+				if (!pFile->Open(path.wstring()))
+				{
+					return SetError(pError, "buffer t@CJ܂: " + pUri->GetString());
+				}
+				range.pData = pFile->GetData();
+				range.Size = pFile->GetSize();
+				doc.Files.push_back(std::move(pFile));
+			}
+
+			if (range.Size < static_cast<size_t>(byteLength))
+			{
+				return SetError(pError, "buffer  byteLength Zł");
+			}
+			range.Size = static_cast<size_t>(byteLength);
+			doc.Buffers[i] = range;
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// ANZTobt@̂ǂw߁A͈͊Oǂ܂Ȃ؂܂
+	/// </summary>
+	bool GetAccessor(const Document& doc, int64_t index, Accessor& out, std::string* pError)
+	{
+		const auto& accessors = doc.Root["accessors"];
+		if (index < 0 || static_cast<size_t>(index) >= accessors.Size())
+		{
+			return SetError(pError, "accessor ̔ԍ͈͊Oł");
+		}
+		const auto& accessor = accessors[static_cast<size_t>(index)];
+		if (accessor.Find("sparse") != nullptr)
+		{
+			return SetError(pError, "sparse accessor ɂ͑ΉĂ܂");
+		}
+
+		out.ComponentType = static_cast<uint32_t>(accessor["componentType"].GetIndex(0));
+		out.ComponentCount = GetComponentCount(accessor["type"].GetString());
+		out.Normalized = accessor["normalized"].GetBool();
+		const auto count = accessor["count"].GetIndex();
+		const uint32_t componentSize = GetComponentSize(out.ComponentType);
+		if (componentSize == 0 || out.ComponentCount == 0 || count < 0)
+		{
+			return SetError(pError, "accessor ̌^sł");
+		}
+		out.Count = static_cast<size_t>(count);
+		const size_t elementSize = static_cast<size_t>(componentSize) * out.ComponentCount;
+
+		const auto viewIndex = accessor["bufferView"].GetIndex();
+		const auto& bufferViews = doc.Root["bufferViews"];
+		if (viewIndex < 0 || static_cast<size_t>(viewIndex) >= bufferViews.Size())
+		{
+			return SetError(pError, "bufferView ̂Ȃ accessor ɂ͑ΉĂ܂");
+		}
+		const auto& view = bufferViews[static_cast<size_t>(viewIndex)];
+		const auto bufferIndex = view["buffer"].GetIndex();
+		if (bufferIndex < 0 || static_cast<size_t>(bufferIndex) >= doc.Buffers.size())
+		{
+			return SetError(pError, "bufferView  buffer ͈͊Oł");
+		}
+		const auto& buffer = doc.Buffers[static_cast<size_t>(bufferIndex)];
+		const auto viewOffset = view["byteOffset"].GetIndex(0);
+		const auto viewLength = view["byteLength"].GetIndex();
+		const auto byteStride = view["byteStride"].GetIndex(0);
+		const auto accessorOffset = accessor["byteOffset"].GetIndex(0);
+		if (viewOffset < 0 || viewLength < 0 || byteStride < 0 || accessorOffset < 0 ||
+			static_cast<uint64_t>(viewOffset) + static_cast<uint64_t>(viewLength) > buffer.Size)
+		{
+			return SetError(pError, "bufferView  buffer ͈̔͊Oł");
+		}
+
+		out.Stride = byteStride > 0 ? static_cast<size_t>(byteStride) : elementSize;
+		if (out.Count > 0)
+		{
+			const uint64_t lastByte = static_cast<uint64_t>(accessorOffset) +
+				static_cast<uint64_t>(out.Stride) * (out.Count - 1) + elementSize;
+			if (lastByte > static_cast<uint64_t>(viewLength))
+			{
+				return SetError(pError, "accessor  bufferView ͈̔͊Oł");
+			}
+		}
+		out.pData = buffer.pData + viewOffset + accessorOffset;
+		return true;
+	}
+
+	/// <summary>
+	/// float ̒_ Vertex ̃o[֒ڏ݂܂
+	/// float ^͂̂܂܃Rs[A^ (KHR_mesh_quantization) ͗vfɕϊ܂
+	/// </summary>
+	template<typename T>
+	void ReadAttribute(const Accessor& accessor, std::vector<Vertex>& vertices, T Vertex::* pMember, uint32_t componentCount)
+	{
+		const uint32_t readCount = (std::min)(componentCount, accessor.ComponentCount);
+		const size_t count = (std::min)(accessor.Count, vertices.size());
+		if (accessor.ComponentType == ComponentFloat)
+		{
+			const size_t copySize = readCount * sizeof(float);
+			const uint8_t* pSrc = accessor.pData;
+			for (size_t i = 0; i < count; ++i, pSrc += accessor.Stride)
+			{
+				std::memcpy(&(vertices[i].*pMember).x, pSrc, copySize);
+			}
+			return;
+		}
+
+		const uint32_t componentSize = GetComponentSize(accessor.ComponentType);
+		for (size_t i = 0; i < count; ++i)
+		{
+			const uint8_t* pSrc = accessor.pData + i * accessor.Stride;
+			float* pDst = &(vertices[i].*pMember).x;
+			for (uint32_t c = 0; c < readCount; ++c)
+			{
+				pDst[c] = ReadComponent(pSrc + c * componentSize, accessor.ComponentType, accessor.Normalized);
+			}
+		}
+	}
+
+	bool ReadIndices(const Accessor& accessor, std::vector<uint32_t>& indices, std::string* pError)
+	{
+		if (accessor.ComponentCount != 1)
+		{
+			return SetError(pError, "CfbNX accessor  SCALAR ł͂܂");
+		}
+		indices.resize(accessor.Count);
+		const uint8_t* pSrc = accessor.pData;
+		switch (accessor.ComponentType)
+		{
+		case ComponentUnsignedByte:
+			for (size_t i = 0; i < accessor.Count; ++i, pSrc += accessor.Stride)
+			{
+				indices[i] = pSrc[0];
+			}
+			return true;
+		case ComponentUnsignedShort:
+			for (size_t i = 0; i < accessor.Count; ++i, pSrc += accessor.Stride)
+			{
+				uint16_t index;
+				std::memcpy(&index, pSrc, sizeof(uint16_t));
+				indices[i] = index;
+			}
+			return true;
+		case ComponentUnsignedInt:
+			if (accessor.Stride == sizeof(uint32_t))
+			{
+				std::memcpy(indices.data(), pSrc, accessor.Count * sizeof(uint32_t));
+				return true;
+			}
+			for (size_t i = 0; i < accessor.Count; ++i, pSrc += accessor.Stride)
+			{
+				std::memcpy(&indices[i], pSrc, sizeof(uint32_t));
+			}
+			return true;
+		default:
+			return SetError(pError, "CfbNX componentType sł");
+		}
+	}
+
+	//! @brief XgbvEt@Op`Xgɕϊ܂
+	void Triangulate(int64_t mode, std::vector<uint32_t>& indices)
+	{
+		if (mode == ModeTriangles || indices.size() < 3)
+		{
+			indices.resize(indices.size() / 3 * 3);
+			return;
+		}
+
+		std::vector<uint32_t> triangles;
+		triangles.reserve((indices.size() - 2) * 3);
+		for (size_t i = 0; i + 2 < indices.size(); ++i)
+		{
+			if (mode == ModeTriangleStrip)
+			{
+				// Ԗڂ̎Op`𑵂͌邽߂ɓւ
+				const bool isOdd = (i & 1) != 0;
+				triangles.push_back(indices[isOdd ? i + 1 : i]);
+				triangles.push_back(indices[isOdd ? i : i + 1]);
+				triangles.push_back(indices[i + 2]);
+			}
+			else
+			{
+				triangles.push_back(indices[0]);
+				triangles.push_back(indices[i + 1]);
+				triangles.push_back(indices[i + 2]);
+			}
+		}
+		indices.swap(triangles);
+	}
+
+	//! @brief ʐςŏdݕtX[Y@𐶐܂ (aiProcess_GenSmoothNormals )
+	void GenerateNormals(std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
+	{
+		for (auto& vertex : vertices)
+		{
+			vertex.m_Normal = Vector3D();
+		}
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			auto& v0 = vertices[indices[i + 0]];
+			auto& v1 = vertices[indices[i + 1]];
+			auto& v2 = vertices[indices[i + 2]];
+			// Oς͖̒ʐς2{Ȃ̂ŁAKɑΖʐς̏d݂ɂȂ
+			const Vector3D faceNormal = (v1.m_Position - v0.m_Position).cross(v2.m_Position - v0.m_Position);
+			v0.m_Normal += faceNormal;
+			v1.m_Normal += faceNormal;
+			v2.m_Normal += faceNormal;
+		}
+		for (auto& vertex : vertices)
+		{
+			vertex.m_Normal = vertex.m_Normal.GetSafeNormal();
+		}
+	}
+
+	//! @brief UV ڐ𐶐܂ (aiProcess_CalcTangentSpace A@ɒ܂)
+	void GenerateTangents(std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
+	{
+		for (auto& vertex : vertices)
+		{
+			vertex.m_Tangent = Vector3D();
+		}
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			auto& v0 = vertices[indices[i + 0]];
+			auto& v1 = vertices[indices[i + 1]];
+			auto& v2 = vertices[indices[i + 2]];
+			const Vector3D edge1 = v1.m_Position - v0.m_Position;
+			const Vector3D edge2 = v2.m_Position - v0.m_Position;
+			const float du1 = v1.m_TexCoord.x - v0.m_TexCoord.x;
+			const float dv1 = v1.m_TexCoord.y - v0.m_TexCoord.y;
+			const float du2 = v2.m_TexCoord.x - v0.m_TexCoord.x;
+			const float dv2 = v2.m_TexCoord.y - v0.m_TexCoord.y;
+			const float det = du1 * dv2 - du2 * dv1;
+			if (std::fabs(det) <= SMALL_NUMBER)
+			{
+				continue;
+			}
+			const Vector3D tangent = (edge1 * dv2 - edge2 * dv1) * (1.0f / det);
+			v0.m_Tangent += tangent;
+			v1.m_Tangent += tangent;
+			v2.m_Tangent += tangent;
+		}
+		for (auto& vertex : vertices)
+		{
+			const Vector3D& normal = vertex.m_Normal;
+			vertex.m_Tangent = (vertex.m_Tangent - normal * normal.dot(vertex.m_Tangent)).GetSafeNormal();
+		}
+	}
+
+	//! @brief lz̗vf float Ŏ擾܂
+	float GetFloat(const JsonValue& array, size_t index)
+	{
+		return static_cast<float>(array[index].GetNumber());
+	}
+
+	bool IsIdentity(const Matrix4x4& mat)
+	{
+		for (int row = 0; row < 4; ++row)
+		{
+			for (int col = 0; col < 4; ++col)
+			{
+				if (mat.m_mat[row][col] != (row == col ? 1.0f : 0.0f)) return false;
+			}
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// m[hϊ𒸓_ɓKpAn֕ϊ܂ (aiProcess_PreTransformVertices | aiProcess_MakeLeftHanded )
+	/// sxNgK (v * M) ŁA@͋t]usAڐ 3x3 ŕϊĐK܂
+	/// Z ̔]͍s Z Ɋ܂߁AʒuE@Eڐꂼ TransformBatch ł܂Ƃ߂ĕϊ܂
+	/// </summary>
+	void TransformVertices(std::vector<Vertex>& vertices, const Matrix4x4& world)
+	{
+		if (IsIdentity(world))
+		{
+			for (auto& vertex : vertices)
+			{
+				vertex.m_Position.z = -vertex.m_Position.z;
+				vertex.m_Normal.z = -vertex.m_Normal.z;
+				vertex.m_Tangent.z = -vertex.m_Tangent.z;
+			}
+			return;
+		}
+
+		// ̔]͊ۂ߂ɉeȂ̂ŁAZ 𔽓]sŕϊĂϊɔ]ʂƈv (0 ݈̂̕قȂ蓾)
+		Matrix4x4 position = world;
+		Matrix4x4 normal = Matrix4x4::transpose(Matrix4x4::inverse(world));
+		for (int row = 0; row < 4; ++row)
+		{
+			position.m_mat[row][2] = -position.m_mat[row][2];
+			normal.m_mat[row][2] = -normal.m_mat[row][2];
+		}
+
+		const size_t count = vertices.size();
+		std::vector<Vector3D> positions(count);
+		std::vector<Vector3D> normals(count);
+		std::vector<Vector3D> tangents(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			positions[i] = vertices[i].m_Position;
+			normals[i] = vertices[i].m_Normal;
+			tangents[i] = vertices[i].m_Tangent;
+		}
+		TransformBatch::TransformPoints(position, positions.data(), positions.data(), count);
+		TransformBatch::TransformDirections(normal, normals.data(), normals.data(), count);
+		TransformBatch::TransformDirections(position, tangents.data(), tangents.data(), count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			vertices[i].m_Position = positions[i];
+			vertices[i].m_Normal = normals[i].GetSafeNormal();
+			vertices[i].m_Tangent = tangents[i].GetSafeNormal();
+		}
+	}
+
+	//! @brief m[h̃[Js (matrix ΂AȂ TRS )
+	Matrix4x4 GetLocalMatrix(const JsonValue& node)
+	{
+		const auto& matrix = node["matrix"];
+		if (matrix.Size() == 16)
+		{
+			// glTF ͗xNgEDȂ̂ŁÂ܂ܕׂƍsxNgK̍sɂȂ
+			Matrix4x4 mat;
+			for (size_t i = 0; i < 16; ++i)
+			{
+				mat.m_mat[i / 4][i % 4] = GetFloat(matrix, i);
+			}
+			return mat;
+		}
+
+		const auto& t = node["translation"];
+		const auto& r = node["rotation"];
+		const auto& s = node["scale"];
+		const Vector3D translation = t.Size() == 3
+			? Vector3D(GetFloat(t, 0), GetFloat(t, 1), GetFloat(t, 2))
+			: Vector3D();
+		const Quaternion rotation = r.Size() == 4
+			? Quaternion(GetFloat(r, 0), GetFloat(r, 1),
+				GetFloat(r, 2), GetFloat(r, 3))
+			: Quaternion(0.0f, 0.0f, 0.0f, 1.0f);
+		const Vector3D scale = s.Size() == 3
+			? Vector3D(GetFloat(s, 0), GetFloat(s, 1), GetFloat(s, 2))
+			: Vector3D(1.0f, 1.0f, 1.0f);
+		return Matrix4x4::Compose(scale, rotation, translation);
+	}
+
+	void CollectPrimitives(const Document& doc, int64_t nodeIndex, const Matrix4x4& parentWorld,
+		uint32_t depth, std::vector<PrimitiveInstance>& outInstances)
+	{
+		const auto& nodes = doc.Root["nodes"];
+		if (depth > MaxNodeDepth || nodeIndex < 0 || static_cast<size_t>(nodeIndex) >= nodes.Size())
+		{
+			return;
+		}
+		const auto& node = nodes[static_cast<size_t>(nodeIndex)];
+		// sxNgKȂ̂ q̃[J * ẽ[h
+		const Matrix4x4 world = GetLocalMatrix(node) * parentWorld;
+
+		const auto meshIndex = node["mesh"].GetIndex();
+		const auto& meshes = doc.Root["meshes"];
+		if (meshIndex >= 0 && static_cast<size_t>(meshIndex) < meshes.Size())
+		{
+			const auto& mesh = meshes[static_cast<size_t>(meshIndex)];
+			const auto& primitives = mesh["primitives"];
+			for (size_t i = 0; i < primitives.Size(); ++i)
+			{
+				PrimitiveInstance instance;
+				instance.pPrimitive = &primitives[i];
+				instance.pMesh = &mesh;
+				instance.World = world;
+				outInstances.push_back(instance);
+			}
+		}
+
+		const auto& children = node["children"];
+		for (size_t i = 0; i < children.Size(); ++i)
+		{
+			CollectPrimitives(doc, children[i].GetIndex(), world, depth + 1, outInstances);
+		}
+	}
+
+	/// <summary>
+	/// textureInfo 摜t@C̃pX擾܂ (ߍ݉摜͖ΉȂ̂ŋ)
+	/// </summary>
+	std::string GetImagePath(const Document& doc, const JsonValue& textureInfo)
+	{
+		const auto textureIndex = textureInfo["index"].GetIndex();
+		if (textureIndex < 0) return std::string();
+		const auto imageIndex = doc.Root["textures"][static_cast<size_t>(textureIndex)]["source"].GetIndex();
+		if (imageIndex < 0) return std::string();
+		const auto& uri = doc.Root["images"][static_cast<size_t>(imageIndex)]["uri"].GetString();
+		if (uri.empty() || IsDataUri(uri)) return std::string();
+		return DecodeUri(uri);
+	}
+
+	void ParseMaterial(const Document& doc, const JsonValue& srcMat, MaterialData& dstMat)
+	{
+		const auto& pbr = srcMat["pbrMetallicRoughness"];
+		const auto& baseColor = pbr["baseColorFactor"];
+		if (baseColor.Size() == 4)
+		{
+			dstMat.Diffuse = Vector3D(GetFloat(baseColor, 0),
+				GetFloat(baseColor, 1), GetFloat(baseColor, 2));
+		}
+		else
+		{
+			dstMat.Diffuse = Vector3D(1.0f, 1.0f, 1.0f);
+		}
+		dstMat.DiffuseTexPath = GetImagePath(doc, pbr["baseColorTexture"]);
+		dstMat.NormalTexPath = GetImagePath(doc, srcMat["normalTexture"]);
+		dstMat.GLTFMetaricRoughnessTexPath = GetImagePath(doc, pbr["metallicRoughnessTexture"]);
+	}
+
+	/// <summary>
+	/// v~eBu MeshData ɕϊ܂
+	/// Op`ȊÕv~eBu (_E) ͋̂܂ܕԂ܂
+	/// </summary>
+	bool ConvertPrimitive(const Document& doc, const PrimitiveInstance& instance,
+		uint32_t defaultMaterialIndex, MeshData& dstMesh, std::string* pError)
+	{
+		const auto& primitive = *instance.pPrimitive;
+		const auto mode = primitive["mode"].GetIndex(ModeTriangles);
+		if (mode != ModeTriangles && mode != ModeTriangleStrip && mode != ModeTriangleFan)
+		{
+			return true;
+		}
+
+		dstMesh.Name = (*instance.pMesh)["name"].GetString();
+		const auto materialIndex = primitive["material"].GetIndex();
+		dstMesh.MaterialIndex = (materialIndex >= 0 && static_cast<size_t>(materialIndex) < doc.Root["materials"].Size())
+			? static_cast<uint32_t>(materialIndex) : defaultMaterialIndex;
+
+		const auto& attributes = primitive["attributes"];
+		Accessor positions;
+		if (!GetAccessor(doc, attributes["POSITION"].GetIndex(), positions, pError))
+		{
+			return false;
+		}
+		if (positions.ComponentCount != 3)
+		{
+			return SetError(pError, "POSITION  VEC3 ł͂܂");
+		}
+
+		// _z֊e𒼐ړǂݍ
+		auto& vertices = dstMesh.Vertices;
+		vertices.resize(positions.Count);
+		ReadAttribute(positions, vertices, &Vertex::m_Position, 3);
+
+		bool hasNormals = false;
+		if (const auto* pNormal = attributes.Find("NORMAL"))
+		{
+			Accessor normals;
+			if (!GetAccessor(doc, pNormal->GetIndex(), normals, pError)) return false;
+			if (normals.Count != positions.Count) return SetError(pError, "NORMAL ̗vf POSITION ƈv܂");
+			ReadAttribute(normals, vertices, &Vertex::m_Normal, 3);
+			hasNormals = true;
+		}
+
+		bool hasTexCoords = false;
+		if (const auto* pTexCoord = attributes.Find("TEXCOORD_0"))
+		{
+			Accessor texCoords;
+			if (!GetAccessor(doc, pTexCoord->GetIndex(), texCoords, pError)) return false;
+			if (texCoords.Count != positions.Count) return SetError(pError, "TEXCOORD_0 ̗vf POSITION ƈv܂");
+			ReadAttribute(texCoords, vertices, &Vertex::m_TexCoord, 2);
+			hasTexCoords = true;
+		}
+
+		bool hasTangents = false;
+		if (const auto* pTangent = attributes.Find("TANGENT"))
+		{
+			// w (]@̌) ͒_CAEgɂȂ̂ xyz ̂
+			Accessor tangents;
+			if (!GetAccessor(doc, pTangent->GetIndex(), tangents, pError)) return false;
+			if (tangents.Count != positions.Count) return SetError(pError, "TANGENT ̗vf POSITION ƈv܂");
+			ReadAttribute(tangents, vertices, &Vertex::m_Tangent, 3);
+			hasTangents = true;
+		}
+
+		// CfbNX (ȂΒ_̕я)
+		auto& indices = dstMesh.Indices;
+		if (const auto* pIndices = primitive.Find("indices"))
+		{
+			Accessor indexAccessor;
+			if (!GetAccessor(doc, pIndices->GetIndex(), indexAccessor, pError)) return false;
+			if (!ReadIndices(indexAccessor, indices, pError)) return false;
+			const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+			for (const auto index : indices)
+			{
+				if (index >= vertexCount)
+				{
+					return SetError(pError, "CfbNX_𒴂Ă܂");
+				}
+			}
+		}
+		else
+		{
+			indices.resize(vertices.size());
+			for (size_t i = 0; i < indices.size(); ++i)
+			{
+				indices[i] = static_cast<uint32_t>(i);
+			}
+		}
+		Triangulate(mode, indices);
+
+		if (!hasNormals)
+		{
+			GenerateNormals(vertices, indices);
+		}
+		if (!hasTangents && hasTexCoords)
+		{
+			GenerateTangents(vertices, indices);
+		}
+
+		TransformVertices(vertices, instance.World);
+		dstMesh.ComputeBounds();
+		return true;
+	}
+
+	/// <summary>
+	/// GLB ̃wb_ƃ`N͂܂
+	/// </summary>
+	bool ParseGLB(const uint8_t* pData, size_t size, BufferRange& outJson, BufferRange& outBin, std::string* pError)
+	{
+		uint32_t header[3];
+		std::memcpy(header, pData, sizeof(header));
+		if (header[1] != 2)
+		{
+			return SetError(pError, "GLB ̃o[W 2 ł͂܂");
+		}
+		const size_t totalSize = (std::min)(static_cast<size_t>(header[2]), size);
+
+		size_t offset = GLBHeaderSize;
+		while (offset + GLBChunkHeaderSize <= totalSize)
+		{
+			uint32_t chunkHeader[2];
+			std::memcpy(chunkHeader, pData + offset, sizeof(chunkHeader));
+			offset += GLBChunkHeaderSize;
+			const size_t chunkSize = chunkHeader[0];
+			if (chunkSize > totalSize - offset)
+			{
+				return SetError(pError, "GLB ̃`Nt@C͈̔͊Oł");
+			}
+			if (chunkHeader[1] == GLBChunkJSON && outJson.pData == nullptr)
+			{
+				outJson = { pData + offset, chunkSize };
+			}
+			else if (chunkHeader[1] == GLBChunkBIN && outBin.pData == nullptr)
+			{
+				outBin = { pData + offset, chunkSize };
+			}
+			// `N 4 oCgEɑĂ
+			offset += (chunkSize + 3) & ~static_cast<size_t>(3);
+		}
+		if (outJson.pData == nullptr)
+		{
+			return SetError(pError, "GLB  JSON `N܂");
+		}
+		return true;
+	}
+}
+using namespace GltfLoaderInternal;
+
+bool GltfLoader::CanLoad(const std::wstring& filePath)
+{
+	auto extension = std::filesystem::path(filePath).extension().wstring();
+	std::transform(extension.begin(), extension.end(), extension.begin(),
+		[](wchar_t c) { return (c >= L'A' && c <= L'Z') ? static_cast<wchar_t>(c - L'A' + L'a') : c; });
+	return extension == L".gltf" || extension == L".glb";
+}
+
+bool GltfLoader::Load(const std::wstring& filePath, ModelData& outData, std::string* pError)
+{
+	outData = ModelData();
+
+	Document doc;
+	doc.BaseDir = std::filesystem::path(filePath).parent_path();
+	auto pFile = std::make_unique<MappedFile>();
+	if (!pFile->Open(filePath))
+	{
+		return SetError(pError, "t@CJ܂");
+	}
+
+	// GLB ̓t@CŜ}bv܂܁ABIN `N buffers[0] ƂĎg
+	BufferRange json = { pFile->GetData(), pFile->GetSize() };
+	BufferRange glbBinChunk;
+	uint32_t magic = 0;
+	if (pFile->GetSize() >= GLBHeaderSize)
+	{
+		std::memcpy(&magic, pFile->GetData(), sizeof(uint32_t));
+	}
+	if (magic == GLBMagic)
+	{
+		json = BufferRange();
+		if (!ParseGLB(pFile->GetData(), pFile->GetSize(), json, glbBinChunk, pError))
+		{
+			return false;
+		}
+	}
+	doc.Files.push_back(std::move(pFile));
+
+	if (!JsonValue::Parse(reinterpret_cast<const char*>(json.pData), json.Size, doc.Root) || !doc.Root.IsObject())
+	{
+		return SetError(pError, "JSON ̉͂Ɏs܂");
+	}
+	if (doc.Root["asset"]["version"].GetString().compare(0, 2, "2.") != 0)
+	{
+		return SetError(pError, "glTF 2.0 ł͂܂");
+	}
+	const auto& requiredExtensions = doc.Root["extensionsRequired"];
+	for (size_t i = 0; i < requiredExtensions.Size(); ++i)
+	{
+		const auto& name = requiredExtensions[i].GetString();
+		const bool isSupported = std::any_of(std::begin(SupportedRequiredExtensions), std::end(SupportedRequiredExtensions),
+			[&](const char* pSupported) { return name == pSupported; });
+		if (!isSupported)
+		{
+			return SetError(pError, "Ή̕K{gł: " + name);
+		}
+	}
+	if (!LoadBuffers(doc, glbBinChunk, pError))
+	{
+		return false;
+	}
+
+	// }eA
+	const auto& materials = doc.Root["materials"];
+	outData.Materials.resize(materials.Size());
+	for (size_t i = 0; i < materials.Size(); ++i)
+	{
+		ParseMaterial(doc, materials[i], outData.Materials[i]);
+	}
+
+	// V[̃m[hHA`悳v~eBuW߂
+	std::vector<PrimitiveInstance> instances;
+	const auto& scenes = doc.Root["scenes"];
+	const auto sceneIndex = doc.Root["scene"].GetIndex(0);
+	if (static_cast<size_t>(sceneIndex) < scenes.Size())
+	{
+		const auto& rootNodes = scenes[static_cast<size_t>(sceneIndex)]["nodes"];
+		for (size_t i = 0; i < rootNodes.Size(); ++i)
+		{
+			CollectPrimitives(doc, rootNodes[i].GetIndex(), Matrix4x4::Identity(), 0, instances);
+		}
+	}
+	else
+	{
+		// V[Ȃ΁Aǂ̃m[h̎qłȂm[h[gƂĈ
+		const auto& nodes = doc.Root["nodes"];
+		std::vector<uint8_t> isChild(nodes.Size(), 0);
+		for (size_t i = 0; i < nodes.Size(); ++i)
+		{
+			const auto& children = nodes[i]["children"];
+			for (size_t c = 0; c < children.Size(); ++c)
+			{
+				const auto child = children[c].GetIndex();
+				if (child >= 0 && static_cast<size_t>(child) < isChild.size()) isChild[static_cast<size_t>(child)] = 1;
+			}
+		}
+		for (size_t i = 0; i < nodes.Size(); ++i)
+		{
+			if (isChild[i] == 0)
+			{
+				CollectPrimitives(doc, static_cast<int64_t>(i), Matrix4x4::Identity(), 0, instances);
+			}
+		}
+	}
+
+	// v~eBu̕ϊ͓ƗĂ̂ŕɎs
+	const uint32_t defaultMaterialIndex = static_cast<uint32_t>(outData.Materials.size());
+	std::vector<std::string> errors(instances.size());
+	std::atomic<bool> isFailed(false);
+	outData.Meshes.resize(instances.size());
+	Parallel::ForEach(instances.size(), [&](size_t i)
+		{
+			if (isFailed.load(std::memory_order_relaxed)) return;
+			if (!ConvertPrimitive(doc, instances[i], defaultMaterialIndex, outData.Meshes[i], &errors[i]))
+			{
+				isFailed.store(true, std::memory_order_relaxed);
+			}
+		});
+	if (isFailed.load())
+	{
+		const auto it = std::find_if(errors.begin(), errors.end(), [](const std::string& error) { return !error.empty(); });
+		SetError(pError, it != errors.end() ? *it : std::string("v~eBu̕ϊɎs܂"));
+		outData = ModelData();
+		return false;
+	}
+
+	// Op`Ȃv~eBu菜
+	outData.Meshes.erase(std::remove_if(outData.Meshes.begin(), outData.Meshes.end(),
+		[](const MeshData& mesh) { return mesh.Indices.empty(); }), outData.Meshes.end());
+
+	// }eAw̃v~eBuΊ̃}eAǉ (Assimp Ɠԍ -1 ɂȂ)
+	const bool usesDefaultMaterial = std::any_of(outData.Meshes.begin(), outData.Meshes.end(),
+		[&](const MeshData& mesh) { return mesh.MaterialIndex == defaultMaterialIndex; });
+	if (usesDefaultMaterial)
+	{
+		outData.Materials.emplace_back();
+	}
+	return true;
+}
@@ -0,0 +1,438 @@
+#include "Graphics/MeshCache.h"
+#include "Graphics/DX12Utilities.h"
+#include "Utilities/FileHash.h"
+#include "Utilities/MappedFile.h"
+#include "Utilities/Utility.h"
+
+#include <cwctype>
+#include <fstream>
+#include <type_traits>
+
+namespace MeshCacheInternal
+{
+	constexpr uint32_t Magic = 0x434D564D; // "MVMC"
+
+	/// <summary>
+	/// t@C擪̃wb_
+	/// </summary>
+	struct FileHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint64_t SourceHash;
+		uint32_t ImportFlags;
+		uint32_t VertexStride;  //!< sizeof(Vertex) (_CAEg̕ύXo)
+		uint32_t MaterialCount;
+		uint32_t MeshCount;
+		uint64_t PayloadSize;   //!< wb_ȍ~̃oCg (ݓr̃t@Ce)
+	};
+
+	static_assert(std::is_trivially_copyable<Vertex>::value, "Vertex must be trivially copyable");
+	static_assert(std::is_trivially_copyable<AABB>::value, "AABB must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Sphere>::value, "Sphere must be trivially copyable");
+	static_assert(std::is_trivially_copyable<VertexCacheStats>::value, "VertexCacheStats must be trivially copyable");
+	static_assert(std::is_trivially_copyable<WeldStats>::value, "WeldStats must be trivially copyable");
+	static_assert(std::is_trivially_copyable<MeshLod>::value, "MeshLod must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Meshlet>::value, "Meshlet must be trivially copyable");
+
+	/// <summary>
+	/// ɃoCigݗĂ
+	/// </summary>
+	class BinaryWriter
+	{
+	public:
+		template<typename T>
+		void Write(const T& value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+			WriteBytes(&value, sizeof(T));
+		}
+
+		void WriteBytes(const void* pData, size_t size)
+		{
+			auto p = static_cast<const uint8_t*>(pData);
+			m_Buffer.insert(m_Buffer.end(), p, p + size);
+		}
+
+		void WriteString(const std::string& str)
+		{
+			Write(static_cast<uint32_t>(str.size()));
+			WriteBytes(str.data(), str.size());
+			Align();
+		}
+
+		//! 4 oCgEɑ (_ECfbNXz̐擪𑵂邽)
+		void Align()
+		{
+			m_Buffer.resize((m_Buffer.size() + 3) & ~static_cast<size_t>(3), 0);
+		}
+
+		std::vector<uint8_t>& GetBuffer() { return m_Buffer; }
+
+	private:
+		std::vector<uint8_t> m_Buffer;
+	};
+
+	/// <summary>
+	/// }bv͈̓`FbNtœǂݏo
+	/// </summary>
+	class BinaryReader
+	{
+	public:
+		BinaryReader(const uint8_t* pData, size_t size)
+			: m_pBegin(pData), m_pCurrent(pData), m_pEnd(pData + size)
+		{
+		}
+
+		bool CanRead(uint64_t size) const
+		{
+			return size <= static_cast<uint64_t>(m_pEnd - m_pCurrent);
+		}
+
+		bool ReadBytes(void* pDst, size_t size)
+		{
+			if (!CanRead(size))
+			{
+				return false;
+			}
+			if (size > 0)
+			{
+				std::memcpy(pDst, m_pCurrent, size);
+			}
+			m_pCurrent += size;
+			return true;
+		}
+
+		template<typename T>
+		bool Read(T& value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+			return ReadBytes(&value, sizeof(T));
+		}
+
+		/// <summary>
+		/// }bvz1񂾂Rs[܂
+		/// (MeshData  GPU ւ̃Abv[hẑŁA}bv𒼐ڂ͎QƂ܂)
+		/// z̓t@C 4 oCgEɑĂ̂ŁAvf̂܂܃Rs[č܂ (resize  0 ߂Ȃ)
+		/// </summary>
+		template<typename T>
+		bool ReadArray(std::vector<T>& values, uint32_t count)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+			const uint64_t size = static_cast<uint64_t>(count) * sizeof(T);
+			if (!CanRead(size))
+			{
+				return false;
+			}
+			if (reinterpret_cast<uintptr_t>(m_pCurrent) % alignof(T) != 0)
+			{
+				values.resize(count);
+				return ReadBytes(values.data(), static_cast<size_t>(size));
+			}
+			const T* pSrc = reinterpret_cast<const T*>(m_pCurrent);
+			values.assign(pSrc, pSrc + count);
+			m_pCurrent += size;
+			return true;
+		}
+
+		bool ReadString(std::string& str)
+		{
+			uint32_t length = 0;
+			if (!Read(length) || !CanRead(length))
+			{
+				return false;
+			}
+			str.assign(reinterpret_cast<const char*>(m_pCurrent), length);
+			m_pCurrent += length;
+			return Align();
+		}
+
+		bool Align()
+		{
+			const size_t offset = static_cast<size_t>(m_pCurrent - m_pBegin);
+			const size_t aligned = (offset + 3) & ~static_cast<size_t>(3);
+			if (!CanRead(aligned - offset))
+			{
+				return false;
+			}
+			m_pCurrent = m_pBegin + aligned;
+			return true;
+		}
+
+		bool IsEnd() const { return m_pCurrent == m_pEnd; }
+
+	private:
+		const uint8_t* m_pBegin = nullptr;
+		const uint8_t* m_pCurrent = nullptr;
+		const uint8_t* m_pEnd = nullptr;
+	};
+
+	bool ReadMaterial(BinaryReader& reader, MaterialData& material)
+	{
+		return reader.Read(material.Diffuse)
+			&& reader.Read(material.Specular)
+			&& reader.Read(material.Alpha)
+			&& reader.Read(material.Shininess)
+			&& reader.ReadString(material.DiffuseTexPath)
+			&& reader.ReadString(material.NormalTexPath)
+			&& reader.ReadString(material.GLTFMetaricRoughnessTexPath)
+			&& reader.ReadString(material.ShininessTexPath)
+			&& reader.ReadString(material.SpecularTexPath);
+	}
+
+	void WriteMaterial(BinaryWriter& writer, const MaterialData& material)
+	{
+		writer.Write(material.Diffuse);
+		writer.Write(material.Specular);
+		writer.Write(material.Alpha);
+		writer.Write(material.Shininess);
+		writer.WriteString(material.DiffuseTexPath);
+		writer.WriteString(material.NormalTexPath);
+		writer.WriteString(material.GLTFMetaricRoughnessTexPath);
+		writer.WriteString(material.ShininessTexPath);
+		writer.WriteString(material.SpecularTexPath);
+	}
+
+	bool ReadMesh(BinaryReader& reader, MeshData& mesh)
+	{
+		uint32_t vertexCount = 0;
+		uint32_t indexCount = 0;
+		uint32_t lodCount = 0;
+		uint32_t meshletCount = 0;
+		const bool isRead = reader.ReadString(mesh.Name)
+			&& reader.Read(mesh.MaterialIndex)
+			&& reader.Read(vertexCount)
+			&& reader.Read(indexCount)
+			&& reader.Read(lodCount)
+			&& reader.Read(meshletCount)
+			&& reader.Read(mesh.LocalBounds)
+			&& reader.Read(mesh.LocalSphere)
+			&& reader.Read(mesh.CacheStatsBefore)
+			&& reader.Read(mesh.CacheStatsAfter)
+			&& reader.Read(mesh.Weld)
+			&& reader.Align()
+			&& reader.ReadArray(mesh.Lods, lodCount)
+			&& reader.ReadArray(mesh.Meshlets, meshletCount)
+			&& reader.ReadArray(mesh.Vertices, vertexCount)
+			&& reader.ReadArray(mesh.Indices, indexCount);
+		if (!isRead)
+		{
+			return false;
+		}
+
+		// ꂽLbVŒ_obt@̊OQƂȂ悤ACfbNX_mF
+		// (̂ȂőľvZȂ̂ŃxNgA_̃Rs[ɔׂď\ɑ)
+		uint32_t maxIndex = 0;
+		for (const auto index : mesh.Indices)
+		{
+			maxIndex = (std::max)(maxIndex, index);
+		}
+		if (indexCount > 0 && maxIndex >= vertexCount)
+		{
+			return false;
+		}
+
+		// ꂽLbVŃCfbNXobt@̊O`悵Ȃ悤 LOD ͈̔͂mF
+		for (const auto& lod : mesh.Lods)
+		{
+			if (lod.IndexOffset > indexCount || lod.IndexCount > indexCount - lod.IndexOffset)
+			{
+				return false;
+			}
+		}
+		for (const auto& meshlet : mesh.Meshlets)
+		{
+			if (meshlet.IndexOffset > indexCount || meshlet.IndexCount > indexCount - meshlet.IndexOffset)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void WriteMesh(BinaryWriter& writer, const MeshData& mesh)
+	{
+		writer.WriteString(mesh.Name);
+		writer.Write(mesh.MaterialIndex);
+		writer.Write(static_cast<uint32_t>(mesh.Vertices.size()));
+		writer.Write(static_cast<uint32_t>(mesh.Indices.size()));
+		writer.Write(static_cast<uint32_t>(mesh.Lods.size()));
+		writer.Write(static_cast<uint32_t>(mesh.Meshlets.size()));
+		writer.Write(mesh.LocalBounds);
+		writer.Write(mesh.LocalSphere);
+		writer.Write(mesh.CacheStatsBefore);
+		writer.Write(mesh.CacheStatsAfter);
+		writer.Write(mesh.Weld);
+		writer.Align();
+		writer.WriteBytes(mesh.Lods.data(), mesh.Lods.size() * sizeof(MeshLod));
+		writer.WriteBytes(mesh.Meshlets.data(), mesh.Meshlets.size() * sizeof(Meshlet));
+		writer.WriteBytes(mesh.Vertices.data(), mesh.Vertices.size() * sizeof(Vertex));
+		writer.WriteBytes(mesh.Indices.data(), mesh.Indices.size() * sizeof(uint32_t));
+	}
+}
+using namespace MeshCacheInternal;
+
+MeshCache::Key MeshCache::MakeKey(const std::wstring& sourcePath, uint32_t importFlags)
+{
+	Key key;
+	key.ImportFlags = importFlags;
+
+	uint64_t hash = FileHash::FNVOffsetBasis;
+	FileHash::HashFile(sourcePath, hash);
+
+	// .gltf ͊O .bin ɒ_f[^̂ŁAtH_ .bin ܂߂
+	std::filesystem::path source(sourcePath);
+	auto extension = source.extension().wstring();
+	std::transform(extension.begin(), extension.end(), extension.begin(), ::towlower);
+	if (extension == L".gltf")
+	{
+		std::vector<std::filesystem::path> buffers;
+		std::error_code ec;
+		for (const auto& entry : std::filesystem::directory_iterator(source.parent_path(), ec))
+		{
+			auto entryExtension = entry.path().extension().wstring();
+			std::transform(entryExtension.begin(), entryExtension.end(), entryExtension.begin(), ::towlower);
+			if (entry.is_regular_file() && entryExtension == L".bin")
+			{
+				buffers.push_back(entry.path());
+			}
+		}
+		// 񋓏ɈˑȂ悤ɖOŏ
+		std::sort(buffers.begin(), buffers.end());
+		for (const auto& buffer : buffers)
+		{
+			const auto name = buffer.filename().wstring();
+			hash = FileHash::HashBytes(hash, reinterpret_cast<const uint8_t*>(name.data()), name.size() * sizeof(wchar_t));
+			FileHash::HashFile(buffer.wstring(), hash);
+		}
+	}
+
+	key.SourceHash = hash;
+	return key;
+}
+
+std::wstring MeshCache::GetCachePath(const std::wstring& sourcePath)
+{
+	// t@Cʂ̏ (؂蕶E啶) Ŏw肵ĂLbVɂȂ悤ɐK
+	std::error_code ec;
+	std::filesystem::path source(sourcePath);
+	auto normalized = std::filesystem::absolute(source, ec).lexically_normal().wstring();
+	std::transform(normalized.begin(), normalized.end(), normalized.begin(), ::towlower);
+	uint64_t pathHash = DX12Utility::StringHash(normalized.c_str());
+
+	static const wchar_t HexDigits[] = L"0123456789abcdef";
+	std::wstring hashText(16, L'0');
+	for (int i = 15; i >= 0; --i)
+	{
+		hashText[i] = HexDigits[pathHash & 0xF];
+		pathHash >>= 4;
+	}
+
+	return Utility::GetCurrentDir() + L"/cache/" + source.stem().wstring() + L"_" + hashText + L".mvmesh";
+}
+
+bool MeshCache::Load(const std::wstring& cachePath, const Key& key, ModelData& outData)
+{
+	MappedFile file(cachePath);
+	if (!file.IsOpen() || file.GetSize() < sizeof(FileHeader))
+	{
+		return false;
+	}
+
+	FileHeader header;
+	std::memcpy(&header, file.GetData(), sizeof(FileHeader));
+	if (header.Magic != Magic ||
+		header.Version != Version ||
+		header.SourceHash != key.SourceHash ||
+		header.ImportFlags != key.ImportFlags ||
+		header.VertexStride != sizeof(Vertex) ||
+		header.PayloadSize != file.GetSize() - sizeof(FileHeader))
+	{
+		return false;
+	}
+
+	BinaryReader reader(file.GetData(), file.GetSize());
+	reader.Read(header);
+
+	ModelData data;
+	data.Materials.resize(header.MaterialCount);
+	for (auto& material : data.Materials)
+	{
+		if (!ReadMaterial(reader, material))
+		{
+			return false;
+		}
+	}
+	data.Meshes.resize(header.MeshCount);
+	for (auto& mesh : data.Meshes)
+	{
+		if (!ReadMesh(reader, mesh))
+		{
+			return false;
+		}
+	}
+	if (!reader.IsEnd())
+	{
+		return false;
+	}
+
+	outData = std::move(data);
+	return true;
+}
+
+bool MeshCache::Save(const std::wstring& cachePath, const Key& key, const ModelData& data)
+{
+	FileHeader header = {};
+	header.Magic = Magic;
+	header.Version = Version;
+	header.SourceHash = key.SourceHash;
+	header.ImportFlags = key.ImportFlags;
+	header.VertexStride = sizeof(Vertex);
+	header.MaterialCount = static_cast<uint32_t>(data.Materials.size());
+	header.MeshCount = static_cast<uint32_t>(data.Meshes.size());
+
+	BinaryWriter writer;
+	writer.Write(header);
+	for (const auto& material : data.Materials)
+	{
+		WriteMaterial(writer, material);
+	}
+	for (const auto& mesh : data.Meshes)
+	{
+		WriteMesh(writer, mesh);
+	}
+
+	// TCYm肵̂Ńwb_
+	auto& buffer = writer.GetBuffer();
+	header.PayloadSize = buffer.size() - sizeof(FileHeader);
+	std::memcpy(buffer.data(), &header, sizeof(FileHeader));
+
+	std::error_code ec;
+	std::filesystem::path path(cachePath);
+	std::filesystem::create_directories(path.parent_path(), ec);
+
+	auto tempPath = path;
+	tempPath += L".tmp";
+	{
+		std::ofstream ofs(tempPath, std::ios::binary | std::ios::trunc);
+		if (!ofs)
+		{
+			return false;
+		}
+		ofs.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+		if (!ofs)
+		{
+			ofs.close();
+			std::filesystem::remove(tempPath, ec);
+			return false;
+		}
+	}
+
+	std::filesystem::rename(tempPath, path, ec);
+	if (ec)
+	{
+		std::filesystem::remove(tempPath, ec);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,53 @@
+#include "Graphics/MeshCuller.h"
+#include "Graphics/Model.h"
+#include "Utilities/Parallel.h"
+
+void MeshCuller::Cull(const std::vector<std::unique_ptr<Model>>& models, const Frustum& frustum)
+{
+	// f̃ItZbgvZ
+	m_MeshOffsets.resize(models.size() + 1);
+	size_t meshCount = 0;
+	for (auto i = 0u; i < models.size(); ++i)
+	{
+		m_MeshOffsets[i] = meshCount;
+		meshCount += models[i]->GetMeshWorldBounds().size();
+	}
+	m_MeshOffsets[models.size()] = meshCount;
+	m_MeshVisibility.resize(meshCount);
+
+	// Aт [begin, end) 𔻒 (f̋E܂ꍇ͕Ĕ)
+	auto cullRange = [&](size_t begin, size_t end)
+		{
+			auto it = std::upper_bound(m_MeshOffsets.begin(), m_MeshOffsets.end(), begin);
+			size_t modelIndex = static_cast<size_t>(it - m_MeshOffsets.begin()) - 1;
+			while (begin < end)
+			{
+				const auto& model = models[modelIndex];
+				const size_t modelBegin = m_MeshOffsets[modelIndex];
+				const size_t rangeEnd = (std::min)(end, m_MeshOffsets[modelIndex + 1]);
+				if (begin < rangeEnd)
+				{
+					uint8_t* pVisibility = m_MeshVisibility.data() + begin;
+					// fŜ̊OȂ烁bV͕̔sv
+					if (!frustum.Intersects(model->GetWorldBounds()))
+					{
+						std::memset(pVisibility, 0, rangeEnd - begin);
+					}
+					else
+					{
+						const AABB* pBounds = model->GetMeshWorldBounds().data() + (begin - modelBegin);
+						frustum.CullAABBs(pBounds, rangeEnd - begin, pVisibility);
+					}
+				}
+				begin = rangeEnd;
+				++modelIndex;
+			}
+		};
+
+	if (meshCount < ParallelThreshold)
+	{
+		cullRange(0, meshCount);
+		return;
+	}
+	Parallel::For(meshCount, ParallelMinBatch, cullRange);
+}
@@ -0,0 +1,305 @@
+#include "Graphics/MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace MeshOptimizerInternal
+{
+	/// <summary>
+	/// _A̒_gOp`ւ̋t (CSR `)
+	/// </summary>
+	struct VertexAdjacency
+	{
+		std::vector<uint32_t> Offsets;   //!< _ v ̎Op` Triangles[Offsets[v] .. Offsets[v + 1])
+		std::vector<uint32_t> Triangles;
+
+		void Build(const std::vector<uint32_t>& indices, uint32_t vertexCount)
+		{
+			Offsets.assign(vertexCount + 1, 0);
+			for (const auto index : indices)
+			{
+				++Offsets[index + 1];
+			}
+			for (uint32_t v = 0; v < vertexCount; ++v)
+			{
+				Offsets[v + 1] += Offsets[v];
+			}
+			Triangles.resize(indices.size());
+			std::vector<uint32_t> cursor(Offsets.begin(), Offsets.end() - 1);
+			for (size_t i = 0; i < indices.size(); ++i)
+			{
+				Triangles[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3);
+			}
+		}
+	};
+
+	/// <summary>
+	/// Tipsify ̎̐̒SIт܂
+	/// o͂ĂLbVǂoȂ_̂AłÂ̂D悵܂
+	/// </summary>
+	/// <param name="isDeadEnd"> ₪ȂALbVO̒_ֈڂꍇ true </param>
+	/// <returns> ̒_ (SĂ̎Op`o͍ς݂Ȃ -1) </returns>
+	int64_t GetNextVertex(const std::vector<uint32_t>& candidates, const std::vector<uint32_t>& liveCount,
+		const std::vector<uint32_t>& cacheTime, uint32_t time,
+		std::vector<uint32_t>& deadEnd, uint32_t& cursor, bool& isDeadEnd)
+	{
+		int64_t best = -1;
+		int64_t bestPriority = -1;
+		for (const auto v : candidates)
+		{
+			if (liveCount[v] == 0) continue;
+			int64_t priority = 0;
+			// o͂1Op`ő2_LbVɓ
+			if (time - cacheTime[v] + 2 * liveCount[v] <= MeshOptimizer::CacheSize)
+			{
+				priority = time - cacheTime[v];
+			}
+			if (priority > bestPriority)
+			{
+				bestPriority = priority;
+				best = v;
+			}
+		}
+		isDeadEnd = best < 0;
+		if (!isDeadEnd)
+		{
+			return best;
+		}
+
+		// ₪Ȃ΍ŋߎg_kAȂΖ̒_擪T
+		while (!deadEnd.empty())
+		{
+			const uint32_t v = deadEnd.back();
+			deadEnd.pop_back();
+			if (liveCount[v] > 0) return v;
+		}
+		const uint32_t vertexCount = static_cast<uint32_t>(liveCount.size());
+		while (cursor < vertexCount)
+		{
+			const uint32_t v = cursor++;
+			if (liveCount[v] > 0) return v;
+		}
+		return -1;
+	}
+
+	/// <summary>
+	/// Op`̖ʐςŏdݕt@ (O) ƏdS
+	/// </summary>
+	void GetTriangleGeometry(const std::vector<Vertex>& vertices, const uint32_t* pTriangle, Vector3D& outNormal, Vector3D& outCentroid)
+	{
+		const Vector3D& p0 = vertices[pTriangle[0]].m_Position;
+		const Vector3D& p1 = vertices[pTriangle[1]].m_Position;
+		const Vector3D& p2 = vertices[pTriangle[2]].m_Position;
+		outNormal = (p1 - p0).cross(p2 - p0);
+		outCentroid = (p0 + p1 + p2) * (1.0f / 3.0f);
+	}
+}
+using namespace MeshOptimizerInternal;
+
+VertexCacheStats MeshOptimizer::AnalyzeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertexCount)
+{
+	VertexCacheStats stats;
+	stats.TriangleCount = static_cast<uint32_t>(indices.size() / 3);
+
+	// cacheTime ͒_LbVɓ (FIFO Ȃ̂ŃqbgĂXVȂ)
+	std::vector<uint32_t> cacheTime(vertexCount, 0);
+	std::vector<uint8_t> isUsed(vertexCount, 0);
+	uint32_t time = CacheSize + 1;
+	for (const auto index : indices)
+	{
+		if (index >= vertexCount) continue;
+		if (time - cacheTime[index] > CacheSize)
+		{
+			cacheTime[index] = time++;
+			++stats.TransformedCount;
+		}
+		if (isUsed[index] == 0)
+		{
+			isUsed[index] = 1;
+			++stats.VertexCount;
+		}
+	}
+	return stats;
+}
+
+void MeshOptimizer::OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertexCount, std::vector<uint32_t>* pClusterStarts)
+{
+	if (pClusterStarts != nullptr)
+	{
+		pClusterStarts->assign(1, 0);
+	}
+	const size_t triangleCount = indices.size() / 3;
+	if (triangleCount == 0 || vertexCount == 0)
+	{
+		return;
+	}
+
+	VertexAdjacency adjacency;
+	adjacency.Build(indices, vertexCount);
+	std::vector<uint32_t> liveCount(vertexCount);
+	for (uint32_t v = 0; v < vertexCount; ++v)
+	{
+		liveCount[v] = adjacency.Offsets[v + 1] - adjacency.Offsets[v];
+	}
+
+	std::vector<uint32_t> cacheTime(vertexCount, 0);
+	std::vector<uint8_t> isEmitted(triangleCount, 0);
+	std::vector<uint32_t> deadEnd;
+	std::vector<uint32_t> candidates;
+	std::vector<uint32_t> output;
+	output.reserve(indices.size());
+	deadEnd.reserve(indices.size());
+
+	uint32_t time = CacheSize + 1;
+	uint32_t cursor = 0;
+	int64_t fan = indices[0];
+	while (fan >= 0)
+	{
+		// fan 𒆐SƂ関o͂̎Op`ׂďo
+		candidates.clear();
+		const uint32_t center = static_cast<uint32_t>(fan);
+		for (uint32_t a = adjacency.Offsets[center]; a < adjacency.Offsets[center + 1]; ++a)
+		{
+			const uint32_t triangle = adjacency.Triangles[a];
+			if (isEmitted[triangle] != 0) continue;
+			isEmitted[triangle] = 1;
+			for (uint32_t k = 0; k < 3; ++k)
+			{
+				const uint32_t v = indices[triangle * 3 + k];
+				output.push_back(v);
+				deadEnd.push_back(v);
+				candidates.push_back(v);
+				--liveCount[v];
+				if (time - cacheTime[v] > CacheSize)
+				{
+					cacheTime[v] = time++;
+				}
+			}
+		}
+
+		bool isDeadEnd = false;
+		fan = GetNextVertex(candidates, liveCount, cacheTime, time, deadEnd, cursor, isDeadEnd);
+		// LbV̊OֈڂꏊNX^̋EɂȂ
+		if (isDeadEnd && fan >= 0 && pClusterStarts != nullptr && pClusterStarts->back() != output.size() / 3)
+		{
+			pClusterStarts->push_back(static_cast<uint32_t>(output.size() / 3));
+		}
+	}
+	indices.swap(output);
+}
+
+void MeshOptimizer::OptimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& clusterStarts)
+{
+	const size_t triangleCount = indices.size() / 3;
+	const size_t clusterCount = clusterStarts.size();
+	if (triangleCount == 0 || clusterCount <= 1)
+	{
+		return;
+	}
+
+	// bVŜ̏dSƁA@̌ (bVȂO@ő̐ςɂȂ)
+	Vector3D meshCentroid;
+	float meshArea = 0.0f;
+	for (size_t t = 0; t < triangleCount; ++t)
+	{
+		Vector3D normal, centroid;
+		GetTriangleGeometry(vertices, &indices[t * 3], normal, centroid);
+		const float area = normal.length();
+		meshCentroid += centroid * area;
+		meshArea += area;
+	}
+	meshCentroid = meshArea > 0.0f ? meshCentroid * (1.0f / meshArea) : Vector3D();
+
+	// NX^ɁuSǂꂾOĂ邩v߂
+	std::vector<float> sortKeys(clusterCount);
+	float volume = 0.0f;
+	for (size_t c = 0; c < clusterCount; ++c)
+	{
+		const size_t begin = clusterStarts[c];
+		const size_t end = c + 1 < clusterCount ? clusterStarts[c + 1] : triangleCount;
+		Vector3D clusterNormal, clusterCentroid;
+		float clusterArea = 0.0f;
+		for (size_t t = begin; t < end; ++t)
+		{
+			Vector3D normal, centroid;
+			GetTriangleGeometry(vertices, &indices[t * 3], normal, centroid);
+			const float area = normal.length();
+			clusterNormal += normal;
+			clusterCentroid += centroid * area;
+			clusterArea += area;
+			volume += normal.dot(centroid - meshCentroid);
+		}
+		clusterCentroid = clusterArea > 0.0f ? clusterCentroid * (1.0f / clusterArea) : meshCentroid;
+		sortKeys[c] = clusterNormal.GetSafeNormal().dot(clusterCentroid - meshCentroid);
+	}
+	//  (nւ̕ϊŔ]Ăꍇ) ɂ炸O𐳂ɂ
+	if (volume < 0.0f)
+	{
+		for (auto& key : sortKeys)
+		{
+			key = -key;
+		}
+	}
+
+	std::vector<uint32_t> order(clusterCount);
+	std::iota(order.begin(), order.end(), 0u);
+	std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return sortKeys[a] > sortKeys[b]; });
+
+	std::vector<uint32_t> sorted;
+	sorted.reserve(indices.size());
+	for (const auto c : order)
+	{
+		const size_t begin = clusterStarts[c];
+		const size_t end = c + 1 < clusterCount ? clusterStarts[c + 1] : triangleCount;
+		sorted.insert(sorted.end(), indices.begin() + begin * 3, indices.begin() + end * 3);
+	}
+
+	// _LbV̌傫ꍇ͕בւȂ
+	const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+	const float currentACMR = AnalyzeVertexCache(indices, vertexCount).GetACMR();
+	const float sortedACMR = AnalyzeVertexCache(sorted, vertexCount).GetACMR();
+	if (sortedACMR <= currentACMR * OverdrawThreshold)
+	{
+		indices.swap(sorted);
+	}
+}
+
+void MeshOptimizer::OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices)
+{
+	constexpr uint32_t Unused = ~0u;
+	std::vector<uint32_t> remap(vertices.size(), Unused);
+	std::vector<Vertex> sorted;
+	sorted.reserve(vertices.size());
+	for (auto& index : indices)
+	{
+		if (remap[index] == Unused)
+		{
+			remap[index] = static_cast<uint32_t>(sorted.size());
+			sorted.push_back(vertices[index]);
+		}
+		index = remap[index];
+	}
+	vertices.swap(sorted);
+}
+
+void MeshOptimizer::Optimize(MeshData& mesh, bool isOptimizeOverdraw)
+{
+	const uint32_t vertexCount = static_cast<uint32_t>(mesh.Vertices.size());
+	mesh.CacheStatsBefore = AnalyzeVertexCache(mesh.Indices, vertexCount);
+
+	std::vector<uint32_t> clusterStarts;
+	OptimizeVertexCache(mesh.Indices, vertexCount, isOptimizeOverdraw ? &clusterStarts : nullptr);
+	if (isOptimizeOverdraw)
+	{
+		OptimizeOverdraw(mesh.Indices, mesh.Vertices, clusterStarts);
+	}
+	OptimizeVertexFetch(mesh.Vertices, mesh.Indices);
+
+	// QƂĂȂ_菜ꍇ͋E{[vZ
+	if (mesh.Vertices.size() != vertexCount)
+	{
+		mesh.ComputeBounds();
+	}
+	mesh.CacheStatsAfter = AnalyzeVertexCache(mesh.Indices, static_cast<uint32_t>(mesh.Vertices.size()));
+}
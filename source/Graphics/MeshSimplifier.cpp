@@ -0,0 +1,396 @@
+#include "Graphics/MeshSimplifier.h"
+#include "Graphics/MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+namespace MeshSimplifierInternal
+{
+	/// <summary>
+	/// ʂ܂ł̋2̘a\񎟌` (ʐςŏdݕt)
+	/// </summary>
+	struct Quadric
+	{
+		double A00 = 0.0, A01 = 0.0, A02 = 0.0, A11 = 0.0, A12 = 0.0, A22 = 0.0;
+		double B0 = 0.0, B1 = 0.0, B2 = 0.0;
+		double C = 0.0;
+		double Weight = 0.0;
+
+		static Quadric FromPlane(double nx, double ny, double nz, double d, double weight)
+		{
+			Quadric q;
+			q.A00 = nx * nx * weight; q.A01 = nx * ny * weight; q.A02 = nx * nz * weight;
+			q.A11 = ny * ny * weight; q.A12 = ny * nz * weight; q.A22 = nz * nz * weight;
+			q.B0 = nx * d * weight; q.B1 = ny * d * weight; q.B2 = nz * d * weight;
+			q.C = d * d * weight;
+			q.Weight = weight;
+			return q;
+		}
+
+		void Add(const Quadric& q)
+		{
+			A00 += q.A00; A01 += q.A01; A02 += q.A02;
+			A11 += q.A11; A12 += q.A12; A22 += q.A22;
+			B0 += q.B0; B1 += q.B1; B2 += q.B2;
+			C += q.C;
+			Weight += q.Weight;
+		}
+
+		//! @brief _ p uƂ̌덷 (d݂Ŋ2)
+		double GetError(const Vector3D& p) const
+		{
+			const double x = p.x, y = p.y, z = p.z;
+			const double error = x * (A00 * x + A01 * y + A02 * z)
+				+ y * (A01 * x + A11 * y + A12 * z)
+				+ z * (A02 * x + A12 * y + A22 * z)
+				+ 2.0 * (B0 * x + B1 * y + B2 * z) + C;
+			return Weight > 0.0 ? (std::max)(error, 0.0) / Weight : 0.0;
+		}
+	};
+
+	/// <summary>
+	/// _ From 𒸓_ To ̈ʒu֊񂹂ǩ
+	/// </summary>
+	struct Collapse
+	{
+		uint32_t From;
+		uint32_t To;
+		float Cost;
+	};
+
+	/// <summary>
+	/// r֐ less ŕׂɓvf𓯂O[vɂ܂Ƃ߁Aevf̃O[v\ (ŏ̔ԍ) Ԃ܂
+	/// </summary>
+	template<typename Less, typename Equal>
+	std::vector<uint32_t> GroupEqual(uint32_t count, Less less, Equal equal)
+	{
+		std::vector<uint32_t> order(count);
+		std::iota(order.begin(), order.end(), 0u);
+		std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b)
+			{
+				return less(a, b) || (!less(b, a) && a < b);
+			});
+
+		std::vector<uint32_t> group(count);
+		for (uint32_t i = 0; i < count; )
+		{
+			uint32_t end = i + 1;
+			while (end < count && equal(order[i], order[end]))
+			{
+				++end;
+			}
+			// ɕׂĂ̂ order[i] O[v̍ŏԍ
+			for (uint32_t k = i; k < end; ++k)
+			{
+				group[order[k]] = order[i];
+			}
+			i = end;
+		}
+		return group;
+	}
+
+	/// <summary>
+	/// iKIɊȗ (LOD ɍƂ͓CX^Xőďk񂵂܂)
+	/// </summary>
+	class Simplifier
+	{
+	public:
+		Simplifier(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
+			: m_Vertices(vertices)
+		{
+			const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+
+			// S_1ɂ܂Ƃ߂Ĉ (WJꂽ_łӂq悤)
+			auto vertexLess = [&](uint32_t a, uint32_t b) { return std::memcmp(&vertices[a], &vertices[b], sizeof(Vertex)) < 0; };
+			auto vertexEqual = [&](uint32_t a, uint32_t b) { return std::memcmp(&vertices[a], &vertices[b], sizeof(Vertex)) == 0; };
+			const auto canonical = GroupEqual(vertexCount, vertexLess, vertexEqual);
+
+			m_Indices.resize(indices.size());
+			for (size_t i = 0; i < indices.size(); ++i)
+			{
+				m_Indices[i] = canonical[indices[i]];
+			}
+
+			// ʒuɑ̈Ⴄ_ (UVE@̌p) ꍇ͓Ȃ
+			auto positionLess = [&](uint32_t a, uint32_t b) { return std::memcmp(&vertices[a].m_Position, &vertices[b].m_Position, sizeof(Vector3D)) < 0; };
+			auto positionEqual = [&](uint32_t a, uint32_t b) { return std::memcmp(&vertices[a].m_Position, &vertices[b].m_Position, sizeof(Vector3D)) == 0; };
+			const auto positionGroup = GroupEqual(vertexCount, positionLess, positionEqual);
+
+			std::vector<uint32_t> wedgeCount(vertexCount, 0);
+			std::vector<uint8_t> isReferenced(vertexCount, 0);
+			for (const auto index : m_Indices)
+			{
+				if (isReferenced[index] == 0)
+				{
+					isReferenced[index] = 1;
+					++wedgeCount[positionGroup[index]];
+				}
+			}
+			m_IsLocked.assign(vertexCount, 0);
+			for (uint32_t v = 0; v < vertexCount; ++v)
+			{
+				if (wedgeCount[positionGroup[v]] > 1)
+				{
+					m_IsLocked[v] = 1;
+				}
+			}
+
+			// t̕ӂȂӂ͋EȂ̂ŁA̗[𓮂Ȃ (ʒuŔ肷̂Ōpڂ͋EɂȂȂ)
+			std::vector<uint64_t> edges;
+			edges.reserve(m_Indices.size());
+			for (size_t t = 0; t + 2 < m_Indices.size(); t += 3)
+			{
+				for (int e = 0; e < 3; ++e)
+				{
+					const uint64_t a = positionGroup[m_Indices[t + e]];
+					const uint64_t b = positionGroup[m_Indices[t + (e + 1) % 3]];
+					edges.push_back((a << 32) | b);
+				}
+			}
+			std::sort(edges.begin(), edges.end());
+			std::vector<uint8_t> isBorderGroup(vertexCount, 0);
+			for (const auto edge : edges)
+			{
+				const uint64_t reverse = (edge << 32) | (edge >> 32);
+				if (!std::binary_search(edges.begin(), edges.end(), reverse))
+				{
+					isBorderGroup[edge >> 32] = 1;
+					isBorderGroup[edge & 0xFFFFFFFFull] = 1;
+				}
+			}
+			for (uint32_t v = 0; v < vertexCount; ++v)
+			{
+				if (isBorderGroup[positionGroup[v]] != 0)
+				{
+					m_IsLocked[v] = 1;
+				}
+			}
+
+			// e_ɐڂOp`̕ʂ̓񎟌`𑫂킹
+			m_Quadrics.assign(vertexCount, Quadric());
+			for (size_t t = 0; t + 2 < m_Indices.size(); t += 3)
+			{
+				const Vector3D& p0 = vertices[m_Indices[t + 0]].m_Position;
+				const Vector3D& p1 = vertices[m_Indices[t + 1]].m_Position;
+				const Vector3D& p2 = vertices[m_Indices[t + 2]].m_Position;
+				const Vector3D normal = (p1 - p0).cross(p2 - p0);
+				const double length = normal.length();
+				if (length <= 0.0)
+				{
+					continue;
+				}
+				const double nx = normal.x / length, ny = normal.y / length, nz = normal.z / length;
+				const double d = -(nx * p0.x + ny * p0.y + nz * p0.z);
+				const Quadric q = Quadric::FromPlane(nx, ny, nz, d, length * 0.5);
+				for (int k = 0; k < 3; ++k)
+				{
+					m_Quadrics[m_Indices[t + k]].Add(q);
+				}
+			}
+		}
+
+		/// <summary>
+		/// CfbNX targetIndexCount ȉɂȂ܂ŏk񂵂܂
+		/// </summary>
+		void Simplify(size_t targetIndexCount)
+		{
+			const uint32_t vertexCount = static_cast<uint32_t>(m_Vertices.size());
+			std::vector<uint32_t> remap(vertexCount);
+			std::vector<uint8_t> isTouched(vertexCount);
+			std::vector<uint32_t> adjacencyOffsets;
+			std::vector<uint32_t> adjacency;
+			std::vector<Collapse> collapses;
+
+			while (m_Indices.size() > targetIndexCount)
+			{
+				BuildAdjacency(adjacencyOffsets, adjacency);
+
+				// 钸_ׂ̒_ւ̏kׂČɂ
+				// (̂ӂƂ1Ȃ̂ŁA̕ӂ͗1)
+				collapses.clear();
+				for (size_t t = 0; t + 2 < m_Indices.size(); t += 3)
+				{
+					for (int e = 0; e < 3; ++e)
+					{
+						const uint32_t from = m_Indices[t + e];
+						const uint32_t to = m_Indices[t + (e + 1) % 3];
+						if (m_IsLocked[from] != 0) continue;
+						const float cost = static_cast<float>(m_Quadrics[from].GetError(m_Vertices[to].m_Position));
+						collapses.push_back({ from, to, cost });
+					}
+				}
+				if (collapses.empty())
+				{
+					break;
+				}
+				std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b)
+					{
+						if (a.Cost != b.Cost) return a.Cost < b.Cost;
+						if (a.From != b.From) return a.From < b.From;
+						return a.To < b.To;
+					});
+
+				// 덷̏ɁApXŒ_dȂȂ悤ɏk񂷂
+				std::iota(remap.begin(), remap.end(), 0u);
+				std::fill(isTouched.begin(), isTouched.end(), 0);
+				const size_t neededTriangles = (m_Indices.size() - targetIndexCount + 2) / 3;
+				size_t removedTriangles = 0;
+				size_t appliedCount = 0;
+				for (const auto& collapse : collapses)
+				{
+					if (removedTriangles >= neededTriangles) break;
+					if (isTouched[collapse.From] != 0 || isTouched[collapse.To] != 0) continue;
+
+					size_t removed = 0;
+					if (!CanCollapse(collapse, remap, adjacencyOffsets, adjacency, removed)) continue;
+
+					remap[collapse.From] = collapse.To;
+					isTouched[collapse.From] = 1;
+					isTouched[collapse.To] = 1;
+					m_Quadrics[collapse.To].Add(m_Quadrics[collapse.From]);
+					m_MaxError = (std::max)(m_MaxError, collapse.Cost);
+					removedTriangles += removed;
+					++appliedCount;
+				}
+				if (appliedCount == 0)
+				{
+					break;
+				}
+
+				// CfbNXtւAׂꂽOp`菜
+				size_t write = 0;
+				for (size_t t = 0; t + 2 < m_Indices.size(); t += 3)
+				{
+					const uint32_t i0 = remap[m_Indices[t + 0]];
+					const uint32_t i1 = remap[m_Indices[t + 1]];
+					const uint32_t i2 = remap[m_Indices[t + 2]];
+					if (i0 == i1 || i1 == i2 || i2 == i0) continue;
+					m_Indices[write++] = i0;
+					m_Indices[write++] = i1;
+					m_Indices[write++] = i2;
+				}
+				m_Indices.resize(write);
+			}
+		}
+
+		const std::vector<uint32_t>& GetIndices() const { return m_Indices; }
+		//! @brief ܂łɍsk̍ő̌덷 ()
+		float GetError() const { return std::sqrt(m_MaxError); }
+
+	private:
+		void BuildAdjacency(std::vector<uint32_t>& offsets, std::vector<uint32_t>& triangles) const
+		{
+			const size_t vertexCount = m_Vertices.size();
+			offsets.assign(vertexCount + 1, 0);
+			for (const auto index : m_Indices)
+			{
+				++offsets[index + 1];
+			}
+			for (size_t v = 0; v < vertexCount; ++v)
+			{
+				offsets[v + 1] += offsets[v];
+			}
+			triangles.resize(m_Indices.size());
+			std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+			for (size_t i = 0; i < m_Indices.size(); ++i)
+			{
+				triangles[cursor[m_Indices[i]]++] = static_cast<uint32_t>(i / 3);
+			}
+		}
+
+		/// <summary>
+		/// kŗԂOp`ȂmFAOp`̐𐔂܂
+		/// </summary>
+		bool CanCollapse(const Collapse& collapse, const std::vector<uint32_t>& remap,
+			const std::vector<uint32_t>& offsets, const std::vector<uint32_t>& triangles, size_t& outRemoved) const
+		{
+			outRemoved = 0;
+			const Vector3D& target = m_Vertices[collapse.To].m_Position;
+			for (uint32_t a = offsets[collapse.From]; a < offsets[collapse.From + 1]; ++a)
+			{
+				const size_t t = static_cast<size_t>(triangles[a]) * 3;
+				uint32_t tri[3] = { remap[m_Indices[t + 0]], remap[m_Indices[t + 1]], remap[m_Indices[t + 2]] };
+				if (tri[0] == tri[1] || tri[1] == tri[2] || tri[2] == tri[0])
+				{
+					continue;
+				}
+				if (tri[0] == collapse.To || tri[1] == collapse.To || tri[2] == collapse.To)
+				{
+					++outRemoved;
+					continue;
+				}
+
+				const Vector3D p0 = m_Vertices[tri[0]].m_Position;
+				const Vector3D p1 = m_Vertices[tri[1]].m_Position;
+				const Vector3D p2 = m_Vertices[tri[2]].m_Position;
+				const Vector3D before = (p1 - p0).cross(p2 - p0);
+				const Vector3D q0 = tri[0] == collapse.From ? target : p0;
+				const Vector3D q1 = tri[1] == collapse.From ? target : p1;
+				const Vector3D q2 = tri[2] == collapse.From ? target : p2;
+				const Vector3D after = (q1 - q0).cross(q2 - q0);
+				if (before.dot(after) <= 0.0f)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		const std::vector<Vertex>& m_Vertices;
+		std::vector<uint32_t> m_Indices;
+		std::vector<uint8_t> m_IsLocked;
+		std::vector<Quadric> m_Quadrics;
+		float m_MaxError = 0.0f; //!< 2
+	};
+}
+using namespace MeshSimplifierInternal;
+
+float MeshSimplifier::Simplify(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+	size_t targetIndexCount, std::vector<uint32_t>& outIndices)
+{
+	Simplifier simplifier(vertices, indices);
+	simplifier.Simplify(targetIndexCount);
+	outIndices = simplifier.GetIndices();
+	return simplifier.GetError();
+}
+
+void MeshSimplifier::GenerateLods(MeshData& mesh)
+{
+	const size_t lod0IndexCount = mesh.Indices.size();
+	mesh.Lods.clear();
+	mesh.Lods.push_back({ 0, static_cast<uint32_t>(lod0IndexCount), 0.0f });
+	if (lod0IndexCount / 3 < MinLodTriangleCount)
+	{
+		return;
+	}
+
+	//  LOD0 蒼A1̊ȗ𑱂ȂeiǨʂo
+	// (덷͏Ɍ̌`ɑ΂lɂȂ܂)
+	Simplifier simplifier(mesh.Vertices, mesh.Indices);
+	const uint32_t vertexCount = static_cast<uint32_t>(mesh.Vertices.size());
+	size_t previousIndexCount = lod0IndexCount;
+	float reduction = 1.0f;
+	for (uint32_t lod = 1; lod < MaxLodCount; ++lod)
+	{
+		reduction *= LodReduction;
+		const size_t targetIndexCount = static_cast<size_t>(lod0IndexCount / 3 * reduction) * 3;
+		simplifier.Simplify(targetIndexCount);
+
+		auto lodIndices = simplifier.GetIndices();
+		if (lodIndices.empty() || lodIndices.size() > previousIndexCount * MinLodReduction)
+		{
+			break;
+		}
+		MeshOptimizer::OptimizeVertexCache(lodIndices, vertexCount);
+
+		MeshLod lodData;
+		lodData.IndexOffset = static_cast<uint32_t>(mesh.Indices.size());
+		lodData.IndexCount = static_cast<uint32_t>(lodIndices.size());
+		lodData.Error = simplifier.GetError();
+		mesh.Lods.push_back(lodData);
+		mesh.Indices.insert(mesh.Indices.end(), lodIndices.begin(), lodIndices.end());
+		previousIndexCount = lodIndices.size();
+	}
+}
@@ -0,0 +1,279 @@
+#include "Graphics/MeshWelder.h"
+#include "Utilities/Parallel.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+namespace MeshWelderInternal
+{
+	//! _̑̐ (ʒu 3 + @ 3 + UV 2 + ڐ 3)
+	constexpr size_t AttributeCount = 11;
+	//! nbV̌vZECfbNX̕tւ𕪊ŏ̗vf
+	constexpr size_t MinBatch = 4096;
+
+	/// <summary>
+	/// ̋e덷̋t (0 ȂrbgPʂŔr)
+	/// </summary>
+	struct QuantizeScale
+	{
+		float InvEpsilon[AttributeCount] = {};
+	};
+
+	QuantizeScale MakeScale(const MeshData& mesh, const MeshWelder::Settings& settings)
+	{
+		// ʒűe덷̓f̑傫ɍ킹
+		const Vector3D extent = mesh.LocalBounds.Max - mesh.LocalBounds.Min;
+		const float maxExtent = (std::max)((std::max)(extent.x, extent.y), extent.z);
+		const float positionEpsilon = settings.PositionEpsilon * maxExtent;
+
+		const float epsilons[AttributeCount] =
+		{
+			positionEpsilon, positionEpsilon, positionEpsilon,
+			settings.NormalEpsilon, settings.NormalEpsilon, settings.NormalEpsilon,
+			settings.TexCoordEpsilon, settings.TexCoordEpsilon,
+			settings.TangentEpsilon, settings.TangentEpsilon, settings.TangentEpsilon,
+		};
+		QuantizeScale scale;
+		for (size_t i = 0; i < AttributeCount; ++i)
+		{
+			scale.InvEpsilon[i] = epsilons[i] > 0.0f ? 1.0f / epsilons[i] : 0.0f;
+		}
+		return scale;
+	}
+
+	/// <summary>
+	/// _̑яɎo܂
+	/// </summary>
+	void GetAttributes(const Vertex& vertex, float (&outValues)[AttributeCount])
+	{
+		outValues[0] = vertex.m_Position.x;
+		outValues[1] = vertex.m_Position.y;
+		outValues[2] = vertex.m_Position.z;
+		outValues[3] = vertex.m_Normal.x;
+		outValues[4] = vertex.m_Normal.y;
+		outValues[5] = vertex.m_Normal.z;
+		outValues[6] = vertex.m_TexCoord.x;
+		outValues[7] = vertex.m_TexCoord.y;
+		outValues[8] = vertex.m_Tangent.x;
+		outValues[9] = vertex.m_Tangent.y;
+		outValues[10] = vertex.m_Tangent.z;
+	}
+
+	/// <summary>
+	/// _ʎqL[ɂ܂ (L[̒_𓝍܂)
+	/// </summary>
+	void Quantize(const Vertex& vertex, const QuantizeScale& scale, int64_t (&outKey)[AttributeCount])
+	{
+		float values[AttributeCount];
+		GetAttributes(vertex, values);
+		for (size_t i = 0; i < AttributeCount; ++i)
+		{
+			if (scale.InvEpsilon[i] > 0.0f)
+			{
+				outKey[i] = static_cast<int64_t>(std::floor(static_cast<double>(values[i]) * scale.InvEpsilon[i] + 0.5));
+			}
+			else
+			{
+				// -0  +0 ͓lƂĈ
+				const float value = values[i] + 0.0f;
+				uint32_t bits;
+				std::memcpy(&bits, &value, sizeof(bits));
+				outKey[i] = bits;
+			}
+		}
+	}
+
+	uint64_t HashKey(const int64_t (&key)[AttributeCount])
+	{
+		uint64_t hash = 14695981039346656037ULL;
+		for (const auto value : key)
+		{
+			hash ^= static_cast<uint64_t>(value);
+			hash *= 1099511628211ULL;
+		}
+		// ʃrbg̕΂ (nbVe[uƕ̗Ŏg)
+		hash ^= hash >> 29;
+		hash *= 0xBF58476D1CE4E5B9ULL;
+		hash ^= hash >> 32;
+		return hash;
+	}
+
+	/// <summary>
+	/// ʎqL[_ (قƂǂ̓rbgPʂňv̂Őɔׂ)
+	/// </summary>
+	bool IsSameKey(const Vertex& a, const Vertex& b, const QuantizeScale& scale)
+	{
+		if (std::memcmp(&a, &b, sizeof(Vertex)) == 0)
+		{
+			return true;
+		}
+		int64_t keyA[AttributeCount];
+		int64_t keyB[AttributeCount];
+		Quantize(a, scale, keyA);
+		Quantize(b, scale, keyB);
+		return std::memcmp(keyA, keyB, sizeof(keyA)) == 0;
+	}
+
+	/// <summary>
+	/// order[begin, end) ̒_擪珇ɒׁAɌꂽ_̔ԍ outRemap ɏ݂܂
+	/// _ԍI[vAhX@̃nbVe[uŒT܂
+	/// </summary>
+	void FindDuplicates(const std::vector<uint32_t>& order, size_t begin, size_t end,
+		const std::vector<Vertex>& vertices, const std::vector<uint64_t>& hashes, const QuantizeScale& scale,
+		std::vector<uint32_t>& outRemap)
+	{
+		constexpr uint32_t Empty = UINT32_MAX;
+		size_t tableSize = 16;
+		while (tableSize < (end - begin) * 2)
+		{
+			tableSize *= 2;
+		}
+		const size_t mask = tableSize - 1;
+		std::vector<uint32_t> table(tableSize, Empty);
+		for (size_t i = begin; i < end; ++i)
+		{
+			const uint32_t vertex = order[i];
+			for (size_t slot = hashes[vertex] & mask; ; slot = (slot + 1) & mask)
+			{
+				const uint32_t other = table[slot];
+				if (other == Empty)
+				{
+					table[slot] = vertex;
+					outRemap[vertex] = vertex;
+					break;
+				}
+				if (hashes[other] == hashes[vertex] && IsSameKey(vertices[other], vertices[vertex], scale))
+				{
+					outRemap[vertex] = other;
+					break;
+				}
+			}
+		}
+	}
+}
+using namespace MeshWelderInternal;
+
+WeldStats MeshWelder::Weld(MeshData& mesh, const Settings& settings)
+{
+	// LODEbVbg̓CfbNX͈̔͂̂ŁA쐬Oɗnڂ
+	assert(mesh.Lods.empty() && mesh.Meshlets.empty());
+
+	auto& vertices = mesh.Vertices;
+	auto& indices = mesh.Indices;
+	const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+	WeldStats stats;
+	stats.VertexCountBefore = vertexCount;
+	stats.VertexCountAfter = vertexCount;
+	if (vertexCount == 0)
+	{
+		mesh.Weld = stats;
+		return stats;
+	}
+
+	mesh.ComputeBounds();
+	const QuantizeScale scale = MakeScale(mesh, settings);
+	const bool isParallel = settings.IsParallel && vertexCount >= ParallelThreshold;
+
+	// _̃L[̃nbV
+	std::vector<uint64_t> hashes(vertexCount);
+	auto computeHashes = [&](size_t begin, size_t end)
+		{
+			int64_t key[AttributeCount];
+			for (size_t i = begin; i < end; ++i)
+			{
+				Quantize(vertices[i], scale, key);
+				hashes[i] = HashKey(key);
+			}
+		};
+	if (isParallel)
+	{
+		Parallel::For(vertexCount, MinBatch, computeHashes);
+	}
+	else
+	{
+		computeHashes(0, vertexCount);
+	}
+
+	// _͓nbV̂ŁAnbV̏ʃrbgŕgɓƗďdT
+	// g̒͒_ԍ̏Ȃ̂ŁAłŏɌꂽ_c
+	std::vector<uint32_t> remap(vertexCount);
+	const uint32_t groupCount = isParallel ? Parallel::GetWorkerCount() * 4 : 1;
+	std::vector<uint32_t> groupStarts(groupCount + 1, 0);
+	std::vector<uint32_t> order(vertexCount);
+	auto getGroup = [&](uint32_t vertex) { return static_cast<uint32_t>((hashes[vertex] >> 32) % groupCount); };
+	for (uint32_t v = 0; v < vertexCount; ++v)
+	{
+		++groupStarts[getGroup(v) + 1];
+	}
+	for (uint32_t g = 0; g < groupCount; ++g)
+	{
+		groupStarts[g + 1] += groupStarts[g];
+	}
+	{
+		std::vector<uint32_t> cursor(groupStarts.begin(), groupStarts.end() - 1);
+		for (uint32_t v = 0; v < vertexCount; ++v)
+		{
+			order[cursor[getGroup(v)]++] = v;
+		}
+	}
+	Parallel::ForEach(groupCount, [&](size_t g)
+		{
+			FindDuplicates(order, groupStarts[g], groupStarts[g + 1], vertices, hashes, scale, remap);
+		});
+
+	// c钸_̏ɋl߁AVԍU
+	std::vector<uint32_t> newIndices(vertexCount);
+	uint32_t newVertexCount = 0;
+	for (uint32_t v = 0; v < vertexCount; ++v)
+	{
+		if (remap[v] == v)
+		{
+			newIndices[v] = newVertexCount;
+			vertices[newVertexCount++] = vertices[v];
+		}
+	}
+	vertices.resize(newVertexCount);
+	stats.VertexCountAfter = newVertexCount;
+
+	// CfbNX̕tւ
+	auto remapIndices = [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				indices[i] = newIndices[remap[indices[i]]];
+			}
+		};
+	if (isParallel)
+	{
+		Parallel::For(indices.size(), MinBatch, remapIndices);
+	}
+	else
+	{
+		remapIndices(0, indices.size());
+	}
+
+	// _2ȏQƂ (ʐς 0 ) Op`菜
+	// ŎQƂȂȂ_ MeshOptimizer::OptimizeVertexFetch() Ŏ菜
+	size_t writePos = 0;
+	for (size_t i = 0; i + 2 < indices.size(); i += 3)
+	{
+		const uint32_t a = indices[i + 0];
+		const uint32_t b = indices[i + 1];
+		const uint32_t c = indices[i + 2];
+		if (a == b || b == c || c == a)
+		{
+			++stats.DegenerateTriangles;
+			continue;
+		}
+		indices[writePos++] = a;
+		indices[writePos++] = b;
+		indices[writePos++] = c;
+	}
+	indices.resize(writePos);
+
+	mesh.ComputeBounds();
+	mesh.Weld = stats;
+	return stats;
+}
@@ -0,0 +1,334 @@
+#include "Graphics/MeshletBuilder.h"
+#include "Graphics/MeshOptimizer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+namespace MeshletBuilderInternal
+{
+	constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+	/// <summary>
+	/// ʒu̒_ɓԍU܂ (UVE@̌pڂŕꂽ_qĂƂ݂Ȃ)
+	/// </summary>
+	/// <returns> ԍ̎ނ̐ </returns>
+	uint32_t GroupPositions(const std::vector<Vertex>& vertices, std::vector<uint32_t>& outGroups)
+	{
+		const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+		std::vector<uint32_t> order(vertexCount);
+		std::iota(order.begin(), order.end(), 0u);
+		auto positionLess = [&](uint32_t a, uint32_t b) { return std::memcmp(&vertices[a].m_Position, &vertices[b].m_Position, sizeof(Vector3D)) < 0; };
+		std::sort(order.begin(), order.end(), positionLess);
+
+		outGroups.assign(vertexCount, 0);
+		uint32_t groupCount = 0;
+		for (uint32_t i = 0; i < vertexCount; ++i)
+		{
+			if (i > 0 && positionLess(order[i - 1], order[i]))
+			{
+				++groupCount;
+			}
+			outGroups[order[i]] = groupCount;
+		}
+		return vertexCount > 0 ? groupCount + 1 : 0;
+	}
+
+	/// <summary>
+	/// SĂ̕ӂ2ȏ̎Op`LĂ邩 (bV) 𒲂ׂ܂
+	/// </summary>
+	bool IsClosed(const std::vector<uint32_t>& indices, size_t indexCount, const std::vector<uint32_t>& groups)
+	{
+		std::vector<uint64_t> edges;
+		edges.reserve(indexCount);
+		for (size_t i = 0; i + 2 < indexCount; i += 3)
+		{
+			for (int k = 0; k < 3; ++k)
+			{
+				const uint32_t a = groups[indices[i + k]];
+				const uint32_t b = groups[indices[i + (k + 1) % 3]];
+				if (a != b)
+				{
+					edges.push_back((static_cast<uint64_t>((std::min)(a, b)) << 32) | (std::max)(a, b));
+				}
+			}
+		}
+		std::sort(edges.begin(), edges.end());
+		for (size_t i = 0; i < edges.size(); )
+		{
+			size_t end = i + 1;
+			while (end < edges.size() && edges[end] == edges[i])
+			{
+				++end;
+			}
+			if (end - i < 2)
+			{
+				return false;
+			}
+			i = end;
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// Op`̕\̌ (PʃxNg)
+	/// ̓[_[ɂđĂȂ̂ŁAʂ̖@𒸓_@̌ɍ킹܂
+	/// </summary>
+	/// <returns> ʐςȂꍇ̓[xNg </returns>
+	Vector3D GetFacingNormal(const Vertex& v0, const Vertex& v1, const Vertex& v2)
+	{
+		Vector3D normal = (v1.m_Position - v0.m_Position).cross(v2.m_Position - v0.m_Position);
+		const float length = normal.length();
+		if (length <= 0.0f)
+		{
+			return Vector3D(0.0f, 0.0f, 0.0f);
+		}
+		normal = normal * (1.0f / length);
+		if (normal.dot(v0.m_Normal + v1.m_Normal + v2.m_Normal) < 0.0f)
+		{
+			normal = normal * -1.0f;
+		}
+		return normal;
+	}
+
+	/// <summary>
+	/// bVbg̋EƖ@R[߂܂
+	/// </summary>
+	void ComputeBounds(const std::vector<Vertex>& vertices, const uint32_t* pIndices, uint32_t indexCount, bool isConeEnabled, Meshlet& meshlet)
+	{
+		// E (AABB ̒Sł_܂ł̋)
+		AABB bounds;
+		for (uint32_t i = 0; i < indexCount; ++i)
+		{
+			bounds.Expand(vertices[pIndices[i]].m_Position);
+		}
+		meshlet.Bounds.Center = bounds.GetCenter();
+		float maxDistSq = 0.0f;
+		for (uint32_t i = 0; i < indexCount; ++i)
+		{
+			const Vector3D d = vertices[pIndices[i]].m_Position - meshlet.Bounds.Center;
+			maxDistSq = (std::max)(maxDistSq, d.dot(d));
+		}
+		meshlet.Bounds.Radius = std::sqrt(maxDistSq);
+
+		meshlet.ConeAxis = Vector3D(0.0f, 0.0f, 0.0f);
+		meshlet.ConeCutoff = 1.0f;
+		if (!isConeEnabled)
+		{
+			return;
+		}
+
+		// ͖ʂ̌̕ρAL͎ƍłꂽʂ̌Ƃ̊px
+		Vector3D normals[MeshletBuilder::MaxTriangles];
+		uint32_t normalCount = 0;
+		Vector3D axis(0.0f, 0.0f, 0.0f);
+		for (uint32_t i = 0; i + 2 < indexCount; i += 3)
+		{
+			const Vector3D normal = GetFacingNormal(vertices[pIndices[i]], vertices[pIndices[i + 1]], vertices[pIndices[i + 2]]);
+			if (normal.dot(normal) > 0.0f)
+			{
+				normals[normalCount++] = normal;
+				axis += normal;
+			}
+		}
+		const float axisLength = axis.length();
+		if (normalCount == 0 || axisLength <= SMALL_NUMBER)
+		{
+			return;
+		}
+		axis = axis * (1.0f / axisLength);
+
+		float minDot = 1.0f;
+		for (uint32_t i = 0; i < normalCount; ++i)
+		{
+			minDot = (std::min)(minDot, normals[i].dot(axis));
+		}
+		// ȏɍLĂƁAǂ猩Ă\̖ʂ
+		if (minDot <= 0.0f)
+		{
+			return;
+		}
+		meshlet.ConeAxis = axis;
+		meshlet.ConeCutoff = std::sqrt((std::max)(1.0f - minDot * minDot, 0.0f));
+	}
+
+	/// <summary>
+	/// bVbg̎Op`𒸓_LbVɕבւ܂ (bVbg̒_ŔԍU蒼čœK)
+	/// </summary>
+	void OptimizeMeshletVertexCache(uint32_t* pIndices, uint32_t indexCount, std::vector<uint32_t>& localIndex)
+	{
+		std::vector<uint32_t> localToGlobal;
+		std::vector<uint32_t> local(indexCount);
+		for (uint32_t i = 0; i < indexCount; ++i)
+		{
+			const uint32_t index = pIndices[i];
+			if (localIndex[index] == InvalidIndex)
+			{
+				localIndex[index] = static_cast<uint32_t>(localToGlobal.size());
+				localToGlobal.push_back(index);
+			}
+			local[i] = localIndex[index];
+		}
+		MeshOptimizer::OptimizeVertexCache(local, static_cast<uint32_t>(localToGlobal.size()));
+		for (uint32_t i = 0; i < indexCount; ++i)
+		{
+			pIndices[i] = localToGlobal[local[i]];
+		}
+		for (const uint32_t index : localToGlobal)
+		{
+			localIndex[index] = InvalidIndex;
+		}
+	}
+}
+using namespace MeshletBuilderInternal;
+
+void MeshletBuilder::Build(MeshData& mesh)
+{
+	mesh.Meshlets.clear();
+	if (!mesh.Lods.empty())
+	{
+		assert(false && "bVbg LOD Oɍ쐬Ă");
+		return;
+	}
+
+	auto& indices = mesh.Indices;
+	const uint32_t vertexCount = static_cast<uint32_t>(mesh.Vertices.size());
+	const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+	if (triangleCount == 0)
+	{
+		return;
+	}
+
+	std::vector<uint32_t> groups;
+	const uint32_t groupCount = GroupPositions(mesh.Vertices, groups);
+	const bool isConeEnabled = IsClosed(indices, triangleCount * 3, groups);
+
+	// ʒuɂgOp`̈ꗗ
+	std::vector<uint32_t> adjacencyOffsets(groupCount + 1, 0);
+	for (uint32_t i = 0; i < triangleCount * 3; ++i)
+	{
+		++adjacencyOffsets[groups[indices[i]] + 1];
+	}
+	for (uint32_t g = 0; g < groupCount; ++g)
+	{
+		adjacencyOffsets[g + 1] += adjacencyOffsets[g];
+	}
+	std::vector<uint32_t> adjacency(triangleCount * 3);
+	{
+		std::vector<uint32_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+		for (uint32_t i = 0; i < triangleCount * 3; ++i)
+		{
+			adjacency[cursor[groups[indices[i]]]++] = i / 3;
+		}
+	}
+
+	std::vector<uint8_t> isUsed(triangleCount, 0);
+	// _܂܂ĂEOp`ɓĂŐṼbVbgԍ
+	std::vector<uint32_t> vertexMeshlet(vertexCount, InvalidIndex);
+	std::vector<uint32_t> candidateMeshlet(triangleCount, InvalidIndex);
+	std::vector<uint32_t> meshletVertices;
+	std::vector<uint32_t> meshletTriangles;
+	std::vector<uint32_t> candidates;
+	std::vector<uint32_t> newIndices;
+	newIndices.reserve(triangleCount * 3);
+	std::vector<uint32_t> localIndex(vertexCount, InvalidIndex);
+
+	uint32_t seed = 0;
+	while (true)
+	{
+		// gp̎Op`̂AœKς݂̏ōŏ̂̂n߂
+		while (seed < triangleCount && isUsed[seed])
+		{
+			++seed;
+		}
+		if (seed == triangleCount)
+		{
+			break;
+		}
+
+		const uint32_t meshletIndex = static_cast<uint32_t>(mesh.Meshlets.size());
+		meshletVertices.clear();
+		meshletTriangles.clear();
+		candidates.clear();
+
+		auto addTriangle = [&](uint32_t triangle)
+			{
+				isUsed[triangle] = 1;
+				meshletTriangles.push_back(triangle);
+				for (int k = 0; k < 3; ++k)
+				{
+					const uint32_t index = indices[triangle * 3 + k];
+					if (vertexMeshlet[index] == meshletIndex)
+					{
+						continue;
+					}
+					vertexMeshlet[index] = meshletIndex;
+					meshletVertices.push_back(index);
+					// V_ƓʒugOp`ɉ
+					const uint32_t group = groups[index];
+					for (uint32_t a = adjacencyOffsets[group]; a < adjacencyOffsets[group + 1]; ++a)
+					{
+						const uint32_t candidate = adjacency[a];
+						if (!isUsed[candidate] && candidateMeshlet[candidate] != meshletIndex)
+						{
+							candidateMeshlet[candidate] = meshletIndex;
+							candidates.push_back(candidate);
+						}
+					}
+				}
+			};
+		addTriangle(seed);
+
+		// ǉő钸_łȂאڎOp`AɒB܂ŉĂ
+		while (meshletTriangles.size() < MaxTriangles)
+		{
+			uint32_t best = InvalidIndex;
+			uint32_t bestNewVertices = 4;
+			for (size_t c = 0; c < candidates.size(); )
+			{
+				const uint32_t triangle = candidates[c];
+				if (isUsed[triangle])
+				{
+					candidates[c] = candidates.back();
+					candidates.pop_back();
+					continue;
+				}
+				uint32_t newVertices = 0;
+				for (int k = 0; k < 3; ++k)
+				{
+					newVertices += vertexMeshlet[indices[triangle * 3 + k]] != meshletIndex ? 1 : 0;
+				}
+				// Ȃ猳̏ (_LbVEI[o[h[̏) Ő̂̂I
+				if (newVertices < bestNewVertices || (newVertices == bestNewVertices && triangle < best))
+				{
+					best = triangle;
+					bestNewVertices = newVertices;
+				}
+				++c;
+			}
+			if (best == InvalidIndex || meshletVertices.size() + bestNewVertices > MaxVertices)
+			{
+				break;
+			}
+			addTriangle(best);
+		}
+
+		Meshlet meshlet;
+		meshlet.IndexOffset = static_cast<uint32_t>(newIndices.size());
+		meshlet.IndexCount = static_cast<uint32_t>(meshletTriangles.size() * 3);
+		for (const uint32_t triangle : meshletTriangles)
+		{
+			newIndices.insert(newIndices.end(), indices.begin() + triangle * 3, indices.begin() + triangle * 3 + 3);
+		}
+		OptimizeMeshletVertexCache(newIndices.data() + meshlet.IndexOffset, meshlet.IndexCount, localIndex);
+		ComputeBounds(mesh.Vertices, newIndices.data() + meshlet.IndexOffset, meshlet.IndexCount, isConeEnabled, meshlet);
+		mesh.Meshlets.push_back(meshlet);
+	}
+
+	// Op`̕тς̂ŁA_QƏɕג (ʒu͕ςȂ̂ŋE͂̂܂܎g)
+	indices.swap(newIndices);
+	MeshOptimizer::OptimizeVertexFetch(mesh.Vertices, indices);
+	mesh.CacheStatsAfter = MeshOptimizer::AnalyzeVertexCache(indices, static_cast<uint32_t>(mesh.Vertices.size()));
+}
@@ -0,0 +1,61 @@
+#include "Graphics/MeshletCuller.h"
+
+#include <cmath>
+
+void MeshletCuller::SetView(const Matrix4x4& viewProj, const Vector3D& viewPosition, bool isConeCulling)
+{
+	m_ViewProj = viewProj;
+	m_ViewPosition = viewPosition;
+	m_IsConeCulling = isConeCulling;
+}
+
+void MeshletCuller::SetWorld(const Matrix4x4& world)
+{
+	// v * World * ViewProj Ȃ̂ŁAWorld * ViewProj oʂ̓[JԂ̕ʂɂȂ
+	// lXP[ł[JԂ̋Ê܂ܔł
+	m_LocalFrustum = Frustum::FromViewProj(world * m_ViewProj);
+	m_LocalViewPosition = Matrix4x4::Apply(Matrix4x4::inverse(world), m_ViewPosition);
+}
+
+const std::vector<IndexRange>& MeshletCuller::Cull(const std::vector<Meshlet>& meshlets)
+{
+	m_Ranges.clear();
+	for (const auto& meshlet : meshlets)
+	{
+		if (!m_LocalFrustum.Intersects(meshlet.Bounds))
+		{
+			continue;
+		}
+
+		// SĂ̎Op`_猩ėȂ珜O
+		// dot(c - e, axis) >= cutoff * |c - e| + r (Êǂ猩Ă@R[_Ɣ΂)
+		if (m_IsConeCulling && meshlet.ConeCutoff < 1.0f)
+		{
+			const Vector3D toCenter = meshlet.Bounds.Center - m_LocalViewPosition;
+			if (toCenter.dot(meshlet.ConeAxis) >= meshlet.ConeCutoff * toCenter.length() + meshlet.Bounds.Radius)
+			{
+				++m_Stats.ConeCulledMeshlets;
+				continue;
+			}
+		}
+
+		// O͈̔͂ɑĂΘA
+		if (!m_Ranges.empty() && m_Ranges.back().IndexOffset + m_Ranges.back().IndexCount == meshlet.IndexOffset)
+		{
+			m_Ranges.back().IndexCount += meshlet.IndexCount;
+		}
+		else
+		{
+			m_Ranges.push_back({ meshlet.IndexOffset, meshlet.IndexCount });
+		}
+		++m_Stats.VisibleMeshlets;
+	}
+
+	m_Stats.TotalMeshlets += static_cast<uint32_t>(meshlets.size());
+	m_Stats.Ranges += static_cast<uint32_t>(m_Ranges.size());
+	if (!m_Ranges.empty())
+	{
+		++m_Stats.Meshes;
+	}
+	return m_Ranges;
+}
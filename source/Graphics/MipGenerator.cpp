@@ -0,0 +1,392 @@
+#include "Graphics/MipGenerator.h"
+#include "Math/MathSIMD.h"
+#include "Utilities/Parallel.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace MipGeneratorInternal
+{
+	using MathSIMD::float4;
+
+	//! Kaiser tB^̔a (k̉f)
+	constexpr float KaiserWidth = 3.0f;
+	//! Kaiser ̌` (傫قǐAڂ₷)
+	constexpr float KaiserAlpha = 4.0f;
+	//! xɉ̃tB^Ăo͂̍s (Ɨ̈̑傫})
+	constexpr uint32_t BandRows = 16;
+	//! sRGB ւ̕Ŕr̊Jnʒu\̋Ԑ
+	constexpr uint32_t EncodeBuckets = 4096;
+
+	/// <summary>
+	/// o͂1fɊ^͂̉f
+	/// </summary>
+	struct Tap
+	{
+		uint32_t Index;
+		float Weight;
+	};
+
+	/// <summary>
+	/// 1̃tB^ (o͂̉f i ɂ Taps[Offsets[i], Offsets[i + 1]) ^)
+	/// </summary>
+	struct AxisFilter
+	{
+		std::vector<uint32_t> Offsets;
+		std::vector<Tap> Taps;
+	};
+
+	/// <summary>
+	/// sRGB Ɛ`̕ϊɎg\ (256 ʂ̒lOɌvZĂ)
+	/// </summary>
+	struct SRGBTable
+	{
+		float ToLinear[256];
+		float Thresholds[256]; //!< sRGB  k  k + 1 ̒Ԃɓ`̒l (͂Ƃ̔rŐmɊۂ߂B͔ԕ)
+		uint8_t FirstCode[EncodeBuckets + 1]; //!< `̒l EncodeBuckets Ԃ̉[ɓ sRGB ̒l (r̊Jnʒu)
+
+		SRGBTable()
+		{
+			for (int i = 0; i < 256; ++i)
+			{
+				ToLinear[i] = Decode(i / 255.0);
+			}
+			for (int i = 0; i < 255; ++i)
+			{
+				Thresholds[i] = Decode((i + 0.5) / 255.0);
+			}
+			Thresholds[255] = std::numeric_limits<float>::infinity();
+			for (uint32_t bucket = 0, code = 0; bucket <= EncodeBuckets; ++bucket)
+			{
+				const float v = static_cast<float>(bucket) / EncodeBuckets;
+				while (v >= Thresholds[code])
+				{
+					++code;
+				}
+				FirstCode[bucket] = static_cast<uint8_t>(code);
+			}
+		}
+
+		static float Decode(double c)
+		{
+			return static_cast<float>(c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+		}
+	};
+
+	const SRGBTable& GetSRGBTable()
+	{
+		static const SRGBTable table;
+		return table;
+	}
+
+	//! @brief 1ό`xbZ֐ I0 (WJ)
+	double BesselI0(double x)
+	{
+		double sum = 1.0;
+		double term = 1.0;
+		const double halfX2 = x * x * 0.25;
+		for (int k = 1; k < 32 && term > sum * 1e-12; ++k)
+		{
+			term *= halfX2 / (static_cast<double>(k) * k);
+			sum += term;
+		}
+		return sum;
+	}
+
+	double Sinc(double x)
+	{
+		if (std::abs(x) < 1e-6)
+		{
+			return 1.0;
+		}
+		const double px = 3.14159265358979323846 * x;
+		return std::sin(px) / px;
+	}
+
+	/// <summary>
+	///  srcSize f dstSize fɏktB^܂
+	/// ͈͊Ỏf͒[̉f̏d݂ɉAd݂̍v 1 ɂ܂
+	/// </summary>
+	AxisFilter BuildAxisFilter(uint32_t srcSize, uint32_t dstSize, MipGenerator::Filter filter)
+	{
+		AxisFilter result;
+		result.Offsets.reserve(dstSize + 1);
+		const double scale = static_cast<double>(srcSize) / dstSize;
+		const double kaiserNorm = 1.0 / BesselI0(KaiserAlpha);
+
+		std::vector<double> weights;
+		for (uint32_t dst = 0; dst < dstSize; ++dst)
+		{
+			result.Offsets.push_back(static_cast<uint32_t>(result.Taps.size()));
+
+			// o͂̉f͏͈̔ [lo, hi)
+			const double lo = dst * scale;
+			const double hi = (dst + 1) * scale;
+			const double center = (lo + hi) * 0.5;
+			const double radius = filter == MipGenerator::Filter::Box ? scale * 0.5 : scale * KaiserWidth;
+			const int first = static_cast<int>(std::floor(center - radius));
+			const int last = static_cast<int>(std::ceil(center + radius));
+
+			weights.assign(static_cast<size_t>(last - first), 0.0);
+			double total = 0.0;
+			for (int i = first; i < last; ++i)
+			{
+				double w = 0.0;
+				if (filter == MipGenerator::Filter::Box)
+				{
+					// ͂̉f [i, i + 1) Ɣ͈͂̏dȂ
+					w = (std::max)(0.0, (std::min)(hi, i + 1.0) - (std::max)(lo, static_cast<double>(i)));
+				}
+				else
+				{
+					// f̒S Kaiser t sinc ] (t ͏o͂̉fPʂ̋)
+					const double t = (i + 0.5 - center) / scale;
+					const double x = t / KaiserWidth;
+					if (std::abs(x) < 1.0)
+					{
+						w = Sinc(t) * BesselI0(KaiserAlpha * std::sqrt(1.0 - x * x)) * kaiserNorm;
+					}
+				}
+				weights[static_cast<size_t>(i - first)] = w;
+				total += w;
+			}
+
+			for (int i = first; i < last; ++i)
+			{
+				const double w = weights[static_cast<size_t>(i - first)];
+				if (w == 0.0)
+				{
+					continue;
+				}
+				const uint32_t index = static_cast<uint32_t>((std::min)((std::max)(i, 0), static_cast<int>(srcSize) - 1));
+				const float weight = static_cast<float>(w / total);
+				if (result.Taps.size() > result.Offsets.back() && result.Taps.back().Index == index)
+				{
+					result.Taps.back().Weight += weight;
+				}
+				else
+				{
+					result.Taps.push_back({ index, weight });
+				}
+			}
+		}
+		result.Offsets.push_back(static_cast<uint32_t>(result.Taps.size()));
+		return result;
+	}
+
+	/// <summary>
+	/// 1s𕽋ςԂ float4 ɕϊ܂
+	/// </summary>
+	void DecodeRow(const uint8_t* pSrc, uint32_t width, MipGenerator::Content type, float* pDst)
+	{
+		constexpr float inv255 = 1.0f / 255.0f;
+		constexpr float twoOver255 = 2.0f / 255.0f;
+		const auto& srgb = GetSRGBTable();
+		for (uint32_t x = 0; x < width; ++x, pSrc += 4, pDst += 4)
+		{
+			switch (type)
+			{
+			case MipGenerator::Content::Color:
+				pDst[0] = srgb.ToLinear[pSrc[0]];
+				pDst[1] = srgb.ToLinear[pSrc[1]];
+				pDst[2] = srgb.ToLinear[pSrc[2]];
+				pDst[3] = pSrc[3] * inv255;
+				break;
+			case MipGenerator::Content::Normal:
+				pDst[0] = pSrc[0] * twoOver255 - 1.0f;
+				pDst[1] = pSrc[1] * twoOver255 - 1.0f;
+				pDst[2] = pSrc[2] * twoOver255 - 1.0f;
+				pDst[3] = pSrc[3] * inv255;
+				break;
+			default:
+				pDst[0] = pSrc[0] * inv255;
+				pDst[1] = pSrc[1] * inv255;
+				pDst[2] = pSrc[2] * inv255;
+				pDst[3] = pSrc[3] * inv255;
+				break;
+			}
+		}
+	}
+
+	uint8_t EncodeUnorm(float v)
+	{
+		const float scaled = v * 255.0f + 0.5f;
+		return static_cast<uint8_t>((std::min)((std::max)(scaled, 0.0f), 255.0f));
+	}
+
+	uint8_t EncodeSRGB(float v)
+	{
+		// Ԃ̉[̒ln߂āAl𒴂Ԃi߂ (0 t߈ȊO͍X1)
+		const auto& srgb = GetSRGBTable();
+		const float clamped = (std::min)((std::max)(v, 0.0f), 1.0f);
+		uint32_t code = srgb.FirstCode[static_cast<uint32_t>(clamped * EncodeBuckets)];
+		while (clamped >= srgb.Thresholds[code])
+		{
+			++code;
+		}
+		return static_cast<uint8_t>(code);
+	}
+
+	/// <summary>
+	/// ς float4  RGBA8 ɖ߂܂
+	/// </summary>
+	void EncodePixel(const float* pSrc, MipGenerator::Content type, uint8_t* pDst)
+	{
+		switch (type)
+		{
+		case MipGenerator::Content::Color:
+			pDst[0] = EncodeSRGB(pSrc[0]);
+			pDst[1] = EncodeSRGB(pSrc[1]);
+			pDst[2] = EncodeSRGB(pSrc[2]);
+			break;
+		case MipGenerator::Content::Normal:
+		{
+			// ςŒZȂ@𐳋K (܂Ȃꍇ +Z)
+			float x = pSrc[0];
+			float y = pSrc[1];
+			float z = pSrc[2];
+			const float lengthSq = x * x + y * y + z * z;
+			if (lengthSq > 1e-12f)
+			{
+				const float invLength = 1.0f / std::sqrt(lengthSq);
+				x *= invLength;
+				y *= invLength;
+				z *= invLength;
+			}
+			else
+			{
+				x = 0.0f;
+				y = 0.0f;
+				z = 1.0f;
+			}
+			pDst[0] = EncodeUnorm(x * 0.5f + 0.5f);
+			pDst[1] = EncodeUnorm(y * 0.5f + 0.5f);
+			pDst[2] = EncodeUnorm(z * 0.5f + 0.5f);
+		}
+		break;
+		default:
+			pDst[0] = EncodeUnorm(pSrc[0]);
+			pDst[1] = EncodeUnorm(pSrc[1]);
+			pDst[2] = EncodeUnorm(pSrc[2]);
+			break;
+		}
+		pDst[3] = EncodeUnorm(pSrc[3]);
+	}
+
+	/// <summary>
+	/// taps ̏d݂ float4 ̉fv܂ (pPixels[(Index - firstIndex) * stride] Q)
+	/// </summary>
+	float4 Accumulate(const float* pPixels, size_t stride, uint32_t firstIndex, const Tap* pBegin, const Tap* pEnd)
+	{
+		float4 sum = MathSIMD::Splat(0.0f);
+		for (const Tap* pTap = pBegin; pTap != pEnd; ++pTap)
+		{
+			const float4 pixel = MathSIMD::Load(pPixels + (pTap->Index - firstIndex) * stride);
+			sum = MathSIMD::Add(sum, MathSIMD::Mul(pixel, MathSIMD::Splat(pTap->Weight)));
+		}
+		return sum;
+	}
+
+	/// <summary>
+	/// o͂̍s [dstBegin, dstEnd) ܂
+	/// Kvȓ͂̍sɉ̃tB^čƗ̈ɒuAɏc̃tB^܂
+	/// </summary>
+	void DownsampleRows(const MipGenerator::Image& source, const MipGenerator::Image& destination, MipGenerator::Content type,
+		const AxisFilter& horizontal, const AxisFilter& vertical, uint32_t dstBegin, uint32_t dstEnd)
+	{
+		const size_t dstStride = static_cast<size_t>(destination.Width) * 4;
+		std::vector<float> decoded(static_cast<size_t>(source.Width) * 4);
+		std::vector<float> band;
+		for (uint32_t bandBegin = dstBegin; bandBegin < dstEnd; bandBegin += BandRows)
+		{
+			const uint32_t bandEnd = (std::min)(bandBegin + BandRows, dstEnd);
+
+			// ̑тQƂ͂̍s͈̔
+			uint32_t srcFirst = source.Height;
+			uint32_t srcLast = 0;
+			for (uint32_t t = vertical.Offsets[bandBegin]; t < vertical.Offsets[bandEnd]; ++t)
+			{
+				srcFirst = (std::min)(srcFirst, vertical.Taps[t].Index);
+				srcLast = (std::max)(srcLast, vertical.Taps[t].Index);
+			}
+
+			band.resize(static_cast<size_t>(srcLast - srcFirst + 1) * dstStride);
+			for (uint32_t y = srcFirst; y <= srcLast; ++y)
+			{
+				DecodeRow(source.pPixels + y * source.RowPitch, source.Width, type, decoded.data());
+				float* pRow = band.data() + (y - srcFirst) * dstStride;
+				for (uint32_t x = 0; x < destination.Width; ++x)
+				{
+					const Tap* pTaps = horizontal.Taps.data();
+					MathSIMD::Store(pRow + x * 4,
+						Accumulate(decoded.data(), 4, 0, pTaps + horizontal.Offsets[x], pTaps + horizontal.Offsets[x + 1]));
+				}
+			}
+
+			for (uint32_t y = bandBegin; y < bandEnd; ++y)
+			{
+				uint8_t* pDst = destination.pPixels + y * destination.RowPitch;
+				const Tap* pTaps = vertical.Taps.data();
+				for (uint32_t x = 0; x < destination.Width; ++x)
+				{
+					float pixel[4];
+					MathSIMD::Store(pixel,
+						Accumulate(band.data() + x * 4, dstStride, srcFirst, pTaps + vertical.Offsets[y], pTaps + vertical.Offsets[y + 1]));
+					EncodePixel(pixel, type, pDst + x * 4);
+				}
+			}
+		}
+	}
+}
+using namespace MipGeneratorInternal;
+
+uint32_t MipGenerator::GetMipCount(uint32_t width, uint32_t height)
+{
+	uint32_t count = 1;
+	for (uint32_t size = (std::max)(width, height); size > 1; size >>= 1)
+	{
+		++count;
+	}
+	return count;
+}
+
+uint32_t MipGenerator::GetNextMipSize(uint32_t size)
+{
+	return (std::max)(size >> 1, 1u);
+}
+
+void MipGenerator::Downsample(const Image& source, const Image& destination, const Settings& settings)
+{
+	assert(source.Width >= destination.Width && source.Height >= destination.Height);
+	if (destination.Width == 0 || destination.Height == 0)
+	{
+		return;
+	}
+
+	const AxisFilter horizontal = BuildAxisFilter(source.Width, destination.Width, settings.Kind);
+	const AxisFilter vertical = BuildAxisFilter(source.Height, destination.Height, settings.Kind);
+	auto job = [&](size_t begin, size_t end)
+		{
+			DownsampleRows(source, destination, settings.Type, horizontal, vertical,
+				static_cast<uint32_t>(begin), static_cast<uint32_t>(end));
+		};
+	if (settings.IsParallel)
+	{
+		Parallel::For(destination.Height, BandRows, job);
+	}
+	else
+	{
+		job(0, destination.Height);
+	}
+}
+
+void MipGenerator::Generate(const Image* pMips, uint32_t mipCount, const Settings& settings)
+{
+	for (uint32_t mip = 1; mip < mipCount; ++mip)
+	{
+		Downsample(pMips[mip - 1], pMips[mip], settings);
+	}
+}
@@ -6,10 +6,78 @@
 #include "Graphics/DX12Commands.h"
 #include "Framework/Renderer.h"
 #include "Graphics/Texture.h"
+#include "Graphics/MeshCache.h"
+#include "Graphics/GltfLoader.h"
+#include "Graphics/MeshWelder.h"
+#include "Graphics/MeshOptimizer.h"
+#include "Graphics/MeshletBuilder.h"
+#include "Graphics/MeshletCuller.h"
+#include "Graphics/MeshSimplifier.h"
+#include "Graphics/LodSelector.h"
+#include "Graphics/TextureStreamer.h"
+#include "Graphics/VertexPacking.h"
 #include "Math/Matrix4x4.h"
+#include "Math/TransformBatch.h"
+#include "Utilities/Parallel.h"
+
+namespace ModelInternal
+{
+	// Assimp ̓ǂݍ݃tO (ύXƃbVLbV͍蒼܂)
+	constexpr uint32_t ImportFlags =
+		aiProcess_Triangulate |               // Op`
+		aiProcess_PreTransformVertices |      // ϊ̓Kp
+		aiProcess_CalcTangentSpace |          // ڐԂ̌vZ
+		aiProcess_GenSmoothNormals |          // X[YVF[fBO̖@
+		aiProcess_RemoveRedundantMaterials |  // 璷ȃ}eA̍폜
+		aiProcess_OptimizeMeshes |            // bV̍œK
+		aiProcess_MakeLeftHanded |            // nɕϊ
+		aiProcess_FlipUVs;                    // UV]
+
+	/// <summary>
+	/// aiMesh 𒸓_ECfbNXzɕϊAE{[vZ܂
+	/// </summary>
+	void ConvertMesh(const aiMesh* pSrcMesh, MeshData& dstMesh)
+	{
+		dstMesh.MaterialIndex = pSrcMesh->mMaterialIndex;
+		dstMesh.Name = pSrcMesh->mName.C_Str();
+
+		auto& vertices = dstMesh.Vertices;
+		vertices.resize(pSrcMesh->mNumVertices);
+		// ̗L͒_ł͂ȂbVPʂŔ
+		const aiVector3D* pPositions = pSrcMesh->mVertices;
+		const aiVector3D* pNormals = pSrcMesh->mNormals;
+		const aiVector3D* pTexCoords = pSrcMesh->HasTextureCoords(0) ? pSrcMesh->mTextureCoords[0] : nullptr;
+		const aiVector3D* pTangents = pSrcMesh->HasTangentsAndBitangents() ? pSrcMesh->mTangents : nullptr;
+		for (auto i = 0u; i < pSrcMesh->mNumVertices; ++i)
+		{
+			auto& vertex = vertices[i];
+			vertex.m_Position = Vector3D(pPositions[i].x, pPositions[i].y, pPositions[i].z);
+			vertex.m_Normal = Vector3D(pNormals[i].x, pNormals[i].y, pNormals[i].z);
+			vertex.m_TexCoord = pTexCoords != nullptr ? Vector2D(pTexCoords[i].x, pTexCoords[i].y) : Vector2D();
+			vertex.m_Tangent = pTangents != nullptr ? Vector3D(pTangents[i].x, pTangents[i].y, pTangents[i].z) : Vector3D();
+		}
+
+		// CfbNXz̍쐬
+		auto& indices = dstMesh.Indices;
+		indices.resize(pSrcMesh->mNumFaces * 3);
+		for (auto i = 0u; i < pSrcMesh->mNumFaces; ++i)
+		{
+			auto pFace = &(pSrcMesh->mFaces[i]);
+			assert(pFace->mNumIndices == 3); // Op`Ă͂Ȃ̂3ł邱ƂmF
+			indices[i * 3 + 0] = pFace->mIndices[0];
+			indices[i * 3 + 1] = pFace->mIndices[1];
+			indices[i * 3 + 2] = pFace->mIndices[2];
+		}
+
+		// E{[̌vZ (LbVɂۑ܂)
+		dstMesh.ComputeBounds();
+	}
+}
+using namespace ModelInternal;
 
 Model::Model(Renderer* pRenderer, const std::wstring& filePath)
 {
+	auto loadStart = std::chrono::high_resolution_clock::now();
 	m_pRenderer = pRenderer;
 	m_Name = Utility::WStringToString(filePath);
 	if (filePath.c_str() == nullptr)
@@ -18,44 +86,85 @@ Model::Model(Renderer* pRenderer, const std::wstring& filePath)
 		return;
 	}
 
-	// wchar_t  char ւ̕ϊ
-	auto path = Utility::WStringToString(filePath);
-
-	Assimp::Importer importer;
-	int flag = 0;
-	flag |= aiProcess_Triangulate;            // Op`
-	flag |= aiProcess_PreTransformVertices;  // ϊ̓Kp
-	flag |= aiProcess_CalcTangentSpace;    // ڐԂ̌vZ
-	flag |= aiProcess_GenSmoothNormals;   // X[YVF[fBO̖@
-	flag |= aiProcess_RemoveRedundantMaterials; // 璷ȃ}eA̍폜
-	flag |= aiProcess_OptimizeMeshes;       // bV̍œK
-	flag |= aiProcess_MakeLeftHanded;      // nɕϊ
-	flag |= aiProcess_FlipUVs;              // UV]
-
-	// f[^̓ǂݍ
-	auto pScene = importer.ReadFile(path, flag);
+	// LbV΂gAȂΓǂݍŃLbV쐬
+	// glTF ͐p[_[œǂݍ݁AΉ̋@\gĂꍇ Assimp œǂݍݒ
+	ModelData modelData;
+	const auto cachePath = MeshCache::GetCachePath(filePath);
+	const auto cacheKey = MeshCache::MakeKey(filePath, ImportFlags);
+	if (MeshCache::Load(cachePath, cacheKey, modelData))
+	{
+		m_ImportSource = ImportSource::Cache;
+	}
+	else
+	{
+		if (GltfLoader::CanLoad(filePath) && GltfLoader::Load(filePath, modelData))
+		{
+			m_ImportSource = ImportSource::Gltf;
+		}
+		else if (ImportFromFile(Utility::WStringToString(filePath), modelData))
+		{
+			m_ImportSource = ImportSource::Assimp;
+		}
+		else
+		{
+			return;
+		}
 
-	// `FbN
-	if (pScene == nullptr)
+		// d_̗nځA_LbVEI[o[h[̕בւAbVbg LOD ̍쐬 (ʂ̓LbVɕۑ̂ŏ񂾂)
+		// bV[J[ȏ゠΃bVPʂ̕ő̂ŁAnڂ̒ł̓Xbh𑝂₳Ȃ
+		MeshWelder::Settings weldSettings;
+		weldSettings.IsParallel = modelData.Meshes.size() < Parallel::GetWorkerCount();
+		Parallel::ForEach(modelData.Meshes.size(), [&](size_t i)
+			{
+				MeshWelder::Weld(modelData.Meshes[i], weldSettings);
+				MeshOptimizer::Optimize(modelData.Meshes[i]);
+				MeshletBuilder::Build(modelData.Meshes[i]);
+				MeshSimplifier::GenerateLods(modelData.Meshes[i]);
+			});
+		MeshCache::Save(cachePath, cacheKey, modelData);
+	}
+	for (const auto& meshData : modelData.Meshes)
 	{
-		assert(false && "bVf[^̓ǂݍ݂Ɏs܂");
-		return;
+		m_CacheStatsBefore.Merge(meshData.CacheStatsBefore);
+		m_CacheStatsAfter.Merge(meshData.CacheStatsAfter);
+		m_WeldStats.Merge(meshData.Weld);
 	}
+	auto importEnd = std::chrono::high_resolution_clock::now();
+	m_ImportTimeMs = std::chrono::duration<double, std::milli>(importEnd - loadStart).count();
 
-	auto numMat = pScene->mNumMaterials;
+	// eNX`̓fPʂł܂Ƃ߂ēǂݍ (fR[h͕AGPU ւ̓]1)
+	std::vector<std::wstring> texturePaths;
+	std::vector<TextureCook::TextureRole> textureRoles;
+	auto numMat = modelData.Materials.size();
 	m_Materials.shrink_to_fit();
 	m_Materials.resize(numMat);
-	for (auto i = 0; i < numMat; ++i)
+	for (auto i = 0u; i < numMat; ++i)
 	{
-		PerseMaterial(pScene->mMaterials[i], m_Materials[i]);
+		const auto& srcMat = modelData.Materials[i];
+		auto& dstMat = m_Materials[i];
+		dstMat.m_Diffuse = srcMat.Diffuse;
+		dstMat.m_Specular = srcMat.Specular;
+		dstMat.m_Alpha = srcMat.Alpha;
+		dstMat.m_Shininess = srcMat.Shininess;
+		// pr TextureCooker (TextureCook::CollectRoles) ƓA}eA̘gŌ܂Ȃ̂̓t@C琄
+		SetTextureId(srcMat.DiffuseTexPath, TextureCook::TextureRole::Color, dstMat.m_DiffuseTexId, texturePaths, textureRoles);
+		SetTextureId(srcMat.NormalTexPath, TextureCook::TextureRole::Normal, dstMat.m_NormalTexId, texturePaths, textureRoles);
+		SetTextureId(srcMat.SpecularTexPath, TextureCook::GuessRoleFromName(Utility::StringToWString(srcMat.SpecularTexPath)),
+			dstMat.m_SpecularTexId, texturePaths, textureRoles);
+		SetTextureId(srcMat.GLTFMetaricRoughnessTexPath, TextureCook::TextureRole::Mask, dstMat.m_GLTFMetaricRoughnessTexId, texturePaths, textureRoles);
+		SetTextureId(srcMat.ShininessTexPath, TextureCook::GuessRoleFromName(Utility::StringToWString(srcMat.ShininessTexPath)),
+			dstMat.m_ShininessTexId, texturePaths, textureRoles);
 	}
+	auto textureStart = std::chrono::high_resolution_clock::now();
+	m_TextureCount = m_pRenderer->CreateTexturesFromFiles(texturePaths, textureRoles);
+	auto textureEnd = std::chrono::high_resolution_clock::now();
+	m_TextureLoadTimeMs = std::chrono::duration<double, std::milli>(textureEnd - textureStart).count();
 
-	auto numMeshes = pScene->mNumMeshes;
-	m_pMeshes.shrink_to_fit();
-	m_pMeshes.resize(numMeshes);
-	for (auto i = 0u; i < numMeshes; ++i)
+	// _`͓ǂݍݎɌ܂ (؂ւ͎ɓǂݍރf甽f܂)
+	m_IsPackedVertex = m_pRenderer->IsPackedVertexEnabled();
+	CreateMeshes(modelData);
+	for (auto i = 0u; i < m_pMeshes.size(); ++i)
 	{
-		m_pMeshes[i] = std::make_unique<Mesh>(m_pRenderer, pScene->mMeshes[i]);
 		auto materialIndex = m_pMeshes[i]->GetMaterialIndex();
 		if (materialIndex != -1)
 		{
@@ -69,41 +178,107 @@ Model::Model(Renderer* pRenderer, const std::wstring& filePath)
 		}
 	}
 
-	pScene = nullptr;
-
-	m_Transform = TransformBuffer();
+	m_LocalBounds = AABB();
+	for (const auto& mesh : m_pMeshes)
+	{
+		m_LocalBounds.Merge(mesh->GetLocalBounds());
+	}
+	m_World = Matrix4x4::Identity();
+	UpdateWorldTransform();
 
 	m_pCommandList = m_pRenderer->GetCommands(D3D12_COMMAND_LIST_TYPE_DIRECT)->GetGraphicsCommandList().Get();
 	m_pWindow = m_pRenderer->GetWindow();
+
+	auto loadEnd = std::chrono::high_resolution_clock::now();
+	m_LoadTimeMs = std::chrono::duration<double, std::milli>(loadEnd - loadStart).count();
 }
 
 Model::~Model()
 {
 }
 
+void Model::RequestTextureMips(TextureStreamer& streamer, const LodSelector& view, const uint8_t* pMeshVisibility) const
+{
+	for (auto i = 0u; i < m_pMeshes.size(); ++i)
+	{
+		if (pMeshVisibility != nullptr && pMeshVisibility[i] == 0)
+		{
+			continue;
+		}
+
+		// [hԂ̒bṼ[JԂ̒ɊZ (UV x̓[JԂŋ߂Ă邽)
+		const auto& mesh = m_pMeshes[i];
+		const auto& worldSphere = m_MeshWorldSpheres[i];
+		const float localRadius = mesh->GetLocalSphere().Radius;
+		float pixelsPerLocalUnit = view.GetPixelsPerUnit(worldSphere);
+		if (localRadius > 0.0f)
+		{
+			pixelsPerLocalUnit *= worldSphere.Radius / localRadius;
+		}
+
+		const Texture* pTextures[] = { mesh->GetDiffuseTex(), mesh->GetNormalTex(), mesh->GetGLTFMetaricRoughnessTex(),
+			mesh->GetShinessTex(), mesh->GetSpecularTex() };
+		for (const auto* pTexture : pTextures)
+		{
+			if (pTexture == nullptr || pTexture->GetStreamHandle() == TextureStreamer::InvalidHandle)
+			{
+				continue;
+			}
+			streamer.Request(pTexture->GetStreamHandle(),
+				TextureStreamer::ComputeMipLevel(pTexture->GetWidth(), pTexture->GetHeight(), mesh->GetUvDensity(), pixelsPerLocalUnit));
+		}
+	}
+}
+
 void Model::Update(float deltaTime)
 {
 	//count += 0.01f;
-	//m_Transform.World.setRotationY(count);
+	//m_World.setRotationY(count);
 }
 
-void Model::Draw(const Matrix4x4& viewMat, const Matrix4x4& projMat)
+uint32_t Model::Draw(const uint8_t* pMeshVisibility, const LodSelector* pLodSelector, uint64_t* pTriangleCount, MeshletCuller* pMeshletCuller)
 {
 	if (m_pCommandList == nullptr)
 	{
 		assert(false && "R}hXgnullptrł");
-		return;
+		return 0;
 	}
 	auto backBufferIndex = m_pWindow->GetCurrentBackBufferIndex();
+	// [hs̓bVԂŋʂȂ̂Ń[g萔Ƃ1xݒ
+	m_pCommandList->SetGraphicsRoot32BitConstants(0, 12, &m_ObjectTransform, 0);
+	if (pMeshletCuller != nullptr)
+	{
+		pMeshletCuller->SetWorld(m_World);
+	}
+	// _ECfbNXobt@̓V[ŜŋLȂ̂ŁA`ς鎞ݒ肵
+	bool isVertexBufferSet = false;
+	DXGI_FORMAT indexFormat = DXGI_FORMAT_UNKNOWN;
+	uint32_t drawCount = 0;
 	for (auto i = 0; i < m_pMeshes.size(); ++i)
 	{
+		// JOꂽbV͒萔obt@̊mۂ܂߂ďȗ
+		if (pMeshVisibility != nullptr && pMeshVisibility[i] == 0)
+		{
+			continue;
+		}
+
 		auto mesh = m_pMeshes[i].get();
-		auto vbv = mesh->GetVBV();
-		auto ibv = mesh->GetIBV();
-		m_Transform.View = viewMat;
-		m_Transform.Proj = projMat;
-		auto transformGPUAddress = m_pRenderer->AllocateConstantBuffer<TransformBuffer>(m_Transform, backBufferIndex);
-		m_pCommandList->SetGraphicsRootConstantBufferView(0, transformGPUAddress);
+		const auto& lods = mesh->GetLods();
+		const uint32_t lodIndex = pLodSelector != nullptr
+			? pLodSelector->Select(lods, m_MeshWorldSpheres[i], mesh->GetLocalSphere().Radius) : 0;
+		const auto& lod = lods[lodIndex];
+
+		// bVbg LOD0 ɂ̂ŁALOD0 `悷鎞bVbgPʂŃJO
+		const std::vector<IndexRange>* pRanges = nullptr;
+		if (pMeshletCuller != nullptr && lodIndex == 0 && !mesh->GetMeshlets().empty())
+		{
+			pRanges = &pMeshletCuller->Cull(mesh->GetMeshlets());
+			if (pRanges->empty())
+			{
+				continue;
+			}
+		}
+
 		auto materialIndex = mesh->GetMaterialIndex();
 		if (materialIndex != -1)
 		{
@@ -126,20 +301,99 @@ void Model::Draw(const Matrix4x4& viewMat, const Matrix4x4& projMat)
 		m_pCommandList->SetGraphicsRootDescriptorTable(5, mesh->GetNormalTex()->GetSRV());
 		m_pCommandList->SetGraphicsRootDescriptorTable(6, mesh->GetGLTFMetaricRoughnessTex()->GetSRV());
 
-		m_pCommandList->IASetVertexBuffers(0, 1, &vbv);
-		m_pCommandList->IASetIndexBuffer(&ibv);
-		m_pCommandList->DrawIndexedInstanced(mesh->GetIndexCount(), 1, 0, 0, 0);
+		if (!isVertexBufferSet)
+		{
+			auto vbv = mesh->GetVBV();
+			m_pCommandList->IASetVertexBuffers(0, 1, &vbv);
+			isVertexBufferSet = true;
+		}
+		if (mesh->GetIndexFormat() != indexFormat)
+		{
+			auto ibv = mesh->GetIBV();
+			m_pCommandList->IASetIndexBuffer(&ibv);
+			indexFormat = ibv.Format;
+		}
+		if (mesh->IsPackedVertex())
+		{
+			m_pCommandList->SetGraphicsRoot32BitConstants(12, 8, &mesh->GetPositionQuantization(), 0);
+		}
+
+		const uint32_t startIndex = mesh->GetStartIndex();
+		const int32_t baseVertex = mesh->GetBaseVertex();
+		if (pRanges != nullptr)
+		{
+			for (const auto& range : *pRanges)
+			{
+				m_pCommandList->DrawIndexedInstanced(range.IndexCount, 1, startIndex + range.IndexOffset, baseVertex, 0);
+				if (pTriangleCount != nullptr)
+				{
+					*pTriangleCount += range.IndexCount / 3;
+				}
+			}
+		}
+		else
+		{
+			m_pCommandList->DrawIndexedInstanced(lod.IndexCount, 1, startIndex + lod.IndexOffset, baseVertex, 0);
+			if (pTriangleCount != nullptr)
+			{
+				*pTriangleCount += lod.IndexCount / 3;
+			}
+		}
+		++drawCount;
 	}
+	return drawCount;
 }
 
 void Model::SetPosition(const Vector3D& pos)
 {
-	m_Transform.World.setTranslation(pos);
+	m_World.setTranslation(pos);
+	UpdateWorldTransform();
 }
 
 void Model::SetScale(const Vector3D& scale)
 {
-	m_Transform.World.setScale(scale);
+	m_World.setScale(scale);
+	UpdateWorldTransform();
+}
+
+void Model::UpdateWorldTransform()
+{
+	m_ObjectTransform.World = Matrix3x4(m_World);
+
+	// E{[[hԂ֕ϊ (AABB::TransformESphere::Transform Ɠ)
+	// S TransformPoints ł܂Ƃ߂ĕϊAAABB ̍L 3x3 ̐Βls TransformDirections ŋ߂ (Arvo ̕@)
+	const size_t meshCount = m_pMeshes.size();
+	std::vector<Vector3D> centers(meshCount * 2);
+	std::vector<Vector3D> extents(meshCount);
+	for (size_t i = 0; i < meshCount; ++i)
+	{
+		centers[i] = m_pMeshes[i]->GetLocalBounds().GetCenter();
+		centers[meshCount + i] = m_pMeshes[i]->GetLocalSphere().Center;
+		extents[i] = m_pMeshes[i]->GetLocalBounds().GetExtents();
+	}
+	Matrix4x4 absolute = m_World;
+	for (int row = 0; row < 3; ++row)
+	{
+		for (int col = 0; col < 3; ++col)
+		{
+			absolute.m_mat[row][col] = std::fabs(absolute.m_mat[row][col]);
+		}
+	}
+	TransformBatch::TransformPoints(m_World, centers.data(), centers.data(), centers.size());
+	TransformBatch::TransformDirections(absolute, extents.data(), extents.data(), meshCount);
+
+	const float radiusScale = Sphere::GetMaxScale(m_World);
+	m_MeshWorldBounds.resize(meshCount);
+	m_MeshWorldSpheres.resize(meshCount);
+	for (size_t i = 0; i < meshCount; ++i)
+	{
+		const AABB& localBounds = m_pMeshes[i]->GetLocalBounds();
+		m_MeshWorldBounds[i] = localBounds.IsValid() ? AABB::FromCenterExtents(centers[i], extents[i]) : localBounds;
+		m_MeshWorldSpheres[i].Center = centers[meshCount + i];
+		m_MeshWorldSpheres[i].Radius = m_pMeshes[i]->GetLocalSphere().Radius * radiusScale;
+	}
+	m_WorldBounds = AABB::Transform(m_LocalBounds, m_World);
+	m_WorldSphere = Sphere::FromAABB(m_WorldBounds);
 }
 
 
@@ -153,63 +407,174 @@ const std::vector<std::unique_ptr<Mesh>>& Model::GetMeshes() const
 	return m_pMeshes;
 }
 
-void Model::PerseMaterial(const aiMaterial* pSrcMat, Material& dstMat)
+bool Model::ImportFromFile(const std::string& path, ModelData& outData)
+{
+	Assimp::Importer importer;
+
+	// f[^̓ǂݍ
+	auto pScene = importer.ReadFile(path, ImportFlags);
+
+	// `FbN
+	if (pScene == nullptr)
+	{
+		assert(false && "bVf[^̓ǂݍ݂Ɏs܂");
+		return false;
+	}
+
+	auto numMat = pScene->mNumMaterials;
+	outData.Materials.resize(numMat);
+	for (auto i = 0u; i < numMat; ++i)
+	{
+		PerseMaterial(pScene->mMaterials[i], outData.Materials[i]);
+	}
+
+	// bV̕ϊ͓ƗĂ̂ŕɎs (TCY΂̂1bVo)
+	auto numMeshes = pScene->mNumMeshes;
+	outData.Meshes.resize(numMeshes);
+	Parallel::ForEach(numMeshes, [&](size_t i)
+		{
+			ConvertMesh(pScene->mMeshes[i], outData.Meshes[i]);
+		});
+	return true;
+}
+
+void Model::CreateMeshes(const ModelData& modelData)
+{
+	const auto numMeshes = modelData.Meshes.size();
+
+	// ebV̒_ECfbNẌ̗V[L̃obt@mۂ
+	auto pArena = m_pRenderer->GetGeometryArena();
+	const uint64_t vertexStride = m_IsPackedVertex ? sizeof(PackedVertex) : sizeof(Vertex);
+	std::vector<MeshBufferRange> ranges(numMeshes);
+	std::vector<GeometryArena::Handle> handles(numMeshes * 2);
+	for (auto i = 0u; i < numMeshes; ++i)
+	{
+		const auto& meshData = modelData.Meshes[i];
+		ranges[i].pArena = pArena;
+		ranges[i].IsPackedVertex = m_IsPackedVertex;
+		ranges[i].VertexHandle = pArena->Allocate(GeometryArena::BufferType::Vertex, meshData.Vertices.size() * vertexStride, vertexStride);
+
+		// _ 65536 ȉȂ 16bit CfbNXɂ (S LOD _zQƂ̂ł܂Ƃ߂Ĕł)
+		ranges[i].Is16BitIndex = meshData.CanUse16BitIndices();
+		const uint64_t indexStride = ranges[i].Is16BitIndex ? sizeof(uint16_t) : sizeof(uint32_t);
+		ranges[i].IndexHandle = pArena->Allocate(GeometryArena::BufferType::Index, meshData.Indices.size() * indexStride, indexStride);
+
+		handles[i * 2] = ranges[i].VertexHandle;
+		handles[i * 2 + 1] = ranges[i].IndexHandle;
+		m_IndexBufferSize += meshData.Indices.size() * indexStride;
+		m_IndexBufferSaving += meshData.Indices.size() * (sizeof(uint32_t) - indexStride);
+	}
+
+	// Abv[hobt@֑SbṼf[^ɏ݁A܂Ƃ߂ē]
+	pArena->Upload(handles, [&](size_t handleIndex, uint8_t* pDst)
+		{
+			const auto& meshData = modelData.Meshes[handleIndex / 2];
+			const auto& range = ranges[handleIndex / 2];
+			if (handleIndex % 2 == 0)
+			{
+				if (m_IsPackedVertex)
+				{
+					// kȂAbv[hobt@֒ڏ
+					VertexPacking::Encode(meshData.Vertices.data(), meshData.Vertices.size(),
+						PositionQuantization::FromBounds(meshData.LocalBounds), reinterpret_cast<PackedVertex*>(pDst));
+				}
+				else
+				{
+					memcpy(pDst, meshData.Vertices.data(), meshData.Vertices.size() * sizeof(Vertex));
+				}
+			}
+			else if (range.Is16BitIndex)
+			{
+				auto pIndices = reinterpret_cast<uint16_t*>(pDst);
+				for (size_t j = 0; j < meshData.Indices.size(); ++j)
+				{
+					pIndices[j] = static_cast<uint16_t>(meshData.Indices[j]);
+				}
+			}
+			else
+			{
+				memcpy(pDst, meshData.Indices.data(), meshData.Indices.size() * sizeof(uint32_t));
+			}
+		});
+
+	m_pMeshes.shrink_to_fit();
+	m_pMeshes.resize(numMeshes);
+	for (auto i = 0u; i < numMeshes; ++i)
+	{
+		m_pMeshes[i] = std::make_unique<Mesh>(m_pRenderer, modelData.Meshes[i], ranges[i]);
+	}
+}
+
+void Model::PerseMaterial(const aiMaterial* pSrcMat, MaterialData& dstMat)
 {
 	aiColor3D color(0.f, 0.f, 0.f);
 
 	// fBt[YF̎擾
 	if (pSrcMat->Get(AI_MATKEY_COLOR_DIFFUSE, color) == AI_SUCCESS)
 	{
-		dstMat.m_Diffuse = Vector3D(color.r, color.g, color.b);
+		dstMat.Diffuse = Vector3D(color.r, color.g, color.b);
 	}
 	else
 	{
-		dstMat.m_Diffuse = Vector3D(0.5f, 0.5f, 0.5f);
+		dstMat.Diffuse = Vector3D(0.5f, 0.5f, 0.5f);
 	}
 
 	// XyL[F̎擾
 	if (pSrcMat->Get(AI_MATKEY_COLOR_SPECULAR, color) == AI_SUCCESS)
 	{
-		dstMat.m_Specular = Vector3D(color.r, color.g, color.b);
+		dstMat.Specular = Vector3D(color.r, color.g, color.b);
 	}
 	else
 	{
-		dstMat.m_Specular = Vector3D(0.5f, 0.5f, 0.5f);
+		dstMat.Specular = Vector3D(0.5f, 0.5f, 0.5f);
 	}
 
 	// ʔˋx̎擾
 	auto shininess = 0.0f;
 	if (pSrcMat->Get(AI_MATKEY_SHININESS, shininess) != AI_SUCCESS)
 	{
-		dstMat.m_Shininess = shininess;
+		dstMat.Shininess = shininess;
 	}
 	else
 	{
-		dstMat.m_Shininess = 0.0f;
+		dstMat.Shininess = 0.0f;
 	}
 
 	// fBt[YeNX`̎擾
-	aiString texturePath;
-	SetTextureId(pSrcMat, texturePath, aiTextureType_DIFFUSE, dstMat.m_DiffuseTexId);
+	GetTexturePath(pSrcMat, aiTextureType_DIFFUSE, dstMat.DiffuseTexPath);
 	// m[}eNX`̎擾
-	SetTextureId(pSrcMat, texturePath, aiTextureType_NORMALS, dstMat.m_NormalTexId);
+	GetTexturePath(pSrcMat, aiTextureType_NORMALS, dstMat.NormalTexPath);
 	// XyLeNX`̎擾
-	SetTextureId(pSrcMat, texturePath, aiTextureType_SPECULAR, dstMat.m_SpecularTexId);
+	GetTexturePath(pSrcMat, aiTextureType_SPECULAR, dstMat.SpecularTexPath);
 	// ^bNeNX`̎擾
-	SetTextureId(pSrcMat, texturePath, aiTextureType_GLTF_METALLIC_ROUGHNESS, dstMat.m_GLTFMetaricRoughnessTexId);
+	GetTexturePath(pSrcMat, aiTextureType_GLTF_METALLIC_ROUGHNESS, dstMat.GLTFMetaricRoughnessTexPath);
 	// VClXeNX`̎擾
-	SetTextureId(pSrcMat, texturePath, aiTextureType_SHININESS, dstMat.m_ShininessTexId);
+	GetTexturePath(pSrcMat, aiTextureType_SHININESS, dstMat.ShininessTexPath);
 }
 
-void Model::SetTextureId(const aiMaterial* pSrcMat,
-	aiString& texturePath, 
+void Model::GetTexturePath(const aiMaterial* pSrcMat,
 	const aiTextureType& texType,
-	TextureID& texId)
+	std::string& texturePath)
+{
+	aiString srcPath;
+	if (pSrcMat->GetTexture(texType, 0, &srcPath) == AI_SUCCESS)
+	{
+		texturePath = srcPath.C_Str();
+	}
+	else
+	{
+		texturePath.clear();
+	}
+}
+
+void Model::SetTextureId(const std::string& texturePath, TextureCook::TextureRole role, TextureID& texId,
+	std::vector<std::wstring>& outTexturePaths, std::vector<TextureCook::TextureRole>& outTextureRoles)
 {
-	if (pSrcMat->GetTexture(texType, 0, &texturePath) == AI_SUCCESS)
+	if (!texturePath.empty())
 	{
-		auto path = Utility::StringToWString(texturePath.C_Str());
-		m_pRenderer->CreateTextureFromFile(path.c_str());
+		auto path = Utility::StringToWString(texturePath);
+		outTexturePaths.push_back(path);
+		outTextureRoles.push_back(role);
 		auto id = DX12Utility::StringHash(path.c_str());
 		texId = id;
 	}
@@ -2,6 +2,8 @@
 #include "Graphics/DX12RootSignature.h"
 #include "Graphics/DX12PipelineState.h"
 #include "Graphics/Model.h"
+#include "Graphics/LodSelector.h"
+#include "Graphics/VertexPacking.h"
 #include "Graphics/Camera.h"
 #include "Graphics/DepthBuffer.h"
 #include "Framework/Renderer.h"
@@ -49,9 +51,14 @@ void SceneStage::RecordStage(ID3D12GraphicsCommandList* pCmdList)
 
 	auto cameraPos = m_pCamera->GetPosition();
 	auto cameraPosVec4D = Vector4D(cameraPos.x, cameraPos.y, cameraPos.z, 1.0f);
-	auto view = m_pCamera->GetView();
-	auto proj = m_pCamera->GetProj();
 	pCmdList->SetGraphicsRoot32BitConstants(1, 4, &cameraPosVec4D, 0);
+
+	// r[EvWFNVs͑SfʂȂ̂Ńt[1xm
+	m_CameraBuffer.View = m_pCamera->GetView();
+	m_CameraBuffer.Proj = m_pCamera->GetProj();
+	auto backBufferIndex = m_pWindow->GetCurrentBackBufferIndex();
+	auto cameraGPUAddress = m_pRenderer->AllocateConstantBuffer<CameraBuffer>(m_CameraBuffer, backBufferIndex);
+	pCmdList->SetGraphicsRootConstantBufferView(11, cameraGPUAddress);
 	pCmdList->SetGraphicsRootDescriptorTable(7, m_IBLBakerStage->GetHandleGPU_DFG());
 	pCmdList->SetGraphicsRootDescriptorTable(8, m_IBLBakerStage->GetHandleGPU_DiffuseLD());
 	pCmdList->SetGraphicsRootDescriptorTable(9, m_IBLBakerStage->GetHandleGPU_SpecularLD());
@@ -64,10 +71,67 @@ void SceneStage::RecordStage(ID3D12GraphicsCommandList* pCmdList)
 	auto lightVP = m_pShadowStage->GetVPMat();
 	pCmdList->SetGraphicsRoot32BitConstants(3, 20, &m_ShadowLightData, 0);
 
-	for (const auto& model : m_pScene->GetModels())
+	// JO
+	auto& stats = m_pRenderer->GetRenderStats();
+	const auto& models = m_pScene->GetModels();
+	const bool isCullingEnabled = m_pRenderer->IsFrustumCullingEnabled();
+	if (isCullingEnabled)
+	{
+		auto cullStart = std::chrono::high_resolution_clock::now();
+		m_MeshCuller.Cull(models, Frustum::FromViewProj(m_pCamera->GetViewProj()));
+		auto cullEnd = std::chrono::high_resolution_clock::now();
+		stats.CullingTimeMs = std::chrono::duration<double, std::milli>(cullEnd - cullStart).count();
+	}
+	else
+	{
+		stats.CullingTimeMs = 0.0;
+	}
+
+	stats.TotalModels = static_cast<uint32_t>(models.size());
+	stats.VisibleModels = 0;
+	stats.TotalMeshes = 0;
+	stats.VisibleMeshes = 0;
+	stats.DrawCalls = 0;
+	stats.Triangles = 0;
+
+	// ʏ̑傫 LOD I
+	LodSelector lodSelector = LodSelector::FromProj(m_pCamera->GetProj(), m_pCamera->GetHeight(),
+		cameraPos, m_pRenderer->GetLodErrorThreshold());
+	const LodSelector* pLodSelector = m_pRenderer->IsLodEnabled() ? &lodSelector : nullptr;
+
+	// LOD0 ŕ`悷郁bV̓bVbgPʂłJO
+	m_MeshletCuller.SetView(m_pCamera->GetViewProj(), cameraPos, m_pRenderer->IsMeshletConeCullingEnabled());
+	m_MeshletCuller.ResetStats();
+	MeshletCuller* pMeshletCuller = m_pRenderer->IsMeshletCullingEnabled() ? &m_MeshletCuller : nullptr;
+	bool isPackedPSO = false;
+	for (auto i = 0u; i < models.size(); ++i)
 	{
-		model->Draw(view, proj);
+		// _`ς鎞pCvCXe[g؂ւ
+		if (models[i]->IsPackedVertex() != isPackedPSO)
+		{
+			isPackedPSO = models[i]->IsPackedVertex();
+			pCmdList->SetPipelineState(isPackedPSO ? m_pPackedPSO->GetPipelineStatePtr() : m_pPSO->GetPipelineStatePtr());
+		}
+		const uint8_t* pVisibility = isCullingEnabled ? m_MeshCuller.GetMeshVisibility(i) : nullptr;
+		auto drawCount = models[i]->Draw(pVisibility, pLodSelector, &stats.Triangles, pMeshletCuller);
+		// Ă郁bṼeNX`ɕKvȃ~bvv (̃t[ Render() ̐擪œǂݍ)
+		models[i]->RequestTextureMips(m_pRenderer->GetTextureStreamer(), lodSelector, pVisibility);
+
+		stats.TotalMeshes += static_cast<uint32_t>(models[i]->GetMeshes().size());
+		stats.VisibleMeshes += drawCount;
+		stats.DrawCalls += drawCount;
+		if (drawCount > 0)
+		{
+			++stats.VisibleModels;
+		}
 	}
+
+	// bVbg̃JOʂbV́Ac͈͂̐h[R[𔭍sĂ
+	const auto& meshletStats = m_MeshletCuller.GetStats();
+	stats.DrawCalls += meshletStats.Ranges - meshletStats.Meshes;
+	stats.TotalMeshlets = meshletStats.TotalMeshlets;
+	stats.VisibleMeshlets = meshletStats.VisibleMeshlets;
+	stats.ConeCulledMeshlets = meshletStats.ConeCulledMeshlets;
 }
 
 void SceneStage::CreateRootSignature(Renderer* pRenderer)
@@ -135,12 +199,13 @@ void SceneStage::CreateRootSignature(Renderer* pRenderer)
 	shadowRange.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
 
 	// [gp[^
-	D3D12_ROOT_PARAMETER param[11] = {};
+	D3D12_ROOT_PARAMETER param[13] = {};
 
-	// Transform CB : RootCBV
-	param[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
-	param[0].Descriptor.ShaderRegister = 0; // b0
-	param[0].Descriptor.RegisterSpace = 0;
+	// Object Transform : 32bitconst
+	param[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+	param[0].Constants.ShaderRegister = 0; // b0
+	param[0].Constants.RegisterSpace = 0;
+	param[0].Constants.Num32BitValues = 12; // Mat3x4
 	param[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
 
 	// CameraPosition CB : RootCBV
@@ -200,6 +265,19 @@ void SceneStage::CreateRootSignature(Renderer* pRenderer)
 	param[10].DescriptorTable.pDescriptorRanges = &shadowRange;
 	param[10].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
 
+	// Camera CB : RootCBV
+	param[11].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+	param[11].Descriptor.ShaderRegister = 4; // b4
+	param[11].Descriptor.RegisterSpace = 0;
+	param[11].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+
+	// Mesh Quantization : 32bitconst (k_̈ʒu̓WJp)
+	param[12].ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+	param[12].Constants.ShaderRegister = 5; // b5
+	param[12].Constants.RegisterSpace = 0;
+	param[12].Constants.Num32BitValues = 8; // PositionQuantization
+	param[12].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+
 	// X^eBbNTv[̐ݒ
 	D3D12_STATIC_SAMPLER_DESC samplerDesc[7] = {};
 	samplerDesc[0] = SetStaticSamplerDesc(DX12Utility::SamplerState::LinearWrap, 0);
@@ -420,4 +498,17 @@ void SceneStage::CreatePipeline(Renderer* pRenderer)
 	// pCvCXe[g̐
 	auto pDevice = m_pRenderer->GetDevice().Get();
 	m_pPSO = std::make_unique<DX12PipelineState>(pDevice, &desc);
+
+	// k_ (PackedVertex) p̃pCvCXe[g (̓CAEgƒ_VF[_[ȊO͋)
+	D3D12_INPUT_ELEMENT_DESC packedElements[] = {
+		{ "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, offsetof(PackedVertex, Position), D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+		{ "NORMAL", 0, DXGI_FORMAT_R8G8B8A8_SNORM, 0, offsetof(PackedVertex, NormalTangent), D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+		{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, offsetof(PackedVertex, TexCoord), D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+	};
+	ComPtr<ID3DBlob> packedVSBlob;
+	hr = D3DReadFileToBlob((ShaderFilePathName + L"DefaultPackedVS.cso").c_str(), packedVSBlob.GetAddressOf());
+	ThrowFailed(hr);
+	desc.InputLayout = { packedElements, _countof(packedElements) };
+	desc.VS = { packedVSBlob->GetBufferPointer(), packedVSBlob->GetBufferSize() };
+	m_pPackedPSO = std::make_unique<DX12PipelineState>(pDevice, &desc);
 }
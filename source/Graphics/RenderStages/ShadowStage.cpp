@@ -4,6 +4,8 @@
 #include "Graphics/DepthBuffer.h"
 #include "Graphics/Model.h"
 #include "Graphics/Mesh.h"
+#include "Graphics/LodSelector.h"
+#include "Graphics/VertexPacking.h"
 #include "Graphics/Camera.h"
 #include "Framework/Renderer.h"
 #include "Framework/Scene.h"
@@ -80,20 +82,92 @@ void ShadowStage::RecordStage(ID3D12GraphicsCommandList* pCmdList)
 	pCommandList->RSSetScissorRects(1, &m_Scissor);
 	pCommandList->OMSetRenderTargets(0, nullptr, FALSE, &depthView);
 	auto lightMat = GetVPMat();
-	for (const auto& model : m_pScene->GetModels())
+	pCommandList->SetGraphicsRoot32BitConstants(0, 16, &lightMat, 0);
+
+	// LX^[JO
+	// CgƃVhE͈͂̊Ԃɂ镨̂e𗎂Ƃ̂ŁAߕʂO
+	// ˉe̎Cg։öŔ肵܂
+	auto& stats = m_pRenderer->GetRenderStats();
+	const auto& models = m_pScene->GetModels();
+	const bool isCullingEnabled = m_pRenderer->IsFrustumCullingEnabled();
+	if (isCullingEnabled)
 	{
-		pCommandList->SetGraphicsRoot32BitConstants(0, 16, &lightMat, 0);
-		auto world = model->GetTransform().World;
-		pCommandList->SetGraphicsRoot32BitConstants(0, 16, &world, 16);
+		auto cullStart = std::chrono::high_resolution_clock::now();
+		auto casterFrustum = Frustum::FromViewProj(lightMat);
+		casterFrustum.RemovePlane(Frustum::Near);
+		m_CasterCuller.Cull(models, casterFrustum);
+		auto cullEnd = std::chrono::high_resolution_clock::now();
+		stats.ShadowCullingTimeMs = std::chrono::duration<double, std::milli>(cullEnd - cullStart).count();
+	}
+	else
+	{
+		stats.ShadowCullingTimeMs = 0.0;
+	}
+
+	stats.ShadowTotalCasters = 0;
+	stats.ShadowVisibleCasters = 0;
+	stats.ShadowTriangles = 0;
 
-		for (const auto& mesh : model->GetMeshes())
+	// VhE}bv̑傫 LOD I (ˉeȂ̂ŋɂȂ)
+	const bool isLodEnabled = m_pRenderer->IsLodEnabled();
+	const auto lodSelector = LodSelector::FromProj(GetProj(), m_DepthBufferHeight,
+		m_DirectionalLightTrans.GetPosition(), m_pRenderer->GetLodErrorThreshold());
+	bool isPackedPSO = false;
+	for (auto i = 0u; i < models.size(); ++i)
+	{
+		const auto& model = models[i];
+		const auto& meshes = model->GetMeshes();
+		if (model->IsPackedVertex() != isPackedPSO)
 		{
-			auto vbv = mesh->GetVBV();
-			auto ibv = mesh->GetIBV();
-			pCommandList->IASetVertexBuffers(0, 1, &vbv);
-			pCommandList->IASetIndexBuffer(&ibv);
+			isPackedPSO = model->IsPackedVertex();
+			pCommandList->SetPipelineState(isPackedPSO ? m_pPackedPSO->GetPipelineStatePtr() : m_pPSO->GetPipelineStatePtr());
+		}
+		const uint8_t* pVisibility = isCullingEnabled ? m_CasterCuller.GetMeshVisibility(i) : nullptr;
+		stats.ShadowTotalCasters += static_cast<uint32_t>(meshes.size());
 
-			pCommandList->DrawIndexedInstanced(mesh->GetIndexCount(), 1, 0, 0, 0);
+		bool isTransformSet = false;
+		bool isVertexBufferSet = false;
+		DXGI_FORMAT indexFormat = DXGI_FORMAT_UNKNOWN;
+		for (auto j = 0u; j < meshes.size(); ++j)
+		{
+			if (pVisibility != nullptr && pVisibility[j] == 0)
+			{
+				continue;
+			}
+			// [hs͉̃bV郂fݒ
+			if (!isTransformSet)
+			{
+				const auto& object = model->GetObjectTransform();
+				pCommandList->SetGraphicsRoot32BitConstants(0, 12, &object, 16);
+				isTransformSet = true;
+			}
+
+			// _ECfbNXobt@̓V[ŜŋLȂ̂ŁA`ς鎞ݒ肵
+			const auto& mesh = meshes[j];
+			if (!isVertexBufferSet)
+			{
+				auto vbv = mesh->GetVBV();
+				pCommandList->IASetVertexBuffers(0, 1, &vbv);
+				isVertexBufferSet = true;
+			}
+			if (mesh->GetIndexFormat() != indexFormat)
+			{
+				auto ibv = mesh->GetIBV();
+				pCommandList->IASetIndexBuffer(&ibv);
+				indexFormat = ibv.Format;
+			}
+			if (mesh->IsPackedVertex())
+			{
+				pCommandList->SetGraphicsRoot32BitConstants(1, 8, &mesh->GetPositionQuantization(), 0);
+			}
+
+			const auto& lods = mesh->GetLods();
+			const uint32_t lodIndex = isLodEnabled
+				? lodSelector.Select(lods, model->GetMeshWorldSpheres()[j], mesh->GetLocalSphere().Radius) : 0;
+			const auto& lod = lods[lodIndex];
+			pCommandList->DrawIndexedInstanced(lod.IndexCount, 1, mesh->GetStartIndex() + lod.IndexOffset, mesh->GetBaseVertex(), 0);
+			++stats.ShadowVisibleCasters;
+			stats.ShadowTriangles += lod.IndexCount / 3;
 		}
 	}
 
@@ -101,11 +175,15 @@ void ShadowStage::RecordStage(ID3D12GraphicsCommandList* pCmdList)
 		D3D12_RESOURCE_STATE_DEPTH_WRITE, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
 }
 
-const Matrix4x4& ShadowStage::GetVPMat() const
+Matrix4x4 ShadowStage::GetVPMat() const
 {
 	auto view = m_DirectionalLightTrans.GetView();
-	auto proj = Matrix4x4::setOrthoLH(m_LightViewSize, m_LightViewSize, 1, 1000);
-	return view * proj;
+	return view * GetProj();
+}
+
+Matrix4x4 ShadowStage::GetProj() const
+{
+	return Matrix4x4::setOrthoLH(m_LightViewSize, m_LightViewSize, 1, 1000);
 }
 
 const Vector3D& ShadowStage::GetLightDir() const
@@ -121,15 +199,22 @@ void ShadowStage::CreateRootSignature(Renderer* pRenderer)
 	flag |= D3D12_ROOT_SIGNATURE_FLAG_DENY_GEOMETRY_SHADER_ROOT_ACCESS;
 
 	// [gp[^
-	D3D12_ROOT_PARAMETER param[1] = {};
+	D3D12_ROOT_PARAMETER param[2] = {};
 
 	// Light Model Matrix CB : 32bitconst
 	param[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
-	param[0].Constants.Num32BitValues = 32;
+	param[0].Constants.Num32BitValues = 28; // Mat4x4 + Mat3x4
 	param[0].Constants.ShaderRegister = 0;
 	param[0].Constants.RegisterSpace = 0;
 	param[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
 
+	// Mesh Quantization : 32bitconst (k_̈ʒu̓WJp)
+	param[1].ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+	param[1].Constants.Num32BitValues = 8; // PositionQuantization
+	param[1].Constants.ShaderRegister = 1;
+	param[1].Constants.RegisterSpace = 0;
+	param[1].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+
 	// [gVOl`̐ݒ
 	D3D12_ROOT_SIGNATURE_DESC desc = {};
 	desc.NumParameters = _countof(param);
@@ -163,7 +248,8 @@ void ShadowStage::CreatePipeline(Renderer* pRenderer)
 	descRS.DepthBias = D3D12_DEFAULT_DEPTH_BIAS;
 	descRS.DepthBiasClamp = D3D12_DEFAULT_DEPTH_BIAS_CLAMP;
 	descRS.SlopeScaledDepthBias = D3D12_DEFAULT_SLOPE_SCALED_DEPTH_BIAS;
-	descRS.DepthClipEnable = TRUE;
+	// Cg̋ߕʂÕLX^[[x 0 ɃNvĕ`悷 (LX^[JOŋߕʂOĂ邽)
+	descRS.DepthClipEnable = FALSE;
 	descRS.MultisampleEnable = FALSE;
 	descRS.AntialiasedLineEnable = FALSE;
 	descRS.ForcedSampleCount = 0;
@@ -221,6 +307,17 @@ void ShadowStage::CreatePipeline(Renderer* pRenderer)
 	// pCvCXe[g̐
 	auto pDevice = m_pRenderer->GetDevice().Get();
 	m_pPSO = std::make_unique<DX12PipelineState>(pDevice, &desc);
+
+	// k_ (PackedVertex) p̃pCvCXe[g (ʒuǂ)
+	D3D12_INPUT_ELEMENT_DESC packedElements[] = {
+		{ "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, offsetof(PackedVertex, Position), D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+	};
+	ComPtr<ID3DBlob> packedVSBlob;
+	hr = D3DReadFileToBlob((ShaderFilePathName + L"ShadowPackedVS.cso").c_str(), packedVSBlob.GetAddressOf());
+	ThrowFailed(hr);
+	desc.InputLayout = { packedElements, _countof(packedElements) };
+	desc.VS = { packedVSBlob->GetBufferPointer(), packedVSBlob->GetBufferSize() };
+	m_pPackedPSO = std::make_unique<DX12PipelineState>(pDevice, &desc);
 }
 
 void ShadowStage::SetDirectionalLightRotation(const Vector3D& vec)
@@ -2,6 +2,11 @@
 #include "Graphics/DX12Utilities.h"
 #include "Graphics/DX12DescriptorHeap.h"
 #include "Framework/Renderer.h"
+#include "Graphics/TextureCook.h"
+#include "Graphics/DX12Commands.h"
+#include "Graphics/MipGenerator.h"
+#include "Utilities/Parallel.h"
+#include <functional>
 
 namespace {
 
@@ -48,49 +53,320 @@ namespace {
         return result;
     }
 
+    //-----------------------------------------------------------------------------
+    //      ~bvXg[~OłeNX`.
+    //      (~bvzłȂ 2D eNX`ŁABC kȂ tailMip ܂ł̂ǂ̃~bvn߂ĂE 4 ̔{ɂȂ)
+    //-----------------------------------------------------------------------------
+    bool CanStream(const DirectX::TexMetadata& metaData, uint32_t tailMip)
+    {
+        if (metaData.dimension != DirectX::TEX_DIMENSION_TEXTURE2D || metaData.arraySize != 1 || metaData.mipLevels <= 1)
+        {
+            return false;
+        }
+        if (!DirectX::IsCompressed(metaData.format))
+        {
+            return true;
+        }
+        for (uint32_t mip = 0; mip <= tailMip; ++mip)
+        {
+            if ((std::max)(metaData.width >> mip, size_t(1)) % 4 != 0 || (std::max)(metaData.height >> mip, size_t(1)) % 4 != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //-----------------------------------------------------------------------------
+    //      MipGenerator ň (1f 4 oCgŁAAt@ 4 oCgڂ) tH[}bg.
+    //-----------------------------------------------------------------------------
+    bool IsRGBA8(DXGI_FORMAT format)
+    {
+        switch (format)
+        {
+        case DXGI_FORMAT_R8G8B8A8_UNORM:
+        case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
+        case DXGI_FORMAT_B8G8R8A8_UNORM:
+        case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB:
+        case DXGI_FORMAT_B8G8R8X8_UNORM:
+        case DXGI_FORMAT_B8G8R8X8_UNORM_SRGB:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    //      ~bv̂Ȃ摜Ƀ~bvǉ܂.
+    //-----------------------------------------------------------------------------
+    HRESULT GenerateMips(MipGenerator::Filter filter, bool isParallel, TextureImage& image)
+    {
+        const auto& metaData = image.MetaData;
+        if (metaData.mipLevels != 1 || metaData.dimension != DirectX::TEX_DIMENSION_TEXTURE2D || metaData.arraySize != 1
+            || (metaData.width == 1 && metaData.height == 1) || DirectX::IsCompressed(metaData.format))
+        {
+            return S_OK;
+        }
+
+        // F̉摜 sRGB ̃tH[}bgœǂނ̂Ő`Ԃŕς (@E}XN UNORM œǂނ̂ł̂܂ܕς)
+        const bool isSRGB = TextureCook::IsSRGB(image.Role)
+            && (ConvertToSRGB(metaData.format) != metaData.format || DirectX::IsSRGB(metaData.format));
+        DirectX::ScratchImage mipChain;
+        HRESULT hr = S_OK;
+        if (IsRGBA8(metaData.format))
+        {
+            hr = mipChain.Initialize2D(metaData.format, metaData.width, metaData.height, 1, 0);
+            if (FAILED(hr))
+            {
+                return hr;
+            }
+
+            const size_t mipCount = mipChain.GetMetadata().mipLevels;
+            std::vector<MipGenerator::Image> mips(mipCount);
+            for (size_t mip = 0; mip < mipCount; ++mip)
+            {
+                const DirectX::Image* pMip = mipChain.GetImage(mip, 0, 0);
+                mips[mip].pPixels = pMip->pixels;
+                mips[mip].Width = static_cast<uint32_t>(pMip->width);
+                mips[mip].Height = static_cast<uint32_t>(pMip->height);
+                mips[mip].RowPitch = pMip->rowPitch;
+            }
+            const DirectX::Image* pSource = image.Image.GetImage(0, 0, 0);
+            for (size_t y = 0; y < pSource->height; ++y)
+            {
+                std::memcpy(mips[0].pPixels + y * mips[0].RowPitch, pSource->pixels + y * pSource->rowPitch, pSource->width * 4);
+            }
+
+            // ςԂ TextureCooker ƓprŌ߂
+            // @}bv͕ςŒZȂ@𐳋K (B8G8R8A8 ł XYZ ̕тς邾Ȃ̂œ)
+            MipGenerator::Settings settings;
+            settings.Kind = filter;
+            settings.Type = TextureCook::GetMipContent(image.Role);
+            settings.IsParallel = isParallel;
+            MipGenerator::Generate(mips.data(), static_cast<uint32_t>(mipCount), settings);
+        }
+        else
+        {
+            // 8bit ȊO (HDRE16bitEO[XP[Ȃ)  DirectXTex ɔC
+            hr = DirectX::GenerateMipMaps(*image.Image.GetImage(0, 0, 0),
+                DirectX::TEX_FILTER_BOX | DirectX::TEX_FILTER_FORCE_NON_WIC | (isSRGB ? DirectX::TEX_FILTER_SRGB : DirectX::TEX_FILTER_DEFAULT),
+                0, mipChain);
+            if (FAILED(hr))
+            {
+                return hr;
+            }
+        }
+
+        image.MetaData = mipChain.GetMetadata();
+        image.Image = std::move(mipChain);
+        return S_OK;
+    }
+
+    //-----------------------------------------------------------------------------
+    //      ꎞIȃR}hXgɓ]R}hL^ĎsA҂܂.
+    //-----------------------------------------------------------------------------
+    void ExecuteUpload(Renderer* pRenderer, const std::function<void(ID3D12GraphicsCommandList*)>& record)
+    {
+        auto pDevice = pRenderer->GetDevice().Get();
+        ComPtr<ID3D12CommandAllocator> tempAllocator;
+        ComPtr<ID3D12GraphicsCommandList> tempCommandList;
+
+        auto hr = pDevice->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(tempAllocator.GetAddressOf()));
+        ThrowFailed(hr);
+
+        // CreateCommandList Open ԂȂ̂ Reset sv
+        hr = pDevice->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, tempAllocator.Get(), nullptr, IID_PPV_ARGS(tempCommandList.GetAddressOf()));
+        ThrowFailed(hr);
+
+        record(tempCommandList.Get());
+
+        // R}hL^I
+        tempCommandList->Close();
+
+        // s (L[Renderer̂̂gp)
+        auto pCommands = pRenderer->GetCommands(D3D12_COMMAND_LIST_TYPE_DIRECT);
+        ID3D12CommandList* ppCommandLists[] = { tempCommandList.Get() };
+        pCommands->GetCommandQueue()->ExecuteCommandLists(1, ppCommandLists);
+
+        // ]܂őҋ@
+        pCommands->WaitGpu(INFINITE);
+    }
+
 }
 
 Texture::Texture(Renderer* pRenderer, const std::wstring& filePath, D3D12_RESOURCE_FLAGS flag)
 {
-    auto pDevice = pRenderer->GetDevice().Get();
-    DirectX::TexMetadata metaData = {};
-    DirectX::ScratchImage image = {};
-    std::vector<D3D12_SUBRESOURCE_DATA> subResources;
+    TextureImage image;
+    const auto role = TextureCook::GuessRoleFromName(filePath);
+    ThrowFailed(Decode(filePath, role, TextureCook::GetDefaultMipFilter(role), image));
+
+    ExecuteUpload(pRenderer, [&](ID3D12GraphicsCommandList* pCommandList)
+        {
+            CreateResource(pRenderer, image, pCommandList, flag, 0);
+        });
+    ReleaseUploadBuffer();
+}
+
+Texture::Texture(Renderer* pRenderer, const TextureImage& image, ID3D12GraphicsCommandList* pCommandList, D3D12_RESOURCE_FLAGS flag, uint32_t firstMip)
+{
+    CreateResource(pRenderer, image, pCommandList, flag, firstMip);
+}
+
+HRESULT Texture::Decode(const std::wstring& filePath, TextureCook::TextureRole role, MipGenerator::Filter mipFilter, TextureImage& outImage,
+    bool isParallel)
+{
+    outImage.Role = role;
 
     // 1. 摜t@C̓ǂݍ
     std::wstring fileName = ExChangeFileExtension(filePath);
     auto ext = FileExtension(fileName);
-    HRESULT hr = S_FALSE;
+    HRESULT hr = E_FAIL;
+
+    // TextureCooker ŕϊς݂ȂABC kE~bvt DDS g (sRGB ǂtH[}bgɊ܂܂Ă)
+    const auto cookedPath = TextureCook::FindCooked(fileName);
+    outImage.IsCooked = !cookedPath.empty()
+        && SUCCEEDED(DirectX::LoadFromDDSFile(cookedPath.c_str(), DirectX::DDS_FLAGS_NONE, &outImage.MetaData, outImage.Image));
+    if (outImage.IsCooked)
+    {
+        return S_OK;
+    }
 
     if (ext == L"png")
     {
-        hr = DirectX::LoadFromWICFile(fileName.c_str(), DirectX::WIC_FLAGS_NONE, &metaData, image);
-        ThrowFailed(hr);
+        hr = DirectX::LoadFromWICFile(fileName.c_str(), DirectX::WIC_FLAGS_NONE, &outImage.MetaData, outImage.Image);
     }
     else if (ext == L"tga")
     {
-        hr = DirectX::LoadFromTGAFile(fileName.c_str(), &metaData, image);
-        ThrowFailed(hr);
+        hr = DirectX::LoadFromTGAFile(fileName.c_str(), &outImage.MetaData, outImage.Image);
     }
     else if (ext == L"hdr")
     {
-        hr = DirectX::LoadFromHDRFile(fileName.c_str(), &metaData, image);
-        ThrowFailed(hr);
+        hr = DirectX::LoadFromHDRFile(fileName.c_str(), &outImage.MetaData, outImage.Image);
     }
     else if (ext == L"dds")
     {
-        hr = DirectX::LoadFromDDSFile(fileName.c_str(), DirectX::DDS_FLAGS_NONE, &metaData, image);
-        ThrowFailed(hr);
+        hr = DirectX::LoadFromDDSFile(fileName.c_str(), DirectX::DDS_FLAGS_NONE, &outImage.MetaData, outImage.Image);
     }
     else
     {
         assert(false && "Ή̉摜tH[}bgł");
     }
+    if (FAILED(hr))
+    {
+        return hr;
+    }
+
+    // WICETGA ̉摜̓~bvȂ̂ŁA̖ʂȂ悤ɂō (DDS ͌̃~bv̂܂܎g)
+    if (ext == L"dds")
+    {
+        return S_OK;
+    }
+    return GenerateMips(mipFilter, isParallel, outImage);
+}
 
-    DXGI_FORMAT resourceFormat = ConvertToSRGB(metaData.format);
+std::vector<std::unique_ptr<Texture>> Texture::CreateFromFiles(Renderer* pRenderer, const std::vector<std::wstring>& filePaths,
+    const std::vector<TextureCook::TextureRole>& roles, const std::vector<MipGenerator::Filter>& mipFilters, uint32_t streamingTailSize)
+{
+    assert(roles.size() == filePaths.size() && mipFilters.size() == filePaths.size());
+    std::vector<std::unique_ptr<Texture>> textures(filePaths.size());
+    if (filePaths.empty())
+    {
+        return textures;
+    }
 
-    // Abv[hpf[^̏
-    DirectX::PrepareUpload(pDevice, image.GetImages(), image.GetImageCount(), metaData, subResources);
+    // t@C̓ǂݍ݂ƃfR[h̓eNX`ɓƗĂ̂ŕɍs
+    // eNX`[J[菭Ȃ΁A]XbhŃ~bv̍쐬S
+    const bool isParallelMips = filePaths.size() < Parallel::GetWorkerCount();
+    std::vector<TextureImage> images(filePaths.size());
+    std::vector<HRESULT> results(filePaths.size(), E_FAIL);
+    Parallel::ForEach(filePaths.size(), [&](size_t i)
+        {
+            // WIC  COM ĝŁA[J[XbhłĂ
+            const HRESULT hrCom = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+            results[i] = Decode(filePaths[i], roles[i], mipFilters[i], images[i], isParallelMips);
+            if (SUCCEEDED(hrCom))
+            {
+                CoUninitialize();
+            }
+        });
+    for (const auto hr : results)
+    {
+        ThrowFailed(hr);
+    }
+
+    // ]1̃R}hXgɂ܂Ƃ߁A1񂾂҂
+    ExecuteUpload(pRenderer, [&](ID3D12GraphicsCommandList* pCommandList)
+        {
+            for (size_t i = 0; i < filePaths.size(); ++i)
+            {
+                auto& image = images[i];
+                const uint32_t tailMip = TextureStreamer::GetTailMip(static_cast<uint32_t>(image.MetaData.width),
+                    static_cast<uint32_t>(image.MetaData.height), static_cast<uint32_t>(image.MetaData.mipLevels), streamingTailSize);
+                if (streamingTailSize == 0 || !CanStream(image.MetaData, tailMip))
+                {
+                    textures[i] = std::make_unique<Texture>(pRenderer, image, pCommandList);
+                    continue;
+                }
+
+                // Xg[~OeNX`͏~bv]Ac̃~bv̂߂ɉ摜ێ
+                // (]f[^͋L^ɃAbv[hpobt@փRs[ς݂Ȃ̂ŁA摜͈ڂĂ悢)
+                textures[i] = std::make_unique<Texture>(pRenderer, image, pCommandList, D3D12_RESOURCE_FLAG_NONE, tailMip);
+                textures[i]->m_StreamImage = std::move(image);
+            }
+        });
+    for (auto& texture : textures)
+    {
+        texture->ReleaseUploadBuffer();
+    }
+    return textures;
+}
+
+std::vector<uint64_t> Texture::GetMipSizes() const
+{
+    std::vector<uint64_t> sizes(m_StreamImage.MetaData.mipLevels);
+    for (size_t mip = 0; mip < sizes.size(); ++mip)
+    {
+        sizes[mip] = m_StreamImage.Image.GetImage(mip, 0, 0)->slicePitch;
+    }
+    return sizes;
+}
+
+void Texture::SetResidentMip(Renderer* pRenderer, uint32_t residentMip, ID3D12GraphicsCommandList* pCommandList)
+{
+    assert(IsStreamable());
+    if (residentMip == m_ResidentMip)
+    {
+        return;
+    }
+
+    // 풓~bṽ\[Xɍ蒼 (ɏ풓Ăe~bv CPU ̉摜])
+    m_pResource.Reset();
+    CreateResource(pRenderer, m_StreamImage, pCommandList, D3D12_RESOURCE_FLAG_NONE, residentMip);
+}
+
+void Texture::CreateResource(Renderer* pRenderer, const TextureImage& image, ID3D12GraphicsCommandList* pCommandList, D3D12_RESOURCE_FLAGS flag,
+    uint32_t firstMip)
+{
+    auto pDevice = pRenderer->GetDevice().Get();
+    const auto& metaData = image.MetaData;
+    std::vector<D3D12_SUBRESOURCE_DATA> subResources;
+    assert(firstMip < metaData.mipLevels);
+
+    // ϊς݂ DDS ̓tH[}bg sRGB ǂ܂܂ĂBϊĂȂ摜͐F sRGB œǂ
+    // (@}bv sRGB œǂނƃVF[_[ *2-1 ̑OɒlȂ̂ŁA@E}XN UNORM ̂܂)
+    DXGI_FORMAT resourceFormat = metaData.format;
+    if (!image.IsCooked)
+    {
+        resourceFormat = TextureCook::IsSRGB(image.Role) ? ConvertToSRGB(metaData.format) : DirectX::MakeLinear(metaData.format);
+    }
+
+    // Abv[hpf[^̏ (złȂ 2D eNX`̓Tu\[X̔ԍ~bv̔ԍȂ̂ŁAfirstMip O)
+    HRESULT hr = DirectX::PrepareUpload(pDevice, image.Image.GetImages(), image.Image.GetImageCount(), metaData, subResources);
+    ThrowFailed(hr);
+    subResources.erase(subResources.begin(), subResources.begin() + firstMip);
+    m_ResidentMip = firstMip;
+    const DirectX::Image* pFirstMip = image.Image.GetImage(firstMip, 0, 0);
 
     // 2. eNX`\[X (Default Heap) ̍쐬
     D3D12_HEAP_PROPERTIES textureProp = {};
@@ -101,10 +377,10 @@ Texture::Texture(Renderer* pRenderer, const std::wstring& filePath, D3D12_RESOUR
     textureProp.VisibleNodeMask = 1;
 
     D3D12_RESOURCE_DESC desc = {};
-    desc.MipLevels = static_cast<UINT16>(metaData.mipLevels);
+    desc.MipLevels = static_cast<UINT16>(metaData.mipLevels - firstMip);
     desc.Format = resourceFormat; // SRGBϊ̃tH[}bggp
-    desc.Width = static_cast<UINT>(metaData.width);
-    desc.Height = static_cast<UINT>(metaData.height);
+    desc.Width = static_cast<UINT>(pFirstMip->width);
+    desc.Height = static_cast<UINT>(pFirstMip->height);
     desc.Flags = flag;
     desc.DepthOrArraySize = static_cast<UINT16>(metaData.arraySize);
     desc.SampleDesc.Count = 1;
@@ -144,34 +420,22 @@ Texture::Texture(Renderer* pRenderer, const std::wstring& filePath, D3D12_RESOUR
     uploadDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
     uploadDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
 
-    // ꎞ\[XȂ̂ŃX}[g|C^ŊǗA֐I(WaitGpu)ɔj
-    ComPtr<ID3D12Resource> uploadResource;
-
+    // R}h̊҂܂ŔjłȂ̂ŁAReleaseUploadBuffer() Ă΂܂ŕێ
     hr = pDevice->CreateCommittedResource(
         &uploadProp,
         D3D12_HEAP_FLAG_NONE,
         &uploadDesc,
         D3D12_RESOURCE_STATE_GENERIC_READ,
         nullptr,
-        IID_PPV_ARGS(uploadResource.GetAddressOf())
+        IID_PPV_ARGS(m_pUploadResource.GetAddressOf())
     );
     ThrowFailed(hr);
 
-    ComPtr<ID3D12CommandAllocator> tempAllocator;
-    ComPtr<ID3D12GraphicsCommandList> tempCommandList;
-
-    hr = pDevice->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(tempAllocator.GetAddressOf()));
-    ThrowFailed(hr);
-
-    // CreateCommandList Open ԂȂ̂ Reset sv
-    hr = pDevice->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, tempAllocator.Get(), nullptr, IID_PPV_ARGS(tempCommandList.GetAddressOf()));
-    ThrowFailed(hr);
-
     // Tu\[X̍XVR}hL^
     UpdateSubresources(
-        tempCommandList.Get(),
+        pCommandList,
         m_pResource.Get(),
-        uploadResource.Get(),
+        m_pUploadResource.Get(),
         0, 0,
         static_cast<UINT>(subResources.size()),
         subResources.data()
@@ -184,22 +448,14 @@ Texture::Texture(Renderer* pRenderer, const std::wstring& filePath, D3D12_RESOUR
     barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_COPY_DEST;
     barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
     barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-    tempCommandList->ResourceBarrier(1, &barrier);
-
-    // R}hL^I
-    tempCommandList->Close();
-
-    // s (L[Renderer̂̂gp)
-    ID3D12CommandQueue* pQueue = pRenderer->GetCommands(D3D12_COMMAND_LIST_TYPE_DIRECT)->GetCommandQueue().Get();
-    ID3D12CommandList* ppCommandLists[] = { tempCommandList.Get() };
-    pQueue->ExecuteCommandLists(1, ppCommandLists);
-
-    // ]܂őҋ@
-    pRenderer->GetCommands(D3D12_COMMAND_LIST_TYPE_DIRECT)->WaitGpu(INFINITE);
+    pCommandList->ResourceBarrier(1, &barrier);
 
-    // 5. VF[_[\[Xr[ (SRV) ̍쐬
-    SRVHeap = pRenderer->GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-    srvIndex = SRVHeap->GetNextAvailableIndex();
+    // 5. VF[_[\[Xr[ (SRV) ̍쐬 (蒼ꍇ͓ԍɏ㏑AQƂĂ郁bV̂܂܎g悤ɂ)
+    if (SRVHeap == nullptr)
+    {
+        SRVHeap = pRenderer->GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        srvIndex = SRVHeap->GetNextAvailableIndex();
+    }
     D3D12_SHADER_RESOURCE_VIEW_DESC viewDesc = GetViewDesc(desc);
 
     pDevice->CreateShaderResourceView(
@@ -229,6 +485,15 @@ D3D12_SHADER_RESOURCE_VIEW_DESC Texture::GetViewDesc(D3D12_RESOURCE_DESC desc)
 
     viewDesc.Format = desc.Format;
     viewDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+    if (desc.Format == DXGI_FORMAT_BC4_UNORM)
+    {
+        // 1`l̃}XN R  RGB ɕA3`l̎Ɠœǂ߂悤ɂ
+        viewDesc.Shader4ComponentMapping = D3D12_ENCODE_SHADER_4_COMPONENT_MAPPING(
+            D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_0,
+            D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_0,
+            D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_0,
+            D3D12_SHADER_COMPONENT_MAPPING_FORCE_VALUE_1);
+    }
 
     switch (desc.Dimension)
     {
@@ -263,9 +528,10 @@ D3D12_SHADER_RESOURCE_VIEW_DESC Texture::GetViewDesc(D3D12_RESOURCE_DESC desc)
 
     case D3D12_RESOURCE_DIMENSION_TEXTURE2D:
     {
+        // }`Tvǂ̓~bvł͂ȂTvŌ܂
         if (desc.DepthOrArraySize > 1)
         {
-            if (desc.MipLevels > 1)
+            if (desc.SampleDesc.Count > 1)
             {
                 viewDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DMSARRAY;
 
@@ -286,7 +552,7 @@ D3D12_SHADER_RESOURCE_VIEW_DESC Texture::GetViewDesc(D3D12_RESOURCE_DESC desc)
         }
         else
         {
-            if (desc.MipLevels > 1)
+            if (desc.SampleDesc.Count > 1)
             {
                 viewDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DMS;
             }
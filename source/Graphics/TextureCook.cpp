@@ -0,0 +1,149 @@
+#include "Graphics/TextureCook.h"
+#include "Graphics/GltfLoader.h"
+#include "Utilities/FileHash.h"
+
+#include <algorithm>
+#include <cwctype>
+#include <filesystem>
+
+namespace TextureCookInternal
+{
+	//! ϊ̑Ώۂɂgq
+	const wchar_t* const CookableExtensions[] = { L".png", L".tga", L".jpg", L".jpeg", L".bmp" };
+
+	/// <summary>
+	/// t@CɊ܂܂Ăpr߂ (Aォ珇ɔ)
+	/// </summary>
+	struct RoleKeyword
+	{
+		const wchar_t* pKeyword;
+		TextureCook::TextureRole Role;
+	};
+	const RoleKeyword RoleKeywords[] =
+	{
+		{ L"normal", TextureCook::TextureRole::Normal },
+		{ L"_nrm", TextureCook::TextureRole::Normal },
+		{ L"_n.", TextureCook::TextureRole::Normal },
+		{ L"roughness", TextureCook::TextureRole::Mask },
+		{ L"metallic", TextureCook::TextureRole::Mask },
+		{ L"metalness", TextureCook::TextureRole::Mask },
+		{ L"occlusion", TextureCook::TextureRole::Mask },
+		{ L"_ao.", TextureCook::TextureRole::Mask },
+		{ L"height", TextureCook::TextureRole::Mask },
+		{ L"mask", TextureCook::TextureRole::Mask },
+	};
+
+	std::wstring ToLower(std::wstring text)
+	{
+		std::transform(text.begin(), text.end(), text.begin(), ::towlower);
+		return text;
+	}
+
+	void AddRole(const std::string& texturePath, TextureCook::TextureRole role,
+		std::unordered_map<std::wstring, TextureCook::TextureRole>& roles)
+	{
+		if (texturePath.empty())
+		{
+			return;
+		}
+		const auto fileName = ToLower(std::filesystem::u8path(texturePath).filename().wstring());
+		roles.emplace(fileName, role);
+	}
+}
+using namespace TextureCookInternal;
+
+const char* TextureCook::GetRoleName(TextureRole role)
+{
+	switch (role)
+	{
+	case TextureRole::Color: return "color";
+	case TextureRole::Normal: return "normal";
+	case TextureRole::Mask: return "mask";
+	default: return "unknown";
+	}
+}
+
+MipGenerator::Content TextureCook::GetMipContent(TextureRole role)
+{
+	switch (role)
+	{
+	case TextureRole::Normal: return MipGenerator::Content::Normal;
+	case TextureRole::Mask: return MipGenerator::Content::Linear;
+	default: return MipGenerator::Content::Color;
+	}
+}
+
+bool TextureCook::IsCookable(const std::wstring& filePath)
+{
+	const auto extension = ToLower(std::filesystem::path(filePath).extension().wstring());
+	return std::any_of(std::begin(CookableExtensions), std::end(CookableExtensions),
+		[&](const wchar_t* pExtension) { return extension == pExtension; });
+}
+
+bool TextureCook::MakeKey(const std::wstring& sourcePath, uint64_t& outKey)
+{
+	uint64_t hash = FileHash::FNVOffsetBasis;
+	const uint32_t version = Version;
+	hash = FileHash::HashBytes(hash, reinterpret_cast<const uint8_t*>(&version), sizeof(version));
+	if (!FileHash::HashFile(sourcePath, hash))
+	{
+		return false;
+	}
+	outKey = hash;
+	return true;
+}
+
+std::wstring TextureCook::GetCookedPath(const std::wstring& sourcePath, uint64_t key)
+{
+	static const wchar_t HexDigits[] = L"0123456789abcdef";
+	std::wstring keyText(16, L'0');
+	for (int i = 15; i >= 0; --i)
+	{
+		keyText[i] = HexDigits[key & 0xF];
+		key >>= 4;
+	}
+
+	std::filesystem::path source(sourcePath);
+	return (source.parent_path() / CookedDirName / (source.stem().wstring() + L"_" + keyText + L".dds")).wstring();
+}
+
+std::wstring TextureCook::FindCooked(const std::wstring& sourcePath)
+{
+	uint64_t key = 0;
+	if (!IsCookable(sourcePath) || !MakeKey(sourcePath, key))
+	{
+		return std::wstring();
+	}
+	auto cookedPath = GetCookedPath(sourcePath, key);
+	std::error_code ec;
+	return std::filesystem::is_regular_file(cookedPath, ec) ? cookedPath : std::wstring();
+}
+
+TextureCook::TextureRole TextureCook::GuessRoleFromName(const std::wstring& filePath)
+{
+	const auto fileName = ToLower(std::filesystem::path(filePath).filename().wstring());
+	for (const auto& keyword : RoleKeywords)
+	{
+		if (fileName.find(keyword.pKeyword) != std::wstring::npos)
+		{
+			return keyword.Role;
+		}
+	}
+	return TextureRole::Color;
+}
+
+bool TextureCook::CollectRoles(const std::wstring& modelPath, std::unordered_map<std::wstring, TextureRole>& roles)
+{
+	ModelData modelData;
+	if (!GltfLoader::CanLoad(modelPath) || !GltfLoader::Load(modelPath, modelData))
+	{
+		return false;
+	}
+	for (const auto& material : modelData.Materials)
+	{
+		AddRole(material.NormalTexPath, TextureRole::Normal, roles);
+		AddRole(material.GLTFMetaricRoughnessTexPath, TextureRole::Mask, roles);
+		AddRole(material.DiffuseTexPath, TextureRole::Color, roles);
+	}
+	return true;
+}
@@ -0,0 +1,190 @@
+#include "Graphics/TextureStreamer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+uint32_t TextureStreamer::GetTailMip(uint32_t width, uint32_t height, uint32_t mipCount, uint32_t tailSize)
+{
+	uint32_t mip = 0;
+	while (mip + 1 < mipCount && (std::max)(width >> mip, height >> mip) > tailSize)
+	{
+		++mip;
+	}
+	return mip;
+}
+
+float TextureStreamer::ComputeMipLevel(uint32_t width, uint32_t height, float uvDensity, float pixelsPerLocalUnit)
+{
+	// UV ȂbVȂǂ͍łe~bvő
+	if (uvDensity <= 0.0f || pixelsPerLocalUnit <= 0.0f)
+	{
+		return static_cast<float>(sizeof(uint32_t) * 8);
+	}
+
+	// ʏ1sNZɓeNZ (cő傫ႤeNX`͖ʐς`ƂĈ)
+	const float texelsPerLocalUnit = std::sqrt(static_cast<float>(width) * static_cast<float>(height)) * uvDensity;
+	return std::log2(texelsPerLocalUnit / pixelsPerLocalUnit);
+}
+
+TextureStreamer::Handle TextureStreamer::Register(uint32_t width, uint32_t height, const std::vector<uint64_t>& mipSizes)
+{
+	assert(!mipSizes.empty());
+
+	Entry entry;
+	entry.MipSizes = mipSizes;
+	entry.TailMip = GetTailMip(width, height, static_cast<uint32_t>(mipSizes.size()), m_Settings.TailSize);
+	entry.ResidentMip = entry.TailMip;
+	entry.RequestedMip = entry.TailMip;
+	for (size_t mip = entry.TailMip; mip < mipSizes.size(); ++mip)
+	{
+		m_ResidentBytes += mipSizes[mip];
+	}
+
+	m_Entries.push_back(std::move(entry));
+	m_Stats.TextureCount = static_cast<uint32_t>(m_Entries.size());
+	m_Stats.ResidentBytes = m_ResidentBytes;
+	return static_cast<Handle>(m_Entries.size() - 1);
+}
+
+void TextureStreamer::Request(Handle handle, float mipLevel)
+{
+	auto& entry = m_Entries[handle];
+	// NaN ͍łׂ~bvƂĈ
+	const float biased = mipLevel + m_Settings.MipBias;
+	const uint32_t mip = biased > 0.0f ? static_cast<uint32_t>((std::min)(biased, static_cast<float>(entry.TailMip))) : 0;
+	entry.RequestedMip = (std::min)(entry.RequestedMip, mip);
+	entry.LastUsedFrame = m_Frame;
+}
+
+const std::vector<TextureStreamer::Change>& TextureStreamer::Update()
+{
+	m_Changes.clear();
+	for (auto& entry : m_Entries)
+	{
+		entry.IsChanged = false;
+	}
+	m_Stats.UploadedBytes = 0;
+	m_Stats.LoadedMips = 0;
+	m_Stats.EvictedMips = 0;
+
+	// \ZꍇȂǂ́A܂\ZɎ߂
+	// ĂeNX`ŗ\Z𒴂ꍇ́Avꂽ~bv傫̂̂Ă (ǂݍ݂͗\Z𒴂Ȃ̂ŁAǂݒJԂƂ͂Ȃ)
+	while (m_ResidentBytes > m_Settings.BudgetBytes && (EvictOne(InvalidHandle, false) || EvictOne(InvalidHandle, true)))
+	{
+	}
+
+	// vɑĂȂeNX`AȂi1iׂ
+	std::vector<Handle> candidates;
+	for (Handle handle = 0; handle < m_Entries.size(); ++handle)
+	{
+		if (m_Entries[handle].RequestedMip < m_Entries[handle].ResidentMip)
+		{
+			candidates.push_back(handle);
+		}
+	}
+	std::stable_sort(candidates.begin(), candidates.end(), [&](Handle a, Handle b)
+		{
+			const auto& entryA = m_Entries[a];
+			const auto& entryB = m_Entries[b];
+			return entryA.ResidentMip - entryA.RequestedMip > entryB.ResidentMip - entryB.RequestedMip;
+		});
+
+	bool isProgressed = true;
+	bool isUploadFull = false;
+	while (isProgressed && !isUploadFull)
+	{
+		isProgressed = false;
+		for (const Handle handle : candidates)
+		{
+			auto& entry = m_Entries[handle];
+			if (entry.RequestedMip >= entry.ResidentMip)
+			{
+				continue;
+			}
+
+			const uint64_t size = entry.MipSizes[entry.ResidentMip - 1];
+			if (m_Stats.UploadedBytes > 0 && m_Stats.UploadedBytes + size > m_Settings.MaxUploadBytesPerFrame)
+			{
+				isUploadFull = true;
+				break;
+			}
+
+			// \Z𒴂镪͑̃eNX`̂Ă (̂ĂȂ΁ÃeNX`͍̒iŉ䖝)
+			while (m_ResidentBytes + size > m_Settings.BudgetBytes && EvictOne(handle, false))
+			{
+			}
+			if (m_ResidentBytes + size > m_Settings.BudgetBytes)
+			{
+				continue;
+			}
+
+			--entry.ResidentMip;
+			entry.IsChanged = true;
+			m_ResidentBytes += size;
+			m_Stats.UploadedBytes += size;
+			++m_Stats.LoadedMips;
+			isProgressed = true;
+		}
+	}
+
+	m_Stats.PendingTextures = 0;
+	for (Handle handle = 0; handle < m_Entries.size(); ++handle)
+	{
+		auto& entry = m_Entries[handle];
+		if (entry.RequestedMip < entry.ResidentMip)
+		{
+			++m_Stats.PendingTextures;
+		}
+		if (entry.IsChanged)
+		{
+			m_Changes.push_back({ handle, entry.ResidentMip });
+		}
+		entry.RequestedMip = entry.TailMip;
+	}
+	m_Stats.ResidentBytes = m_ResidentBytes;
+	++m_Frame;
+	return m_Changes;
+}
+
+bool TextureStreamer::EvictOne(Handle exclude, bool isNeededEvictable)
+{
+	Handle victim = InvalidHandle;
+	for (Handle handle = 0; handle < m_Entries.size(); ++handle)
+	{
+		const auto& entry = m_Entries[handle];
+		if (handle == exclude || entry.ResidentMip >= entry.TailMip)
+		{
+			continue;
+		}
+		// ̃t[ŎgeNX`́Avׂ]ȃ~bv̂Ă
+		if (!isNeededEvictable && entry.LastUsedFrame == m_Frame && entry.ResidentMip >= entry.RequestedMip)
+		{
+			continue;
+		}
+
+		// łgĂȂ̂IсAȂ傫~bv̂D悷
+		if (victim == InvalidHandle)
+		{
+			victim = handle;
+			continue;
+		}
+		const auto& best = m_Entries[victim];
+		if (entry.LastUsedFrame < best.LastUsedFrame
+			|| (entry.LastUsedFrame == best.LastUsedFrame && entry.MipSizes[entry.ResidentMip] > best.MipSizes[best.ResidentMip]))
+		{
+			victim = handle;
+		}
+	}
+	if (victim == InvalidHandle)
+	{
+		return false;
+	}
+
+	auto& entry = m_Entries[victim];
+	m_ResidentBytes -= entry.MipSizes[entry.ResidentMip];
+	++entry.ResidentMip;
+	entry.IsChanged = true;
+	++m_Stats.EvictedMips;
+	return true;
+}
@@ -114,10 +114,8 @@ const Matrix4x4& Transform::GetView() const
 
 void Transform::Update()
 {
-	auto scale = Matrix4x4::ScalingToMatrix(m_Scale);
-	auto rot = Matrix4x4::QuaternionToMatrix(m_Quaternion);
-	auto pos = Matrix4x4::TransitionToMatrix(m_Position);
-	m_World = scale * rot * pos;
+	// scale * rot * pos sςȂō
+	m_World = Matrix4x4::Compose(m_Scale, m_Quaternion, m_Position);
 
 	// 0s: Right (X)
 	m_Right.x = m_World.m_mat[0][0];
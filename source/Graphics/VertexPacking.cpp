@@ -0,0 +1,281 @@
+#include "Graphics/VertexPacking.h"
+#include "Math/MathSIMD.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace VertexPackingInternal
+{
+	using MathSIMD::float4;
+
+	constexpr float PositionMax = 65535.0f; //!< UNORM16 ̍ől
+	constexpr float SnormMax = 127.0f;      //!< SNORM8 ̍ől
+
+	//! SIMD WX^e[o߂̈ꎞ̈
+	struct Lanes
+	{
+		float v[4];
+	};
+
+	inline Lanes ToLanes(float4 value)
+	{
+		Lanes lanes;
+		MathSIMD::Store(lanes.v, value);
+		return lanes;
+	}
+
+	//! @brief ؂̂ĂŎľܓɂȂ悤 0.5 𑫂 (̒l -0.5)
+	inline float4 RoundBias(float4 value)
+	{
+		const float4 isNegative = MathSIMD::CmpLT(value, MathSIMD::Splat(0.0f));
+		return MathSIMD::Add(value, MathSIMD::Select(isNegative, MathSIMD::Splat(-0.5f), MathSIMD::Splat(0.5f)));
+	}
+
+	/// <summary>
+	/// ʑ̎ʑ (PʃxNg [-1, 1] 2Ɏʂ܂)
+	/// </summary>
+	void OctEncode(float4 x, float4 y, float4 z, float4& outU, float4& outV)
+	{
+		const float4 zero = MathSIMD::Splat(0.0f);
+		const float4 one = MathSIMD::Splat(1.0f);
+		const float4 minusOne = MathSIMD::Splat(-1.0f);
+
+		//  0 ̃xNg +Z ƂĈ
+		const float4 sum = MathSIMD::Add(MathSIMD::Add(MathSIMD::Abs(x), MathSIMD::Abs(y)), MathSIMD::Abs(z));
+		const float4 isZero = MathSIMD::CmpLT(sum, MathSIMD::Splat(1e-20f));
+		const float4 inv = MathSIMD::Div(one, MathSIMD::Select(isZero, one, sum));
+		const float4 u = MathSIMD::Select(isZero, zero, MathSIMD::Mul(x, inv));
+		const float4 v = MathSIMD::Select(isZero, zero, MathSIMD::Mul(y, inv));
+
+		// ͑ΊpŊO֐܂Ԃ
+		const float4 signU = MathSIMD::Select(MathSIMD::CmpLT(u, zero), minusOne, one);
+		const float4 signV = MathSIMD::Select(MathSIMD::CmpLT(v, zero), minusOne, one);
+		const float4 foldU = MathSIMD::Mul(MathSIMD::Sub(one, MathSIMD::Abs(v)), signU);
+		const float4 foldV = MathSIMD::Mul(MathSIMD::Sub(one, MathSIMD::Abs(u)), signV);
+		const float4 isLower = MathSIMD::CmpLT(z, zero);
+		outU = MathSIMD::Select(isLower, foldU, u);
+		outV = MathSIMD::Select(isLower, foldV, v);
+	}
+
+	/// <summary>
+	/// ʑ̎ʑ̋tϊ (VF[_[ OctDecode ƓvZ)
+	/// </summary>
+	void OctDecode(float4 u, float4 v, float4& outX, float4& outY, float4& outZ)
+	{
+		const float4 zero = MathSIMD::Splat(0.0f);
+		const float4 z = MathSIMD::Sub(MathSIMD::Sub(MathSIMD::Splat(1.0f), MathSIMD::Abs(u)), MathSIMD::Abs(v));
+		const float4 t = MathSIMD::Max(MathSIMD::Sub(zero, z), zero);
+		const float4 negT = MathSIMD::Sub(zero, t);
+		const float4 x = MathSIMD::Add(u, MathSIMD::Select(MathSIMD::CmpLT(u, zero), t, negT));
+		const float4 y = MathSIMD::Add(v, MathSIMD::Select(MathSIMD::CmpLT(v, zero), t, negT));
+		const float4 length = MathSIMD::Sqrt(MathSIMD::Add(MathSIMD::Add(MathSIMD::Mul(x, x), MathSIMD::Mul(y, y)), MathSIMD::Mul(z, z)));
+		outX = MathSIMD::Div(x, length);
+		outY = MathSIMD::Div(y, length);
+		outZ = MathSIMD::Div(z, length);
+	}
+
+	//! @brief SNORM8 ̓WJ (-128  -127 ͂ǂ -1)
+	inline float4 UnpackSnorm(float4 value)
+	{
+		return MathSIMD::Max(MathSIMD::Mul(value, MathSIMD::Splat(1.0f / SnormMax)), MathSIMD::Splat(-1.0f));
+	}
+
+	void Encode4(const Vertex* const (&pSrc)[4], size_t count, const float4 (&offset)[3], const float4 (&invScale)[3], PackedVertex* pDst)
+	{
+		const float4 zero = MathSIMD::Splat(0.0f);
+		const float4 one = MathSIMD::Splat(1.0f);
+		const float4 positionMax = MathSIMD::Splat(PositionMax);
+		const float4 snormMax = MathSIMD::Splat(SnormMax);
+
+		// ʒu: AABB  0`1 ɐK 16bit 
+		const float4 position[3] = {
+			MathSIMD::Set(pSrc[0]->m_Position.x, pSrc[1]->m_Position.x, pSrc[2]->m_Position.x, pSrc[3]->m_Position.x),
+			MathSIMD::Set(pSrc[0]->m_Position.y, pSrc[1]->m_Position.y, pSrc[2]->m_Position.y, pSrc[3]->m_Position.y),
+			MathSIMD::Set(pSrc[0]->m_Position.z, pSrc[1]->m_Position.z, pSrc[2]->m_Position.z, pSrc[3]->m_Position.z),
+		};
+		Lanes quantized[3];
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			float4 t = MathSIMD::Mul(MathSIMD::Sub(position[axis], offset[axis]), invScale[axis]);
+			t = MathSIMD::Min(MathSIMD::Max(t, zero), one);
+			quantized[axis] = ToLanes(MathSIMD::Add(MathSIMD::Mul(t, positionMax), MathSIMD::Splat(0.5f)));
+		}
+
+		// @Eڐ: ʑ̎ʑ 8bit 
+		float4 normalU, normalV, tangentU, tangentV;
+		OctEncode(
+			MathSIMD::Set(pSrc[0]->m_Normal.x, pSrc[1]->m_Normal.x, pSrc[2]->m_Normal.x, pSrc[3]->m_Normal.x),
+			MathSIMD::Set(pSrc[0]->m_Normal.y, pSrc[1]->m_Normal.y, pSrc[2]->m_Normal.y, pSrc[3]->m_Normal.y),
+			MathSIMD::Set(pSrc[0]->m_Normal.z, pSrc[1]->m_Normal.z, pSrc[2]->m_Normal.z, pSrc[3]->m_Normal.z),
+			normalU, normalV);
+		OctEncode(
+			MathSIMD::Set(pSrc[0]->m_Tangent.x, pSrc[1]->m_Tangent.x, pSrc[2]->m_Tangent.x, pSrc[3]->m_Tangent.x),
+			MathSIMD::Set(pSrc[0]->m_Tangent.y, pSrc[1]->m_Tangent.y, pSrc[2]->m_Tangent.y, pSrc[3]->m_Tangent.y),
+			MathSIMD::Set(pSrc[0]->m_Tangent.z, pSrc[1]->m_Tangent.z, pSrc[2]->m_Tangent.z, pSrc[3]->m_Tangent.z),
+			tangentU, tangentV);
+		const Lanes octs[4] = {
+			ToLanes(RoundBias(MathSIMD::Mul(normalU, snormMax))),
+			ToLanes(RoundBias(MathSIMD::Mul(normalV, snormMax))),
+			ToLanes(RoundBias(MathSIMD::Mul(tangentU, snormMax))),
+			ToLanes(RoundBias(MathSIMD::Mul(tangentV, snormMax))),
+		};
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			PackedVertex packed;
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				packed.Position[axis] = static_cast<uint16_t>(quantized[axis].v[i]);
+			}
+			// Vertex ͏]@̌Ȃ̂ŁAڋԂ͏ N x T ̌ (+1)
+			packed.Position[3] = static_cast<uint16_t>(PositionMax);
+			for (int k = 0; k < 4; ++k)
+			{
+				packed.NormalTangent[k] = static_cast<int8_t>(static_cast<int>(octs[k].v[i]));
+			}
+			packed.TexCoord[0] = VertexPacking::FloatToHalf(pSrc[i]->m_TexCoord.x);
+			packed.TexCoord[1] = VertexPacking::FloatToHalf(pSrc[i]->m_TexCoord.y);
+			pDst[i] = packed;
+		}
+	}
+
+	void Decode4(const PackedVertex* const (&pSrc)[4], size_t count, const float4 (&offset)[3], const float4 (&scale)[3], Vertex* pDst)
+	{
+		float4 position[3];
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			const float4 q = MathSIMD::Set(pSrc[0]->Position[axis], pSrc[1]->Position[axis], pSrc[2]->Position[axis], pSrc[3]->Position[axis]);
+			position[axis] = MathSIMD::MulAdd(MathSIMD::Mul(q, MathSIMD::Splat(1.0f / PositionMax)), scale[axis], offset[axis]);
+		}
+
+		float4 octs[4];
+		for (int k = 0; k < 4; ++k)
+		{
+			octs[k] = UnpackSnorm(MathSIMD::Set(pSrc[0]->NormalTangent[k], pSrc[1]->NormalTangent[k], pSrc[2]->NormalTangent[k], pSrc[3]->NormalTangent[k]));
+		}
+		float4 normal[3], tangent[3];
+		OctDecode(octs[0], octs[1], normal[0], normal[1], normal[2]);
+		OctDecode(octs[2], octs[3], tangent[0], tangent[1], tangent[2]);
+
+		const Lanes positionLanes[3] = { ToLanes(position[0]), ToLanes(position[1]), ToLanes(position[2]) };
+		const Lanes normalLanes[3] = { ToLanes(normal[0]), ToLanes(normal[1]), ToLanes(normal[2]) };
+		const Lanes tangentLanes[3] = { ToLanes(tangent[0]), ToLanes(tangent[1]), ToLanes(tangent[2]) };
+		for (size_t i = 0; i < count; ++i)
+		{
+			Vertex& vertex = pDst[i];
+			vertex.m_Position = Vector3D(positionLanes[0].v[i], positionLanes[1].v[i], positionLanes[2].v[i]);
+			vertex.m_Normal = Vector3D(normalLanes[0].v[i], normalLanes[1].v[i], normalLanes[2].v[i]);
+			vertex.m_Tangent = Vector3D(tangentLanes[0].v[i], tangentLanes[1].v[i], tangentLanes[2].v[i]);
+			vertex.m_TexCoord.x = VertexPacking::HalfToFloat(pSrc[i]->TexCoord[0]);
+			vertex.m_TexCoord.y = VertexPacking::HalfToFloat(pSrc[i]->TexCoord[1]);
+		}
+	}
+
+	/// <summary>
+	/// 4 vfA[͍Ō̗vfJԂĖ߂܂
+	/// </summary>
+	template<typename Src, typename Func>
+	void ForEach4(const Src* pSrc, size_t count, Func&& func)
+	{
+		for (size_t i = 0; i < count; i += 4)
+		{
+			const size_t n = (std::min)(count - i, static_cast<size_t>(4));
+			const Src* const p[4] = {
+				&pSrc[i],
+				&pSrc[i + (std::min)(static_cast<size_t>(1), n - 1)],
+				&pSrc[i + (std::min)(static_cast<size_t>(2), n - 1)],
+				&pSrc[i + (std::min)(static_cast<size_t>(3), n - 1)],
+			};
+			func(p, i, n);
+		}
+	}
+}
+using namespace VertexPackingInternal;
+
+void VertexPacking::Encode(const Vertex* pSrc, size_t count, const PositionQuantization& quantization, PackedVertex* pDst)
+{
+	// 傫 0 ̎͑S_ Offset ̈ʒuɂ
+	auto inverse = [](float scale) { return scale > 0.0f ? 1.0f / scale : 0.0f; };
+	const float4 offset[3] = {
+		MathSIMD::Splat(quantization.Offset.x), MathSIMD::Splat(quantization.Offset.y), MathSIMD::Splat(quantization.Offset.z) };
+	const float4 invScale[3] = {
+		MathSIMD::Splat(inverse(quantization.Scale.x)), MathSIMD::Splat(inverse(quantization.Scale.y)), MathSIMD::Splat(inverse(quantization.Scale.z)) };
+
+	ForEach4(pSrc, count, [&](const Vertex* const (&p)[4], size_t begin, size_t n)
+		{
+			Encode4(p, n, offset, invScale, pDst + begin);
+		});
+}
+
+void VertexPacking::Decode(const PackedVertex* pSrc, size_t count, const PositionQuantization& quantization, Vertex* pDst)
+{
+	const float4 offset[3] = {
+		MathSIMD::Splat(quantization.Offset.x), MathSIMD::Splat(quantization.Offset.y), MathSIMD::Splat(quantization.Offset.z) };
+	const float4 scale[3] = {
+		MathSIMD::Splat(quantization.Scale.x), MathSIMD::Splat(quantization.Scale.y), MathSIMD::Splat(quantization.Scale.z) };
+
+	ForEach4(pSrc, count, [&](const PackedVertex* const (&p)[4], size_t begin, size_t n)
+		{
+			Decode4(p, n, offset, scale, pDst + begin);
+		});
+}
+
+uint16_t VertexPacking::FloatToHalf(float value)
+{
+	uint32_t bits = 0;
+	std::memcpy(&bits, &value, sizeof(bits));
+	const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+	uint32_t absBits = bits & 0x7FFFFFFFu;
+
+	// NaNEAxŕ\Ȃ傫 (65520 ȏ͊ۂ߂Ɩ)
+	if (absBits >= 0x7F800000u)
+	{
+		return sign | (absBits > 0x7F800000u ? 0x7E00u : 0x7C00u);
+	}
+	if (absBits >= 0x477FF000u)
+	{
+		return sign | 0x7C00u;
+	}
+
+	// 2^-14 ͔x̔񐳋K ( = value * 2^24 ۂ߂)
+	if (absBits < 0x38800000u)
+	{
+		float absValue = 0.0f;
+		std::memcpy(&absValue, &absBits, sizeof(absValue));
+		return sign | static_cast<uint16_t>(std::nearbyint(absValue * 16777216.0f));
+	}
+
+	// w̃oCAX 127  15 ֕tւẢ 13bit ŋߐڋ֊ۂ߂
+	const uint32_t isOdd = (absBits >> 13) & 1u;
+	absBits += 0xC8000FFFu + isOdd;
+	return sign | static_cast<uint16_t>(absBits >> 13);
+}
+
+float VertexPacking::HalfToFloat(uint16_t value)
+{
+	const uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+	const uint32_t exponent = (value >> 10) & 0x1Fu;
+	const uint32_t mantissa = value & 0x3FFu;
+
+	uint32_t bits = 0;
+	if (exponent == 0)
+	{
+		// 0 Ɣ񐳋K
+		const float magnitude = static_cast<float>(mantissa) * (1.0f / 16777216.0f);
+		std::memcpy(&bits, &magnitude, sizeof(bits));
+		bits |= sign;
+	}
+	else if (exponent == 0x1Fu)
+	{
+		bits = sign | 0x7F800000u | (mantissa << 13);
+	}
+	else
+	{
+		bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+	}
+
+	float result = 0.0f;
+	std::memcpy(&result, &bits, sizeof(result));
+	return result;
+}
@@ -102,7 +102,10 @@ PSOutput main(VSOutput input)
     PSOutput output = (PSOutput) 0;
     
     float3 V = input.ray;
-    float3 N = NormalMap.Sample(NormalSmp, input.TexCoord).xyz * 2.0f - 1.0f;
+    // BC5 ̖@}bv XY Ȃ̂ŁAZ ͒Pʒ畜
+    float3 N;
+    N.xy = NormalMap.Sample(NormalSmp, input.TexCoord).xy * 2.0f - 1.0f;
+    N.z = sqrt(saturate(1.0f - dot(N.xy, N.xy)));
     N = mul(input.InvTangentBasis, N);
     float3 R = normalize(reflect(V, N));
 
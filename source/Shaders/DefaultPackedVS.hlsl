@@ -0,0 +1,3 @@
+// k_ (PackedVertex) p DefaultVS
+#define PACKED_VERTEX
+#include "DefaultVS.hlsl"
\ No newline at end of file
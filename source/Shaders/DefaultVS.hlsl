@@ -1,3 +1,19 @@
+#ifdef PACKED_VERTEX
+#include "VertexPacking.hlsli"
+
+// k_ (PackedVertex)
+struct VSInput
+{
+    float4 Position : POSITION;      // xyz: ʎqʒu, w: ڋԂ̌ (0 / 1)
+    float4 NormalTangent : NORMAL;   // xy: ʑ̎ʑ@, zw: ʑ̎ʑڐ
+    float2 TexCoord : TEXCOORD;
+};
+
+cbuffer MeshQuantization : register(b5)
+{
+    PositionQuantization Quantization;
+}
+#else
 struct VSInput
 {
     float3 Position : POSITION;
@@ -5,6 +21,7 @@ struct VSInput
     float2 TexCoord : TEXCOORD;
     float3 Tangent : TANGENT;
 };
+#endif
 
 cbuffer CameraPos : register(b1)
 {
@@ -22,11 +39,15 @@ struct VSOutput
     float3x3 InvTangentBasis : INV_TANGENT_BASIS; // ڐԂւ̊ϊs̋ts
 };
 
-cbuffer Transform : register(b0)
+cbuffer ObjectTransform : register(b0)
+{
+    row_major float3x4 World : packoffset(c0);
+}
+
+cbuffer CameraTransform : register(b4)
 {
-    float4x4 World : packoffset(c0);
-    float4x4 View : packoffset(c4);
-    float4x4 Proj : packoffset(c8);
+    float4x4 View : packoffset(c0);
+    float4x4 Proj : packoffset(c4);
 }
 
 cbuffer LightTransform : register(b3)
@@ -40,8 +61,20 @@ VSOutput main(VSInput input)
 {
     VSOutput output = (VSOutput) 0;
     
-    float4 localPos = float4(input.Position, 1.0f);
-    float4 worldPos = mul(World, localPos);
+#ifdef PACKED_VERTEX
+    float3 inputPos = DecodePosition(input.Position.xyz, Quantization);
+    float3 inputNormal = OctDecode(input.NormalTangent.xy);
+    float3 inputTangent = OctDecode(input.NormalTangent.zw);
+    float tangentSign = input.Position.w * 2.0f - 1.0f;
+#else
+    float3 inputPos = input.Position;
+    float3 inputNormal = input.Normal;
+    float3 inputTangent = input.Tangent;
+    float tangentSign = 1.0f;
+#endif
+
+    float4 localPos = float4(inputPos, 1.0f);
+    float4 worldPos = float4(mul(World, localPos), 1.0f);
     float4 viewPos = mul(View, worldPos);
     float4 projPos = mul(Proj, viewPos);
     
@@ -52,9 +85,9 @@ VSOutput main(VSInput input)
     output.WorldPos = worldPos.xyz;
     
     // xNg
-    float3 N = normalize(mul((float3x3) World, input.Normal));
-    float3 T = normalize(mul((float3x3) World, input.Tangent));
-    float3 B = normalize(cross(N, T));
+    float3 N = normalize(mul((float3x3) World, inputNormal));
+    float3 T = normalize(mul((float3x3) World, inputTangent));
+    float3 B = normalize(cross(N, T)) * tangentSign;
     
     output.InvTangentBasis = transpose(float3x3(T, B, N));
     
@@ -0,0 +1,3 @@
+// k_ (PackedVertex) p ShadowVS
+#define PACKED_VERTEX
+#include "ShadowVS.hlsl"
\ No newline at end of file
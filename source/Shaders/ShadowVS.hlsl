@@ -1,7 +1,21 @@
+#ifdef PACKED_VERTEX
+#include "VertexPacking.hlsli"
+
+struct VSInput
+{
+    float4 Position : POSITION; // ʎqʒu (PackedVertex)
+};
+
+cbuffer MeshQuantization : register(b1)
+{
+    PositionQuantization Quantization;
+}
+#else
 struct VSInput
 {
     float3 Position : POSITION;
 };
+#endif
 
 struct VSOutput
 {
@@ -11,15 +25,19 @@ struct VSOutput
 cbuffer Transform : register(b0)
 {
     float4x4 LightVP : packoffset(c0);
-    float4x4 ModelWorld : packoffset(c4);
+    row_major float3x4 ModelWorld : packoffset(c4);
 }
 
 VSOutput main(VSInput input)
 {
     VSOutput output = (VSOutput) 0;
     
+#ifdef PACKED_VERTEX
+    float4 localPos = float4(DecodePosition(input.Position.xyz, Quantization), 1.0f);
+#else
     float4 localPos = float4(input.Position, 1.0f);
-    float4 worldPos = mul(ModelWorld, localPos);
+#endif
+    float4 worldPos = float4(mul(ModelWorld, localPos), 1.0f);
     float4 projPos = mul(LightVP, worldPos);
     
     output.Position = projPos;
@@ -0,0 +1,25 @@
+// k_ (PackedVertex) ̓WJ
+// CPU  VertexPacking::Decode ƓvZł
+
+// bV̈ʒu̗ʎq͈ (ʒu = Offset + ʎql * Scale)
+struct PositionQuantization
+{
+    float3 Offset;
+    float Padding0;
+    float3 Scale;
+    float Padding1;
+};
+
+// ʑ̎ʑPʃxNgɖ߂܂
+float3 OctDecode(float2 e)
+{
+    float3 n = float3(e, 1.0f - abs(e.x) - abs(e.y));
+    float t = saturate(-n.z);
+    n.xy += (n.xy >= 0.0f) ? -t : t;
+    return normalize(n);
+}
+
+float3 DecodePosition(float3 quantized, PositionQuantization quantization)
+{
+    return quantization.Offset + quantized * quantization.Scale;
+}
@@ -0,0 +1,585 @@
+// GltfLoader A傫 glTF ( 100 Op`̍) ňȑO̓ǂݍݕƔׂeXgEx`}[N
+//   ȑO̓ǂݍݕ: Assimp ͂̊ŃrhłȂ̂ŁAAssimp ̌oHƓ菇̎QƎőp܂
+//                     (t@CŜǂݍ  ANZT̔z (aiMesh ) փRs[  m[hϊEnւ̕ϊ  Vertex zփRs[)
+//   .gltf + .bin ƁAe .glb: _ECfbNXEEQƎƈv邱 (0 ̈̕Ⴂ) ƓǂݍݎԂ̔
+//   @Eڐ̂Ȃ .glb (ʒuƐK uint16  UV  byteStride Ō݂Ɋi[): UV vA@Eڐ͓IȌɋ߂
+// g: MeshGltfLoadTest [1ӂ̎lp`̐ ( 708 =  100 Op`)] (s 0 ȊOԂ܂)
+
+#include "Graphics/GltfLoader.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Quaternion.h"
+#include "Utilities/Json.h"
+#include "TestUtility.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+	constexpr int DefaultQuadsPerSide = 708;
+	constexpr int RepeatCount = 5;
+	//! ̊iqŁA@EڐƉ͓IȌ̊px̏ ( 0.07 xɂȂB덷͍݂ɔႷ̂ŁAeiqł͍݂ɍ킹čL)
+	constexpr double MaxGeneratedAngleDegree = 0.15;
+	constexpr double Pi = 3.14159265358979323846;
+
+	constexpr uint32_t ComponentUnsignedShort = 5123;
+	constexpr uint32_t ComponentUnsignedInt = 5125;
+	constexpr uint32_t ComponentFloat = 5126;
+
+	/// <summary>
+	///  y = h(x, z) ̊iq (xEz  -1`1)
+	/// </summary>
+	struct Grid
+	{
+		std::vector<Vector3D> Positions;
+		std::vector<Vector3D> Normals;
+		std::vector<float> Tangents; //!< xyzw
+		std::vector<Vector2D> TexCoords;
+		std::vector<uint16_t> QuantizedTexCoords; //!< K uint16  UV
+		std::vector<uint32_t> Indices;
+	};
+
+	float GetHeight(float x, float z) { return 0.2f * std::sin(3.0f * x) * std::cos(2.0f * z); }
+
+	//! @brief ͓̉IȖ@ (-dh/dx, 1, -dh/dz)
+	Vector3D GetAnalyticNormal(float x, float z)
+	{
+		const float dx = 0.6f * std::cos(3.0f * x) * std::cos(2.0f * z);
+		const float dz = -0.4f * std::sin(3.0f * x) * std::sin(2.0f * z);
+		return Vector3D(-dx, 1.0f, -dz).GetSafeNormal();
+	}
+
+	//! @brief U (x ) ɉ͓IȐڐ (1, dh/dx, 0)
+	Vector3D GetAnalyticTangent(float x, float z)
+	{
+		const float dx = 0.6f * std::cos(3.0f * x) * std::cos(2.0f * z);
+		return Vector3D(1.0f, dx, 0.0f).GetSafeNormal();
+	}
+
+	Grid MakeGrid(int quadsPerSide)
+	{
+		Grid grid;
+		const int side = quadsPerSide + 1;
+		for (int row = 0; row < side; ++row)
+		{
+			for (int col = 0; col < side; ++col)
+			{
+				const float u = static_cast<float>(col) / quadsPerSide;
+				const float v = static_cast<float>(row) / quadsPerSide;
+				const float x = u * 2.0f - 1.0f;
+				const float z = v * 2.0f - 1.0f;
+				grid.Positions.emplace_back(x, GetHeight(x, z), z);
+				grid.Normals.push_back(GetAnalyticNormal(x, z));
+				const Vector3D tangent = GetAnalyticTangent(x, z);
+				grid.Tangents.insert(grid.Tangents.end(), { tangent.x, tangent.y, tangent.z, 1.0f });
+				grid.TexCoords.emplace_back(u, v);
+				grid.QuantizedTexCoords.push_back(static_cast<uint16_t>(std::lround(u * 65535.0f)));
+				grid.QuantizedTexCoords.push_back(static_cast<uint16_t>(std::lround(v * 65535.0f)));
+			}
+		}
+		for (int row = 0; row < quadsPerSide; ++row)
+		{
+			for (int col = 0; col < quadsPerSide; ++col)
+			{
+				const uint32_t i0 = static_cast<uint32_t>(row * side + col);
+				const uint32_t i1 = i0 + 1;
+				const uint32_t i2 = i0 + static_cast<uint32_t>(side);
+				const uint32_t i3 = i2 + 1;
+				grid.Indices.insert(grid.Indices.end(), { i0, i2, i1, i1, i2, i3 });
+			}
+		}
+		return grid;
+	}
+
+	//! em[h̍s (sxNgK) Ǝqm[h TRS
+	Matrix4x4 GetParentMatrix()
+	{
+		return Matrix4x4::Compose(Vector3D(2.0f, 2.0f, 2.0f), Quaternion::AngleAxis(30.0f, Vector3D(0.0f, 1.0f, 0.0f)), Vector3D(1.0f, -2.0f, 3.0f));
+	}
+	const Vector3D ChildScale(1.5f, 0.75f, 1.25f);
+	const Quaternion ChildRotation = Quaternion::AngleAxis(-20.0f, Vector3D(1.0f, 0.0f, 1.0f));
+	const Vector3D ChildTranslation(-0.5f, 0.25f, 4.0f);
+
+	/// <summary>
+	/// glTF  JSON ƃoCiobt@gݗĂ܂
+	/// interleaved ȂʒuƐK uint16  UV 1 bufferView Ɍ݂ɕׁA@EڐȂ܂
+	/// </summary>
+	class GltfWriter
+	{
+	public:
+		GltfWriter(const Grid& grid, bool interleaved)
+		{
+			const size_t vertexCount = grid.Positions.size();
+			if (interleaved)
+			{
+				// 1_ 16 oCg: ʒu 12 oCg + UV 4 oCg
+				std::vector<uint8_t> vertices(vertexCount * 16);
+				for (size_t i = 0; i < vertexCount; ++i)
+				{
+					std::memcpy(&vertices[i * 16], &grid.Positions[i], sizeof(Vector3D));
+					std::memcpy(&vertices[i * 16 + 12], &grid.QuantizedTexCoords[i * 2], sizeof(uint16_t) * 2);
+				}
+				AddView(vertices.data(), vertices.size(), 16, 34962);
+				AddPositionAccessor(grid, 0, 0);
+				AddAccessor(0, 12, ComponentUnsignedShort, true, vertexCount, "VEC2");
+			}
+			else
+			{
+				AddView(grid.Positions.data(), vertexCount * sizeof(Vector3D), 0, 34962);
+				AddPositionAccessor(grid, 0, 0);
+				AddView(grid.Normals.data(), vertexCount * sizeof(Vector3D), 0, 34962);
+				AddAccessor(1, 0, ComponentFloat, false, vertexCount, "VEC3");
+				AddView(grid.TexCoords.data(), vertexCount * sizeof(Vector2D), 0, 34962);
+				AddAccessor(2, 0, ComponentFloat, false, vertexCount, "VEC2");
+				AddView(grid.Tangents.data(), grid.Tangents.size() * sizeof(float), 0, 34962);
+				AddAccessor(3, 0, ComponentFloat, false, vertexCount, "VEC4");
+			}
+			const size_t indexView = m_ViewCount;
+			AddView(grid.Indices.data(), grid.Indices.size() * sizeof(uint32_t), 0, 34963);
+			AddAccessor(indexView, 0, ComponentUnsignedInt, false, grid.Indices.size(), "SCALAR");
+
+			const char* pAttributes = interleaved
+				? "{\"POSITION\":0,\"TEXCOORD_0\":1}"
+				: "{\"POSITION\":0,\"NORMAL\":1,\"TEXCOORD_0\":2,\"TANGENT\":3}";
+			const size_t indexAccessor = interleaved ? 2 : 4;
+			m_Meshes = Format("[{\"name\":\"Grid\",\"primitives\":[{\"attributes\":%s,\"indices\":%zu,\"mode\":4}]}]", pAttributes, indexAccessor);
+		}
+
+		//! @brief .gltf ƊO .bin o܂
+		bool WriteGltf(const std::filesystem::path& path) const
+		{
+			const std::filesystem::path binPath = std::filesystem::path(path).replace_extension(".bin");
+			const std::string json = MakeJson("\"uri\":\"" + binPath.filename().string() + "\",");
+			return WriteFile(binPath, m_Bin.data(), m_Bin.size()) && WriteFile(path, json.data(), json.size());
+		}
+
+		//! @brief .glb (JSON `N BIN `N) o܂
+		bool WriteGlb(const std::filesystem::path& path) const
+		{
+			std::string json = MakeJson("");
+			json.resize((json.size() + 3) & ~size_t(3), ' ');
+			std::vector<uint8_t> bin = m_Bin;
+			bin.resize((bin.size() + 3) & ~size_t(3), 0);
+			const uint32_t header[3] = { 0x46546C67, 2, static_cast<uint32_t>(12 + 8 + json.size() + 8 + bin.size()) };
+			const uint32_t jsonHeader[2] = { static_cast<uint32_t>(json.size()), 0x4E4F534A };
+			const uint32_t binHeader[2] = { static_cast<uint32_t>(bin.size()), 0x004E4942 };
+			std::vector<uint8_t> file;
+			auto append = [&](const void* pData, size_t size)
+				{
+					file.insert(file.end(), static_cast<const uint8_t*>(pData), static_cast<const uint8_t*>(pData) + size);
+				};
+			append(header, sizeof(header));
+			append(jsonHeader, sizeof(jsonHeader));
+			append(json.data(), json.size());
+			append(binHeader, sizeof(binHeader));
+			append(bin.data(), bin.size());
+			return WriteFile(path, file.data(), file.size());
+		}
+
+	private:
+		template<typename... Args>
+		static std::string Format(const char* pFormat, Args... args)
+		{
+			const int length = std::snprintf(nullptr, 0, pFormat, args...);
+			std::string text(static_cast<size_t>(length) + 1, '\0');
+			std::snprintf(text.data(), text.size(), pFormat, args...);
+			text.pop_back();
+			return text;
+		}
+
+		static bool WriteFile(const std::filesystem::path& path, const void* pData, size_t size)
+		{
+			std::ofstream stream(path, std::ios::binary);
+			stream.write(static_cast<const char*>(pData), static_cast<std::streamsize>(size));
+			return static_cast<bool>(stream);
+		}
+
+		//! @brief obt@̖ (4 oCgE) ɒǉA͈̔͂ bufferView ܂
+		void AddView(const void* pData, size_t size, size_t stride, int target)
+		{
+			m_Bin.resize((m_Bin.size() + 3) & ~size_t(3), 0);
+			const size_t offset = m_Bin.size();
+			m_Bin.insert(m_Bin.end(), static_cast<const uint8_t*>(pData), static_cast<const uint8_t*>(pData) + size);
+			const std::string strideText = stride > 0 ? Format(",\"byteStride\":%zu", stride) : std::string();
+			m_Views += Format("%s{\"buffer\":0,\"byteOffset\":%zu,\"byteLength\":%zu%s,\"target\":%d}",
+				m_ViewCount == 0 ? "" : ",", offset, size, strideText.c_str(), target);
+			++m_ViewCount;
+		}
+
+		void AddAccessor(size_t view, size_t offset, uint32_t componentType, bool normalized, size_t count, const char* pType)
+		{
+			m_Accessors += Format("%s{\"bufferView\":%zu,\"byteOffset\":%zu,\"componentType\":%u,\"normalized\":%s,\"count\":%zu,\"type\":\"%s\"%s}",
+				m_Accessors.empty() ? "" : ",", view, offset, componentType, normalized ? "true" : "false", count, pType, m_AccessorExtra.c_str());
+			m_AccessorExtra.clear();
+		}
+
+		void AddPositionAccessor(const Grid& grid, size_t view, size_t offset)
+		{
+			const AABB bounds = AABB::FromPoints(grid.Positions.data(), grid.Positions.size());
+			m_AccessorExtra = Format(",\"min\":[%.9g,%.9g,%.9g],\"max\":[%.9g,%.9g,%.9g]",
+				bounds.Min.x, bounds.Min.y, bounds.Min.z, bounds.Max.x, bounds.Max.y, bounds.Max.z);
+			AddAccessor(view, offset, ComponentFloat, false, grid.Positions.size(), "VEC3");
+		}
+
+		//! @brief Ŝ JSON (bufferUri  buffers[0]  uri ̃o[AGLB Ȃ)
+		std::string MakeJson(const std::string& bufferUri) const
+		{
+			std::string parent;
+			const Matrix4x4 parentMatrix = GetParentMatrix();
+			for (int i = 0; i < 16; ++i)
+			{
+				parent += Format("%s%.9g", i == 0 ? "" : ",", parentMatrix.m_mat[i / 4][i % 4]);
+			}
+			const std::string nodes = Format("[{\"name\":\"Root\",\"matrix\":[%s],\"children\":[1]},"
+				"{\"name\":\"GridNode\",\"mesh\":0,\"scale\":[%.9g,%.9g,%.9g],\"rotation\":[%.9g,%.9g,%.9g,%.9g],\"translation\":[%.9g,%.9g,%.9g]}]",
+				parent.c_str(), ChildScale.x, ChildScale.y, ChildScale.z, ChildRotation.x, ChildRotation.y, ChildRotation.z, ChildRotation.w,
+				ChildTranslation.x, ChildTranslation.y, ChildTranslation.z);
+			return Format("{\"asset\":{\"version\":\"2.0\"},\"scene\":0,\"scenes\":[{\"nodes\":[0]}],\"nodes\":%s,\"meshes\":%s,"
+				"\"accessors\":[%s],\"bufferViews\":[%s],\"buffers\":[{%s\"byteLength\":%zu}]}",
+				nodes.c_str(), m_Meshes.c_str(), m_Accessors.c_str(), m_Views.c_str(), bufferUri.c_str(), m_Bin.size());
+		}
+
+		std::vector<uint8_t> m_Bin;
+		size_t m_ViewCount = 0;
+		std::string m_Views;
+		std::string m_Accessors;
+		std::string m_AccessorExtra;
+		std::string m_Meshes;
+	};
+
+	/// <summary>
+	/// ȑO̓ǂݍݕ (Assimp ̌oH) ̎QƎ̌
+	/// </summary>
+	struct ReferenceMesh
+	{
+		std::vector<Vertex> Vertices;
+		std::vector<uint32_t> Indices;
+	};
+
+	std::vector<uint8_t> ReadWholeFile(const std::filesystem::path& path)
+	{
+		std::ifstream stream(path, std::ios::binary);
+		return std::vector<uint8_t>(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+	}
+
+	/// <summary>
+	/// ANZT float ̔zփRs[܂ (t@Cg floatEK uint16 ̂)
+	/// </summary>
+	std::vector<float> ReadAccessor(const JsonValue& root, const std::vector<uint8_t>& bin, int64_t index, uint32_t& outComponentCount)
+	{
+		const JsonValue& accessor = root["accessors"][static_cast<size_t>(index)];
+		const JsonValue& view = root["bufferViews"][static_cast<size_t>(accessor["bufferView"].GetIndex())];
+		const std::string& type = accessor["type"].GetString();
+		outComponentCount = type == "SCALAR" ? 1 : type == "VEC2" ? 2 : type == "VEC3" ? 3 : 4;
+		const uint32_t componentType = static_cast<uint32_t>(accessor["componentType"].GetIndex());
+		const size_t componentSize = componentType == ComponentUnsignedShort ? 2 : 4;
+		const size_t count = static_cast<size_t>(accessor["count"].GetIndex());
+		const size_t stride = static_cast<size_t>(view["byteStride"].GetIndex(static_cast<int64_t>(componentSize * outComponentCount)));
+		const uint8_t* pBase = bin.data() + view["byteOffset"].GetIndex(0) + accessor["byteOffset"].GetIndex(0);
+
+		std::vector<float> values(count * outComponentCount);
+		for (size_t i = 0; i < count; ++i)
+		{
+			for (uint32_t c = 0; c < outComponentCount; ++c)
+			{
+				const uint8_t* pSrc = pBase + i * stride + c * componentSize;
+				float& dst = values[i * outComponentCount + c];
+				if (componentType == ComponentFloat)
+				{
+					std::memcpy(&dst, pSrc, sizeof(float));
+				}
+				else
+				{
+					uint16_t value;
+					std::memcpy(&value, pSrc, sizeof(value));
+					dst = value / 65535.0f;
+				}
+			}
+		}
+		return values;
+	}
+
+	//! @brief VEC3EVEC4 ̃ANZT xyz  Vector3D ̔zփRs[܂
+	std::vector<Vector3D> ReadVector3(const JsonValue& root, const std::vector<uint8_t>& bin, int64_t index)
+	{
+		uint32_t componentCount = 0;
+		const std::vector<float> values = ReadAccessor(root, bin, index, componentCount);
+		std::vector<Vector3D> out(values.size() / componentCount);
+		for (size_t i = 0; i < out.size(); ++i)
+		{
+			out[i] = Vector3D(values[i * componentCount], values[i * componentCount + 1], values[i * componentCount + 2]);
+		}
+		return out;
+	}
+
+	Matrix4x4 GetReferenceLocalMatrix(const JsonValue& node)
+	{
+		const JsonValue& matrix = node["matrix"];
+		if (matrix.Size() == 16)
+		{
+			Matrix4x4 mat;
+			for (size_t i = 0; i < 16; ++i)
+			{
+				mat.m_mat[i / 4][i % 4] = static_cast<float>(matrix[i].GetNumber());
+			}
+			return mat;
+		}
+		auto get = [&](const char* pKey, size_t i) { return static_cast<float>(node[pKey][i].GetNumber()); };
+		return Matrix4x4::Compose(Vector3D(get("scale", 0), get("scale", 1), get("scale", 2)),
+			Quaternion(get("rotation", 0), get("rotation", 1), get("rotation", 2), get("rotation", 3)),
+			Vector3D(get("translation", 0), get("translation", 1), get("translation", 2)));
+	}
+
+	Vector3D TransformDirection(const Matrix4x4& matrix, const Vector3D& v)
+	{
+		const auto& m = matrix.m_mat;
+		return Vector3D(
+			v.x * m[0][0] + v.y * m[1][0] + v.z * m[2][0],
+			v.x * m[0][1] + v.y * m[1][1] + v.z * m[2][1],
+			v.x * m[0][2] + v.y * m[1][2] + v.z * m[2][2]);
+	}
+
+	/// <summary>
+	/// Assimp ̌oHƓ菇œǂݍ݂܂
+	/// t@CŜǂݍ݁AANZT̔zĂm[hϊ (aiProcess_PreTransformVertices)E
+	/// Z ̔] (aiProcess_MakeLeftHanded) 1_KpAŌ Vertex z֋lߒ܂
+	/// t@C ([g̉Ɏq1Av~eBu1) ܂
+	/// </summary>
+	bool LoadReference(const std::filesystem::path& path, ReferenceMesh& out)
+	{
+		const std::vector<uint8_t> file = ReadWholeFile(path);
+		std::vector<uint8_t> bin;
+		const char* pJson = reinterpret_cast<const char*>(file.data());
+		size_t jsonSize = file.size();
+		uint32_t magic = 0;
+		if (file.size() >= 12)
+		{
+			std::memcpy(&magic, file.data(), sizeof(magic));
+		}
+		if (magic == 0x46546C67)
+		{
+			uint32_t jsonLength = 0, binLength = 0;
+			std::memcpy(&jsonLength, file.data() + 12, sizeof(uint32_t));
+			std::memcpy(&binLength, file.data() + 20 + jsonLength, sizeof(uint32_t));
+			pJson = reinterpret_cast<const char*>(file.data() + 20);
+			jsonSize = jsonLength;
+			bin.assign(file.begin() + 28 + jsonLength, file.begin() + 28 + jsonLength + binLength);
+		}
+
+		JsonValue root;
+		if (!JsonValue::Parse(pJson, jsonSize, root))
+		{
+			return false;
+		}
+		if (magic != 0x46546C67)
+		{
+			bin = ReadWholeFile(path.parent_path() / root["buffers"][size_t(0)]["uri"].GetString());
+		}
+
+		const JsonValue& nodes = root["nodes"];
+		const JsonValue& rootNode = nodes[static_cast<size_t>(root["scenes"][size_t(0)]["nodes"][size_t(0)].GetIndex())];
+		const JsonValue& meshNode = nodes[static_cast<size_t>(rootNode["children"][size_t(0)].GetIndex())];
+		const Matrix4x4 world = GetReferenceLocalMatrix(meshNode) * GetReferenceLocalMatrix(rootNode);
+		const JsonValue& primitive = root["meshes"][static_cast<size_t>(meshNode["mesh"].GetIndex())]["primitives"][size_t(0)];
+		const JsonValue& attributes = primitive["attributes"];
+
+		// aiMesh ̑̔z
+		std::vector<Vector3D> positions = ReadVector3(root, bin, attributes["POSITION"].GetIndex());
+		std::vector<Vector3D> normals, tangents;
+		if (attributes.Find("NORMAL") != nullptr)
+		{
+			normals = ReadVector3(root, bin, attributes["NORMAL"].GetIndex());
+		}
+		if (attributes.Find("TANGENT") != nullptr)
+		{
+			tangents = ReadVector3(root, bin, attributes["TANGENT"].GetIndex());
+		}
+		uint32_t componentCount = 0;
+		const std::vector<float> texCoords = ReadAccessor(root, bin, attributes["TEXCOORD_0"].GetIndex(), componentCount);
+		const JsonValue& indexAccessor = root["accessors"][static_cast<size_t>(primitive["indices"].GetIndex())];
+		const JsonValue& indexView = root["bufferViews"][static_cast<size_t>(indexAccessor["bufferView"].GetIndex())];
+		std::vector<uint32_t> indices(static_cast<size_t>(indexAccessor["count"].GetIndex()));
+		std::memcpy(indices.data(), bin.data() + indexView["byteOffset"].GetIndex(0) + indexAccessor["byteOffset"].GetIndex(0), indices.size() * sizeof(uint32_t));
+
+		const Matrix4x4 normalMatrix = Matrix4x4::transpose(Matrix4x4::inverse(world));
+		for (auto& position : positions)
+		{
+			position = Matrix4x4::Apply(world, position);
+			position.z = -position.z;
+		}
+		for (auto& normal : normals)
+		{
+			normal = TransformDirection(normalMatrix, normal);
+			normal.z = -normal.z;
+			normal = normal.GetSafeNormal();
+		}
+		for (auto& tangent : tangents)
+		{
+			tangent = TransformDirection(world, tangent);
+			tangent.z = -tangent.z;
+			tangent = tangent.GetSafeNormal();
+		}
+
+		out.Vertices.resize(positions.size());
+		for (size_t i = 0; i < positions.size(); ++i)
+		{
+			Vertex& vertex = out.Vertices[i];
+			vertex.m_Position = positions[i];
+			vertex.m_Normal = normals.empty() ? Vector3D() : normals[i];
+			vertex.m_TexCoord = Vector2D(texCoords[i * 2], texCoords[i * 2 + 1]);
+			vertex.m_Tangent = tangents.empty() ? Vector3D() : tangents[i];
+		}
+		out.Indices = indices;
+		return true;
+	}
+
+	bool IsSame(const Vector3D& a, const Vector3D& b) { return a.x == b.x && a.y == b.y && a.z == b.z; }
+	bool IsSame(const Vector2D& a, const Vector2D& b) { return a.x == b.x && a.y == b.y; }
+
+	double GetAngleDegree(const Vector3D& a, const Vector3D& b)
+	{
+		const double cosine = (std::max)(-1.0, (std::min)(1.0, static_cast<double>(a.GetSafeNormal().dot(b.GetSafeNormal()))));
+		return std::acos(cosine) * 180.0 / Pi;
+	}
+
+	template<typename Func>
+	double MeasureBestMilliseconds(Func&& func)
+	{
+		double best = 0.0;
+		for (int i = 0; i < RepeatCount; ++i)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			func();
+			const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			best = i == 0 ? milliseconds : (std::min)(best, milliseconds);
+		}
+		return best;
+	}
+
+	/// <summary>
+	/// @Eڐt@C GltfLoader ƎQƎœǂݍ݁AʂƎԂׂ܂
+	/// </summary>
+	void TestAgainstReference(const std::filesystem::path& path)
+	{
+		ModelData model;
+		std::string error;
+		if (!TEST_CHECK(GltfLoader::Load(path.wstring(), model, &error)))
+		{
+			std::printf("  %s: %s\n", path.filename().string().c_str(), error.c_str());
+			return;
+		}
+		ReferenceMesh reference;
+		if (!TEST_CHECK(LoadReference(path, reference)) || !TEST_CHECK(model.Meshes.size() == 1))
+		{
+			return;
+		}
+
+		const MeshData& mesh = model.Meshes[0];
+		size_t mismatchCount = 0;
+		const bool sizeMatches = mesh.Vertices.size() == reference.Vertices.size();
+		for (size_t i = 0; sizeMatches && i < mesh.Vertices.size(); ++i)
+		{
+			const Vertex& a = mesh.Vertices[i];
+			const Vertex& b = reference.Vertices[i];
+			mismatchCount += IsSame(a.m_Position, b.m_Position) && IsSame(a.m_Normal, b.m_Normal)
+				&& IsSame(a.m_TexCoord, b.m_TexCoord) && IsSame(a.m_Tangent, b.m_Tangent) ? 0 : 1;
+		}
+		const bool indicesMatch = mesh.Indices == reference.Indices;
+		const AABB bounds = AABB::FromPoints(&reference.Vertices[0].m_Position.x, reference.Vertices.size(), sizeof(Vertex));
+		const bool boundsMatch = IsSame(mesh.LocalBounds.Min, bounds.Min) && IsSame(mesh.LocalBounds.Max, bounds.Max);
+
+		const double loaderMs = MeasureBestMilliseconds([&]() { ModelData timed; GltfLoader::Load(path.wstring(), timed); });
+		const double referenceMs = MeasureBestMilliseconds([&]() { ReferenceMesh timed; LoadReference(path, timed); });
+		const bool isOk = sizeMatches && mismatchCount == 0 && indicesMatch && boundsMatch;
+		std::printf("  %-6s %-18s %zu verts / %zu tris, %zu vertex mismatches, indices %s, bounds %s\n",
+			isOk ? "ok" : "FAILED", path.filename().string().c_str(), mesh.Vertices.size(), mesh.Indices.size() / 3, mismatchCount,
+			indicesMatch ? "match" : "differ", boundsMatch ? "match" : "differ");
+		std::printf("         GltfLoader %8.2f ms, previous path (reference) %8.2f ms  x%.2f\n", loaderMs, referenceMs, referenceMs / loaderMs);
+		TEST_CHECK(sizeMatches);
+		TEST_CHECK(mismatchCount == 0);
+		TEST_CHECK(indicesMatch);
+		TEST_CHECK(boundsMatch);
+	}
+
+	/// <summary>
+	/// @Eڐ̂Ȃt@Cǂݍ݁AUV Ɛ@Eڐm߂܂
+	/// </summary>
+	void TestGenerated(const std::filesystem::path& path, const Grid& grid, int quadsPerSide)
+	{
+		const double maxAngle = MaxGeneratedAngleDegree * (std::max)(1.0, static_cast<double>(DefaultQuadsPerSide) / quadsPerSide);
+		ModelData model;
+		std::string error;
+		if (!TEST_CHECK(GltfLoader::Load(path.wstring(), model, &error)))
+		{
+			std::printf("  %s: %s\n", path.filename().string().c_str(), error.c_str());
+			return;
+		}
+		if (!TEST_CHECK(model.Meshes.size() == 1) || !TEST_CHECK(model.Meshes[0].Vertices.size() == grid.Positions.size()))
+		{
+			return;
+		}
+
+		const Matrix4x4 world = Matrix4x4::Compose(ChildScale, ChildRotation, ChildTranslation) * GetParentMatrix();
+		const Matrix4x4 normalMatrix = Matrix4x4::transpose(Matrix4x4::inverse(world));
+		const MeshData& mesh = model.Meshes[0];
+		size_t texCoordMismatches = 0;
+		double maxNormalAngle = 0.0, maxTangentAngle = 0.0;
+		for (size_t i = 0; i < mesh.Vertices.size(); ++i)
+		{
+			const Vertex& vertex = mesh.Vertices[i];
+			const Vector2D expectedTexCoord(grid.QuantizedTexCoords[i * 2] / 65535.0f, grid.QuantizedTexCoords[i * 2 + 1] / 65535.0f);
+			texCoordMismatches += IsSame(vertex.m_TexCoord, expectedTexCoord) ? 0 : 1;
+
+			Vector3D normal = TransformDirection(normalMatrix, grid.Normals[i]);
+			Vector3D tangent = TransformDirection(world, Vector3D(grid.Tangents[i * 4], grid.Tangents[i * 4 + 1], grid.Tangents[i * 4 + 2]));
+			normal.z = -normal.z;
+			tangent.z = -tangent.z;
+			maxNormalAngle = (std::max)(maxNormalAngle, GetAngleDegree(vertex.m_Normal, normal));
+			maxTangentAngle = (std::max)(maxTangentAngle, GetAngleDegree(vertex.m_Tangent, tangent));
+		}
+
+		const double loaderMs = MeasureBestMilliseconds([&]() { ModelData timed; GltfLoader::Load(path.wstring(), timed); });
+		const bool isOk = texCoordMismatches == 0 && maxNormalAngle <= maxAngle && maxTangentAngle <= maxAngle;
+		std::printf("  %-6s %-18s %zu UV mismatches, generated normals max %.3f deg, tangents max %.3f deg (limit %.2f)\n",
+			isOk ? "ok" : "FAILED", path.filename().string().c_str(), texCoordMismatches, maxNormalAngle, maxTangentAngle, maxAngle);
+		std::printf("         GltfLoader %8.2f ms (normals and tangents generated)\n", loaderMs);
+		TEST_CHECK(texCoordMismatches == 0);
+		TEST_CHECK(maxNormalAngle <= maxAngle);
+		TEST_CHECK(maxTangentAngle <= maxAngle);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const int quadsPerSide = argc >= 2 ? (std::max)(std::atoi(argv[1]), 1) : DefaultQuadsPerSide;
+	const Grid grid = MakeGrid(quadsPerSide);
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "MeshGltfLoadTest";
+	std::filesystem::create_directories(directory);
+
+	std::printf("generated height field: %zu verts / %zu tris (%s)\n", grid.Positions.size(), grid.Indices.size() / 3, directory.string().c_str());
+	const GltfWriter full(grid, false);
+	const GltfWriter interleaved(grid, true);
+	const std::filesystem::path gltfPath = directory / "Grid.gltf";
+	const std::filesystem::path glbPath = directory / "Grid.glb";
+	const std::filesystem::path interleavedPath = directory / "GridNoNormals.glb";
+	if (TEST_CHECK(full.WriteGltf(gltfPath) && full.WriteGlb(glbPath) && interleaved.WriteGlb(interleavedPath)))
+	{
+		std::printf("GltfLoader vs previous path (assimp-equivalent reference, best of %d)\n", RepeatCount);
+		TestAgainstReference(gltfPath);
+		TestAgainstReference(glbPath);
+		std::printf("GltfLoader with generated normals and tangents\n");
+		TestGenerated(interleavedPath, grid, quadsPerSide);
+	}
+
+	std::error_code errorCode;
+	std::filesystem::remove_all(directory, errorCode);
+	return TestUtility::Finish("MeshGltfLoadTest");
+}
@@ -0,0 +1,186 @@
+//  glTF  Model ̓ǂݍ݂Ɠ菇 (nځEœKEbVbgELOD) ŏA
+// e LOD ̃CfbNX͈́EOp`E덷m߂eXg
+// nڂ̓Xbhgꍇ (MeshWelder::Settings::IsParallel) ƎgȂꍇŌʂƂm߂܂
+// g: MeshLodTest <assets fBNg> (s 0 ȊOԂ܂)
+
+#include "Graphics/GltfLoader.h"
+#include "Graphics/MeshOptimizer.h"
+#include "Graphics/MeshSimplifier.h"
+#include "Graphics/MeshWelder.h"
+#include "Graphics/MeshletBuilder.h"
+#include "TestUtility.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace
+{
+	//! @brief Op`3̈قȂ钸_QƂAʐς 0 łȂ
+	bool IsValidTriangle(const MeshData& mesh, uint32_t i0, uint32_t i1, uint32_t i2)
+	{
+		if (i0 == i1 || i1 == i2 || i0 == i2)
+		{
+			return false;
+		}
+		const Vector3D& p0 = mesh.Vertices[i0].m_Position;
+		const Vector3D& p1 = mesh.Vertices[i1].m_Position;
+		const Vector3D& p2 = mesh.Vertices[i2].m_Position;
+		return (p1 - p0).cross(p2 - p0).length() > 0.0f;
+	}
+
+	/// <summary>
+	/// 1bV LOD m߁ALOD ̎Op`ƌ덷\܂
+	/// </summary>
+	void CheckMesh(const MeshData& mesh, uint32_t lod0DegenerateCount)
+	{
+		std::printf("  %-24s %7zu vertices, radius %.4g\n", mesh.Name.c_str(), mesh.Vertices.size(), mesh.LocalSphere.Radius);
+		if (!TEST_CHECK(!mesh.Lods.empty() && mesh.Lods.size() <= MeshSimplifier::MaxLodCount))
+		{
+			return;
+		}
+
+		const uint32_t vertexCount = static_cast<uint32_t>(mesh.Vertices.size());
+		uint32_t expectedOffset = 0;
+		for (size_t lod = 0; lod < mesh.Lods.size(); ++lod)
+		{
+			const MeshLod& range = mesh.Lods[lod];
+			const uint32_t triangleCount = range.IndexCount / 3;
+
+			// LOD  Indices ̐擪猄ԂȂсAŌ LOD  Indices ̏IɂȂ
+			TEST_CHECK(range.IndexOffset == expectedOffset);
+			TEST_CHECK(range.IndexCount > 0 && range.IndexCount % 3 == 0);
+			if (!TEST_CHECK(static_cast<size_t>(range.IndexOffset) + range.IndexCount <= mesh.Indices.size()))
+			{
+				return;
+			}
+			expectedOffset = range.IndexOffset + range.IndexCount;
+
+			uint32_t outOfRangeCount = 0;
+			uint32_t degenerateCount = 0;
+			for (uint32_t i = range.IndexOffset; i < range.IndexOffset + range.IndexCount; i += 3)
+			{
+				const uint32_t i0 = mesh.Indices[i + 0];
+				const uint32_t i1 = mesh.Indices[i + 1];
+				const uint32_t i2 = mesh.Indices[i + 2];
+				if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount)
+				{
+					++outOfRangeCount;
+				}
+				else if (!IsValidTriangle(mesh, i0, i1, i2))
+				{
+					++degenerateCount;
+				}
+			}
+			TEST_CHECK(outOfRangeCount == 0);
+			// nڂŎ菜Ȃf[^̏kގOp` (LOD0 ̐) 葝Ă͂Ȃ
+			TEST_CHECK(degenerateCount <= lod0DegenerateCount);
+			if (lod == 0)
+			{
+				TEST_CHECK(range.Error == 0.0f);
+			}
+			else
+			{
+				// ȗ͑čŝŁA덷͑ŎOp`͑O LOD  MinLodReduction ȉɂȂ
+				const MeshLod& previous = mesh.Lods[lod - 1];
+				TEST_CHECK(range.Error >= previous.Error);
+				TEST_CHECK(range.IndexCount <= previous.IndexCount * MeshSimplifier::MinLodReduction);
+			}
+			std::printf("    LOD%zu %8u tris  error %.3g (%.3g%% of radius)%s\n", lod, triangleCount, range.Error,
+				mesh.LocalSphere.Radius > 0.0f ? range.Error / mesh.LocalSphere.Radius * 100.0f : 0.0f,
+				degenerateCount > 0 ? "  [degenerate triangles]" : "");
+		}
+		TEST_CHECK(expectedOffset == mesh.Indices.size());
+
+		// LOD Ȃ͎̂Op`ȂbVAȏ㌸点ȂbV
+		if (mesh.Lods.size() == 1 && mesh.Lods[0].IndexCount / 3 >= MeshSimplifier::MinLodTriangleCount)
+		{
+			std::printf("    (no LOD: simplification could not reach %.0f%% of LOD0)\n", MeshSimplifier::MinLodReduction * 100.0f);
+		}
+	}
+
+	//! @brief ̗nڂ1Xbh̗nڂ̌ (_ECfbNX) rbgPʂňv邩
+	bool IsSameWeld(const MeshData& source)
+	{
+		MeshData parallel = source;
+		MeshData serial = source;
+		MeshWelder::Settings serialSettings;
+		serialSettings.IsParallel = false;
+		MeshWelder::Weld(parallel);
+		MeshWelder::Weld(serial, serialSettings);
+		return parallel.Vertices.size() == serial.Vertices.size()
+			&& parallel.Indices == serial.Indices
+			&& std::memcmp(parallel.Vertices.data(), serial.Vertices.data(), parallel.Vertices.size() * sizeof(Vertex)) == 0;
+	}
+
+	uint32_t CountDegenerateTriangles(const MeshData& mesh)
+	{
+		uint32_t count = 0;
+		for (size_t i = 0; i + 3 <= mesh.Indices.size(); i += 3)
+		{
+			if (!IsValidTriangle(mesh, mesh.Indices[i], mesh.Indices[i + 1], mesh.Indices[i + 2]))
+			{
+				++count;
+			}
+		}
+		return count;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	if (argc != 2)
+	{
+		std::fprintf(stderr, "usage: MeshLodTest <assets directory>\n");
+		return 2;
+	}
+
+	std::vector<std::filesystem::path> files;
+	for (const auto& entry : std::filesystem::recursive_directory_iterator(argv[1]))
+	{
+		if (entry.is_regular_file() && GltfLoader::CanLoad(entry.path().wstring()))
+		{
+			files.push_back(entry.path());
+		}
+	}
+	std::sort(files.begin(), files.end());
+	if (!TEST_CHECK(!files.empty()))
+	{
+		return TestUtility::Finish("MeshLodTest");
+	}
+
+	size_t lodMeshCount = 0;
+	for (const auto& file : files)
+	{
+		std::printf("%s\n", file.filename().string().c_str());
+		ModelData model;
+		std::string error;
+		if (!TEST_CHECK(GltfLoader::Load(file.wstring(), model, &error)))
+		{
+			std::printf("  %s\n", error.c_str());
+			continue;
+		}
+		for (auto& mesh : model.Meshes)
+		{
+			if (mesh.Vertices.size() >= MeshWelder::ParallelThreshold)
+			{
+				TEST_CHECK(IsSameWeld(mesh));
+			}
+
+			// Model::Load Ɠŏ
+			MeshWelder::Weld(mesh);
+			const uint32_t degenerateCount = CountDegenerateTriangles(mesh);
+			MeshOptimizer::Optimize(mesh);
+			MeshletBuilder::Build(mesh);
+			MeshSimplifier::GenerateLods(mesh);
+			CheckMesh(mesh, degenerateCount);
+			lodMeshCount += mesh.Lods.size() > 1 ? 1 : 0;
+		}
+	}
+	// ̃fɂ LOD 郁bV (Skydome) 
+	TEST_CHECK(lodMeshCount > 0);
+	return TestUtility::Finish("MeshLodTest");
+}
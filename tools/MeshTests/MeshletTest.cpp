@@ -0,0 +1,600 @@
+// MeshletBuilderEMeshletCuller ̃eXg
+//  glTF ƁA́EJiq Model ̓ǂݍ݂Ɠ菇 (œKEbVbg) ŏAm߂܂
+//   : ebVbg̒_EOp`ȉŁACfbNXԂȂASĂ̎Op`傤1̃bVbgɓ邱
+//   E: EbVbg̑S_܂ނƁA@R[ŏObVbg̎Op`Sėł邱
+//         ̂Ŏ_Ɣ΂ʂ̃bVbgO邱ƁAJbV͖@R[Ȃ
+//   JO: ̃JE[hsŁA̃bVbgƘACfbNX͈͂
+//             [hԂŔ{xŔ肵 () ƈv邱
+// g: MeshMeshletTest <assets fBNg> (s 0 ȊOԂ܂)
+
+#include "Graphics/GltfLoader.h"
+#include "Graphics/MeshOptimizer.h"
+#include "Graphics/MeshWelder.h"
+#include "Graphics/MeshletBuilder.h"
+#include "Graphics/MeshletCuller.h"
+#include "TestUtility.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using TestUtility::Random;
+
+namespace
+{
+	//! ̔ŁAʂR[̋E炱߂bVbg͂ǂ̌ʂł ([hԂ̋)
+	constexpr double BorderlineDistance = 1.0e-4;
+	//! bVɎJ̐
+	constexpr uint32_t ViewCount = 64;
+
+	using Triangle = std::array<float, 33>;
+
+	/// <summary>
+	/// Op`𒸓_̒lŕ\ (ۂ܂܁Al̏_擪ɂȂ悤ɉ)
+	/// </summary>
+	Triangle MakeTriangle(const MeshData& mesh, const uint32_t* pIndices)
+	{
+		std::array<std::array<float, 11>, 3> corners;
+		for (int k = 0; k < 3; ++k)
+		{
+			static_assert(sizeof(Vertex) == sizeof(float) * 11, "Vertex  float 11 ");
+			std::memcpy(corners[k].data(), &mesh.Vertices[pIndices[k]], sizeof(Vertex));
+		}
+		const int first = static_cast<int>(std::min_element(corners.begin(), corners.end()) - corners.begin());
+		Triangle triangle;
+		for (int k = 0; k < 3; ++k)
+		{
+			std::copy(corners[(first + k) % 3].begin(), corners[(first + k) % 3].end(), triangle.begin() + k * 11);
+		}
+		return triangle;
+	}
+
+	std::vector<Triangle> GetTriangles(const MeshData& mesh)
+	{
+		std::vector<Triangle> triangles;
+		for (size_t i = 0; i + 3 <= mesh.Indices.size(); i += 3)
+		{
+			triangles.push_back(MakeTriangle(mesh, &mesh.Indices[i]));
+		}
+		std::sort(triangles.begin(), triangles.end());
+		return triangles;
+	}
+
+	//! @brief Op`̕\̌ (MeshletBuilder Ɠ_@̑\ƂAʐςȂ΃[)
+	Vector3D GetFacingNormal(const Vertex& v0, const Vertex& v1, const Vertex& v2)
+	{
+		Vector3D normal = (v1.m_Position - v0.m_Position).cross(v2.m_Position - v0.m_Position);
+		const float length = normal.length();
+		if (length <= 0.0f)
+		{
+			return Vector3D(0.0f, 0.0f, 0.0f);
+		}
+		normal = normal * (1.0f / length);
+		return normal.dot(v0.m_Normal + v1.m_Normal + v2.m_Normal) < 0.0f ? normal * -1.0f : normal;
+	}
+
+	//! @brief ʖɒ_Aeʂ divisions x divisions ɕ ([-1, 1]^3AĂ)
+	MeshData MakeCube(uint32_t divisions)
+	{
+		MeshData mesh;
+		mesh.Name = "cube";
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			for (int side = -1; side <= 1; side += 2)
+			{
+				const uint32_t base = static_cast<uint32_t>(mesh.Vertices.size());
+				for (uint32_t v = 0; v <= divisions; ++v)
+				{
+					for (uint32_t u = 0; u <= divisions; ++u)
+					{
+						float p[3];
+						p[axis] = static_cast<float>(side);
+						p[(axis + 1) % 3] = u * 2.0f / divisions - 1.0f;
+						p[(axis + 2) % 3] = v * 2.0f / divisions - 1.0f;
+						float n[3] = {};
+						n[axis] = static_cast<float>(side);
+						Vertex vertex = {};
+						vertex.m_Position = Vector3D(p[0], p[1], p[2]);
+						vertex.m_Normal = Vector3D(n[0], n[1], n[2]);
+						vertex.m_TexCoord = Vector2D(static_cast<float>(u) / divisions, static_cast<float>(v) / divisions);
+						mesh.Vertices.push_back(vertex);
+					}
+				}
+				for (uint32_t v = 0; v < divisions; ++v)
+				{
+					for (uint32_t u = 0; u < divisions; ++u)
+					{
+						const uint32_t i0 = base + v * (divisions + 1) + u;
+						const uint32_t i1 = i0 + 1;
+						const uint32_t i2 = i0 + divisions + 1;
+						const uint32_t i3 = i2 + 1;
+						mesh.Indices.insert(mesh.Indices.end(), { i0, i1, i3, i0, i3, i2 });
+					}
+				}
+			}
+		}
+		return mesh;
+	}
+
+	//! @brief N̂Jiq (XZ ʁA@ +Y )
+	MeshData MakeGrid(uint32_t divisions)
+	{
+		MeshData mesh;
+		mesh.Name = "open grid";
+		for (uint32_t z = 0; z <= divisions; ++z)
+		{
+			for (uint32_t x = 0; x <= divisions; ++x)
+			{
+				const float px = x * 2.0f / divisions - 1.0f;
+				const float pz = z * 2.0f / divisions - 1.0f;
+				Vertex vertex = {};
+				vertex.m_Position = Vector3D(px, 0.1f * std::sin(px * 5.0f) * std::cos(pz * 3.0f), pz);
+				vertex.m_Normal = Vector3D(0.0f, 1.0f, 0.0f);
+				mesh.Vertices.push_back(vertex);
+			}
+		}
+		for (uint32_t z = 0; z < divisions; ++z)
+		{
+			for (uint32_t x = 0; x < divisions; ++x)
+			{
+				const uint32_t i0 = z * (divisions + 1) + x;
+				mesh.Indices.insert(mesh.Indices.end(), { i0, i0 + divisions + 1, i0 + 1, i0 + 1, i0 + divisions + 1, i0 + divisions + 2 });
+			}
+		}
+		return mesh;
+	}
+
+	/// <summary>
+	/// bVbg̕ƋEm߂܂
+	/// </summary>
+	/// <param name="before"> MeshletBuilder::Build() ̑ÕbV </param>
+	void CheckMeshlets(const MeshData& before, const MeshData& mesh)
+	{
+		bool isTiled = !mesh.Meshlets.empty();
+		bool isUnderLimits = true;
+		bool isBoundsContaining = true;
+		bool hasCone = false;
+		uint32_t expectedOffset = 0;
+		uint32_t maxVertices = 0;
+		uint32_t maxTriangles = 0;
+		for (const auto& meshlet : mesh.Meshlets)
+		{
+			isTiled = isTiled && meshlet.IndexOffset == expectedOffset && meshlet.IndexCount > 0 && meshlet.IndexCount % 3 == 0
+				&& static_cast<size_t>(meshlet.IndexOffset) + meshlet.IndexCount <= mesh.Indices.size();
+			if (!isTiled)
+			{
+				break;
+			}
+			expectedOffset += meshlet.IndexCount;
+
+			std::vector<uint32_t> vertices(mesh.Indices.begin() + meshlet.IndexOffset, mesh.Indices.begin() + meshlet.IndexOffset + meshlet.IndexCount);
+			std::sort(vertices.begin(), vertices.end());
+			const uint32_t vertexCount = static_cast<uint32_t>(std::unique(vertices.begin(), vertices.end()) - vertices.begin());
+			maxVertices = (std::max)(maxVertices, vertexCount);
+			maxTriangles = (std::max)(maxTriangles, meshlet.IndexCount / 3);
+			isUnderLimits = isUnderLimits && vertexCount <= MeshletBuilder::MaxVertices && meshlet.IndexCount / 3 <= MeshletBuilder::MaxTriangles;
+
+			for (uint32_t i = 0; i < vertexCount; ++i)
+			{
+				const Vector3D d = mesh.Vertices[vertices[i]].m_Position - meshlet.Bounds.Center;
+				isBoundsContaining = isBoundsContaining && d.length() <= meshlet.Bounds.Radius * (1.0f + 1.0e-5f) + 1.0e-6f;
+			}
+			hasCone = hasCone || meshlet.ConeCutoff < 1.0f;
+		}
+		isTiled = isTiled && expectedOffset == mesh.Indices.size();
+
+		std::printf("  %-24s %7zu tris  %5zu meshlets  max %2u vertices %3u triangles  %s\n", mesh.Name.c_str(), mesh.Indices.size() / 3,
+			mesh.Meshlets.size(), maxVertices, maxTriangles, hasCone ? "cones" : "no cones");
+		TEST_CHECK(isTiled);
+		TEST_CHECK(isUnderLimits);
+		TEST_CHECK(isBoundsContaining);
+		// בւĂOp` (_̒lƊ) ͑Ȃ
+		TEST_CHECK(GetTriangles(before) == GetTriangles(mesh));
+	}
+
+	/// <summary>
+	/// [hs (lXP[E]Esړ) {xł悤ɕێ
+	/// </summary>
+	struct WorldTransform
+	{
+		double Scale = 1.0;
+		double Rotation[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } }; //!< sxNgK (s i  i ̍s)
+		double Translation[3] = {};
+
+		static WorldTransform FromRandom(Random& random)
+		{
+			WorldTransform world;
+			double q[4] = { random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f) };
+			const double length = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+			for (auto& value : q)
+			{
+				value /= length;
+			}
+			const double x = q[0], y = q[1], z = q[2], w = q[3];
+			const double rotation[3][3] = {
+				{ 1 - 2 * (y * y + z * z), 2 * (x * y + w * z), 2 * (x * z - w * y) },
+				{ 2 * (x * y - w * z), 1 - 2 * (x * x + z * z), 2 * (y * z + w * x) },
+				{ 2 * (x * z + w * y), 2 * (y * z - w * x), 1 - 2 * (x * x + y * y) } };
+			std::memcpy(world.Rotation, rotation, sizeof(rotation));
+			world.Scale = random.Range(0.5f, 3.0f);
+			for (auto& value : world.Translation)
+			{
+				value = random.Range(-10.0f, 10.0f);
+			}
+			return world;
+		}
+
+		Matrix4x4 ToMatrix() const
+		{
+			Matrix4x4 matrix = Matrix4x4::Identity();
+			for (int i = 0; i < 3; ++i)
+			{
+				for (int j = 0; j < 3; ++j)
+				{
+					matrix.m_mat[i][j] = static_cast<float>(Scale * Rotation[i][j]);
+				}
+				matrix.m_mat[3][i] = static_cast<float>(Translation[i]);
+			}
+			return matrix;
+		}
+
+		void ToWorld(const Vector3D& point, double out[3]) const
+		{
+			const double p[3] = { point.x, point.y, point.z };
+			for (int j = 0; j < 3; ++j)
+			{
+				out[j] = Scale * (p[0] * Rotation[0][j] + p[1] * Rotation[1][j] + p[2] * Rotation[2][j]) + Translation[j];
+			}
+		}
+
+		void ToWorldDirection(const Vector3D& direction, double out[3]) const
+		{
+			const double d[3] = { direction.x, direction.y, direction.z };
+			for (int j = 0; j < 3; ++j)
+			{
+				out[j] = d[0] * Rotation[0][j] + d[1] * Rotation[1][j] + d[2] * Rotation[2][j];
+			}
+		}
+
+		//! @brief [hW[JW (]̋t͓]u)
+		Vector3D ToLocal(const double point[3]) const
+		{
+			const double p[3] = { point[0] - Translation[0], point[1] - Translation[1], point[2] - Translation[2] };
+			double local[3];
+			for (int i = 0; i < 3; ++i)
+			{
+				local[i] = (p[0] * Rotation[i][0] + p[1] * Rotation[i][1] + p[2] * Rotation[i][2]) / Scale;
+			}
+			return Vector3D(static_cast<float>(local[0]), static_cast<float>(local[1]), static_cast<float>(local[2]));
+		}
+	};
+
+	double Dot(const double a[3], const double b[3]) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]; }
+
+	//! ̔茋
+	enum class Visibility
+	{
+		Visible,
+		FrustumCulled,
+		ConeCulled,
+		Borderline, //!< Eɋ߂Aǂ̌ʂł悢
+	};
+
+	/// <summary>
+	/// bVbg̉[hԁE{xōs܂ (MeshletCuller Ƃ͕ʂ̎)
+	/// </summary>
+	Visibility ClassifyMeshlet(const Meshlet& meshlet, const WorldTransform& world, const Matrix4x4& viewProj, const double eye[3], bool isConeCulling)
+	{
+		double center[3];
+		world.ToWorld(meshlet.Bounds.Center, center);
+		const double radius = meshlet.Bounds.Radius * world.Scale;
+
+		// clip = v * M ̊e񂩂畽ʂ (Gribb / HartmannAz  0`1)
+		const auto& m = viewProj.m_mat;
+		bool isBorderline = false;
+		for (int plane = 0; plane < 6; ++plane)
+		{
+			double coefficients[4];
+			for (int row = 0; row < 4; ++row)
+			{
+				const double c[4] = { m[row][0], m[row][1], m[row][2], m[row][3] };
+				switch (plane)
+				{
+				case 0: coefficients[row] = c[3] + c[0]; break;
+				case 1: coefficients[row] = c[3] - c[0]; break;
+				case 2: coefficients[row] = c[3] + c[1]; break;
+				case 3: coefficients[row] = c[3] - c[1]; break;
+				case 4: coefficients[row] = c[2]; break;
+				default: coefficients[row] = c[3] - c[2]; break;
+				}
+			}
+			const double distance = (Dot(coefficients, center) + coefficients[3]) / std::sqrt(Dot(coefficients, coefficients));
+			if (distance + radius < -BorderlineDistance)
+			{
+				return Visibility::FrustumCulled;
+			}
+			isBorderline = isBorderline || distance + radius <= BorderlineDistance;
+		}
+		if (isBorderline)
+		{
+			return Visibility::Borderline;
+		}
+
+		if (isConeCulling && meshlet.ConeCutoff < 1.0f)
+		{
+			double axis[3];
+			world.ToWorldDirection(meshlet.ConeAxis, axis);
+			const double toCenter[3] = { center[0] - eye[0], center[1] - eye[1], center[2] - eye[2] };
+			const double difference = Dot(toCenter, axis) - (meshlet.ConeCutoff * std::sqrt(Dot(toCenter, toCenter)) + radius);
+			if (std::abs(difference) <= BorderlineDistance)
+			{
+				return Visibility::Borderline;
+			}
+			if (difference > 0.0)
+			{
+				return Visibility::ConeCulled;
+			}
+		}
+		return Visibility::Visible;
+	}
+
+	//! @brief SĂ̎Op`_猩ė (ʐς̂ȂOp`͌Ȃ̂ŏ)
+	bool IsBackFacing(const MeshData& mesh, const Meshlet& meshlet, const Vector3D& localEye)
+	{
+		for (uint32_t i = meshlet.IndexOffset; i < meshlet.IndexOffset + meshlet.IndexCount; i += 3)
+		{
+			const Vertex& v0 = mesh.Vertices[mesh.Indices[i]];
+			const Vector3D normal = GetFacingNormal(v0, mesh.Vertices[mesh.Indices[i + 1]], mesh.Vertices[mesh.Indices[i + 2]]);
+			const Vector3D toVertex = v0.m_Position - localEye;
+			if (normal.dot(toVertex) < -1.0e-4f * toVertex.length())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// ̃J MeshletCuller ̌ʂ𑍓̔Ɣׂ܂
+	/// </summary>
+	void CheckCulling(const MeshData& mesh, Random& random)
+	{
+		uint32_t mismatchCount = 0;
+		uint32_t rangeMismatchCount = 0;
+		uint32_t frontFacingCulledCount = 0;
+		uint32_t statsMismatchCount = 0;
+		uint64_t totalVisible = 0;
+		uint64_t totalConeCulled = 0;
+		uint64_t totalRanges = 0;
+		uint64_t totalMeshlets = 0;
+		const size_t meshletCount = mesh.Meshlets.size();
+
+		MeshletCuller culler;
+		for (uint32_t view = 0; view < ViewCount; ++view)
+		{
+			const WorldTransform world = WorldTransform::FromRandom(random);
+			const Matrix4x4 worldMatrix = world.ToMatrix();
+			double center[3];
+			world.ToWorld(mesh.LocalSphere.Center, center);
+			const double radius = mesh.LocalSphere.Radius * world.Scale;
+
+			// bVO璭߂JƁAɓJ (p̋̂)
+			const float distance = static_cast<float>(radius) * (view % 4 == 0 ? random.Range(0.1f, 0.9f) : random.Range(1.2f, 4.0f));
+			Vector3D direction(random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f));
+			direction = direction.GetSafeNormal();
+			const Vector3D target(static_cast<float>(center[0]) + random.Range(-0.3f, 0.3f) * static_cast<float>(radius),
+				static_cast<float>(center[1]), static_cast<float>(center[2]));
+			const Vector3D eyePosition = target + direction * distance;
+			const float fov = view % 3 == 0 ? 0.4f : 1.2f;
+			const Matrix4x4 viewProj = Matrix4x4::setLookAtLH(eyePosition, target, Vector3D(0.0f, 1.0f, 0.0f))
+				* Matrix4x4::setPerspectiveFovLH(fov, 16.0f / 9.0f, 0.05f * static_cast<float>(radius), 8.0f * static_cast<float>(radius));
+			const double eye[3] = { eyePosition.x, eyePosition.y, eyePosition.z };
+			const bool isConeCulling = view % 8 != 7;
+
+			culler.SetView(viewProj, eyePosition, isConeCulling);
+			culler.SetWorld(worldMatrix);
+			culler.ResetStats();
+			const std::vector<IndexRange> ranges = culler.Cull(mesh.Meshlets);
+
+			// o͂ꂽ͈͂烁bVbg̉߂ (͈͂͏EdȂ炸EאڂAbVbg̋Eŋ؂)
+			std::vector<uint8_t> isVisible(meshletCount, 0);
+			bool isRangeValid = true;
+			size_t meshlet = 0;
+			for (size_t r = 0; r < ranges.size() && isRangeValid; ++r)
+			{
+				while (meshlet < meshletCount && mesh.Meshlets[meshlet].IndexOffset < ranges[r].IndexOffset)
+				{
+					++meshlet;
+				}
+				isRangeValid = meshlet < meshletCount && mesh.Meshlets[meshlet].IndexOffset == ranges[r].IndexOffset && ranges[r].IndexCount > 0
+					&& (r == 0 || ranges[r - 1].IndexOffset + ranges[r - 1].IndexCount < ranges[r].IndexOffset);
+				uint32_t covered = 0;
+				while (isRangeValid && meshlet < meshletCount && covered < ranges[r].IndexCount)
+				{
+					isVisible[meshlet] = 1;
+					covered += mesh.Meshlets[meshlet].IndexCount;
+					++meshlet;
+				}
+				isRangeValid = isRangeValid && covered == ranges[r].IndexCount;
+			}
+			rangeMismatchCount += isRangeValid ? 0 : 1;
+
+			// ̔ƔׁǍʂ͈ (̘AbVbgA) Ƃׂ
+			std::vector<IndexRange> expectedRanges;
+			uint32_t visibleCount = 0;
+			uint32_t coneCulledCount = 0;
+			uint32_t borderlineCount = 0;
+			const Vector3D localEye = world.ToLocal(eye);
+			for (size_t i = 0; i < meshletCount; ++i)
+			{
+				const Meshlet& current = mesh.Meshlets[i];
+				const Visibility visibility = ClassifyMeshlet(current, world, viewProj, eye, isConeCulling);
+				const bool isExpectedVisible = visibility == Visibility::Borderline ? isVisible[i] != 0 : visibility == Visibility::Visible;
+				mismatchCount += isExpectedVisible == (isVisible[i] != 0) ? 0 : 1;
+				if (isExpectedVisible)
+				{
+					++visibleCount;
+					if (!expectedRanges.empty() && expectedRanges.back().IndexOffset + expectedRanges.back().IndexCount == current.IndexOffset)
+					{
+						expectedRanges.back().IndexCount += current.IndexCount;
+					}
+					else
+					{
+						expectedRanges.push_back({ current.IndexOffset, current.IndexCount });
+					}
+				}
+				// @R[ŏỐAǂ̎Op`\ĂȂ
+				if (visibility == Visibility::ConeCulled)
+				{
+					++coneCulledCount;
+					frontFacingCulledCount += IsBackFacing(mesh, current, localEye) ? 0 : 1;
+				}
+				borderlineCount += visibility == Visibility::Borderline ? 1 : 0;
+			}
+			bool isSameRanges = expectedRanges.size() == ranges.size();
+			for (size_t r = 0; isSameRanges && r < ranges.size(); ++r)
+			{
+				isSameRanges = ranges[r].IndexOffset == expectedRanges[r].IndexOffset && ranges[r].IndexCount == expectedRanges[r].IndexCount;
+			}
+			rangeMismatchCount += isSameRanges ? 0 : 1;
+
+			const auto& stats = culler.GetStats();
+			statsMismatchCount += stats.TotalMeshlets == meshletCount && stats.VisibleMeshlets == visibleCount && stats.Ranges == ranges.size()
+				&& coneCulledCount <= stats.ConeCulledMeshlets && stats.ConeCulledMeshlets <= coneCulledCount + borderlineCount
+				&& (isConeCulling || stats.ConeCulledMeshlets == 0) ? 0 : 1;
+			totalVisible += visibleCount;
+			totalConeCulled += stats.ConeCulledMeshlets;
+			totalRanges += ranges.size();
+			totalMeshlets += meshletCount;
+		}
+
+		std::printf("    %u views: %.1f%% visible, %.1f%% cone-culled, %.1f ranges per view (%.1f visible meshlets per range)\n", ViewCount,
+			100.0 * totalVisible / totalMeshlets, 100.0 * totalConeCulled / totalMeshlets, static_cast<double>(totalRanges) / ViewCount,
+			totalRanges > 0 ? static_cast<double>(totalVisible) / totalRanges : 0.0);
+		if (mismatchCount + rangeMismatchCount + frontFacingCulledCount + statsMismatchCount > 0)
+		{
+			std::printf("    FAILED  %u visibility mismatches, %u range mismatches, %u front-facing meshlets culled, %u stats mismatches\n",
+				mismatchCount, rangeMismatchCount, frontFacingCulledCount, statsMismatchCount);
+		}
+		TEST_CHECK(mismatchCount == 0);
+		TEST_CHECK(rangeMismatchCount == 0);
+		TEST_CHECK(frontFacingCulledCount == 0);
+		TEST_CHECK(statsMismatchCount == 0);
+	}
+
+	/// <summary>
+	/// ̂ +Z ̉璭߂ƁA-Z ̖ʂȂ郁bVbg͑SĖ@R[ŏO
+	/// </summary>
+	void CheckCubeBackFace(const MeshData& cube)
+	{
+		const Vector3D eye(0.0f, 0.0f, 20.0f);
+		const Matrix4x4 viewProj = Matrix4x4::setLookAtLH(eye, Vector3D(0.0f, 0.0f, 0.0f), Vector3D(0.0f, 1.0f, 0.0f))
+			* Matrix4x4::setPerspectiveFovLH(0.5f, 1.0f, 0.1f, 100.0f);
+		MeshletCuller culler;
+		culler.SetView(viewProj, eye, true);
+		culler.SetWorld(Matrix4x4::Identity());
+		const std::vector<IndexRange> ranges = culler.Cull(cube.Meshlets);
+
+		uint32_t backCount = 0;
+		uint32_t backVisibleCount = 0;
+		uint32_t frontCulledCount = 0;
+		for (const auto& meshlet : cube.Meshlets)
+		{
+			bool isBack = true;
+			bool isFront = false;
+			for (uint32_t i = meshlet.IndexOffset; i < meshlet.IndexOffset + meshlet.IndexCount; ++i)
+			{
+				const float z = cube.Vertices[cube.Indices[i]].m_Normal.z;
+				isBack = isBack && z == -1.0f;
+				isFront = isFront || z == 1.0f;
+			}
+			const bool isVisible = std::any_of(ranges.begin(), ranges.end(), [&](const IndexRange& range)
+				{
+					return range.IndexOffset <= meshlet.IndexOffset && meshlet.IndexOffset < range.IndexOffset + range.IndexCount;
+				});
+			backCount += isBack ? 1 : 0;
+			backVisibleCount += isBack && isVisible ? 1 : 0;
+			frontCulledCount += isFront && !isVisible ? 1 : 0;
+		}
+		std::printf("    back face: %u meshlets, %u not culled; %u meshlets with front-facing triangles culled\n", backCount, backVisibleCount, frontCulledCount);
+		TEST_CHECK(backCount > 0);
+		TEST_CHECK(backVisibleCount == 0);
+		TEST_CHECK(frontCulledCount == 0);
+	}
+
+	/// <summary>
+	/// Model::Load Ɠ菇ŃbVbgAEEEJOm߂܂
+	/// </summary>
+	MeshData BuildAndCheck(MeshData mesh, bool isWeld, Random& random)
+	{
+		if (isWeld)
+		{
+			MeshWelder::Weld(mesh);
+		}
+		MeshOptimizer::Optimize(mesh);
+		const MeshData before = mesh;
+		MeshletBuilder::Build(mesh);
+		CheckMeshlets(before, mesh);
+		CheckCulling(mesh, random);
+		return mesh;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	if (argc != 2)
+	{
+		std::fprintf(stderr, "usage: MeshMeshletTest <assets directory>\n");
+		return 2;
+	}
+
+	Random random(18);
+	std::printf("generated meshes\n");
+	{
+		MeshData cube = MakeCube(24);
+		cube.LocalBounds = AABB::FromMinMax(Vector3D(-1.0f), Vector3D(1.0f));
+		cube.LocalSphere = Sphere::FromAABB(cube.LocalBounds);
+		cube = BuildAndCheck(cube, false, random);
+		TEST_CHECK(std::all_of(cube.Meshlets.begin(), cube.Meshlets.end(), [](const Meshlet& meshlet) { return meshlet.ConeCutoff < 1.0f; }));
+		CheckCubeBackFace(cube);
+
+		MeshData grid = MakeGrid(64);
+		grid.LocalBounds = AABB::FromMinMax(Vector3D(-1.0f, -0.1f, -1.0f), Vector3D(1.0f, 0.1f, 1.0f));
+		grid.LocalSphere = Sphere::FromAABB(grid.LocalBounds);
+		grid = BuildAndCheck(grid, false, random);
+		// ĂȂbV͗ʂ̂Ŗ@R[Ȃ
+		TEST_CHECK(std::all_of(grid.Meshlets.begin(), grid.Meshlets.end(), [](const Meshlet& meshlet) { return meshlet.ConeCutoff == 1.0f; }));
+	}
+
+	std::vector<std::filesystem::path> files;
+	for (const auto& entry : std::filesystem::recursive_directory_iterator(argv[1]))
+	{
+		if (entry.is_regular_file() && GltfLoader::CanLoad(entry.path().wstring()))
+		{
+			files.push_back(entry.path());
+		}
+	}
+	std::sort(files.begin(), files.end());
+	TEST_CHECK(!files.empty());
+	for (const auto& file : files)
+	{
+		std::printf("%s\n", file.filename().string().c_str());
+		ModelData model;
+		std::string error;
+		if (!TEST_CHECK(GltfLoader::Load(file.wstring(), model, &error)))
+		{
+			std::printf("  %s\n", error.c_str());
+			continue;
+		}
+		for (auto& mesh : model.Meshes)
+		{
+			BuildAndCheck(std::move(mesh), true, random);
+		}
+	}
+	return TestUtility::Finish("MeshMeshletTest");
+}
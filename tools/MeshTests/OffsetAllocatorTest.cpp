@@ -0,0 +1,358 @@
+// OffsetAllocator (GeometryArena ̃TuAP[V) ̃eXg
+// ŊmہEEGrowEDefragment JԂA̓xɊmۍς݂̗̈ʂɊǗʂƔׂ܂
+//   m: zuEÄ̗ƏdȂ炸A܂钆ōł󂫗̈ (best-fit) 邱
+//         ŝ͖{ɂǂ̋󂫗̈ɂ܂Ȃꍇł邱
+//   󂫗̈: ׂ荇󂫗̈悪c炸Ă邱 (GetFreeBlockCountEGetLargestFreeBlock Ԃƈv)
+//   GetUsedSizeEGetAllocationCount mۍς݂̗̈ƈv邱
+//   Defragment: lߒzuEAMove ̏ɓobt@ŃRs[ĂgȂ
+// g: MeshOffsetAllocatorTest (s 0 ȊOԂ܂)
+
+#include "Utilities/OffsetAllocator.h"
+#include "TestUtility.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <vector>
+
+using TestUtility::Random;
+
+namespace
+{
+	//! mۂ̈̔zuE (GeometryArena ͒_̃XgChĝ 2 ̗ݏłȂ̂܂߂)
+	constexpr uint64_t Alignments[] = { 1, 2, 4, 12, 16, 20, 48, 256 };
+
+	uint64_t AlignUp(uint64_t value, uint64_t alignment)
+	{
+		return (value + alignment - 1) / alignment * alignment;
+	}
+
+	/// <summary>
+	/// eXgŊǗmۍς݂̗̈ƁA̒gރobt@
+	/// </summary>
+	class Model
+	{
+	public:
+		struct Block
+		{
+			uint64_t Size;
+			uint64_t Alignment;
+			uint8_t Tag; //!< gɏޒl (Defragment ̃Rs[ŉĂȂm߂)
+		};
+
+		explicit Model(uint64_t capacity) : m_Buffer(capacity, 0) {}
+
+		const std::map<uint64_t, Block>& GetBlocks() const { return m_Blocks; }
+		uint64_t GetCapacity() const { return m_Buffer.size(); }
+
+		void Add(uint64_t offset, const Block& block)
+		{
+			m_Blocks[offset] = block;
+			std::memset(&m_Buffer[offset], block.Tag, block.Size);
+		}
+
+		void Remove(uint64_t offset) { m_Blocks.erase(offset); }
+		void Grow(uint64_t capacity) { m_Buffer.resize(capacity, 0); }
+
+		/// <summary>
+		/// mۍς݂̗̈̊Ԃ̌ (ItZbg, TCY) ItZbgɕԂ܂
+		/// </summary>
+		std::vector<std::pair<uint64_t, uint64_t>> GetGaps() const
+		{
+			std::vector<std::pair<uint64_t, uint64_t>> gaps;
+			uint64_t cursor = 0;
+			for (const auto& [offset, block] : m_Blocks)
+			{
+				if (offset > cursor)
+				{
+					gaps.push_back({ cursor, offset - cursor });
+				}
+				cursor = offset + block.Size;
+			}
+			if (cursor < GetCapacity())
+			{
+				gaps.push_back({ cursor, GetCapacity() - cursor });
+			}
+			return gaps;
+		}
+
+		/// <summary>
+		/// best-fit Ŋmۂꍇ̃ItZbg (܂錄Ԃ̂TCYEItZbgł)
+		/// </summary>
+		uint64_t FindBestFit(uint64_t size, uint64_t alignment) const
+		{
+			uint64_t bestOffset = OffsetAllocator::InvalidOffset;
+			uint64_t bestSize = 0;
+			for (const auto& [gapOffset, gapSize] : GetGaps())
+			{
+				if (AlignUp(gapOffset, alignment) + size > gapOffset + gapSize)
+				{
+					continue;
+				}
+				if (bestOffset == OffsetAllocator::InvalidOffset || gapSize < bestSize)
+				{
+					bestOffset = AlignUp(gapOffset, alignment);
+					bestSize = gapSize;
+				}
+			}
+			return bestOffset;
+		}
+
+		/// <summary>
+		/// Defragment()  Move AGeometryArena Ɠobt@̒ŏɃRs[܂
+		/// </summary>
+		/// <returns> ɎcĂړ㏑Rs[ false </returns>
+		bool ApplyMoves(const std::vector<OffsetAllocator::Move>& moves)
+		{
+			bool isSafe = true;
+			std::map<uint64_t, Block> blocks;
+			for (size_t i = 0; i < moves.size(); ++i)
+			{
+				const auto& move = moves[i];
+				// ܂Rs[ĂȂړɏ܂Ȃ
+				for (size_t j = i + 1; j < moves.size(); ++j)
+				{
+					const bool isOverlapped = move.DstOffset < moves[j].SrcOffset + moves[j].Size && moves[j].SrcOffset < move.DstOffset + move.Size;
+					isSafe = isSafe && !isOverlapped;
+				}
+				std::memmove(&m_Buffer[move.DstOffset], &m_Buffer[move.SrcOffset], move.Size);
+			}
+
+			std::map<uint64_t, uint64_t> newOffsets;
+			for (const auto& move : moves)
+			{
+				newOffsets[move.SrcOffset] = move.DstOffset;
+			}
+			for (const auto& [offset, block] : m_Blocks)
+			{
+				const auto it = newOffsets.find(offset);
+				blocks[it != newOffsets.end() ? it->second : offset] = block;
+			}
+			m_Blocks.swap(blocks);
+			return isSafe;
+		}
+
+		//! @brief ë̒g񂾒l̂܂܂
+		bool IsContentIntact() const
+		{
+			for (const auto& [offset, block] : m_Blocks)
+			{
+				const uint8_t tag = block.Tag;
+				if (!std::all_of(m_Buffer.begin() + offset, m_Buffer.begin() + offset + block.Size, [tag](uint8_t value) { return value == tag; }))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+	private:
+		std::map<uint64_t, Block> m_Blocks;
+		std::vector<uint8_t> m_Buffer;
+	};
+
+	/// <summary>
+	/// AP[^̏ԂeXg̊mۍς݂̗̈ƈv邩m߂܂
+	/// </summary>
+	bool IsConsistent(const OffsetAllocator& allocator, const Model& model)
+	{
+		bool isConsistent = allocator.GetCapacity() == model.GetCapacity();
+		uint64_t usedSize = 0;
+		uint64_t end = 0;
+		for (const auto& [offset, block] : model.GetBlocks())
+		{
+			// zuEAÖ̗ƏdȂ炸AeʂɎ܂
+			isConsistent = isConsistent && offset % block.Alignment == 0 && offset >= end && offset + block.Size <= model.GetCapacity();
+			end = offset + block.Size;
+			usedSize += block.Size;
+		}
+		isConsistent = isConsistent && allocator.GetUsedSize() == usedSize && allocator.GetFreeSize() == model.GetCapacity() - usedSize;
+		isConsistent = isConsistent && allocator.GetAllocationCount() == model.GetBlocks().size();
+
+		// 󂫗̈悪Ă΁Amۍς݂̗̈̊Ԃ̌1󂫗̈1ɂȂ
+		const auto gaps = model.GetGaps();
+		uint64_t largestGap = 0;
+		for (const auto& gap : gaps)
+		{
+			largestGap = (std::max)(largestGap, gap.second);
+		}
+		isConsistent = isConsistent && allocator.GetFreeBlockCount() == gaps.size() && allocator.GetLargestFreeBlock() == largestGap;
+		return isConsistent;
+	}
+
+	/// <summary>
+	/// ܂菇ł̌EGrowEDefragment
+	/// </summary>
+	void TestBasic()
+	{
+		std::printf("basic\n");
+		OffsetAllocator allocator(1000);
+		const uint64_t a = allocator.Allocate(100);
+		const uint64_t b = allocator.Allocate(100);
+		const uint64_t c = allocator.Allocate(100);
+		TEST_CHECK(a == 0 && b == 100 && c == 200);
+		TEST_CHECK(allocator.GetFreeBlockCount() == 1);
+
+		// ׂ󂢂̈ƁA31̋󂫗̈ɂȂ
+		allocator.Free(a);
+		allocator.Free(c);
+		TEST_CHECK(allocator.GetFreeBlockCount() == 2);
+		allocator.Free(b);
+		TEST_CHECK(allocator.GetFreeBlockCount() == 1 && allocator.GetLargestFreeBlock() == 1000 && allocator.GetUsedSize() == 0);
+
+		// zuE܂ł̌Ԃ͋󂫗̈ɖ߂Abest-fit ͂̌Ԃg
+		const uint64_t d = allocator.Allocate(10);
+		const uint64_t e = allocator.Allocate(100, 48);
+		TEST_CHECK(d == 0 && e == 48);
+		TEST_CHECK(allocator.Allocate(30) == 10);
+		TEST_CHECK(allocator.GetFreeBlockCount() == 2);
+
+		// 󂢂Ă Grow ōLƌA܂ĂΐV󂫗̈ɂȂ
+		allocator.Grow(2000);
+		TEST_CHECK(allocator.GetFreeBlockCount() == 2 && allocator.GetLargestFreeBlock() == 2000 - 148);
+		TEST_CHECK(allocator.Allocate(2000 - 148) == 148);
+		allocator.Grow(2100);
+		TEST_CHECK(allocator.GetFreeBlockCount() == 2 && allocator.GetLargestFreeBlock() == 100);
+		// eʂ炷 Grow ͉Ȃ
+		allocator.Grow(10);
+		TEST_CHECK(allocator.GetCapacity() == 2100);
+
+		// ܂Ȃ InvalidOffset
+		TEST_CHECK(allocator.Allocate(101) == OffsetAllocator::InvalidOffset);
+
+		// OĂ Defragment ƑO֋l߁AzuÊ߂ɓȂ̈͂̂܂
+		allocator.Free(d);
+		const auto moves = allocator.Defragment();
+		TEST_CHECK(moves.size() == 1 && moves[0].SrcOffset == 10 && moves[0].DstOffset == 0 && moves[0].Size == 30);
+		TEST_CHECK(allocator.GetFreeBlockCount() == 2);
+	}
+
+	/// <summary>
+	/// ŊmہEEGrowEDefragment JԂ܂
+	/// </summary>
+	void TestRandom(uint32_t seed, uint32_t operationCount)
+	{
+		Random random(seed);
+		OffsetAllocator allocator(64 * 1024);
+		Model model(64 * 1024);
+
+		uint32_t allocatedCount = 0;
+		uint32_t failedCount = 0;
+		uint32_t defragmentCount = 0;
+		uint64_t movedBytes = 0;
+		uint32_t failedOperation = 0;
+		const char* pFailure = nullptr;
+		uint8_t tag = 0;
+		for (uint32_t operation = 1; operation <= operationCount && pFailure == nullptr; ++operation)
+		{
+			const float choice = random.Range(0.0f, 1.0f);
+			if (choice < 0.55f || model.GetBlocks().empty())
+			{
+				// ̂A܂ɑ傫
+				const uint64_t size = random.Range(0.0f, 1.0f) < 0.9f ? 1 + static_cast<uint64_t>(random.Range(0.0f, 512.0f))
+					: 1 + static_cast<uint64_t>(random.Range(0.0f, 16384.0f));
+				const uint64_t alignment = Alignments[static_cast<size_t>(random.Range(0.0f, 7.99f))];
+				const uint64_t expected = model.FindBestFit(size, alignment);
+				const uint64_t offset = allocator.Allocate(size, alignment);
+				if (offset != expected)
+				{
+					pFailure = "Allocate did not pick the best-fit free block";
+				}
+				else if (offset == OffsetAllocator::InvalidOffset)
+				{
+					++failedCount;
+				}
+				else
+				{
+					model.Add(offset, { size, alignment, ++tag });
+					++allocatedCount;
+				}
+			}
+			else if (choice < 0.95f)
+			{
+				// mۍς݂̗̈悩1Iŉ
+				auto it = model.GetBlocks().begin();
+				std::advance(it, static_cast<size_t>(random.Range(0.0f, static_cast<float>(model.GetBlocks().size()) - 0.01f)));
+				const uint64_t offset = it->first;
+				allocator.Free(offset);
+				model.Remove(offset);
+			}
+			else if (choice < 0.97f)
+			{
+				const uint64_t capacity = model.GetCapacity() + 1 + static_cast<uint64_t>(random.Range(0.0f, 8192.0f));
+				allocator.Grow(capacity);
+				model.Grow(capacity);
+			}
+			else
+			{
+				const auto moves = allocator.Defragment();
+				++defragmentCount;
+
+				// ړ̃ItZbgɕсAړ͈ړO
+				bool isOrdered = true;
+				for (size_t i = 0; i < moves.size(); ++i)
+				{
+					isOrdered = isOrdered && moves[i].DstOffset < moves[i].SrcOffset && model.GetBlocks().count(moves[i].SrcOffset) == 1
+						&& model.GetBlocks().at(moves[i].SrcOffset).Size == moves[i].Size;
+					isOrdered = isOrdered && (i == 0 || moves[i - 1].SrcOffset < moves[i].SrcOffset);
+					movedBytes += moves[i].Size;
+				}
+				if (!isOrdered)
+				{
+					pFailure = "Defragment moves are not ordered by source offset";
+				}
+				else if (!model.ApplyMoves(moves))
+				{
+					pFailure = "a Defragment move overwrote a source that was not copied yet";
+				}
+				else if (!model.IsContentIntact())
+				{
+					pFailure = "contents were corrupted by copying the Defragment moves in order";
+				}
+				else
+				{
+					// 擪zuEČԂȂl܂Ă
+					uint64_t cursor = 0;
+					for (const auto& [offset, block] : model.GetBlocks())
+					{
+						if (offset != AlignUp(cursor, block.Alignment))
+						{
+							pFailure = "Defragment did not pack the blocks";
+						}
+						cursor = offset + block.Size;
+					}
+				}
+			}
+
+			if (pFailure == nullptr && !IsConsistent(allocator, model))
+			{
+				pFailure = "allocator state does not match the allocated blocks";
+			}
+			if (pFailure != nullptr)
+			{
+				failedOperation = operation;
+			}
+		}
+		std::printf("  seed %2u: %u operations, %u allocations (%u failed), %u defragments moving %.1f KB, capacity %.1f KB, %zu live blocks\n",
+			seed, operationCount, allocatedCount, failedCount, defragmentCount, movedBytes / 1024.0, model.GetCapacity() / 1024.0, model.GetBlocks().size());
+		if (pFailure != nullptr)
+		{
+			std::printf("  FAILED  operation %u: %s\n", failedOperation, pFailure);
+		}
+		TEST_CHECK(pFailure == nullptr);
+		TEST_CHECK(model.IsContentIntact());
+	}
+}
+
+int main()
+{
+	TestBasic();
+	std::printf("random operations\n");
+	for (uint32_t seed = 1; seed <= 4; ++seed)
+	{
+		TestRandom(seed, 10000);
+	}
+	return TestUtility::Finish("MeshOffsetAllocatorTest");
+}
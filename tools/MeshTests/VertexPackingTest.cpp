@@ -0,0 +1,301 @@
+// VertexPacking (16 oCg PackedVertex) ̕ϊxm߂eXg
+//   x: S 65536 l̉ƁA̒Pxł߂x (Ȃ) ֊ۂ߂邱
+//   ʒu: 덷 AABB ̑傫 / 131070 (UNORM16 ݂̍̔) ȓ
+//   @Eڐ: ʑ̎ʑ (SNORM8) ̊px̌덷ő MaxAngleErrorDegreeE MaxMeanAngleErrorDegree ȓ
+//   UV: x̊ۂ߂̌덷 ( 2^-11) ȓ
+//  glTF ̃bVƗ̒_̗Ŋm߂܂
+// g: MeshVertexPackingTest <assets fBNg> (s 0 ȊOԂ܂)
+
+#include "Graphics/GltfLoader.h"
+#include "Graphics/VertexPacking.h"
+#include "TestUtility.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using TestUtility::Random;
+
+namespace
+{
+	//! @Eڐ̊px̌덷̏ (8bit ̔ʑ̎ʑł SciFiHelmet  0.94 xǍ 0.95 xɂȂ)
+	constexpr double MaxAngleErrorDegree = 0.96;
+	//! @̊px̌덷̕ς̏ (lȌŖ 0.33 x)
+	constexpr double MaxMeanAngleErrorDegree = 0.35;
+	constexpr double Pi = 3.14159265358979323846;
+
+	//! @brief x̃rbg{x̒lɂ (VertexPacking::HalfToFloat Ƃ͕ʂ̎̎Qƒl)
+	double HalfBitsToDouble(uint16_t bits)
+	{
+		const double sign = (bits & 0x8000u) ? -1.0 : 1.0;
+		const int exponent = (bits >> 10) & 0x1F;
+		const int mantissa = bits & 0x3FF;
+		if (exponent == 0)
+		{
+			return sign * std::ldexp(mantissa, -24);
+		}
+		return sign * std::ldexp(1024 + mantissa, exponent - 25);
+	}
+
+	//! @brief value ł߂x̒l֊ۂ߂l (Ȃ牼̕A65520 ȏ͖)
+	double RoundToHalf(float value)
+	{
+		const double absValue = std::abs(static_cast<double>(value));
+		if (absValue >= 65520.0)
+		{
+			return std::copysign(HUGE_VAL, value);
+		}
+		// ݂͐KȂ 2^(w - 10)A񐳋KȂ 2^-24
+		int exponent = 0;
+		std::frexp(absValue, &exponent);
+		const double step = std::ldexp(1.0, (std::max)(exponent - 11, -24));
+		return std::copysign(std::nearbyint(absValue / step) * step, value);
+	}
+
+	void TestHalf(Random& random)
+	{
+		std::printf("half float\n");
+		uint32_t roundTripFailures = 0;
+		uint32_t valueFailures = 0;
+		for (uint32_t bits = 0; bits < 0x10000u; ++bits)
+		{
+			const uint16_t half = static_cast<uint16_t>(bits);
+			const float value = VertexPacking::HalfToFloat(half);
+			const bool isNaN = (half & 0x7C00u) == 0x7C00u && (half & 0x3FFu) != 0;
+			if (isNaN)
+			{
+				// NaN  NaN ̂܂ (yC[h͕ۂȂ)
+				roundTripFailures += std::isnan(value) && std::isnan(VertexPacking::HalfToFloat(VertexPacking::FloatToHalf(value))) ? 0 : 1;
+				continue;
+			}
+			const bool isInfinity = (half & 0x7FFFu) == 0x7C00u;
+			const double expected = isInfinity ? std::copysign(HUGE_VAL, (half & 0x8000u) ? -1.0 : 1.0) : HalfBitsToDouble(half);
+			valueFailures += static_cast<double>(value) == expected ? 0 : 1;
+			roundTripFailures += VertexPacking::FloatToHalf(value) == half ? 0 : 1;
+		}
+		std::printf("  all 65536 halves: %u value mismatches, %u round-trip mismatches\n", valueFailures, roundTripFailures);
+		TEST_CHECK(valueFailures == 0);
+		TEST_CHECK(roundTripFailures == 0);
+
+		// 񐳋K疳ɂȂ傫܂ŁAwlɎU炵
+		constexpr uint32_t SampleCount = 1000000;
+		uint32_t roundingFailures = 0;
+		for (uint32_t i = 0; i < SampleCount; ++i)
+		{
+			const float value = std::copysign(std::exp2(random.Range(-26.0f, 16.5f)), random.Range(-1.0f, 1.0f));
+			const double rounded = VertexPacking::HalfToFloat(VertexPacking::FloatToHalf(value));
+			if (rounded != RoundToHalf(value))
+			{
+				if (roundingFailures == 0)
+				{
+					std::printf("  FAILED  %.9g -> %.9g (expected %.9g)\n", value, rounded, RoundToHalf(value));
+				}
+				++roundingFailures;
+			}
+		}
+		// 傤ǒԂ̒l͍ŋߐڋ֊ۂ߂
+		const float ties[] = { 1.0f + 1.0f / 2048.0f, 1.0f + 3.0f / 2048.0f, 2049.0f, 2051.0f, 65519.0f };
+		const double tieResults[] = { 1.0, 1.0 + 4.0 / 2048.0, 2048.0, 2052.0, 65504.0 };
+		for (size_t i = 0; i < std::size(ties); ++i)
+		{
+			roundingFailures += VertexPacking::HalfToFloat(VertexPacking::FloatToHalf(ties[i])) == tieResults[i] ? 0 : 1;
+		}
+		std::printf("  %u random floats: %u not rounded to the nearest half\n", SampleCount, roundingFailures);
+		TEST_CHECK(roundingFailures == 0);
+	}
+
+	/// <summary>
+	/// EncodeEDecode _ƌ̒_̍
+	/// </summary>
+	struct PackingError
+	{
+		double MaxPositionRatio = 0.0; //!< ʒǔ덷 /  (1 ȉȂ͈͓)
+		double MaxPosition = 0.0;      //!< ʒǔ덷̍ől
+		double PositionBound = 0.0;    //!< ʒǔ덷̏ (ő̎)
+		double MaxNormalDegree = 0.0;
+		double SumNormalDegree = 0.0;
+		double MaxTangentDegree = 0.0;
+		double MaxTexCoordRatio = 0.0; //!< UV ̌덷 / x̊ۂ߂̌덷
+		double MaxTexCoord = 0.0;
+		size_t Count = 0;
+	};
+
+	//! @brief 2̃xNĝȂp (x)
+	double GetAngleDegree(const Vector3D& a, const Vector3D& b)
+	{
+		const double ax = a.x, ay = a.y, az = a.z, bx = b.x, by = b.y, bz = b.z;
+		const double cx = ay * bz - az * by, cy = az * bx - ax * bz, cz = ax * by - ay * bx;
+		return std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz), ax * bx + ay * by + az * bz) * 180.0 / Pi;
+	}
+
+	PackingError MeasurePacking(const std::vector<Vertex>& vertices, const AABB& bounds)
+	{
+		const PositionQuantization quantization = PositionQuantization::FromBounds(bounds);
+		std::vector<PackedVertex> packed(vertices.size());
+		std::vector<Vertex> decoded(vertices.size());
+		VertexPacking::Encode(vertices.data(), vertices.size(), quantization, packed.data());
+		VertexPacking::Decode(packed.data(), packed.size(), quantization, decoded.data());
+
+		// ݂̔ɁAPx Offset + t * Scale vZۂ߂̕ (W̑傫̐ ULP) 
+		const float scale[3] = { quantization.Scale.x, quantization.Scale.y, quantization.Scale.z };
+		const float minimum[3] = { bounds.Min.x, bounds.Min.y, bounds.Min.z };
+		const float maximum[3] = { bounds.Max.x, bounds.Max.y, bounds.Max.z };
+		double bound[3];
+		PackingError error;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			const double magnitude = (std::max)(std::abs(minimum[axis]), std::abs(maximum[axis]));
+			bound[axis] = scale[axis] / 131070.0 + 4.0 * TestUtility::GetUlpSize(magnitude);
+			error.PositionBound = (std::max)(error.PositionBound, bound[axis]);
+		}
+
+		for (size_t i = 0; i < vertices.size(); ++i)
+		{
+			const Vertex& source = vertices[i];
+			const Vertex& result = decoded[i];
+			const float sourcePosition[3] = { source.m_Position.x, source.m_Position.y, source.m_Position.z };
+			const float resultPosition[3] = { result.m_Position.x, result.m_Position.y, result.m_Position.z };
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				const double difference = std::abs(static_cast<double>(resultPosition[axis]) - sourcePosition[axis]);
+				error.MaxPosition = (std::max)(error.MaxPosition, difference);
+				error.MaxPositionRatio = (std::max)(error.MaxPositionRatio, difference / bound[axis]);
+			}
+
+			const double normalDegree = GetAngleDegree(source.m_Normal, result.m_Normal);
+			error.MaxNormalDegree = (std::max)(error.MaxNormalDegree, normalDegree);
+			error.SumNormalDegree += normalDegree;
+			error.MaxTangentDegree = (std::max)(error.MaxTangentDegree, GetAngleDegree(source.m_Tangent, result.m_Tangent));
+
+			const float sourceUv[2] = { source.m_TexCoord.x, source.m_TexCoord.y };
+			const float resultUv[2] = { result.m_TexCoord.x, result.m_TexCoord.y };
+			for (int k = 0; k < 2; ++k)
+			{
+				const double difference = std::abs(static_cast<double>(resultUv[k]) - sourceUv[k]);
+				// x݂̍̔ (񐳋K͈̔͂ł 2^-25)
+				const double halfStep = (std::max)(std::abs(static_cast<double>(sourceUv[k])) * std::ldexp(1.0, -11), std::ldexp(1.0, -25));
+				error.MaxTexCoord = (std::max)(error.MaxTexCoord, difference);
+				error.MaxTexCoordRatio = (std::max)(error.MaxTexCoordRatio, difference / halfStep);
+			}
+		}
+		error.Count = vertices.size();
+		return error;
+	}
+
+	void ReportPacking(const char* pName, const PackingError& error)
+	{
+		std::printf("  %-20s %7zu vertices  position %.3g (bound %.3g)  normal max %.3f deg mean %.3f deg  tangent max %.3f deg  uv %.3g\n",
+			pName, error.Count, error.MaxPosition, error.PositionBound, error.MaxNormalDegree,
+			error.Count > 0 ? error.SumNormalDegree / error.Count : 0.0, error.MaxTangentDegree, error.MaxTexCoord);
+		TEST_CHECK(error.MaxPositionRatio <= 1.0);
+		TEST_CHECK(error.MaxNormalDegree <= MaxAngleErrorDegree);
+		TEST_CHECK(error.Count == 0 || error.SumNormalDegree / error.Count <= MaxMeanAngleErrorDegree);
+		TEST_CHECK(error.MaxTangentDegree <= MaxAngleErrorDegree);
+		TEST_CHECK(error.MaxTexCoordRatio <= 1.0);
+	}
+
+	Vector3D RandomDirection(Random& random)
+	{
+		for (;;)
+		{
+			const Vector3D v(random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f));
+			const float length = v.length();
+			if (length > 0.1f && length <= 1.0f)
+			{
+				return v * (1.0f / length);
+			}
+		}
+	}
+
+	void TestRandomVertices(Random& random)
+	{
+		constexpr size_t VertexCount = 1000000;
+		std::vector<Vertex> vertices(VertexCount);
+		for (auto& vertex : vertices)
+		{
+			vertex.m_Position = Vector3D(random.Range(-50.0f, 150.0f), random.Range(-1.0f, 1.0f), random.Range(1000.0f, 1001.0f));
+			vertex.m_Normal = RandomDirection(random);
+			vertex.m_Tangent = RandomDirection(random);
+			vertex.m_TexCoord = Vector2D(random.Range(-4.0f, 4.0f), random.Range(0.0f, 1.0f));
+		}
+		// ̌ (ʑ̂̒_) Ɛ܂Ԃ̋E
+		const Vector3D axes[] = {
+			Vector3D(1.0f, 0.0f, 0.0f), Vector3D(-1.0f, 0.0f, 0.0f), Vector3D(0.0f, 1.0f, 0.0f),
+			Vector3D(0.0f, -1.0f, 0.0f), Vector3D(0.0f, 0.0f, 1.0f), Vector3D(0.0f, 0.0f, -1.0f),
+		};
+		for (size_t i = 0; i < std::size(axes); ++i)
+		{
+			vertices[i].m_Normal = axes[i];
+			vertices[i].m_Tangent = axes[std::size(axes) - 1 - i];
+		}
+
+		AABB bounds = AABB::FromPoints(&vertices[0].m_Position.x, vertices.size(), sizeof(Vertex));
+		ReportPacking("random", MeasurePacking(vertices, bounds));
+
+		// 4 ̔{łȂ_łAcount ɂ͏܂Ȃ
+		for (size_t count = 1; count <= 7; ++count)
+		{
+			std::vector<PackedVertex> packed(count + 1);
+			std::memset(&packed[count], 0xCD, sizeof(PackedVertex));
+			VertexPacking::Encode(vertices.data(), count, PositionQuantization::FromBounds(bounds), packed.data());
+			const uint8_t* pGuard = reinterpret_cast<const uint8_t*>(&packed[count]);
+			TEST_CHECK(std::all_of(pGuard, pGuard + sizeof(PackedVertex), [](uint8_t value) { return value == 0xCD; }));
+		}
+
+		const PositionQuantization quantization = PositionQuantization::FromBounds(bounds);
+		std::vector<PackedVertex> packed(vertices.size());
+		const auto start = std::chrono::steady_clock::now();
+		VertexPacking::Encode(vertices.data(), vertices.size(), quantization, packed.data());
+		const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		std::printf("  Encode: %zu vertices in %.2f ms (%.2f ns/vertex)\n", vertices.size(), milliseconds, milliseconds * 1.0e6 / vertices.size());
+	}
+}
+
+int main(int argc, char** argv)
+{
+	if (argc != 2)
+	{
+		std::fprintf(stderr, "usage: MeshVertexPackingTest <assets directory>\n");
+		return 2;
+	}
+
+	Random random(41);
+	TestHalf(random);
+
+	std::printf("vertices\n");
+	TestRandomVertices(random);
+
+	std::vector<std::filesystem::path> files;
+	for (const auto& entry : std::filesystem::recursive_directory_iterator(argv[1]))
+	{
+		if (entry.is_regular_file() && GltfLoader::CanLoad(entry.path().wstring()))
+		{
+			files.push_back(entry.path());
+		}
+	}
+	std::sort(files.begin(), files.end());
+	TEST_CHECK(!files.empty());
+	for (const auto& file : files)
+	{
+		ModelData model;
+		std::string error;
+		if (!TEST_CHECK(GltfLoader::Load(file.wstring(), model, &error)))
+		{
+			std::printf("  %s: %s\n", file.filename().string().c_str(), error.c_str());
+			continue;
+		}
+		for (auto& mesh : model.Meshes)
+		{
+			// Model::CreateMeshes ƓAbV AABB ʎq͈̔͂ɂ
+			mesh.ComputeBounds();
+			ReportPacking(file.stem().string().c_str(), MeasurePacking(mesh.Vertices, mesh.LocalBounds));
+		}
+	}
+	return TestUtility::Finish("MeshVertexPackingTest");
+}
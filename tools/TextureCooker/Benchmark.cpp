@@ -0,0 +1,163 @@
+// BlockCompressor ̑x (KsNZ/b) Ɖ掿 (PSNR) 𑪂R}hCc[
+// g: TextureCompressBench [--format BC1|BC3|BC4|BC5|BC7] [--quality fast|normal|high] [--single-thread] [--repeat N] <摜>...
+// `Eiw肵Ȃ΂ׂĂ̑gݍ킹𑪂܂
+
+#include "Graphics/BlockCompressor.h"
+#include "Utilities/Parallel.h"
+#include "ImageLoader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+using BlockCompressor::Format;
+using BlockCompressor::Quality;
+
+namespace
+{
+	const Format AllFormats[] = { Format::BC1, Format::BC3, Format::BC4, Format::BC5, Format::BC7 };
+	const Quality AllQualities[] = { Quality::Fast, Quality::Normal, Quality::High };
+
+	/// <summary>
+	/// R}hC̐ݒ
+	/// </summary>
+	struct Options
+	{
+		std::vector<fs::path> Images;
+		std::vector<Format> Formats;
+		std::vector<Quality> Qualities;
+		bool IsParallel = true;
+		uint32_t RepeatCount = 1; //!< ŌJԂAŒZ̎Ԃg
+	};
+
+	bool ParseOptions(int argc, char** argv, Options& outOptions)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string arg = argv[i];
+			if (arg == "--format" && i + 1 < argc)
+			{
+				const std::string name = argv[++i];
+				bool isFound = false;
+				for (const auto format : AllFormats)
+				{
+					if (name == BlockCompressor::GetFormatName(format))
+					{
+						outOptions.Formats.push_back(format);
+						isFound = true;
+					}
+				}
+				if (!isFound)
+				{
+					return false;
+				}
+			}
+			else if (arg == "--quality" && i + 1 < argc)
+			{
+				const std::string name = argv[++i];
+				bool isFound = false;
+				for (const auto quality : AllQualities)
+				{
+					if (name == BlockCompressor::GetQualityName(quality))
+					{
+						outOptions.Qualities.push_back(quality);
+						isFound = true;
+					}
+				}
+				if (!isFound)
+				{
+					return false;
+				}
+			}
+			else if (arg == "--single-thread")
+			{
+				outOptions.IsParallel = false;
+			}
+			else if (arg == "--repeat" && i + 1 < argc)
+			{
+				outOptions.RepeatCount = static_cast<uint32_t>((std::max)(std::atoi(argv[++i]), 1));
+			}
+			else if (!arg.empty() && arg[0] != '-')
+			{
+				outOptions.Images.push_back(fs::u8path(arg));
+			}
+			else
+			{
+				return false;
+			}
+		}
+		if (outOptions.Formats.empty())
+		{
+			outOptions.Formats.assign(std::begin(AllFormats), std::end(AllFormats));
+		}
+		if (outOptions.Qualities.empty())
+		{
+			outOptions.Qualities.assign(std::begin(AllQualities), std::end(AllQualities));
+		}
+		return !outOptions.Images.empty();
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Options options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		std::fprintf(stderr, "usage: TextureCompressBench [--format BC1|BC3|BC4|BC5|BC7] [--quality fast|normal|high] [--single-thread] [--repeat N] <image>...\n");
+		return 2;
+	}
+
+	std::printf("instruction set: %s, threads: %u\n", BlockCompressor::GetInstructionSetName(),
+		options.IsParallel ? Parallel::GetWorkerCount() : 1u);
+	std::printf("  %-6s %-7s %12s %10s %10s  %s\n", "format", "quality", "time", "MP/s", "PSNR", "image");
+
+	bool isFailed = false;
+	for (const auto& path : options.Images)
+	{
+		ImageLoader::ImageRGBA8 image;
+		std::string error;
+		if (!ImageLoader::LoadRGBA8(path, image, &error))
+		{
+			std::fprintf(stderr, "  FAILED  %s: %s\n", path.u8string().c_str(), error.c_str());
+			isFailed = true;
+			continue;
+		}
+		BlockCompressor::SourceImage source;
+		source.pPixels = image.Pixels.data();
+		source.Width = image.Width;
+		source.Height = image.Height;
+		source.RowPitch = image.GetRowPitch();
+		const double megaPixels = static_cast<double>(source.Width) * source.Height / 1.0e6;
+
+		std::vector<uint8_t> decoded(static_cast<size_t>(source.Width) * source.Height * 4);
+		for (const auto format : options.Formats)
+		{
+			std::vector<uint8_t> blocks(BlockCompressor::GetCompressedSize(format, source.Width, source.Height));
+			for (const auto quality : options.Qualities)
+			{
+				BlockCompressor::Settings settings;
+				settings.Level = quality;
+				settings.IsParallel = options.IsParallel;
+				double bestSeconds = 0.0;
+				for (uint32_t repeat = 0; repeat < options.RepeatCount; ++repeat)
+				{
+					const auto start = std::chrono::steady_clock::now();
+					BlockCompressor::Compress(source, format, settings, blocks.data());
+					const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+					bestSeconds = repeat == 0 ? seconds : (std::min)(bestSeconds, seconds);
+				}
+				BlockCompressor::Decompress(blocks.data(), format, source.Width, source.Height, decoded.data());
+				const double psnr = BlockCompressor::ComputePSNR(source, decoded.data(), format);
+				std::printf("  %-6s %-7s %9.1f ms %10.2f %7.2f dB  %s\n",
+					BlockCompressor::GetFormatName(format), BlockCompressor::GetQualityName(quality),
+					bestSeconds * 1000.0, megaPixels / bestSeconds, psnr, path.filename().u8string().c_str());
+			}
+		}
+	}
+	return isFailed ? 1 : 0;
+}
@@ -0,0 +1,563 @@
+// BlockCompressor ̈kƓWJA덷̏ƒ[_̕тm߂eXg
+// PFE2F̃Of[VE@}bv (BC5) ̃ubNSĂ̕iňk܂
+// [_̑召̓[h (BC1  4 F/3 FABC4  8 iK/6 iK) \̂ŁAubÑoCg𒼐ړǂŊm߂܂
+// pbgŐmɕ\Of[V́A[_ƔԍrbgPʂŊ҂ǂłȂ΂܂
+// g: TextureBlockCompressorTest (s 0 ȊOԂ܂)
+
+#include "Graphics/BlockCompressor.h"
+#include "TestUtility.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+using BlockCompressor::Format;
+using BlockCompressor::Quality;
+using TestUtility::Random;
+
+namespace
+{
+	constexpr Quality Qualities[] = { Quality::Fast, Quality::Normal, Quality::High };
+	//! 1ubN̉f
+	constexpr uint32_t BlockPixelCount = 16;
+
+	//! 565 ̒[_Ɋۂ߂PF1f̓덷̏ (REB  5 rbgōő 4AG  6 rbgōő 2 )
+	constexpr int MaxSolid565SquaredError = 4 * 4 + 2 * 2 + 4 * 4;
+	//! BC7 [h 6 ̒[_ (7 rbg + ʂ p rbg) Ɋۂ߂PF1f̓덷̏ (RGBA  1 )
+	constexpr int MaxSolidBC7SquaredError = 4;
+	//! @}bv (BC5) ŕ@̊px̌덷̏ (x)
+	//! eXg̉ʂ 4x4  REG ő 40 قǕς̂ŁA8 iK݂̍̔ ( 3) ꂼ 1.3 ɓ
+	constexpr double MaxNormalAngleError = 2.5;
+
+	/// <summary>
+	/// eXgp RGBA8 ̉摜
+	/// </summary>
+	struct TestImage
+	{
+		std::vector<uint8_t> Pixels;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+
+		TestImage(uint32_t width, uint32_t height) : Pixels(static_cast<size_t>(width) * height * 4), Width(width), Height(height) {}
+
+		uint8_t* GetPixel(uint32_t x, uint32_t y) { return Pixels.data() + (static_cast<size_t>(y) * Width + x) * 4; }
+
+		void SetPixel(uint32_t x, uint32_t y, const uint8_t (&rgba)[4]) { std::memcpy(GetPixel(x, y), rgba, 4); }
+
+		BlockCompressor::SourceImage ToSource() const
+		{
+			BlockCompressor::SourceImage source;
+			source.pPixels = Pixels.data();
+			source.Width = Width;
+			source.Height = Height;
+			source.RowPitch = static_cast<size_t>(Width) * 4;
+			return source;
+		}
+	};
+
+	/// <summary>
+	/// kubNƁAWJ摜
+	/// </summary>
+	struct Roundtrip
+	{
+		std::vector<uint8_t> Blocks;
+		std::vector<uint8_t> Decoded;
+	};
+
+	Roundtrip Encode(const TestImage& image, Format format, Quality quality)
+	{
+		BlockCompressor::Settings settings;
+		settings.Level = quality;
+		settings.IsParallel = false;
+		Roundtrip result;
+		result.Blocks.resize(BlockCompressor::GetCompressedSize(format, image.Width, image.Height));
+		result.Decoded.resize(image.Pixels.size());
+		BlockCompressor::Compress(image.ToSource(), format, settings, result.Blocks.data());
+		BlockCompressor::Decompress(result.Blocks.data(), format, image.Width, image.Height, result.Decoded.data());
+		return result;
+	}
+
+	//! @brief ``l̐ (ComputePSNR ƓABC4  RABC5  RGAȊO RGBA)
+	uint32_t GetChannelCount(Format format)
+	{
+		return format == Format::BC4 ? 1 : format == Format::BC5 ? 2 : 4;
+	}
+
+	/// <summary>
+	/// 摜ƓWJʂ1f̓덷̍ől (``lׂ܂)
+	/// </summary>
+	int GetMaxPixelSquaredError(const TestImage& image, const std::vector<uint8_t>& decoded, Format format)
+	{
+		const uint32_t channelCount = GetChannelCount(format);
+		int maxError = 0;
+		for (size_t i = 0; i < image.Pixels.size(); i += 4)
+		{
+			int error = 0;
+			for (uint32_t c = 0; c < channelCount; ++c)
+			{
+				const int d = static_cast<int>(image.Pixels[i + c]) - static_cast<int>(decoded[i + c]);
+				error += d * d;
+			}
+			maxError = (std::max)(maxError, error);
+		}
+		return maxError;
+	}
+
+	/// <summary>
+	/// `Ȃ`l D3D Ɠl (F 0AAt@ 255) ɓWJĂ邩
+	/// </summary>
+	bool HasDefaultChannels(const std::vector<uint8_t>& decoded, Format format)
+	{
+		const uint32_t channelCount = GetChannelCount(format);
+		for (size_t i = 0; i < decoded.size(); i += 4)
+		{
+			for (uint32_t c = channelCount; c < 4; ++c)
+			{
+				if (decoded[i + c] != (c == 3 ? 255 : 0))
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	uint16_t ReadColor(const uint8_t* pBytes)
+	{
+		return static_cast<uint16_t>(pBytes[0] | (pBytes[1] << 8));
+	}
+
+	//! @brief BC1 ̐F̃ubN i Ԗڂ̉f̔ԍ (2 rbg)
+	uint32_t GetColorIndex(const uint8_t* pColorBlock, uint32_t i)
+	{
+		uint32_t indexBits;
+		std::memcpy(&indexBits, pColorBlock + 4, sizeof(indexBits));
+		return (indexBits >> (2 * i)) & 3;
+	}
+
+	//! @brief BC4 ̃ubN i Ԗڂ̉f̔ԍ (3 rbg)
+	uint32_t GetAlphaIndex(const uint8_t* pAlphaBlock, uint32_t i)
+	{
+		uint64_t indexBits = 0;
+		for (int b = 0; b < 6; ++b)
+		{
+			indexBits |= static_cast<uint64_t>(pAlphaBlock[2 + b]) << (8 * b);
+		}
+		return static_cast<uint32_t>((indexBits >> (3 * i)) & 7);
+	}
+
+	/// <summary>
+	/// BC1 (BC3 ̐F) ̒[_̕тAWJƂɈӐ}[hɂȂĂ邩
+	/// 4 F[h͒[_ 0 > [_ 1A[_ 3 F[hƂēWĴőSf[_ 0A
+	/// 3 F[h ([_ 0 < [_ 1) ͕sȉfɓ 3 gȂ (BC3 ͏ 4 F[hȂ̂ŎgȂ)
+	/// </summary>
+	bool IsColorOrderValid(const uint8_t* pColorBlock, bool isBC3, bool isOpaque)
+	{
+		const uint16_t color0 = ReadColor(pColorBlock);
+		const uint16_t color1 = ReadColor(pColorBlock + 2);
+		if (color0 > color1)
+		{
+			return true;
+		}
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			const uint32_t index = GetColorIndex(pColorBlock, i);
+			if ((color0 == color1 && index != 0) || (isOpaque && index == 3))
+			{
+				return false;
+			}
+		}
+		return !isBC3 || color0 == color1;
+	}
+
+	//! @brief SubN̐F̒[_̕тm߂܂ (BC1EBC3 ȊO͏ true)
+	bool AreColorOrdersValid(const std::vector<uint8_t>& blocks, Format format, bool isOpaque)
+	{
+		if (format != Format::BC1 && format != Format::BC3)
+		{
+			return true;
+		}
+		const size_t blockSize = BlockCompressor::GetBlockSize(format);
+		const size_t colorOffset = format == Format::BC3 ? 8 : 0;
+		for (size_t offset = 0; offset < blocks.size(); offset += blockSize)
+		{
+			if (!IsColorOrderValid(blocks.data() + offset + colorOffset, format == Format::BC3, isOpaque))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	//! @brief 565 ɋl߂F (R )
+	uint16_t PackColor565(uint32_t r, uint32_t g, uint32_t b)
+	{
+		return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+	}
+
+	//! @brief 565 ̐FWJ RGBA8 (ʃrbgʂɌJԂ)
+	void Expand565(uint16_t color, uint8_t (&outRGBA)[4])
+	{
+		const uint32_t r = color >> 11;
+		const uint32_t g = (color >> 5) & 63;
+		const uint32_t b = color & 31;
+		outRGBA[0] = static_cast<uint8_t>((r << 3) | (r >> 2));
+		outRGBA[1] = static_cast<uint8_t>((g << 2) | (g >> 4));
+		outRGBA[2] = static_cast<uint8_t>((b << 3) | (b >> 2));
+		outRGBA[3] = 255;
+	}
+
+	//! @brief BC4  8 iK[h ([_ 0 > [_ 1) ̔ԍ index ̒l
+	uint8_t GetEightValuePalette(uint32_t value0, uint32_t value1, uint32_t index)
+	{
+		if (index < 2)
+		{
+			return static_cast<uint8_t>(index == 0 ? value0 : value1);
+		}
+		return static_cast<uint8_t>(((8 - index) * value0 + (index - 1) * value1 + 3) / 7);
+	}
+
+	/// <summary>
+	/// PF̉摜͑SfFɓWJA덷͒[_̗ʎq͈̔͂Ɏ܂
+	/// BC4EBC5  8 rbg̒[_Őmɕ\̂ŁA[_͗̒lŔԍׂ͂ 0
+	/// 565 Őmɕ\F́ABC1EBC3 ̒[_̐FŔԍׂ͂ 0
+	/// </summary>
+	void CheckSolid(const uint8_t (&color)[4])
+	{
+		TestImage image(8, 8);
+		for (uint32_t y = 0; y < image.Height; ++y)
+		{
+			for (uint32_t x = 0; x < image.Width; ++x)
+			{
+				image.SetPixel(x, y, color);
+			}
+		}
+		uint8_t expanded[4];
+		const uint16_t color565 = PackColor565(color[0] >> 3, color[1] >> 2, color[2] >> 3);
+		Expand565(color565, expanded);
+		const bool is565 = std::equal(expanded, expanded + 3, color);
+
+		const Format formats[] = { Format::BC1, Format::BC3, Format::BC4, Format::BC5, Format::BC7 };
+		for (const auto format : formats)
+		{
+			const int limit = format == Format::BC4 || format == Format::BC5 ? 0
+				: format == Format::BC7 ? MaxSolidBC7SquaredError : is565 ? 0 : MaxSolid565SquaredError;
+			for (const auto quality : Qualities)
+			{
+				const Roundtrip result = Encode(image, format, quality);
+				const int maxError = GetMaxPixelSquaredError(image, result.Decoded, format);
+				bool isUniform = true;
+				for (size_t i = 4; i < result.Decoded.size(); ++i)
+				{
+					isUniform = isUniform && result.Decoded[i] == result.Decoded[i % 4];
+				}
+
+				// [_lǂ肩 (BC4EBC5  565 ŕ\F̂)
+				bool isEndpointExact = true;
+				const size_t blockSize = BlockCompressor::GetBlockSize(format);
+				for (size_t offset = 0; offset < result.Blocks.size(); offset += blockSize)
+				{
+					const uint8_t* pBlock = result.Blocks.data() + offset;
+					if (format == Format::BC4 || format == Format::BC5)
+					{
+						for (uint32_t c = 0; c < GetChannelCount(format); ++c)
+						{
+							const uint8_t* pAlpha = pBlock + c * 8;
+							isEndpointExact = isEndpointExact && pAlpha[0] == color[c] && pAlpha[1] == color[c]
+								&& std::all_of(pAlpha + 2, pAlpha + 8, [](uint8_t b) { return b == 0; });
+						}
+					}
+					else if (is565 && (format == Format::BC1 || format == Format::BC3))
+					{
+						const uint8_t* pColor = pBlock + (format == Format::BC3 ? 8 : 0);
+						isEndpointExact = isEndpointExact && ReadColor(pColor) == color565 && ReadColor(pColor + 2) == color565
+							&& std::all_of(pColor + 4, pColor + 8, [](uint8_t b) { return b == 0; });
+					}
+				}
+				const bool isOrderValid = AreColorOrdersValid(result.Blocks, format, true);
+				const bool isDefault = HasDefaultChannels(result.Decoded, format);
+
+				const bool isOk = maxError <= limit && isUniform && isEndpointExact && isOrderValid && isDefault;
+				std::printf("  %-6s solid %3u,%3u,%3u,%3u %s %-6s  max pixel error^2 %2d (limit %2d)%s%s%s\n", isOk ? "ok" : "FAILED",
+					color[0], color[1], color[2], color[3], BlockCompressor::GetFormatName(format), BlockCompressor::GetQualityName(quality),
+					maxError, limit, isUniform ? "" : ", not uniform", isEndpointExact ? "" : ", endpoints differ",
+					isOrderValid ? "" : ", bad endpoint order");
+				TEST_CHECK(maxError <= limit);
+				TEST_CHECK(isUniform);
+				TEST_CHECK(isEndpointExact);
+				TEST_CHECK(isOrderValid);
+				TEST_CHECK(isDefault);
+			}
+		}
+	}
+
+	/// <summary>
+	/// 2 565 ̐F BC1  4 F[h̃pbgǂɉׂ֕Of[V (EE)
+	/// mɕ\̂ŁA[_͑傫[_ 0 ɂȂAԍ͗񂲂Ƃ 0E2E3E1 (͂̋t) łȂ΂Ȃ
+	/// </summary>
+	void CheckColorGradient(uint16_t color0, uint16_t color1, bool isReversed)
+	{
+		uint8_t palette[4][4];
+		Expand565(color0, palette[0]);
+		Expand565(color1, palette[1]);
+		for (int c = 0; c < 4; ++c)
+		{
+			palette[2][c] = static_cast<uint8_t>((2 * palette[0][c] + palette[1][c] + 1) / 3);
+			palette[3][c] = static_cast<uint8_t>((palette[0][c] + 2 * palette[1][c] + 1) / 3);
+		}
+		const uint32_t columnIndices[4] = { isReversed ? 1u : 0u, isReversed ? 3u : 2u, isReversed ? 2u : 3u, isReversed ? 0u : 1u };
+		TestImage image(4, 4);
+		for (uint32_t y = 0; y < 4; ++y)
+		{
+			for (uint32_t x = 0; x < 4; ++x)
+			{
+				image.SetPixel(x, y, palette[columnIndices[x]]);
+			}
+		}
+
+		for (const auto format : { Format::BC1, Format::BC3 })
+		{
+			for (const auto quality : Qualities)
+			{
+				const Roundtrip result = Encode(image, format, quality);
+				const uint8_t* pColor = result.Blocks.data() + (format == Format::BC3 ? 8 : 0);
+				const int maxError = GetMaxPixelSquaredError(image, result.Decoded, format);
+				const bool isEndpointExact = ReadColor(pColor) == color0 && ReadColor(pColor + 2) == color1;
+				bool isIndexExact = true;
+				for (uint32_t i = 0; i < BlockPixelCount; ++i)
+				{
+					isIndexExact = isIndexExact && GetColorIndex(pColor, i) == columnIndices[i % 4];
+				}
+
+				const bool isOk = maxError == 0 && isEndpointExact && isIndexExact;
+				std::printf("  %-6s gradient %04x-%04x %-5s %s %-6s  max pixel error^2 %d, endpoints %04x %04x%s\n", isOk ? "ok" : "FAILED",
+					color0, color1, isReversed ? "left" : "right", BlockCompressor::GetFormatName(format), BlockCompressor::GetQualityName(quality),
+					maxError, ReadColor(pColor), ReadColor(pColor + 2), isIndexExact ? "" : ", indices differ");
+				TEST_CHECK(maxError == 0);
+				TEST_CHECK(isEndpointExact);
+				TEST_CHECK(isIndexExact);
+			}
+		}
+	}
+
+	/// <summary>
+	/// 8 iK[h̃pbgǂɕׂ1`l̃Of[V (BC4  RABC5  R Ƌt G)
+	/// mɕ\̂ŁA[_͑傫[_ 0 (8 iK[h) ɂȂAԍׂ͕ƂłȂ΂Ȃ
+	/// </summary>
+	void CheckChannelGradient(Format format, uint32_t value0, uint32_t value1)
+	{
+		// f i ̔ԍ ([_ 0 [_ 1 ֏ɕׁA2)
+		const uint32_t Order[8] = { 0, 2, 3, 4, 5, 6, 7, 1 };
+		const uint32_t channelCount = GetChannelCount(format);
+		TestImage image(4, 4);
+		uint32_t expectedIndices[2][BlockPixelCount];
+		for (uint32_t i = 0; i < BlockPixelCount; ++i)
+		{
+			expectedIndices[0][i] = Order[i % 8];
+			expectedIndices[1][i] = Order[7 - i % 8];
+			uint8_t* pPixel = image.GetPixel(i % 4, i / 4);
+			for (uint32_t c = 0; c < channelCount; ++c)
+			{
+				pPixel[c] = GetEightValuePalette(value0, value1, expectedIndices[c][i]);
+			}
+			pPixel[3] = 255;
+		}
+
+		for (const auto quality : Qualities)
+		{
+			const Roundtrip result = Encode(image, format, quality);
+			const int maxError = GetMaxPixelSquaredError(image, result.Decoded, format);
+			bool isEndpointExact = true;
+			bool isIndexExact = true;
+			for (uint32_t c = 0; c < channelCount; ++c)
+			{
+				const uint8_t* pAlpha = result.Blocks.data() + c * 8;
+				isEndpointExact = isEndpointExact && pAlpha[0] == value0 && pAlpha[1] == value1;
+				for (uint32_t i = 0; i < BlockPixelCount; ++i)
+				{
+					isIndexExact = isIndexExact && GetAlphaIndex(pAlpha, i) == expectedIndices[c][i];
+				}
+			}
+			const bool isDefault = HasDefaultChannels(result.Decoded, format);
+
+			const bool isOk = maxError == 0 && isEndpointExact && isIndexExact && isDefault;
+			std::printf("  %-6s gradient %3u-%-3u          %s %-6s  max pixel error^2 %d, endpoints %u %u%s\n", isOk ? "ok" : "FAILED",
+				value0, value1, BlockCompressor::GetFormatName(format), BlockCompressor::GetQualityName(quality),
+				maxError, result.Blocks[0], result.Blocks[1], isIndexExact ? "" : ", indices differ");
+			TEST_CHECK(maxError == 0);
+			TEST_CHECK(isEndpointExact);
+			TEST_CHECK(isIndexExact);
+			TEST_CHECK(isDefault);
+		}
+	}
+
+	/// <summary>
+	/// pbgɍڂȂ2F̊Ԃ̊炩ȃOf[V (8x8 ̎΂ߕ)
+	/// S` PSNR ȏŕiグĂȂƁABC1EBC3 ̒[_̕т[hƍĂ邱Ƃm߂܂
+	/// </summary>
+	/// <param name="minPSNR"> BC1EBC3EBC4EBC5EBC7  PSNR ̉ (l 1 dB قǉlAk̎Ƃo) </param>
+	void CheckSmoothGradient(const uint8_t (&from)[4], const uint8_t (&to)[4], const double (&minPSNR)[5])
+	{
+		TestImage image(8, 8);
+		for (uint32_t y = 0; y < image.Height; ++y)
+		{
+			for (uint32_t x = 0; x < image.Width; ++x)
+			{
+				const float t = (x + y) / 14.0f;
+				uint8_t* pPixel = image.GetPixel(x, y);
+				for (int c = 0; c < 4; ++c)
+				{
+					pPixel[c] = static_cast<uint8_t>(from[c] + (to[c] - from[c]) * t + 0.5f);
+				}
+			}
+		}
+
+		const Format formats[] = { Format::BC1, Format::BC3, Format::BC4, Format::BC5, Format::BC7 };
+		const bool isOpaque = from[3] == 255 && to[3] == 255;
+		for (size_t f = 0; f < std::size(formats); ++f)
+		{
+			double previousPSNR = 0.0;
+			for (const auto quality : Qualities)
+			{
+				const Roundtrip result = Encode(image, formats[f], quality);
+				const double psnr = BlockCompressor::ComputePSNR(image.ToSource(), result.Decoded.data(), formats[f]);
+				const bool isOrderValid = AreColorOrdersValid(result.Blocks, formats[f], isOpaque);
+
+				const bool isOk = psnr >= minPSNR[f] && psnr >= previousPSNR && isOrderValid;
+				std::printf("  %-6s smooth %3u,%3u,%3u,%3u -> %3u,%3u,%3u,%3u %s %-6s  %6.2f dB (limit %.0f)%s%s\n", isOk ? "ok" : "FAILED",
+					from[0], from[1], from[2], from[3], to[0], to[1], to[2], to[3], BlockCompressor::GetFormatName(formats[f]),
+					BlockCompressor::GetQualityName(quality), psnr, minPSNR[f], psnr >= previousPSNR ? "" : ", worse than lower quality",
+					isOrderValid ? "" : ", bad endpoint order");
+				TEST_CHECK(psnr >= minPSNR[f]);
+				TEST_CHECK(psnr >= previousPSNR);
+				TEST_CHECK(isOrderValid);
+				previousPSNR = psnr;
+			}
+		}
+	}
+
+	/// <summary>
+	/// @}bṽubN (ɂ₩ȉʂ XY  RG ɓꂽ)  BC5 ňkAZ 𕜌@̊px̌덷m߂܂
+	/// ׂ鑊 8 rbg RG 畜@Ȃ̂ŁAkɂ덷𑪂܂
+	/// REG ꂼ̃ubN̓덷́AŏlEől[_ɂ 8 iK[h (Fast ̌) ̏𒴂Ă͂܂
+	/// </summary>
+	void CheckNormalBlock(Random& random)
+	{
+		TestImage image(8, 8);
+		const float frequencyX = random.Range(0.3f, 0.6f);
+		const float frequencyY = random.Range(0.3f, 0.6f);
+		for (uint32_t y = 0; y < image.Height; ++y)
+		{
+			for (uint32_t x = 0; x < image.Width; ++x)
+			{
+				//  0.5 * sin(fx x) * cos(fy y) ̌z@
+				const float dx = 0.5f * frequencyX * std::cos(frequencyX * x) * std::cos(frequencyY * y);
+				const float dy = -0.5f * frequencyY * std::sin(frequencyX * x) * std::sin(frequencyY * y);
+				const float length = std::sqrt(dx * dx + dy * dy + 1.0f);
+				uint8_t* pPixel = image.GetPixel(x, y);
+				pPixel[0] = static_cast<uint8_t>((-dx / length * 0.5f + 0.5f) * 255.0f + 0.5f);
+				pPixel[1] = static_cast<uint8_t>((-dy / length * 0.5f + 0.5f) * 255.0f + 0.5f);
+				pPixel[2] = static_cast<uint8_t>((1.0f / length * 0.5f + 0.5f) * 255.0f + 0.5f);
+				pPixel[3] = 255;
+			}
+		}
+
+		auto toNormal = [](const uint8_t* pPixel, double (&outNormal)[3])
+			{
+				outNormal[0] = pPixel[0] * (2.0 / 255.0) - 1.0;
+				outNormal[1] = pPixel[1] * (2.0 / 255.0) - 1.0;
+				outNormal[2] = std::sqrt((std::max)(0.0, 1.0 - outNormal[0] * outNormal[0] - outNormal[1] * outNormal[1]));
+			};
+		const double radiansToDegrees = 180.0 / 3.14159265358979323846;
+		for (const auto quality : Qualities)
+		{
+			const Roundtrip result = Encode(image, Format::BC5, quality);
+			double maxAngle = 0.0;
+			for (size_t i = 0; i < image.Pixels.size(); i += 4)
+			{
+				double expected[3];
+				double actual[3];
+				toNormal(&image.Pixels[i], expected);
+				toNormal(&result.Decoded[i], actual);
+				const double dot = expected[0] * actual[0] + expected[1] * actual[1] + expected[2] * actual[2];
+				const double lengths = std::sqrt((expected[0] * expected[0] + expected[1] * expected[1] + expected[2] * expected[2])
+					* (actual[0] * actual[0] + actual[1] * actual[1] + actual[2] * actual[2]));
+				maxAngle = (std::max)(maxAngle, std::acos((std::min)(1.0, dot / lengths)) * radiansToDegrees);
+			}
+
+			// ubNE`l̓덷ƒ[_̕
+			// ʂ XY  0E255 ɓ͂Ȃ̂ŁA6 iK[h ([_ 0 <= [_ 1) ȂŒl̔ԍ 6E7 gĂ͂Ȃ
+			double maxErrorRatio = 0.0;
+			bool isOrderValid = true;
+			for (uint32_t block = 0; block < 4; ++block)
+			{
+				const uint32_t blockX = block % 2 * 4;
+				const uint32_t blockY = block / 2 * 4;
+				for (uint32_t c = 0; c < 2; ++c)
+				{
+					const uint8_t* pAlpha = result.Blocks.data() + block * 16 + c * 8;
+					int minValue = 255;
+					int maxValue = 0;
+					double squaredError = 0.0;
+					for (uint32_t i = 0; i < BlockPixelCount; ++i)
+					{
+						const size_t offset = ((blockY + i / 4) * image.Width + blockX + i % 4) * 4 + c;
+						const int value = image.Pixels[offset];
+						const int d = value - static_cast<int>(result.Decoded[offset]);
+						minValue = (std::min)(minValue, value);
+						maxValue = (std::max)(maxValue, value);
+						squaredError += d * d;
+						isOrderValid = isOrderValid && (pAlpha[0] > pAlpha[1] || GetAlphaIndex(pAlpha, i) < 6);
+					}
+					// 8 iK݂̍̔ɁApbg̒l̊ۂ (0.5) 𑫂ꂪSfɏoꍇ
+					const double maxDifference = (maxValue - minValue) / 14.0 + 0.5;
+					maxErrorRatio = (std::max)(maxErrorRatio, squaredError / (BlockPixelCount * maxDifference * maxDifference));
+				}
+			}
+			const bool isDefault = HasDefaultChannels(result.Decoded, Format::BC5);
+
+			const bool isOk = maxAngle <= MaxNormalAngleError && maxErrorRatio <= 1.0 && isOrderValid && isDefault;
+			std::printf("  %-6s normal map BC5 %-6s  max angle error %.3f deg (limit %.1f), block error^2 %.2f of limit%s\n", isOk ? "ok" : "FAILED",
+				BlockCompressor::GetQualityName(quality), maxAngle, MaxNormalAngleError, maxErrorRatio, isOrderValid ? "" : ", bad endpoint order");
+			TEST_CHECK(maxAngle <= MaxNormalAngleError);
+			TEST_CHECK(maxErrorRatio <= 1.0);
+			TEST_CHECK(isOrderValid);
+			TEST_CHECK(isDefault);
+		}
+	}
+}
+
+int main()
+{
+	std::printf("TextureBlockCompressorTest (%s)\n", BlockCompressor::GetInstructionSetName());
+
+	std::printf("solid colours\n");
+	const uint8_t solids[][4] = { { 200, 100, 50, 255 }, { 255, 0, 0, 255 }, { 0, 0, 0, 255 }, { 255, 255, 255, 255 }, { 33, 77, 201, 255 } };
+	for (const auto& color : solids)
+	{
+		CheckSolid(color);
+	}
+
+	std::printf("gradients exactly on the palette\n");
+	CheckColorGradient(PackColor565(28, 50, 6), PackColor565(3, 10, 25), false);
+	CheckColorGradient(PackColor565(28, 50, 6), PackColor565(3, 10, 25), true);
+	CheckColorGradient(PackColor565(31, 63, 31), PackColor565(0, 0, 0), true);
+	CheckChannelGradient(Format::BC4, 200, 10);
+	CheckChannelGradient(Format::BC4, 255, 0);
+	CheckChannelGradient(Format::BC5, 180, 60);
+
+	std::printf("smooth two-colour gradients\n");
+	CheckSmoothGradient({ 250, 40, 10, 255 }, { 20, 180, 230, 255 }, { 29.0, 29.0, 33.0, 35.0, 43.0 });
+	CheckSmoothGradient({ 90, 92, 95, 255 }, { 130, 128, 120, 255 }, { 42.0, 42.0, 48.0, 48.0, 52.0 });
+
+	std::printf("normal map blocks\n");
+	Random random(22);
+	for (int i = 0; i < 4; ++i)
+	{
+		CheckNormalBlock(random);
+	}
+	return TestUtility::Finish("TextureBlockCompressorTest");
+}
@@ -0,0 +1,137 @@
+#include "DdsFile.h"
+
+#include <fstream>
+
+namespace
+{
+	constexpr uint32_t MakeFourCC(char a, char b, char c, char d)
+	{
+		return static_cast<uint32_t>(static_cast<uint8_t>(a)) | (static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8)
+			| (static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16) | (static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24);
+	}
+
+	constexpr uint32_t Magic = MakeFourCC('D', 'D', 'S', ' ');
+	constexpr uint32_t FourCCDX10 = MakeFourCC('D', 'X', '1', '0');
+
+	// DDS_HEADER  dwFlagsEddspf.dwFlagsEdwCaps
+	constexpr uint32_t HeaderFlagCaps = 0x1;
+	constexpr uint32_t HeaderFlagHeight = 0x2;
+	constexpr uint32_t HeaderFlagWidth = 0x4;
+	constexpr uint32_t HeaderFlagPixelFormat = 0x1000;
+	constexpr uint32_t HeaderFlagMipMapCount = 0x20000;
+	constexpr uint32_t HeaderFlagLinearSize = 0x80000;
+	constexpr uint32_t PixelFormatFlagFourCC = 0x4;
+	constexpr uint32_t CapsComplex = 0x8;
+	constexpr uint32_t CapsTexture = 0x1000;
+	constexpr uint32_t CapsMipMap = 0x400000;
+	//! D3D10_RESOURCE_DIMENSION_TEXTURE2D
+	constexpr uint32_t ResourceDimensionTexture2D = 3;
+
+	/// <summary>
+	/// DDS_HEADER (124 oCg)  DDS_HEADER_DXT10 (20 oCg) 𑱂
+	/// </summary>
+	struct FileHeader
+	{
+		uint32_t Magic;
+		uint32_t Size;
+		uint32_t Flags;
+		uint32_t Height;
+		uint32_t Width;
+		uint32_t PitchOrLinearSize;
+		uint32_t Depth;
+		uint32_t MipMapCount;
+		uint32_t Reserved1[11];
+		uint32_t PixelFormatSize;
+		uint32_t PixelFormatFlags;
+		uint32_t FourCC;
+		uint32_t RGBBitCount;
+		uint32_t BitMasks[4];
+		uint32_t Caps;
+		uint32_t Caps2;
+		uint32_t Caps3;
+		uint32_t Caps4;
+		uint32_t Reserved2;
+		// DDS_HEADER_DXT10
+		uint32_t DXGIFormat;
+		uint32_t ResourceDimension;
+		uint32_t MiscFlag;
+		uint32_t ArraySize;
+		uint32_t MiscFlags2;
+	};
+	static_assert(sizeof(FileHeader) == 4 + 124 + 20, "DDS wb_[̃TCY܂");
+
+	//! @brief 1ubÑoCg (BC1EBC4  8AȊO 16)
+	uint32_t GetBlockSize(DdsFile::Format format)
+	{
+		switch (format)
+		{
+		case DdsFile::Format::BC1_UNORM:
+		case DdsFile::Format::BC1_UNORM_SRGB:
+		case DdsFile::Format::BC4_UNORM:
+			return 8;
+		default:
+			return 16;
+		}
+	}
+}
+
+const char* DdsFile::GetFormatName(Format format)
+{
+	switch (format)
+	{
+	case Format::BC1_UNORM: return "BC1";
+	case Format::BC1_UNORM_SRGB: return "BC1_SRGB";
+	case Format::BC3_UNORM: return "BC3";
+	case Format::BC3_UNORM_SRGB: return "BC3_SRGB";
+	case Format::BC4_UNORM: return "BC4";
+	case Format::BC5_UNORM: return "BC5";
+	case Format::BC7_UNORM: return "BC7";
+	case Format::BC7_UNORM_SRGB: return "BC7_SRGB";
+	default: return "?";
+	}
+}
+
+bool DdsFile::ReadMetadata(const std::filesystem::path& path, Metadata& outMetadata)
+{
+	std::ifstream file(path, std::ios::binary);
+	FileHeader header = {};
+	if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+	{
+		return false;
+	}
+	if (header.Magic != Magic || header.Size != 124 || (header.PixelFormatFlags & PixelFormatFlagFourCC) == 0
+		|| header.FourCC != FourCCDX10 || header.ResourceDimension != ResourceDimensionTexture2D || header.ArraySize != 1)
+	{
+		return false;
+	}
+	outMetadata.TextureFormat = static_cast<Format>(header.DXGIFormat);
+	outMetadata.Width = header.Width;
+	outMetadata.Height = header.Height;
+	outMetadata.MipLevels = (header.Flags & HeaderFlagMipMapCount) != 0 && header.MipMapCount > 0 ? header.MipMapCount : 1;
+	return true;
+}
+
+bool DdsFile::Save(const std::filesystem::path& path, const Metadata& metadata, const uint8_t* pData, size_t dataSize)
+{
+	FileHeader header = {};
+	header.Magic = Magic;
+	header.Size = 124;
+	header.Flags = HeaderFlagCaps | HeaderFlagHeight | HeaderFlagWidth | HeaderFlagPixelFormat | HeaderFlagMipMapCount | HeaderFlagLinearSize;
+	header.Height = metadata.Height;
+	header.Width = metadata.Width;
+	header.PitchOrLinearSize = ((metadata.Width + 3) / 4) * ((metadata.Height + 3) / 4) * GetBlockSize(metadata.TextureFormat);
+	header.MipMapCount = metadata.MipLevels;
+	header.PixelFormatSize = 32;
+	header.PixelFormatFlags = PixelFormatFlagFourCC;
+	header.FourCC = FourCCDX10;
+	header.Caps = CapsTexture | (metadata.MipLevels > 1 ? CapsComplex | CapsMipMap : 0);
+	header.DXGIFormat = static_cast<uint32_t>(metadata.TextureFormat);
+	header.ResourceDimension = ResourceDimensionTexture2D;
+	header.ArraySize = 1;
+
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(reinterpret_cast<const char*>(pData), static_cast<std::streamsize>(dataSize));
+	file.close();
+	return !file.fail();
+}
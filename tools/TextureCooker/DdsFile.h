@@ -0,0 +1,51 @@
+#pragma once
+// TextureCooker o BC keNX` DDS (DX10 gwb_[t) ̓ǂݏ
+// 2D eNX`1E~bvt܂ (DirectXTex Ɉˑ܂)
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace DdsFile
+{
+	/// <summary>
+	/// o` (l DXGI_FORMAT Ɠ)
+	/// </summary>
+	enum class Format : uint32_t
+	{
+		Unknown = 0,
+		BC1_UNORM = 71,
+		BC1_UNORM_SRGB = 72,
+		BC3_UNORM = 77,
+		BC3_UNORM_SRGB = 78,
+		BC4_UNORM = 80,
+		BC5_UNORM = 83,
+		BC7_UNORM = 98,
+		BC7_UNORM_SRGB = 99,
+	};
+
+	/// <summary>
+	/// eNX`̌`ƃTCY
+	/// </summary>
+	struct Metadata
+	{
+		Format TextureFormat = Format::Unknown;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t MipLevels = 0;
+	};
+
+	const char* GetFormatName(Format format);
+
+	/// <summary>
+	/// wb_[ǂ݁A`ƃTCYo܂
+	/// </summary>
+	/// <returns> DX10 gwb_[t 2D eNX`łȂ false </returns>
+	bool ReadMetadata(const std::filesystem::path& path, Metadata& outMetadata);
+
+	/// <summary>
+	/// wb_[ƃubNo܂
+	/// </summary>
+	/// <param name="pData"> 傫ɌԂȂׂS~bṽubN </param>
+	bool Save(const std::filesystem::path& path, const Metadata& metadata, const uint8_t* pData, size_t dataSize);
+}
@@ -0,0 +1,378 @@
+#include "ImageLoader.h"
+
+#include <csetjmp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include <png.h>
+#include <jpeglib.h>
+
+namespace
+{
+	bool SetError(std::string* pError, const std::string& message)
+	{
+		if (pError != nullptr)
+		{
+			*pError = message;
+		}
+		return false;
+	}
+
+	bool ReadFile(const std::filesystem::path& path, std::vector<uint8_t>& outData)
+	{
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file)
+		{
+			return false;
+		}
+		const std::streamoff size = file.tellg();
+		if (size < 0)
+		{
+			return false;
+		}
+		outData.resize(static_cast<size_t>(size));
+		file.seekg(0);
+		return static_cast<bool>(file.read(reinterpret_cast<char*>(outData.data()), size));
+	}
+
+	uint32_t ReadU16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+	uint32_t ReadU32(const uint8_t* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24); }
+
+	//! 摜1̉f̏ (ꂽwb_[ŋȗ̈mۂȂ悤)
+	constexpr uint64_t MaxPixelCount = 1ull << 28;
+
+	bool Allocate(uint32_t width, uint32_t height, ImageLoader::ImageRGBA8& outImage)
+	{
+		if (width == 0 || height == 0 || static_cast<uint64_t>(width) * height > MaxPixelCount)
+		{
+			return false;
+		}
+		outImage.Width = width;
+		outImage.Height = height;
+		outImage.Pixels.assign(outImage.GetRowPitch() * height, 0);
+		return true;
+	}
+
+	bool LoadPNG(const std::vector<uint8_t>& data, ImageLoader::ImageRGBA8& outImage, std::string* pError)
+	{
+		png_image image;
+		std::memset(&image, 0, sizeof(image));
+		image.version = PNG_IMAGE_VERSION;
+		if (!png_image_begin_read_from_memory(&image, data.data(), data.size()))
+		{
+			return SetError(pError, std::string("PNG ǂ߂܂: ") + image.message);
+		}
+		image.format = PNG_FORMAT_RGBA;
+		if (!Allocate(image.width, image.height, outImage))
+		{
+			png_image_free(&image);
+			return SetError(pError, "PNG ̃TCYsł");
+		}
+		if (!png_image_finish_read(&image, nullptr, outImage.Pixels.data(), static_cast<png_int_32>(outImage.GetRowPitch()), nullptr))
+		{
+			return SetError(pError, std::string("PNG ̃fR[hɎs܂: ") + image.message);
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// libjpeg ̃G[ŌĂяoɖ߂邽߂̃G[}l[W[ (ł exit() 邽)
+	/// </summary>
+	struct JpegErrorManager
+	{
+		jpeg_error_mgr Base;
+		std::jmp_buf JumpBuffer;
+		char Message[JMSG_LENGTH_MAX];
+	};
+
+	void OnJpegError(j_common_ptr pInfo)
+	{
+		auto* pManager = reinterpret_cast<JpegErrorManager*>(pInfo->err);
+		(*pInfo->err->format_message)(pInfo, pManager->Message);
+		std::longjmp(pManager->JumpBuffer, 1);
+	}
+
+	bool LoadJPEG(const std::vector<uint8_t>& data, ImageLoader::ImageRGBA8& outImage, std::string* pError)
+	{
+		jpeg_decompress_struct info;
+		JpegErrorManager errorManager;
+		std::vector<uint8_t> row;
+		info.err = jpeg_std_error(&errorManager.Base);
+		errorManager.Base.error_exit = OnJpegError;
+		if (setjmp(errorManager.JumpBuffer))
+		{
+			jpeg_destroy_decompress(&info);
+			return SetError(pError, std::string("JPEG ̃fR[hɎs܂: ") + errorManager.Message);
+		}
+
+		jpeg_create_decompress(&info);
+		jpeg_mem_src(&info, data.data(), static_cast<unsigned long>(data.size()));
+		jpeg_read_header(&info, TRUE);
+		if (info.jpeg_color_space == JCS_CMYK || info.jpeg_color_space == JCS_YCCK)
+		{
+			jpeg_destroy_decompress(&info);
+			return SetError(pError, "CMYK  JPEG ɂ͑ΉĂ܂");
+		}
+		info.out_color_space = JCS_RGB;
+		jpeg_start_decompress(&info);
+		if (info.output_components != 3 || !Allocate(info.output_width, info.output_height, outImage))
+		{
+			jpeg_destroy_decompress(&info);
+			return SetError(pError, "JPEG ̃TCYsł");
+		}
+
+		row.resize(static_cast<size_t>(info.output_width) * 3);
+		while (info.output_scanline < info.output_height)
+		{
+			uint8_t* pDst = outImage.Pixels.data() + info.output_scanline * outImage.GetRowPitch();
+			JSAMPROW pRow = row.data();
+			jpeg_read_scanlines(&info, &pRow, 1);
+			for (uint32_t x = 0; x < info.output_width; ++x)
+			{
+				pDst[x * 4 + 0] = row[x * 3 + 0];
+				pDst[x * 4 + 1] = row[x * 3 + 1];
+				pDst[x * 4 + 2] = row[x * 3 + 2];
+				pDst[x * 4 + 3] = 255;
+			}
+		}
+		jpeg_finish_decompress(&info);
+		jpeg_destroy_decompress(&info);
+		return true;
+	}
+
+	/// <summary>
+	/// TGA (tJ[EO[XP[A񈳏k RLEBJ[}bvE16bit ͔Ή)
+	/// </summary>
+	bool LoadTGA(const std::vector<uint8_t>& data, ImageLoader::ImageRGBA8& outImage, std::string* pError)
+	{
+		constexpr size_t HeaderSize = 18;
+		if (data.size() < HeaderSize)
+		{
+			return SetError(pError, "TGA ̃wb_[sł");
+		}
+		const uint8_t* pHeader = data.data();
+		const uint32_t idLength = pHeader[0];
+		const uint32_t colorMapType = pHeader[1];
+		const uint32_t imageType = pHeader[2];
+		const uint32_t colorMapSize = ReadU16(pHeader + 5) * ((pHeader[7] + 7) / 8);
+		const uint32_t width = ReadU16(pHeader + 12);
+		const uint32_t height = ReadU16(pHeader + 14);
+		const uint32_t depth = pHeader[16];
+		const uint32_t descriptor = pHeader[17];
+
+		const bool isRLE = imageType >= 9;
+		const bool isGray = imageType == 3 || imageType == 11;
+		const bool isTrueColor = imageType == 2 || imageType == 10;
+		if (!((isGray && depth == 8) || (isTrueColor && (depth == 24 || depth == 32))))
+		{
+			return SetError(pError, "ΉĂȂ TGA ł (tJ[ 24/32bit ƃO[XP[ 8bit ̂)");
+		}
+		if (!Allocate(width, height, outImage))
+		{
+			return SetError(pError, "TGA ̃TCYsł");
+		}
+
+		// At@̃rbg 0 ȂA32bit łAt@͎gĂȂ
+		const bool hasAlpha = depth == 32 && (descriptor & 0x0F) != 0;
+		const uint32_t pixelSize = depth / 8;
+		size_t position = HeaderSize + idLength + (colorMapType != 0 ? colorMapSize : 0);
+		auto readPixel = [&](uint8_t* pDst)
+			{
+				const uint8_t* pSrc = data.data() + position;
+				position += pixelSize;
+				if (isGray)
+				{
+					pDst[0] = pDst[1] = pDst[2] = pSrc[0];
+					pDst[3] = 255;
+				}
+				else
+				{
+					// TGA  BGR(A) ̏
+					pDst[0] = pSrc[2];
+					pDst[1] = pSrc[1];
+					pDst[2] = pSrc[0];
+					pDst[3] = hasAlpha ? pSrc[3] : 255;
+				}
+			};
+
+		// t@C̕яɓǂ݁AŌɌ𒼂
+		const size_t pixelCount = static_cast<size_t>(width) * height;
+		uint8_t* pPixels = outImage.Pixels.data();
+		for (size_t i = 0; i < pixelCount;)
+		{
+			uint32_t runLength = 1;
+			bool isRepeat = false;
+			if (isRLE)
+			{
+				if (position >= data.size())
+				{
+					return SetError(pError, "TGA ̃f[^rŏIĂ܂");
+				}
+				const uint8_t packet = data[position++];
+				runLength = (packet & 0x7F) + 1u;
+				isRepeat = (packet & 0x80) != 0;
+			}
+			if (i + runLength > pixelCount || position + (isRepeat ? 1 : runLength) * pixelSize > data.size())
+			{
+				return SetError(pError, "TGA ̃f[^rŏIĂ܂");
+			}
+			for (uint32_t r = 0; r < runLength; ++r, ++i)
+			{
+				if (isRepeat && r > 0)
+				{
+					std::memcpy(pPixels + i * 4, pPixels + (i - 1) * 4, 4);
+				}
+				else
+				{
+					readPixel(pPixels + i * 4);
+				}
+			}
+		}
+
+		const size_t rowPitch = outImage.GetRowPitch();
+		if ((descriptor & 0x10) != 0)
+		{
+			for (uint32_t y = 0; y < height; ++y)
+			{
+				uint32_t* pRow = reinterpret_cast<uint32_t*>(pPixels + y * rowPitch);
+				std::reverse(pRow, pRow + width);
+			}
+		}
+		if ((descriptor & 0x20) == 0)
+		{
+			// _Ȃ̂ŏ㉺ւ
+			for (uint32_t y = 0; y < height / 2; ++y)
+			{
+				std::swap_ranges(pPixels + y * rowPitch, pPixels + (y + 1) * rowPitch, pPixels + (height - 1 - y) * rowPitch);
+			}
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// 32bit ̃rbg}XN 8bit ̒lo܂
+	/// </summary>
+	uint8_t ExtractMasked(uint32_t value, uint32_t mask)
+	{
+		if (mask == 0)
+		{
+			return 255;
+		}
+		uint32_t shift = 0;
+		while (((mask >> shift) & 1) == 0)
+		{
+			++shift;
+		}
+		const uint32_t maxValue = mask >> shift;
+		return static_cast<uint8_t>(((value & mask) >> shift) * 255u / maxValue);
+	}
+
+	/// <summary>
+	/// BMP (񈳏k 24/32bit ƁArbgtB[h 32bit)
+	/// </summary>
+	bool LoadBMP(const std::vector<uint8_t>& data, ImageLoader::ImageRGBA8& outImage, std::string* pError)
+	{
+		constexpr size_t FileHeaderSize = 14;
+		constexpr size_t InfoHeaderSize = 40;
+		constexpr uint32_t CompressionRGB = 0;
+		constexpr uint32_t CompressionBitFields = 3;
+		if (data.size() < FileHeaderSize + InfoHeaderSize || data[0] != 'B' || data[1] != 'M')
+		{
+			return SetError(pError, "BMP ̃wb_[sł");
+		}
+		const uint8_t* pInfo = data.data() + FileHeaderSize;
+		const uint32_t dataOffset = ReadU32(data.data() + 10);
+		const uint32_t infoSize = ReadU32(pInfo);
+		const int32_t width = static_cast<int32_t>(ReadU32(pInfo + 4));
+		const int32_t height = static_cast<int32_t>(ReadU32(pInfo + 8));
+		const uint32_t bitCount = ReadU16(pInfo + 14);
+		const uint32_t compression = ReadU32(pInfo + 16);
+
+		const bool isBitFields = compression == CompressionBitFields && bitCount == 32;
+		if (!(compression == CompressionRGB && (bitCount == 24 || bitCount == 32)) && !isBitFields)
+		{
+			return SetError(pError, "ΉĂȂ BMP ł (񈳏k 24/32bit ̂)");
+		}
+		// Ȃォ牺̏
+		const bool isTopDown = height < 0;
+		const uint32_t absHeight = static_cast<uint32_t>(isTopDown ? -static_cast<int64_t>(height) : height);
+		if (width <= 0 || !Allocate(static_cast<uint32_t>(width), absHeight, outImage))
+		{
+			return SetError(pError, "BMP ̃TCYsł");
+		}
+
+		// rbgtB[h̃}XN͏wb_[̌ (BITMAPINFOHEADER)  (V4/V5) ɂBAt@ V4 ȍ~̂
+		uint32_t masks[4] = { 0x00FF0000u, 0x0000FF00u, 0x000000FFu, 0 };
+		if (isBitFields)
+		{
+			const size_t maskCount = infoSize >= 56 ? 4 : 3;
+			if (data.size() < FileHeaderSize + InfoHeaderSize + maskCount * 4)
+			{
+				return SetError(pError, "BMP ̃wb_[sł");
+			}
+			for (size_t i = 0; i < maskCount; ++i)
+			{
+				masks[i] = ReadU32(pInfo + InfoHeaderSize + i * 4);
+			}
+		}
+
+		const size_t srcPitch = ((static_cast<size_t>(width) * bitCount + 31) / 32) * 4;
+		if (dataOffset > data.size() || data.size() - dataOffset < srcPitch * absHeight)
+		{
+			return SetError(pError, "BMP ̃f[^rŏIĂ܂");
+		}
+		for (uint32_t y = 0; y < absHeight; ++y)
+		{
+			const uint8_t* pSrc = data.data() + dataOffset + (isTopDown ? y : absHeight - 1 - y) * srcPitch;
+			uint8_t* pDst = outImage.Pixels.data() + y * outImage.GetRowPitch();
+			for (int32_t x = 0; x < width; ++x, pDst += 4)
+			{
+				if (bitCount == 24)
+				{
+					pDst[0] = pSrc[x * 3 + 2];
+					pDst[1] = pSrc[x * 3 + 1];
+					pDst[2] = pSrc[x * 3 + 0];
+					pDst[3] = 255;
+				}
+				else
+				{
+					const uint32_t value = ReadU32(pSrc + x * 4);
+					for (int c = 0; c < 4; ++c)
+					{
+						pDst[c] = ExtractMasked(value, masks[c]);
+					}
+				}
+			}
+		}
+		return true;
+	}
+}
+
+bool ImageLoader::LoadRGBA8(const std::filesystem::path& path, ImageRGBA8& outImage, std::string* pError)
+{
+	std::vector<uint8_t> data;
+	if (!ReadFile(path, data))
+	{
+		return SetError(pError, "t@Cǂ߂܂");
+	}
+
+	const auto extension = ToLower(path.extension().wstring());
+	if (extension == L".png")
+	{
+		return LoadPNG(data, outImage, pError);
+	}
+	if (extension == L".jpg" || extension == L".jpeg")
+	{
+		return LoadJPEG(data, outImage, pError);
+	}
+	if (extension == L".tga")
+	{
+		return LoadTGA(data, outImage, pError);
+	}
+	if (extension == L".bmp")
+	{
+		return LoadBMP(data, outImage, pError);
+	}
+	return SetError(pError, "ΉĂȂ`ł");
+}
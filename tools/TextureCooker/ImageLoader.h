@@ -0,0 +1,38 @@
+#pragma once
+// TextureCooker  TextureCompressBench ŋʂ̉摜̓ǂݍ
+// PNG  libpngAJPEG  libjpegATGAEBMP ͎Oœǂ݂܂ (DirectXTexEWIC Ɉˑ܂)
+
+#include <algorithm>
+#include <cstdint>
+#include <cwctype>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace ImageLoader
+{
+	inline std::wstring ToLower(std::wstring text)
+	{
+		std::transform(text.begin(), text.end(), text.begin(), ::towlower);
+		return text;
+	}
+
+	/// <summary>
+	/// RGBA8 ̉摜 (s̊ԂɌԂ͂܂)
+	/// </summary>
+	struct ImageRGBA8
+	{
+		std::vector<uint8_t> Pixels;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+
+		size_t GetRowPitch() const { return static_cast<size_t>(Width) * 4; }
+	};
+
+	/// <summary>
+	/// 摜ǂݍ݁ARGBA8 ɑ܂ (At@̂Ȃ摜 255)
+	/// sRGB ǂ͗prŌ߂̂ŁAt@C̐Fԏ͖܂
+	/// </summary>
+	/// <returns> ǂݍ߂Ȃꍇ false </returns>
+	bool LoadRGBA8(const std::filesystem::path& path, ImageRGBA8& outImage, std::string* pError = nullptr);
+}
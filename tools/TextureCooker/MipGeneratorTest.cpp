@@ -0,0 +1,408 @@
+// MipGenerator ̏k{x̎QƎƔׂeXg
+// QƂ̓tB^̏d݁EsRGB ̕ϊEKׂ double ŌvZAŌ 8bit ֊ۂ߂܂
+// MipGenerator  float ŌvẐŊۂ߂̋E 1 邱Ƃ܂AȏジĂ͂܂
+// g: TextureMipGeneratorTest (s 0 ȊOԂ܂)
+
+#include "Graphics/MipGenerator.h"
+#include "TestUtility.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using MipGenerator::Content;
+using MipGenerator::Filter;
+using TestUtility::Random;
+
+namespace
+{
+	//! QƂƔׂċ (8bit ̒l)
+	constexpr int MaxDifference = 1;
+	//! MipGenerator Ɠ Kaiser tB^̔a (k̉f) Ƒ̌`
+	constexpr double KaiserWidth = 3.0;
+	constexpr double KaiserAlpha = 4.0;
+
+	/// <summary>
+	/// eXgp RGBA8 ̉摜
+	/// </summary>
+	struct TestImage
+	{
+		std::vector<uint8_t> Pixels;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+
+		TestImage() = default;
+		TestImage(uint32_t width, uint32_t height) : Pixels(static_cast<size_t>(width) * height * 4), Width(width), Height(height) {}
+
+		MipGenerator::Image ToImage()
+		{
+			MipGenerator::Image image;
+			image.pPixels = Pixels.data();
+			image.Width = Width;
+			image.Height = Height;
+			image.RowPitch = static_cast<size_t>(Width) * 4;
+			return image;
+		}
+	};
+
+	const char* GetFilterName(Filter filter) { return filter == Filter::Box ? "Box" : "Kaiser"; }
+
+	const char* GetContentName(Content type)
+	{
+		switch (type)
+		{
+		case Content::Color: return "Color";
+		case Content::Normal: return "Normal";
+		default: return "Linear";
+		}
+	}
+
+	double DecodeSRGB(double c)
+	{
+		return c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4);
+	}
+
+	double EncodeSRGB(double v)
+	{
+		return v <= 0.0031308 ? v * 12.92 : 1.055 * std::pow(v, 1.0 / 2.4) - 0.055;
+	}
+
+	uint8_t ToUnorm(double v)
+	{
+		return static_cast<uint8_t>(std::clamp(std::floor(v * 255.0 + 0.5), 0.0, 255.0));
+	}
+
+	double BesselI0(double x)
+	{
+		double sum = 1.0;
+		double term = 1.0;
+		for (int k = 1; k < 64; ++k)
+		{
+			term *= (x * 0.5) * (x * 0.5) / (static_cast<double>(k) * k);
+			sum += term;
+		}
+		return sum;
+	}
+
+	/// <summary>
+	/// 1̏d (weights[dst * srcSize + src])
+	/// o͂̉f͈͂̔͂ɁA͈͊Ỏf͒[̉fɊ񂹁Av 1 ɂ܂
+	/// </summary>
+	std::vector<double> BuildWeights(uint32_t srcSize, uint32_t dstSize, Filter filter)
+	{
+		std::vector<double> weights(static_cast<size_t>(srcSize) * dstSize, 0.0);
+		const double scale = static_cast<double>(srcSize) / dstSize;
+		for (uint32_t dst = 0; dst < dstSize; ++dst)
+		{
+			const double lo = dst * scale;
+			const double hi = (dst + 1) * scale;
+			const double center = (lo + hi) * 0.5;
+			const double radius = filter == Filter::Box ? scale * 0.5 : scale * KaiserWidth;
+			double* pRow = &weights[static_cast<size_t>(dst) * srcSize];
+			double total = 0.0;
+			for (int i = static_cast<int>(std::floor(center - radius)); i < static_cast<int>(std::ceil(center + radius)); ++i)
+			{
+				double w = 0.0;
+				if (filter == Filter::Box)
+				{
+					w = (std::max)(0.0, (std::min)(hi, i + 1.0) - (std::max)(lo, static_cast<double>(i)));
+				}
+				else
+				{
+					const double t = (i + 0.5 - center) / scale;
+					const double x = t / KaiserWidth;
+					if (std::abs(x) < 1.0)
+					{
+						const double sinc = std::abs(t) < 1e-9 ? 1.0 : std::sin(3.14159265358979323846 * t) / (3.14159265358979323846 * t);
+						w = sinc * BesselI0(KaiserAlpha * std::sqrt(1.0 - x * x)) / BesselI0(KaiserAlpha);
+					}
+				}
+				pRow[std::clamp(i, 0, static_cast<int>(srcSize) - 1)] += w;
+				total += w;
+			}
+			for (uint32_t src = 0; src < srcSize; ++src)
+			{
+				pRow[src] /= total;
+			}
+		}
+		return weights;
+	}
+
+	/// <summary>
+	/// {x̎QƎ source  width x height ɏk܂
+	/// </summary>
+	TestImage ReferenceDownsample(const TestImage& source, uint32_t width, uint32_t height, Filter filter, Content type)
+	{
+		// ςԂ֕ϊ
+		std::vector<double> decoded(source.Pixels.size());
+		for (size_t i = 0; i < source.Pixels.size(); ++i)
+		{
+			const double c = source.Pixels[i] / 255.0;
+			const bool isAlpha = i % 4 == 3;
+			decoded[i] = isAlpha ? c : (type == Content::Color ? DecodeSRGB(c) : (type == Content::Normal ? c * 2.0 - 1.0 : c));
+		}
+
+		const std::vector<double> horizontal = BuildWeights(source.Width, width, filter);
+		const std::vector<double> vertical = BuildWeights(source.Height, height, filter);
+		std::vector<double> rows(static_cast<size_t>(source.Height) * width * 4, 0.0);
+		for (uint32_t y = 0; y < source.Height; ++y)
+		{
+			for (uint32_t x = 0; x < width; ++x)
+			{
+				for (uint32_t sx = 0; sx < source.Width; ++sx)
+				{
+					const double w = horizontal[static_cast<size_t>(x) * source.Width + sx];
+					for (int c = 0; c < 4; ++c)
+					{
+						rows[(static_cast<size_t>(y) * width + x) * 4 + c] += w * decoded[(static_cast<size_t>(y) * source.Width + sx) * 4 + c];
+					}
+				}
+			}
+		}
+
+		TestImage result(width, height);
+		for (uint32_t y = 0; y < height; ++y)
+		{
+			for (uint32_t x = 0; x < width; ++x)
+			{
+				double pixel[4] = {};
+				for (uint32_t sy = 0; sy < source.Height; ++sy)
+				{
+					const double w = vertical[static_cast<size_t>(y) * source.Height + sy];
+					for (int c = 0; c < 4; ++c)
+					{
+						pixel[c] += w * rows[(static_cast<size_t>(sy) * width + x) * 4 + c];
+					}
+				}
+
+				uint8_t* pDst = &result.Pixels[(static_cast<size_t>(y) * width + x) * 4];
+				if (type == Content::Normal)
+				{
+					const double length = std::sqrt(pixel[0] * pixel[0] + pixel[1] * pixel[1] + pixel[2] * pixel[2]);
+					const double n[3] = { length > 1e-6 ? pixel[0] / length : 0.0, length > 1e-6 ? pixel[1] / length : 0.0,
+						length > 1e-6 ? pixel[2] / length : 1.0 };
+					for (int c = 0; c < 3; ++c)
+					{
+						pDst[c] = ToUnorm(n[c] * 0.5 + 0.5);
+					}
+				}
+				else
+				{
+					for (int c = 0; c < 3; ++c)
+					{
+						pDst[c] = ToUnorm(type == Content::Color ? EncodeSRGB(std::clamp(pixel[c], 0.0, 1.0)) : pixel[c]);
+					}
+				}
+				pDst[3] = ToUnorm(pixel[3]);
+			}
+		}
+		return result;
+	}
+
+	/// <summary>
+	/// Of[VEgE̎s͗l摜 (@Ȃ +Z ̒PʃxNg)
+	/// </summary>
+	TestImage MakeImage(uint32_t width, uint32_t height, Content type, Random& random)
+	{
+		TestImage image(width, height);
+		for (uint32_t y = 0; y < height; ++y)
+		{
+			for (uint32_t x = 0; x < width; ++x)
+			{
+				uint8_t* pPixel = &image.Pixels[(static_cast<size_t>(y) * width + x) * 4];
+				if (type == Content::Normal)
+				{
+					const double nx = random.Range(-0.8f, 0.8f);
+					const double ny = std::sin(x * 0.3) * 0.6;
+					const double length = std::sqrt(nx * nx + ny * ny + 1.0);
+					pPixel[0] = ToUnorm(nx / length * 0.5 + 0.5);
+					pPixel[1] = ToUnorm(ny / length * 0.5 + 0.5);
+					pPixel[2] = ToUnorm(1.0 / length * 0.5 + 0.5);
+				}
+				else if ((x / 4 + y / 4) % 2 == 0)
+				{
+					pPixel[0] = static_cast<uint8_t>((x * 7 + y * 3) % 256);
+					pPixel[1] = static_cast<uint8_t>(std::sin(x / 5.0) * 120.0 + 128.0);
+					pPixel[2] = static_cast<uint8_t>(random.Range(0.0f, 255.99f));
+				}
+				else
+				{
+					for (int c = 0; c < 3; ++c)
+					{
+						pPixel[c] = static_cast<uint8_t>(random.Range(0.0f, 255.99f));
+					}
+				}
+				pPixel[3] = static_cast<uint8_t>(height > 1 ? y * 255 / (height - 1) : 255);
+			}
+		}
+		return image;
+	}
+
+	/// <summary>
+	/// QƂƂ̍𐔂܂
+	/// </summary>
+	struct DifferenceStats
+	{
+		int MaxDifference = 0;
+		size_t DifferentCount = 0;
+		size_t ChannelCount = 0;
+
+		void Add(const TestImage& actual, const TestImage& expected)
+		{
+			for (size_t i = 0; i < actual.Pixels.size(); ++i)
+			{
+				const int difference = std::abs(static_cast<int>(actual.Pixels[i]) - static_cast<int>(expected.Pixels[i]));
+				MaxDifference = (std::max)(MaxDifference, difference);
+				DifferentCount += difference > 0 ? 1 : 0;
+			}
+			ChannelCount += actual.Pixels.size();
+		}
+	};
+
+	MipGenerator::Settings MakeSettings(Filter filter, Content type, bool isParallel)
+	{
+		MipGenerator::Settings settings;
+		settings.Kind = filter;
+		settings.Type = type;
+		settings.IsParallel = isParallel;
+		return settings;
+	}
+
+	/// <summary>
+	/// 1x1 ܂ł̃~bvAe~bv1̃~bv (MipGenerator ̏o) QƎō̂Ɣׂ܂
+	/// 1Xbȟʂv邱Ƃm߂܂
+	/// </summary>
+	void CheckChain(uint32_t width, uint32_t height, Filter filter, Content type, Random& random)
+	{
+		const uint32_t mipCount = MipGenerator::GetMipCount(width, height);
+		std::vector<TestImage> mips(mipCount);
+		mips[0] = MakeImage(width, height, type, random);
+		for (uint32_t mip = 1; mip < mipCount; ++mip)
+		{
+			mips[mip] = TestImage(MipGenerator::GetNextMipSize(mips[mip - 1].Width), MipGenerator::GetNextMipSize(mips[mip - 1].Height));
+		}
+		std::vector<TestImage> serialMips = mips;
+
+		std::vector<MipGenerator::Image> images(mipCount);
+		std::vector<MipGenerator::Image> serialImages(mipCount);
+		for (uint32_t mip = 0; mip < mipCount; ++mip)
+		{
+			images[mip] = mips[mip].ToImage();
+			serialImages[mip] = serialMips[mip].ToImage();
+		}
+		MipGenerator::Generate(images.data(), mipCount, MakeSettings(filter, type, true));
+		MipGenerator::Generate(serialImages.data(), mipCount, MakeSettings(filter, type, false));
+
+		DifferenceStats stats;
+		bool isSameAsSerial = true;
+		for (uint32_t mip = 1; mip < mipCount; ++mip)
+		{
+			stats.Add(mips[mip], ReferenceDownsample(mips[mip - 1], mips[mip].Width, mips[mip].Height, filter, type));
+			isSameAsSerial = isSameAsSerial && mips[mip].Pixels == serialMips[mip].Pixels;
+		}
+		std::printf("  %-6s %-6s %4ux%-4u %2u mips  max diff %d  (%zu of %zu channels differ)\n", GetFilterName(filter), GetContentName(type),
+			width, height, mipCount, stats.MaxDifference, stats.DifferentCount, stats.ChannelCount);
+		TEST_CHECK(stats.MaxDifference <= MaxDifference);
+		TEST_CHECK(isSameAsSerial);
+
+		// @͊ۂߌ덷͈̔͂ŒPʒ
+		if (type == Content::Normal)
+		{
+			double maxLengthError = 0.0;
+			for (uint32_t mip = 1; mip < mipCount; ++mip)
+			{
+				for (size_t i = 0; i < mips[mip].Pixels.size(); i += 4)
+				{
+					double lengthSq = 0.0;
+					for (int c = 0; c < 3; ++c)
+					{
+						const double n = mips[mip].Pixels[i + c] * (2.0 / 255.0) - 1.0;
+						lengthSq += n * n;
+					}
+					maxLengthError = (std::max)(maxLengthError, std::abs(std::sqrt(lengthSq) - 1.0));
+				}
+			}
+			TEST_CHECK(maxLengthError <= std::sqrt(3.0) / 255.0);
+		}
+	}
+
+	/// <summary>
+	/// 2 ̗ݏłȂ䗦̏k (TextureCooker  4 ̔{ɑꍇȂ) QƎƔׂ܂
+	/// </summary>
+	void CheckResize(uint32_t srcWidth, uint32_t srcHeight, uint32_t dstWidth, uint32_t dstHeight, Filter filter, Content type, Random& random)
+	{
+		TestImage source = MakeImage(srcWidth, srcHeight, type, random);
+		TestImage destination(dstWidth, dstHeight);
+		MipGenerator::Downsample(source.ToImage(), destination.ToImage(), MakeSettings(filter, type, true));
+		DifferenceStats stats;
+		stats.Add(destination, ReferenceDownsample(source, dstWidth, dstHeight, filter, type));
+		std::printf("  %-6s %-6s %4ux%-4u -> %ux%u  max diff %d  (%zu of %zu channels differ)\n", GetFilterName(filter), GetContentName(type),
+			srcWidth, srcHeight, dstWidth, dstHeight, stats.MaxDifference, stats.DifferentCount, stats.ChannelCount);
+		TEST_CHECK(stats.MaxDifference <= MaxDifference);
+	}
+
+	/// <summary>
+	/// lȉ摜͏kĂlςȂ (sRGB ̉mɊۂ߂Ă邩)
+	/// </summary>
+	void CheckUniform(Filter filter, Content type)
+	{
+		int failedValue = -1;
+		for (int value = 0; value < 256 && failedValue < 0; ++value)
+		{
+			TestImage source(9, 6);
+			std::fill(source.Pixels.begin(), source.Pixels.end(), static_cast<uint8_t>(value));
+			TestImage destination(4, 3);
+			MipGenerator::Downsample(source.ToImage(), destination.ToImage(), MakeSettings(filter, type, false));
+			if (destination.Pixels != std::vector<uint8_t>(destination.Pixels.size(), static_cast<uint8_t>(value)))
+			{
+				failedValue = value;
+			}
+		}
+		if (failedValue >= 0)
+		{
+			std::printf("  %s %s: uniform value %d changed\n", GetFilterName(filter), GetContentName(type), failedValue);
+		}
+		TEST_CHECK(failedValue < 0);
+	}
+}
+
+int main()
+{
+	const Filter filters[] = { Filter::Box, Filter::Kaiser };
+	const Content types[] = { Content::Color, Content::Linear, Content::Normal };
+	// 2 ̗ݏEE1 f̃~bv̘A
+	const uint32_t sizes[][2] = { { 64, 64 }, { 61, 37 }, { 1, 33 }, { 128, 1 } };
+
+	std::printf("mip chains vs float64 reference\n");
+	Random random(24);
+	for (const auto filter : filters)
+	{
+		for (const auto type : types)
+		{
+			for (const auto& size : sizes)
+			{
+				CheckChain(size[0], size[1], filter, type, random);
+			}
+		}
+	}
+
+	std::printf("arbitrary ratios vs float64 reference\n");
+	for (const auto filter : filters)
+	{
+		for (const auto type : types)
+		{
+			CheckResize(127, 64, 124, 64, filter, type, random);
+			CheckResize(100, 60, 37, 23, filter, type, random);
+		}
+	}
+
+	for (const auto filter : filters)
+	{
+		CheckUniform(filter, Content::Color);
+		CheckUniform(filter, Content::Linear);
+	}
+	return TestUtility::Finish("TextureMipGeneratorTest");
+}
@@ -0,0 +1,350 @@
+// TextureStreamer (~bv̏풓߂XPW[) ̃eXg
+//   e[: o^͒ӂ TailSize ȉ̃~bv풓邱
+//   iKIȓǂݍ: 1t[̓ǂݍ݂ MaxUploadBytesPerFrame 𒴂A~bv1iׂȂ邱
+//   LRU: \Z𒴂Ƃ͍łgĂȂeNX`̂Ă邱
+//   \Z: e[ď풓~bv̍v BudgetBytes 𒴂A܂Ȃvœǂݍ݂ƔjJԂȂ
+// ̗vƗ\Ző̃t[i߁A풓ʁEύX̒ʒmтĂ邱Ƃm߂܂
+// g: TextureStreamerTest (s 0 ȊOԂ܂)
+
+#include "Graphics/TextureStreamer.h"
+#include "TestUtility.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using TestUtility::Random;
+
+namespace
+{
+	constexpr uint64_t MiB = 1024ull * 1024;
+	//! \Z1t[̓ǂݍݗʂŐȂꍇ̒l
+	constexpr uint64_t Unlimited = ~0ull;
+
+	//! @brief RGBA8 ̐`̃eNX`̊e~bṽoCg
+	std::vector<uint64_t> GetMipSizes(uint32_t size)
+	{
+		std::vector<uint64_t> mipSizes;
+		for (;;)
+		{
+			mipSizes.push_back(static_cast<uint64_t>(size) * size * 4);
+			if (size == 1)
+			{
+				break;
+			}
+			size /= 2;
+		}
+		return mipSizes;
+	}
+
+	//! @brief mip e~bv (mip ܂) ̃oCg̍v
+	uint64_t GetBytesFrom(const std::vector<uint64_t>& mipSizes, uint32_t mip)
+	{
+		uint64_t bytes = 0;
+		for (size_t i = mip; i < mipSizes.size(); ++i)
+		{
+			bytes += mipSizes[i];
+		}
+		return bytes;
+	}
+
+	TextureStreamer::Settings MakeSettings(uint64_t budgetBytes, uint64_t maxUploadBytesPerFrame)
+	{
+		TextureStreamer::Settings settings;
+		settings.BudgetBytes = budgetBytes;
+		settings.MaxUploadBytesPerFrame = maxUploadBytesPerFrame;
+		return settings;
+	}
+
+	/// <summary>
+	/// Kvȃ~bv̌vZƃe[
+	/// </summary>
+	void TestMipLevel()
+	{
+		// 2048 ̃eNX` UV x 1 œ\A 1  1024 sNZɉfȂ1sNZ 2 eNZ = ~bv 1
+		TEST_CHECK(std::abs(TextureStreamer::ComputeMipLevel(2048, 2048, 1.0f, 1024.0f) - 1.0f) < 1e-5f);
+		// ʐς`ƂĈ
+		TEST_CHECK(std::abs(TextureStreamer::ComputeMipLevel(4096, 1024, 1.0f, 1024.0f) - 1.0f) < 1e-5f);
+		// g債ĕ\Ȃ~bv 0 ׂ (̒l)
+		TEST_CHECK(TextureStreamer::ComputeMipLevel(512, 512, 1.0f, 1024.0f) < 0.0f);
+		// UV ȂbV͍łe~bvő
+		TEST_CHECK(TextureStreamer::ComputeMipLevel(2048, 2048, 0.0f, 1024.0f) >= 12.0f);
+
+		TEST_CHECK(TextureStreamer::GetTailMip(2048, 2048, 12, 128) == 4);
+		TEST_CHECK(TextureStreamer::GetTailMip(2048, 512, 12, 128) == 4);
+		TEST_CHECK(TextureStreamer::GetTailMip(128, 128, 8, 128) == 0);
+		// ~bvȂ΍łe~bve[
+		TEST_CHECK(TextureStreamer::GetTailMip(2048, 2048, 3, 128) == 2);
+
+		TextureStreamer streamer;
+		const auto mipSizes = GetMipSizes(2048);
+		const auto handle = streamer.Register(2048, 2048, mipSizes);
+		TEST_CHECK(streamer.GetTailMip(handle) == 4);
+		TEST_CHECK(streamer.GetResidentMip(handle) == 4);
+		TEST_CHECK(streamer.GetStats().ResidentBytes == GetBytesFrom(mipSizes, 4));
+
+		// v͏؂̂āAe[ev̓e[̂܂
+		streamer.SetSettings(MakeSettings(Unlimited, Unlimited));
+		streamer.Request(handle, 2.7f);
+		streamer.Update();
+		TEST_CHECK(streamer.GetResidentMip(handle) == 2);
+		streamer.Request(handle, 9.0f);
+		streamer.Request(handle, 1.2f); // t[̗v͍łׂ̂g
+		streamer.Update();
+		TEST_CHECK(streamer.GetResidentMip(handle) == 1);
+	}
+
+	/// <summary>
+	/// 1t[̓ǂݍݗʂ̏ŁA~bv1iׂȂ邱
+	/// </summary>
+	void TestProgressiveLoading()
+	{
+		TextureStreamer streamer;
+		streamer.SetSettings(MakeSettings(Unlimited, 1 * MiB));
+		const auto mipSizes = GetMipSizes(4096);
+		const auto handle = streamer.Register(4096, 4096, mipSizes);
+		TEST_CHECK(streamer.GetResidentMip(handle) == 5);
+
+		uint32_t frameCount = 0;
+		bool isOneMipPerFrame = true;
+		bool isChangeReported = true;
+		for (uint32_t expected = 4;; --expected)
+		{
+			streamer.Request(handle, 0.0f);
+			const auto& changes = streamer.Update();
+			++frameCount;
+			const auto& stats = streamer.GetStats();
+			std::printf("  frame %u: resident mip %u, uploaded %.2f MB\n", frameCount, streamer.GetResidentMip(handle), stats.UploadedBytes / static_cast<double>(MiB));
+
+			// 傫~bv1iȂǂݍ (~܂Ȃ悤)
+			isOneMipPerFrame = isOneMipPerFrame && stats.LoadedMips == 1 && streamer.GetResidentMip(handle) == expected
+				&& stats.UploadedBytes == mipSizes[expected];
+			isChangeReported = isChangeReported && changes.size() == 1 && changes[0].Texture == handle && changes[0].ResidentMip == expected;
+			if (expected == 0)
+			{
+				break;
+			}
+		}
+		TEST_CHECK(frameCount == 5);
+		TEST_CHECK(isOneMipPerFrame);
+		TEST_CHECK(isChangeReported);
+		TEST_CHECK(streamer.GetStats().PendingTextures == 0);
+
+		// ǂݍݏIύX͂Ȃ
+		streamer.Request(handle, 0.0f);
+		TEST_CHECK(streamer.Update().empty());
+		TEST_CHECK(streamer.GetStats().UploadedBytes == 0);
+
+		// Ɏ܂鏬~bv͂܂Ƃ߂ēǂݍ
+		TextureStreamer small;
+		small.SetSettings(MakeSettings(Unlimited, 2 * MiB));
+		const auto smallHandle = small.Register(512, 512, GetMipSizes(512));
+		small.Request(smallHandle, 0.0f);
+		small.Update();
+		TEST_CHECK(small.GetResidentMip(smallHandle) == 0);
+		TEST_CHECK(small.GetStats().LoadedMips == 2);
+		TEST_CHECK(small.GetStats().UploadedBytes <= 2 * MiB);
+	}
+
+	/// <summary>
+	/// \Z𒴂Ƃ͍łgĂȂeNX`̂Ă邱
+	/// </summary>
+	void TestLruEviction()
+	{
+		TextureStreamer streamer;
+		streamer.SetSettings(MakeSettings(Unlimited, Unlimited));
+		const auto mipSizes = GetMipSizes(2048);
+		const auto a = streamer.Register(2048, 2048, mipSizes);
+		const auto b = streamer.Register(2048, 2048, mipSizes);
+		const auto c = streamer.Register(2048, 2048, mipSizes);
+
+		// a, b, c ̏Ɏg (a łÂ)
+		streamer.Request(a, 0.0f);
+		streamer.Update();
+		streamer.Request(b, 0.0f);
+		streamer.Update();
+		streamer.Request(c, 0.0f);
+		streamer.Update();
+		TEST_CHECK(streamer.GetResidentMip(a) == 0 && streamer.GetResidentMip(b) == 0 && streamer.GetResidentMip(c) == 0);
+
+		// ~bv 0 1炷\ZɂƁAłÂ a ̃~bv 0 ̂Ă
+		const uint64_t full = GetBytesFrom(mipSizes, 0);
+		streamer.SetSettings(MakeSettings(full * 3 - mipSizes[0], Unlimited));
+		streamer.Update();
+		std::printf("  budget -16 MB: a %u, b %u, c %u\n", streamer.GetResidentMip(a), streamer.GetResidentMip(b), streamer.GetResidentMip(c));
+		TEST_CHECK(streamer.GetResidentMip(a) == 1 && streamer.GetResidentMip(b) == 0 && streamer.GetResidentMip(c) == 0);
+		TEST_CHECK(streamer.GetStats().EvictedMips == 1);
+
+		// a gƁAǂݍނ߂ɎɌÂ b ̂Ă
+		streamer.Request(a, 0.0f);
+		streamer.Update();
+		std::printf("  request a: a %u, b %u, c %u\n", streamer.GetResidentMip(a), streamer.GetResidentMip(b), streamer.GetResidentMip(c));
+		TEST_CHECK(streamer.GetResidentMip(a) == 0 && streamer.GetResidentMip(b) == 1 && streamer.GetResidentMip(c) == 0);
+
+		// ̃t[ŎgeNX`̗vꂽ~bv́AgĂȂeNX`Ύ̂ĂȂ
+		const uint64_t tail = GetBytesFrom(mipSizes, streamer.GetTailMip(b));
+		streamer.SetSettings(MakeSettings(full * 2 + tail, Unlimited));
+		streamer.Request(a, 0.0f);
+		streamer.Request(c, 0.0f);
+		streamer.Update();
+		std::printf("  budget 2 textures + tail, request a c: a %u, b %u, c %u\n", streamer.GetResidentMip(a), streamer.GetResidentMip(b), streamer.GetResidentMip(c));
+		TEST_CHECK(streamer.GetResidentMip(a) == 0 && streamer.GetResidentMip(c) == 0);
+		TEST_CHECK(streamer.GetResidentMip(b) == streamer.GetTailMip(b));
+		TEST_CHECK(streamer.GetStats().ResidentBytes <= full * 2 + tail);
+
+		// gĂeNX`łAvׂ]ȃ~bv͎̂Ă
+		streamer.SetSettings(MakeSettings(full * 2 + tail - mipSizes[0], Unlimited));
+		streamer.Request(a, 0.0f);
+		streamer.Request(c, 1.0f);
+		streamer.Update();
+		TEST_CHECK(streamer.GetResidentMip(a) == 0 && streamer.GetResidentMip(c) == 1);
+		TEST_CHECK(streamer.GetStats().PendingTextures == 0);
+	}
+
+	/// <summary>
+	/// \Z͒A܂Ȃvœǂݍ݂ƔjJԂȂ
+	/// </summary>
+	void TestBudgetCap()
+	{
+		TextureStreamer streamer;
+		streamer.SetSettings(MakeSettings(20 * MiB, Unlimited));
+		const auto mipSizes = GetMipSizes(2048);
+		const auto a = streamer.Register(2048, 2048, mipSizes);
+		const auto b = streamer.Register(2048, 2048, mipSizes);
+
+		// 2̃~bv 0 (킹Ė 42 MB) ͗\ZɎ܂Ȃ
+		bool isUnderBudget = true;
+		bool isStable = true;
+		uint32_t residentA = 0;
+		uint32_t residentB = 0;
+		for (uint32_t frame = 0; frame < 8; ++frame)
+		{
+			streamer.Request(a, 0.0f);
+			streamer.Request(b, 0.0f);
+			streamer.Update();
+			const auto& stats = streamer.GetStats();
+			isUnderBudget = isUnderBudget && stats.ResidentBytes <= 20 * MiB;
+			if (frame > 0)
+			{
+				isStable = isStable && stats.LoadedMips == 0 && stats.EvictedMips == 0
+					&& streamer.GetResidentMip(a) == residentA && streamer.GetResidentMip(b) == residentB;
+			}
+			residentA = streamer.GetResidentMip(a);
+			residentB = streamer.GetResidentMip(b);
+		}
+		std::printf("  budget 20 MB: a %u, b %u, resident %.2f MB, pending %u\n", residentA, residentB,
+			streamer.GetStats().ResidentBytes / static_cast<double>(MiB), streamer.GetStats().PendingTextures);
+		TEST_CHECK(isUnderBudget);
+		TEST_CHECK(isStable);
+		TEST_CHECK(streamer.GetStats().PendingTextures >= 1);
+		// \Z͈̔͂łׂ͍Ă
+		TEST_CHECK(residentA < streamer.GetTailMip(a) || residentB < streamer.GetTailMip(b));
+
+		// \Ze[菬ĂAe[͎̂ĂȂ
+		streamer.SetSettings(MakeSettings(0, Unlimited));
+		streamer.Request(a, 0.0f);
+		streamer.Update();
+		TEST_CHECK(streamer.GetResidentMip(a) == streamer.GetTailMip(a) && streamer.GetResidentMip(b) == streamer.GetTailMip(b));
+		TEST_CHECK(streamer.GetStats().ResidentBytes == GetBytesFrom(mipSizes, streamer.GetTailMip(a)) * 2);
+		TEST_CHECK(streamer.GetStats().LoadedMips == 0);
+	}
+
+	/// <summary>
+	/// ̗vE\Ző̃t[i߁A풓ʂƕύX̒ʒmтĂ邱Ƃm߂܂
+	/// </summary>
+	void TestRandomFrames()
+	{
+		constexpr uint32_t TextureCount = 24;
+		constexpr uint32_t FrameCount = 2000;
+
+		Random random(25);
+		TextureStreamer streamer;
+		std::vector<std::vector<uint64_t>> mipSizes(TextureCount);
+		std::vector<uint32_t> residentMips(TextureCount);
+		uint64_t tailBytes = 0;
+		for (uint32_t i = 0; i < TextureCount; ++i)
+		{
+			const uint32_t size = 1u << static_cast<uint32_t>(random.Range(5.0f, 12.99f));
+			mipSizes[i] = GetMipSizes(size);
+			const auto handle = streamer.Register(size, size, mipSizes[i]);
+			TEST_CHECK(handle == i);
+			residentMips[i] = streamer.GetResidentMip(handle);
+			tailBytes += GetBytesFrom(mipSizes[i], streamer.GetTailMip(handle));
+		}
+
+		uint32_t failedFrame = 0;
+		uint64_t maxUploadedBytes = 0;
+		uint32_t totalLoaded = 0;
+		uint32_t totalEvicted = 0;
+		TextureStreamer::Settings settings = MakeSettings(64 * MiB, 8 * MiB);
+		streamer.SetSettings(settings);
+		for (uint32_t frame = 1; frame <= FrameCount && failedFrame == 0; ++frame)
+		{
+			if (frame % 200 == 0)
+			{
+				settings.BudgetBytes = static_cast<uint64_t>(random.Range(0.0f, 128.0f) * MiB);
+				streamer.SetSettings(settings);
+			}
+			for (uint32_t i = 0; i < TextureCount; ++i)
+			{
+				if (random.Range(0.0f, 1.0f) < 0.3f)
+				{
+					streamer.Request(i, random.Range(-1.0f, 8.0f));
+				}
+			}
+			const auto& changes = streamer.Update();
+			const auto& stats = streamer.GetStats();
+
+			// ʒmꂽύXƏ풓Ă~bvvA풓ʂ~bṽoCg̍vƈv
+			bool isConsistent = true;
+			std::vector<uint32_t> expectedMips = residentMips;
+			for (const auto& change : changes)
+			{
+				expectedMips[change.Texture] = change.ResidentMip;
+			}
+			uint64_t residentBytes = 0;
+			for (uint32_t i = 0; i < TextureCount; ++i)
+			{
+				isConsistent = isConsistent && streamer.GetResidentMip(i) == expectedMips[i] && streamer.GetResidentMip(i) <= streamer.GetTailMip(i);
+				residentMips[i] = streamer.GetResidentMip(i);
+				residentBytes += GetBytesFrom(mipSizes[i], residentMips[i]);
+			}
+			isConsistent = isConsistent && residentBytes == stats.ResidentBytes;
+
+			// \Z (e[\Z𒴂ꍇ̓e[) 𒴂Aǂݍ݂͏ (1iȂ璴Ă悢) 
+			const bool isUnderBudget = stats.ResidentBytes <= (std::max)(settings.BudgetBytes, tailBytes);
+			const bool isUnderUploadLimit = stats.UploadedBytes <= settings.MaxUploadBytesPerFrame || stats.LoadedMips == 1;
+			if (!isConsistent || !isUnderBudget || !isUnderUploadLimit)
+			{
+				failedFrame = frame;
+			}
+			maxUploadedBytes = (std::max)(maxUploadedBytes, stats.UploadedBytes);
+			totalLoaded += stats.LoadedMips;
+			totalEvicted += stats.EvictedMips;
+		}
+		std::printf("  %u textures, %u frames: loaded %u mips, evicted %u mips, max upload %.2f MB/frame\n", TextureCount, FrameCount, totalLoaded,
+			totalEvicted, maxUploadedBytes / static_cast<double>(MiB));
+		if (failedFrame != 0)
+		{
+			std::printf("  inconsistent at frame %u\n", failedFrame);
+		}
+		TEST_CHECK(failedFrame == 0);
+		TEST_CHECK(totalLoaded > 0 && totalEvicted > 0);
+	}
+}
+
+int main()
+{
+	std::printf("mip level / tail\n");
+	TestMipLevel();
+	std::printf("progressive loading (1 MB per frame)\n");
+	TestProgressiveLoading();
+	std::printf("LRU eviction\n");
+	TestLruEviction();
+	std::printf("budget cap\n");
+	TestBudgetCap();
+	std::printf("random frames\n");
+	TestRandomFrames();
+	return TestUtility::Finish("TextureStreamerTest");
+}
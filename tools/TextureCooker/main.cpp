@@ -0,0 +1,424 @@
+// assets/ ȉ̃eNX` BC kE~bvt DDS ɕϊR}hCc[
+// g: TextureCooker [--force] [--quality fast|normal|high] <assets tH_>
+// ϊʂ͊e摜ƓtH_ cooked/ ɒuAr[A[͌摜̑ɂǂݍ݂܂
+
+#include "Graphics/BlockCompressor.h"
+#include "Graphics/MipGenerator.h"
+#include "Graphics/TextureCook.h"
+#include "Utilities/Parallel.h"
+#include "DdsFile.h"
+#include "ImageLoader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fs = std::filesystem;
+using TextureCook::TextureRole;
+using ImageLoader::ImageRGBA8;
+using ImageLoader::ToLower;
+
+namespace
+{
+	/// <summary>
+	/// R}hC̐ݒ
+	/// </summary>
+	struct Options
+	{
+		fs::path AssetsDir;
+		bool IsForce = false; //!< ϊʂĂ蒼
+		BlockCompressor::Quality Quality = BlockCompressor::Quality::Normal;
+		bool IsParallelBlocks = true; //!< 1̉摜̒łubNɈk
+	};
+
+	/// <summary>
+	/// 1̕ϊ
+	/// </summary>
+	struct CookResult
+	{
+		bool IsSucceeded = false;
+		bool IsSkipped = false; //!< ŐV̕ϊʂ̂ŕϊȂ
+		DdsFile::Metadata Cooked;
+		uint64_t SourceSize = 0;
+		uint64_t CookedSize = 0;
+		double TimeMs = 0.0;
+		double PSNR = 0.0; //!< 擪̃~bv PSNR (dB)
+		std::string Error;
+	};
+
+	bool ParseOptions(int argc, char** argv, Options& outOptions)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string arg = argv[i];
+			if (arg == "--force")
+			{
+				outOptions.IsForce = true;
+			}
+			else if (arg == "--quality" && i + 1 < argc)
+			{
+				const std::string quality = argv[++i];
+				if (quality == "fast")
+				{
+					outOptions.Quality = BlockCompressor::Quality::Fast;
+				}
+				else if (quality == "normal")
+				{
+					outOptions.Quality = BlockCompressor::Quality::Normal;
+				}
+				else if (quality == "high")
+				{
+					outOptions.Quality = BlockCompressor::Quality::High;
+				}
+				else
+				{
+					return false;
+				}
+			}
+			else if (!arg.empty() && arg[0] != '-' && outOptions.AssetsDir.empty())
+			{
+				outOptions.AssetsDir = fs::u8path(arg);
+			}
+			else
+			{
+				return false;
+			}
+		}
+		return !outOptions.AssetsDir.empty();
+	}
+
+	/// <summary>
+	/// Sf R = G = B  (1`l BC4 ɂł邩)
+	/// </summary>
+	bool IsGrayscale(const ImageRGBA8& image)
+	{
+		const uint8_t* pPixel = image.Pixels.data();
+		for (size_t i = 0; i < static_cast<size_t>(image.Width) * image.Height; ++i, pPixel += 4)
+		{
+			if (pPixel[0] != pPixel[1] || pPixel[1] != pPixel[2])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	MipGenerator::Image ToMipImage(ImageRGBA8& image)
+	{
+		MipGenerator::Image result;
+		result.pPixels = image.Pixels.data();
+		result.Width = image.Width;
+		result.Height = image.Height;
+		result.RowPitch = image.GetRowPitch();
+		return result;
+	}
+
+	/// <summary>
+	/// BC ͐擪̃~bv 4 ̔{łKv̂ŁAE 4 ̔{ɑ܂
+	/// 4 fȏ̕ӂ 4 ̔{ɏk (ő 3 f)A4 f̕ӂ͍ł߂f 4 fɊg債܂
+	/// </summary>
+	ImageRGBA8 AlignToBlocks(ImageRGBA8 image, const MipGenerator::Settings& settings)
+	{
+		if (image.Width < 4 || image.Height < 4)
+		{
+			ImageRGBA8 expanded;
+			expanded.Width = (std::max)(image.Width, 4u);
+			expanded.Height = (std::max)(image.Height, 4u);
+			expanded.Pixels.resize(expanded.GetRowPitch() * expanded.Height);
+			for (uint32_t y = 0; y < expanded.Height; ++y)
+			{
+				const uint32_t sourceY = y * image.Height / expanded.Height;
+				for (uint32_t x = 0; x < expanded.Width; ++x)
+				{
+					const uint32_t sourceX = x * image.Width / expanded.Width;
+					std::memcpy(&expanded.Pixels[y * expanded.GetRowPitch() + x * 4], &image.Pixels[sourceY * image.GetRowPitch() + sourceX * 4], 4);
+				}
+			}
+			image = std::move(expanded);
+		}
+
+		ImageRGBA8 aligned;
+		aligned.Width = image.Width & ~3u;
+		aligned.Height = image.Height & ~3u;
+		if (aligned.Width == image.Width && aligned.Height == image.Height)
+		{
+			return image;
+		}
+		aligned.Pixels.resize(aligned.GetRowPitch() * aligned.Height);
+		MipGenerator::Downsample(ToMipImage(image), ToMipImage(aligned), settings);
+		return aligned;
+	}
+
+	/// <summary>
+	/// 1̉摜ϊ DDS ɏo܂
+	/// </summary>
+	CookResult Cook(const fs::path& sourcePath, TextureRole role, const Options& options)
+	{
+		CookResult result;
+		const auto start = std::chrono::steady_clock::now();
+		auto fail = [&](const std::string& message)
+			{
+				result.Error = message;
+				return result;
+			};
+
+		std::error_code ec;
+		result.SourceSize = fs::file_size(sourcePath, ec);
+		uint64_t key = 0;
+		if (!TextureCook::MakeKey(sourcePath.wstring(), key))
+		{
+			return fail("摜ǂ߂܂");
+		}
+		const fs::path cookedPath = TextureCook::GetCookedPath(sourcePath.wstring(), key);
+		if (!options.IsForce && fs::is_regular_file(cookedPath, ec) && DdsFile::ReadMetadata(cookedPath, result.Cooked))
+		{
+			result.IsSucceeded = true;
+			result.IsSkipped = true;
+			result.CookedSize = fs::file_size(cookedPath, ec);
+			return result;
+		}
+
+		// 1. ǂݍ (RGBA8 ɑ)
+		ImageRGBA8 source;
+		std::string error;
+		if (!ImageLoader::LoadRGBA8(sourcePath, source, &error))
+		{
+			return fail("ǂݍ݂Ɏs܂: " + error);
+		}
+
+		// F͐`ԂŁA@ [-1, 1] ɖ߂ătB^ (ItCȂ̂Ŏsו̎c Kaiser g)
+		MipGenerator::Settings mipSettings;
+		mipSettings.Kind = MipGenerator::Filter::Kaiser;
+		mipSettings.Type = TextureCook::GetMipContent(role);
+		mipSettings.IsParallel = options.IsParallelBlocks;
+
+		// 2. BC ͐擪̃~bv 4 ̔{łKv
+		if (source.Width % 4 != 0 || source.Height % 4 != 0)
+		{
+			source = AlignToBlocks(std::move(source), mipSettings);
+		}
+
+		// 3. 1x1 ܂ł̃~bv (@}bv͊e~bvŒ 1 ɖ߂)
+		const uint32_t mipCount = MipGenerator::GetMipCount(source.Width, source.Height);
+		std::vector<ImageRGBA8> mipImages(mipCount);
+		std::vector<MipGenerator::Image> mips(mipCount);
+		mipImages[0] = std::move(source);
+		for (uint32_t mip = 0; mip < mipCount; ++mip)
+		{
+			if (mip > 0)
+			{
+				mipImages[mip].Width = MipGenerator::GetNextMipSize(mipImages[mip - 1].Width);
+				mipImages[mip].Height = MipGenerator::GetNextMipSize(mipImages[mip - 1].Height);
+				mipImages[mip].Pixels.resize(mipImages[mip].GetRowPitch() * mipImages[mip].Height);
+			}
+			mips[mip] = ToMipImage(mipImages[mip]);
+		}
+		MipGenerator::Generate(mips.data(), mipCount, mipSettings);
+
+		// 4. prɍ킹`ֈk (F sRGB ̂܂܈kA` sRGB Ǝ)
+		DdsFile::Format format = DdsFile::Format::BC7_UNORM_SRGB;
+		BlockCompressor::Format blockFormat = BlockCompressor::Format::BC7;
+		switch (role)
+		{
+		case TextureRole::Color:
+			format = DdsFile::Format::BC7_UNORM_SRGB;
+			blockFormat = BlockCompressor::Format::BC7;
+			break;
+		case TextureRole::Normal:
+			format = DdsFile::Format::BC5_UNORM;
+			blockFormat = BlockCompressor::Format::BC5;
+			break;
+		case TextureRole::Mask:
+			if (IsGrayscale(mipImages[0]))
+			{
+				format = DdsFile::Format::BC4_UNORM;
+				blockFormat = BlockCompressor::Format::BC4;
+			}
+			else
+			{
+				format = DdsFile::Format::BC1_UNORM;
+				blockFormat = BlockCompressor::Format::BC1;
+			}
+			break;
+		}
+
+		// DDS ̃~bv͑傫ɃubNԂȂׂ
+		std::vector<size_t> mipOffsets(mipCount + 1, 0);
+		for (uint32_t mip = 0; mip < mipCount; ++mip)
+		{
+			mipOffsets[mip + 1] = mipOffsets[mip] + BlockCompressor::GetCompressedSize(blockFormat, mips[mip].Width, mips[mip].Height);
+		}
+		std::vector<uint8_t> blocks(mipOffsets[mipCount]);
+		BlockCompressor::Settings settings;
+		settings.Level = options.Quality;
+		settings.IsParallel = options.IsParallelBlocks;
+		for (uint32_t mip = 0; mip < mipCount; ++mip)
+		{
+			BlockCompressor::SourceImage mipImage;
+			mipImage.pPixels = mips[mip].pPixels;
+			mipImage.Width = mips[mip].Width;
+			mipImage.Height = mips[mip].Height;
+			mipImage.RowPitch = mips[mip].RowPitch;
+			BlockCompressor::Compress(mipImage, blockFormat, settings, blocks.data() + mipOffsets[mip]);
+			if (mip == 0)
+			{
+				std::vector<uint8_t> decoded(mipImage.RowPitch * mipImage.Height);
+				BlockCompressor::Decompress(blocks.data(), blockFormat, mipImage.Width, mipImage.Height, decoded.data());
+				result.PSNR = BlockCompressor::ComputePSNR(mipImage, decoded.data(), blockFormat);
+			}
+		}
+
+		// 5. ꎞt@CɏĂuA摜̌Âϊʂ
+		result.Cooked.TextureFormat = format;
+		result.Cooked.Width = mips[0].Width;
+		result.Cooked.Height = mips[0].Height;
+		result.Cooked.MipLevels = mipCount;
+		fs::create_directories(cookedPath.parent_path(), ec);
+		fs::path tempPath = cookedPath;
+		tempPath += L".tmp";
+		if (!DdsFile::Save(tempPath, result.Cooked, blocks.data(), blocks.size()))
+		{
+			fs::remove(tempPath, ec);
+			return fail("݂Ɏs܂");
+		}
+		fs::rename(tempPath, cookedPath, ec);
+		if (ec)
+		{
+			fs::remove(tempPath, ec);
+			return fail("݂Ɏs܂");
+		}
+
+		const auto stalePrefix = sourcePath.stem().wstring() + L"_";
+		for (const auto& entry : fs::directory_iterator(cookedPath.parent_path(), ec))
+		{
+			const auto name = entry.path().filename().wstring();
+			if (entry.path() != cookedPath && entry.path().extension() == L".dds"
+				&& name.size() == stalePrefix.size() + 16 + 4 && name.compare(0, stalePrefix.size(), stalePrefix) == 0)
+			{
+				std::error_code removeError;
+				fs::remove(entry.path(), removeError);
+			}
+		}
+
+		result.IsSucceeded = true;
+		result.CookedSize = fs::file_size(cookedPath, ec);
+		result.TimeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		return result;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Options options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		std::fprintf(stderr, "usage: TextureCooker [--force] [--quality fast|normal|high] <assets dir>\n");
+		return 2;
+	}
+
+	// 摜ƃfW߂ (ϊʂ̃tH_͏)
+	std::vector<fs::path> images;
+	std::vector<fs::path> models;
+	std::error_code ec;
+	for (auto it = fs::recursive_directory_iterator(options.AssetsDir, ec); it != fs::recursive_directory_iterator(); it.increment(ec))
+	{
+		if (ec)
+		{
+			break;
+		}
+		if (it->is_directory() && it->path().filename() == TextureCook::CookedDirName)
+		{
+			it.disable_recursion_pending();
+			continue;
+		}
+		if (!it->is_regular_file())
+		{
+			continue;
+		}
+		const auto extension = ToLower(it->path().extension().wstring());
+		if (TextureCook::IsCookable(it->path().wstring()))
+		{
+			images.push_back(it->path());
+		}
+		else if (extension == L".gltf" || extension == L".glb")
+		{
+			models.push_back(it->path());
+		}
+	}
+	std::sort(images.begin(), images.end());
+	std::sort(models.begin(), models.end());
+	if (images.empty())
+	{
+		std::fprintf(stderr, "no textures found under %s\n", options.AssetsDir.u8string().c_str());
+		return 1;
+	}
+
+	// pr̓}eAQƂĂ摜D悵Ac̓t@C琄
+	std::unordered_map<std::wstring, TextureRole> roles;
+	for (const auto& model : models)
+	{
+		if (!TextureCook::CollectRoles(model.wstring(), roles))
+		{
+			std::fprintf(stderr, "warning: failed to read materials from %s\n", model.u8string().c_str());
+		}
+	}
+
+	// 1ɕϊ (摜Xbh菭Ȃ΁A摜̒̃ubNɈk)
+	options.IsParallelBlocks = images.size() < Parallel::GetWorkerCount();
+	std::vector<TextureRole> imageRoles(images.size());
+	for (size_t i = 0; i < images.size(); ++i)
+	{
+		auto it = roles.find(ToLower(images[i].filename().wstring()));
+		imageRoles[i] = it != roles.end() ? it->second : TextureCook::GuessRoleFromName(images[i].wstring());
+	}
+	std::vector<CookResult> results(images.size());
+	const auto start = std::chrono::steady_clock::now();
+	std::mutex printMutex;
+	Parallel::ForEach(images.size(), [&](size_t i)
+		{
+			results[i] = Cook(images[i], imageRoles[i], options);
+			const auto& result = results[i];
+			std::lock_guard<std::mutex> lock(printMutex);
+			if (!result.IsSucceeded)
+			{
+				std::fprintf(stderr, "  FAILED  %s: %s\n", images[i].u8string().c_str(), result.Error.c_str());
+				return;
+			}
+			char psnrText[32] = "        -";
+			if (!result.IsSkipped)
+			{
+				std::snprintf(psnrText, sizeof(psnrText), "%6.2f dB", result.PSNR);
+			}
+			std::printf("  %-7s %-6s %-8s %5ux%-5u mips %2u  %8.1f KB -> %8.1f KB  %s  %8.1f ms  %s\n",
+				result.IsSkipped ? "cached" : "cooked", TextureCook::GetRoleName(imageRoles[i]), DdsFile::GetFormatName(result.Cooked.TextureFormat),
+				result.Cooked.Width, result.Cooked.Height, result.Cooked.MipLevels,
+				result.SourceSize / 1024.0, result.CookedSize / 1024.0, psnrText, result.TimeMs, images[i].u8string().c_str());
+		});
+
+	size_t failedCount = 0;
+	size_t cookedCount = 0;
+	uint64_t sourceSize = 0;
+	uint64_t cookedSize = 0;
+	for (const auto& result : results)
+	{
+		if (!result.IsSucceeded)
+		{
+			++failedCount;
+			continue;
+		}
+		cookedCount += result.IsSkipped ? 0 : 1;
+		sourceSize += result.SourceSize;
+		cookedSize += result.CookedSize;
+	}
+	const double totalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	std::printf("%zu textures (%zu cooked, %zu up to date, %zu failed), %.2f MB -> %.2f MB, %.1f s\n",
+		images.size(), cookedCount, images.size() - cookedCount - failedCount, failedCount,
+		sourceSize / (1024.0 * 1024.0), cookedSize / (1024.0 * 1024.0), totalMs / 1000.0);
+	return failedCount > 0 ? 1 : 0;
+}